@@ -167,6 +167,29 @@ C2H_TEST("DeviceFor::ForEachInExtents 3D dynamic", "[ForEachInExtents][dynamic][
 #endif // !_CCCL_COMPILER(MSVC)
 }
 
+C2H_TEST("DeviceFor::ForEachInExtents 3D mixed", "[ForEachInExtents][dynamic][device]", index_types_dynamic)
+{
+  [[maybe_unused]] constexpr int rank = 3;
+  using index_type                    = c2h::get<0, TestType>;
+  using data_t                        = cuda::std::array<index_type, rank>;
+  using store_op_t                    = LinearStore<index_type, rank>;
+  auto X                              = GENERATE_COPY(take(3, random(2, 10)));
+  auto Z                              = GENERATE_COPY(take(3, random(2, 10)));
+  // the static extents make some of the divisors of the coordinates static, and the others dynamic
+  cuda::std::extents<index_type, cuda::std::dynamic_extent, 3, cuda::std::dynamic_extent> ext{X, Z};
+  c2h::device_vector<data_t> d_output(cub::detail::size(ext), data_t{});
+  c2h::host_vector<data_t> h_output(cub::detail::size(ext), data_t{});
+  auto d_output_raw = cuda::std::span<data_t>{thrust::raw_pointer_cast(d_output.data()), cub::detail::size(ext)};
+  CAPTURE(c2h::type_name<index_type>(), X, Z);
+
+  device_for_each_in_extents(ext, store_op_t{d_output_raw});
+  c2h::host_vector<data_t> h_output_gpu = d_output;
+  fill_linear(h_output, ext);
+#if !_CCCL_COMPILER(MSVC)
+  REQUIRE(h_output == h_output_gpu);
+#endif // !_CCCL_COMPILER(MSVC)
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 
@@ -0,0 +1,98 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Throughput of a histogram of skewed samples built by several host threads, with an atomic per sample through
+// cuda::atomic_ref and with per thread private copies of the bins through cuda::privatizing_accumulator
+
+#include <cuda/atomic>
+#include <cuda/std/cstdint>
+#include <cuda/std/span>
+
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "nvbench_helper.cuh"
+
+struct atomic_ref_bins
+{};
+struct privatized_bins
+{};
+
+NVBENCH_DECLARE_TYPE_STRINGS(atomic_ref_bins, "atomic_ref", "cuda::atomic_ref");
+NVBENCH_DECLARE_TYPE_STRINGS(privatized_bins, "privatized", "cuda::privatizing_accumulator");
+
+using histogram_types = nvbench::type_list<atomic_ref_bins, privatized_bins>;
+
+// Samples whose bins follow a geometric distribution, so that the first few bins get most of them
+static std::vector<std::uint32_t> skewed_samples(std::size_t num_samples, int num_bins, double skew)
+{
+  std::mt19937 engine{42};
+  std::geometric_distribution<int> distribution{skew};
+  std::vector<std::uint32_t> samples(num_samples);
+  for (std::uint32_t& sample : samples)
+  {
+    sample = static_cast<std::uint32_t>((std::min) (distribution(engine), num_bins - 1));
+  }
+  return samples;
+}
+
+template <typename Histogram>
+static void host_histogram(nvbench::state& state, nvbench::type_list<Histogram>)
+{
+  const auto num_bins    = static_cast<int>(state.get_int64("Bins"));
+  const auto num_samples = static_cast<std::size_t>(state.get_int64("Samples"));
+  const int num_threads  = static_cast<int>((std::max) (2u, std::thread::hardware_concurrency()));
+
+  const std::vector<std::uint32_t> samples = skewed_samples(num_samples, num_bins, 0.25);
+  std::vector<cuda::std::uint64_t> bins(num_bins);
+
+  state.add_element_count(num_samples, "Samples");
+
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    std::fill(bins.begin(), bins.end(), 0);
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread != num_threads; ++thread)
+    {
+      threads.emplace_back([&, thread] {
+        const std::size_t begin = num_samples * thread / num_threads;
+        const std::size_t end   = num_samples * (thread + 1) / num_threads;
+        if constexpr (std::is_same_v<Histogram, atomic_ref_bins>)
+        {
+          for (std::size_t i = begin; i != end; ++i)
+          {
+            cuda::atomic_ref<cuda::std::uint64_t>{bins[samples[i]]}.fetch_add(1, cuda::std::memory_order_relaxed);
+          }
+        }
+        else
+        {
+          cuda::privatizing_accumulator<cuda::std::uint64_t> acc{
+            cuda::std::span<cuda::std::uint64_t>{bins.data(), bins.size()}};
+          for (std::size_t i = begin; i != end; ++i)
+          {
+            acc[samples[i]].fetch_add(1, cuda::std::memory_order_relaxed);
+          }
+        }
+      });
+    }
+    for (std::thread& thread : threads)
+    {
+      thread.join();
+    }
+  });
+}
+
+NVBENCH_BENCH_TYPES(host_histogram, NVBENCH_TYPE_AXES(histogram_types))
+  .set_name("host_histogram")
+  .set_type_axes_names({"Histogram"})
+  .add_int64_axis("Bins", {16, 256, 4096})
+  .add_int64_axis("Samples", {1 << 22});
@@ -0,0 +1,141 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Throughput of host threads that wait on each other when there are more threads than hardware threads, where
+// spinning waiters take the processor away from the thread they wait for
+
+#include <cuda/std/atomic>
+#include <cuda/std/cstdint>
+#include <cuda/std/semaphore>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "nvbench_helper.cuh"
+
+template <typename Fn>
+static void run_threads(int num_threads, Fn fn)
+{
+  std::vector<std::thread> threads;
+  for (int thread = 0; thread != num_threads; ++thread)
+  {
+    threads.emplace_back(fn, thread);
+  }
+  for (std::thread& thread : threads)
+  {
+    thread.join();
+  }
+}
+
+static int num_threads(const nvbench::state& state)
+{
+  const int hardware_threads = static_cast<int>((std::max) (1u, std::thread::hardware_concurrency()));
+  return hardware_threads * static_cast<int>(state.get_int64("Oversubscription"));
+}
+
+// A token passed around a ring of threads, each of which waits on its own atomic for it
+static void token_ring(nvbench::state& state)
+{
+  const int threads = num_threads(state);
+  const auto rounds = static_cast<int>(state.get_int64("Rounds"));
+
+  state.add_element_count(static_cast<std::size_t>(threads) * rounds, "Handoffs");
+
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    // A thread may run a round when its atomic holds the number of that round plus one
+    std::vector<cuda::std::atomic<int>> turns(threads);
+    turns[0].store(1);
+    run_threads(threads, [&](int thread) {
+      cuda::std::atomic<int>& next = turns[(thread + 1) % threads];
+      for (int round = 0; round != rounds; ++round)
+      {
+        for (int turn; (turn = turns[thread].load(cuda::std::memory_order_acquire)) != round + 1;)
+        {
+          turns[thread].wait(turn, cuda::std::memory_order_acquire);
+        }
+        next.store(round + 1 + (thread + 1 == threads), cuda::std::memory_order_release);
+        next.notify_one();
+      }
+    });
+  });
+}
+
+NVBENCH_BENCH(token_ring)
+  .set_name("token_ring")
+  .add_int64_axis("Oversubscription", {1, 2, 4})
+  .add_int64_axis("Rounds", {100});
+
+// Producers and consumers that hand items over through a pair of counting semaphores
+static void semaphore_pipeline(nvbench::state& state)
+{
+  // Pairs of one producer and one consumer
+  const int threads = (std::max) (2, num_threads(state) / 2 * 2);
+  const auto items  = static_cast<int>(state.get_int64("Items"));
+
+  state.add_element_count(static_cast<std::size_t>(threads / 2) * items, "Items");
+
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    cuda::std::counting_semaphore<> slots(16);
+    cuda::std::counting_semaphore<> full(0);
+    run_threads(threads, [&](int thread) {
+      for (int item = 0; item != items; ++item)
+      {
+        if (thread % 2 == 0)
+        {
+          slots.acquire();
+          full.release();
+        }
+        else
+        {
+          full.acquire();
+          slots.release();
+        }
+      }
+    });
+  });
+}
+
+NVBENCH_BENCH(semaphore_pipeline)
+  .set_name("semaphore_pipeline")
+  .add_int64_axis("Oversubscription", {1, 2, 4})
+  .add_int64_axis("Items", {10000});
+
+// Updates of an atomic that is too wide to be lock free, which all threads serialize on its embedded lock
+struct wide
+{
+  cuda::std::uint64_t words[3];
+};
+
+static void locked_counter(nvbench::state& state)
+{
+  const int threads  = num_threads(state);
+  const auto updates = static_cast<int>(state.get_int64("Updates"));
+
+  state.add_element_count(static_cast<std::size_t>(threads) * updates, "Updates");
+
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    cuda::std::atomic<wide> counter{wide{{0, 0, 0}}};
+    run_threads(threads, [&](int) {
+      for (int update = 0; update != updates; ++update)
+      {
+        wide old = counter.load(cuda::std::memory_order_relaxed);
+        while (!counter.compare_exchange_weak(old, wide{{old.words[0] + 1, old.words[1], old.words[2]}}))
+        {
+        }
+      }
+    });
+  });
+}
+
+NVBENCH_BENCH(locked_counter)
+  .set_name("locked_counter")
+  .add_int64_axis("Oversubscription", {1, 2, 4})
+  .add_int64_axis("Updates", {10000});
@@ -0,0 +1,58 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Phase throughput of host threads that all synchronize on one barrier, for the centralized counter of
+// cuda::std::barrier and the combining tree of cuda::tree_barrier
+
+#include <cuda/barrier>
+#include <cuda/std/barrier>
+
+#include <thread>
+#include <vector>
+
+#include "nvbench_helper.cuh"
+
+NVBENCH_DECLARE_TYPE_STRINGS(cuda::std::barrier<>, "flat", "cuda::std::barrier<>");
+NVBENCH_DECLARE_TYPE_STRINGS(cuda::tree_barrier<>, "tree", "cuda::tree_barrier<>");
+
+using barrier_types = nvbench::type_list<cuda::std::barrier<>, cuda::tree_barrier<>>;
+
+template <typename Barrier>
+static void host_contention(nvbench::state& state, nvbench::type_list<Barrier>)
+{
+  const auto num_threads = static_cast<int>(state.get_int64("Threads"));
+  const auto num_phases  = static_cast<int>(state.get_int64("Phases"));
+
+  state.add_element_count(num_phases, "Phases");
+
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    Barrier barrier(num_threads);
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread != num_threads; ++thread)
+    {
+      threads.emplace_back([&] {
+        for (int phase = 0; phase != num_phases; ++phase)
+        {
+          barrier.arrive_and_wait();
+        }
+      });
+    }
+    for (std::thread& thread : threads)
+    {
+      thread.join();
+    }
+  });
+}
+
+NVBENCH_BENCH_TYPES(host_contention, NVBENCH_TYPE_AXES(barrier_types))
+  .set_name("host_contention")
+  .set_type_axes_names({"Barrier"})
+  .add_int64_axis("Threads", {4, 16, 64, 128})
+  .add_int64_axis("Phases", {1000});
@@ -0,0 +1,172 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Parsing throughput of the floating-point cuda::std::from_chars in bytes of numeric CSV data, on the host against
+// std::from_chars and strtod, and on the device with one field per thread
+
+#include <thrust/device_vector.h>
+
+#include <cuda/std/charconv>
+
+#include <charconv>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "nvbench_helper.cuh"
+
+using fp_types = nvbench::type_list<float, double>;
+
+// The rows of a table of measurements: a price with 2 decimals, a count, a reading with 6 significant digits, a
+// physical quantity in scientific notation and a ratio with all the digits of a double
+struct csv_data
+{
+  std::string text;
+  std::vector<int> field_offsets;
+};
+
+static csv_data make_csv(std::size_t rows)
+{
+  std::mt19937_64 engine{42};
+  std::uniform_real_distribution<double> price{0.01, 10000.0};
+  std::uniform_int_distribution<int> count{0, 1000000};
+  std::normal_distribution<double> reading{20.0, 5.0};
+  std::lognormal_distribution<double> quantity{0.0, 20.0};
+  std::uniform_real_distribution<double> ratio{0.0, 1.0};
+
+  csv_data csv{};
+  char field[64];
+  const auto append = [&](int length, char separator) {
+    csv.field_offsets.push_back(static_cast<int>(csv.text.size()));
+    csv.text.append(field, static_cast<std::size_t>(length));
+    csv.text += separator;
+  };
+  for (std::size_t row = 0; row < rows; ++row)
+  {
+    append(std::snprintf(field, sizeof(field), "%.2f", price(engine)), ',');
+    append(std::snprintf(field, sizeof(field), "%d", count(engine)), ',');
+    append(std::snprintf(field, sizeof(field), "%.6g", reading(engine)), ',');
+    append(std::snprintf(field, sizeof(field), "%.8e", quantity(engine)), ',');
+    append(static_cast<int>(std::to_chars(field, field + sizeof(field), ratio(engine)).ptr - field), '\n');
+  }
+  return csv;
+}
+
+template <typename T>
+static T parse_strtod(const char* first, char** last)
+{
+  if constexpr (std::is_same_v<T, float>)
+  {
+    return std::strtof(first, last);
+  }
+  else
+  {
+    return std::strtod(first, last);
+  }
+}
+
+template <typename T>
+static void from_chars_fp(nvbench::state& state, nvbench::type_list<T>)
+{
+  const std::string implementation = state.get_string("Implementation");
+  const auto rows                  = static_cast<std::size_t>(state.get_int64("Rows"));
+
+  const csv_data csv    = make_csv(rows);
+  const char* const end = csv.text.data() + csv.text.size();
+  T sum{};
+
+  state.add_element_count(csv.field_offsets.size(), "Fields");
+  state.add_global_memory_reads<char>(csv.text.size(), "Size");
+
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    // Each field is followed by a separator that the parsing skips
+    for (const char* first = csv.text.data(); first < end;)
+    {
+      T value{};
+      if (implementation == "cuda")
+      {
+        first = cuda::std::from_chars(first, end, value).ptr + 1;
+      }
+      else if (implementation == "std")
+      {
+        first = std::from_chars(first, end, value).ptr + 1;
+      }
+      else
+      {
+        char* last{};
+        value = parse_strtod<T>(first, &last);
+        first = last + 1;
+      }
+      sum += value;
+    }
+  });
+
+  // Keep the conversions alive
+  if (sum == T{})
+  {
+    state.skip("No input");
+  }
+}
+
+NVBENCH_BENCH_TYPES(from_chars_fp, NVBENCH_TYPE_AXES(fp_types))
+  .set_name("from_chars_fp")
+  .set_type_axes_names({"T{ct}"})
+  .add_string_axis("Implementation", {"cuda", "std", "strtod"})
+  .add_int64_axis("Rows", {1 << 16});
+
+template <typename T>
+__global__ void from_chars_fp_kernel(const char* text, const int* field_offsets, int fields, int size, T* out)
+{
+  const int i = static_cast<int>(blockIdx.x * blockDim.x + threadIdx.x);
+  if (i < fields)
+  {
+    const int last = i + 1 < fields ? field_offsets[i + 1] - 1 : size - 1;
+    T value{};
+    (void) cuda::std::from_chars(text + field_offsets[i], text + last, value);
+    out[i] = value;
+  }
+}
+
+template <typename T>
+static void from_chars_fp_device(nvbench::state& state, nvbench::type_list<T>)
+{
+  const auto rows = static_cast<std::size_t>(state.get_int64("Rows"));
+
+  const csv_data csv = make_csv(rows);
+  const thrust::device_vector<char> text(csv.text.begin(), csv.text.end());
+  const thrust::device_vector<int> field_offsets(csv.field_offsets.begin(), csv.field_offsets.end());
+  thrust::device_vector<T> out(csv.field_offsets.size());
+
+  const int fields         = static_cast<int>(csv.field_offsets.size());
+  constexpr int block_size = 256;
+  const int grid_size      = (fields + block_size - 1) / block_size;
+
+  state.add_element_count(csv.field_offsets.size(), "Fields");
+  state.add_global_memory_reads<char>(csv.text.size(), "Size");
+  state.add_global_memory_reads<int>(csv.field_offsets.size());
+  state.add_global_memory_writes<T>(csv.field_offsets.size());
+
+  state.exec(nvbench::exec_tag::gpu | nvbench::exec_tag::no_batch, [&](nvbench::launch& launch) {
+    from_chars_fp_kernel<<<grid_size, block_size, 0, launch.get_stream()>>>(
+      thrust::raw_pointer_cast(text.data()),
+      thrust::raw_pointer_cast(field_offsets.data()),
+      fields,
+      static_cast<int>(csv.text.size()),
+      thrust::raw_pointer_cast(out.data()));
+  });
+}
+
+NVBENCH_BENCH_TYPES(from_chars_fp_device, NVBENCH_TYPE_AXES(fp_types))
+  .set_name("from_chars_fp_device")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Rows", nvbench::range(16, 24, 4));
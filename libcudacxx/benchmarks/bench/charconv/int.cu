@@ -0,0 +1,144 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Throughput of the decimal integer cuda::std::to_chars and cuda::std::from_chars on the host against the standard
+// library, and of the batch conversion cuda::to_chars_batch of a whole column
+
+#include <cuda/charconv>
+#include <cuda/std/span>
+
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "nvbench_helper.cuh"
+
+using int_types = nvbench::type_list<std::int32_t, std::uint64_t>;
+
+// Values with a uniformly distributed number of digits, as the columns of text exports mix small and large numbers
+template <typename T>
+static std::vector<T> make_values(std::size_t elements)
+{
+  std::mt19937_64 engine{42};
+  std::vector<T> values(elements);
+  for (T& x : values)
+  {
+    const auto bits = static_cast<int>(engine() % (8 * sizeof(T)));
+    x               = static_cast<T>(engine() >> (64 - 8 * sizeof(T) + bits));
+  }
+  return values;
+}
+
+template <typename T>
+static void to_chars_int(nvbench::state& state, nvbench::type_list<T>)
+{
+  const std::string implementation = state.get_string("Implementation");
+  const auto elements              = static_cast<std::size_t>(state.get_int64("Elements"));
+
+  const std::vector<T> values = make_values<T>(elements);
+  std::vector<char> output(elements * 21);
+  std::vector<std::size_t> offsets(elements + 1);
+  char* const last = output.data() + output.size();
+
+  state.add_element_count(elements, "Elements");
+
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    char* it = output.data();
+    if (implementation == "cuda_batch")
+    {
+      it = cuda::to_chars_batch(it, last, cuda::std::span<const T>{values}, cuda::std::span<std::size_t>{offsets}).ptr;
+    }
+    else
+    {
+      for (std::size_t i = 0; i < elements; ++i)
+      {
+        it = implementation == "cuda" ? cuda::std::to_chars(it, last, values[i]).ptr
+                                      : std::to_chars(it, last, values[i]).ptr;
+        offsets[i + 1] = static_cast<std::size_t>(it - output.data());
+      }
+    }
+  });
+}
+
+NVBENCH_BENCH_TYPES(to_chars_int, NVBENCH_TYPE_AXES(int_types))
+  .set_name("to_chars_int")
+  .set_type_axes_names({"T{ct}"})
+  .add_string_axis("Implementation", {"cuda", "cuda_batch", "std"})
+  .add_int64_axis("Elements", {1 << 16});
+
+template <typename T>
+static T parse_strto(const char* first, char** last)
+{
+  if constexpr (std::is_signed_v<T>)
+  {
+    return static_cast<T>(std::strtoll(first, last, 10));
+  }
+  else
+  {
+    return static_cast<T>(std::strtoull(first, last, 10));
+  }
+}
+
+template <typename T>
+static void from_chars_int(nvbench::state& state, nvbench::type_list<T>)
+{
+  const std::string implementation = state.get_string("Implementation");
+  const auto elements              = static_cast<std::size_t>(state.get_int64("Elements"));
+
+  // The values separated by commas
+  std::string text;
+  for (const T x : make_values<T>(elements))
+  {
+    text += std::to_string(x) + ',';
+  }
+  const char* const end = text.data() + text.size();
+  T sum{};
+
+  state.add_element_count(elements, "Elements");
+  state.add_global_memory_reads<char>(text.size(), "Size");
+
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    for (const char* first = text.data(); first < end;)
+    {
+      T value{};
+      if (implementation == "cuda")
+      {
+        first = cuda::std::from_chars(first, end, value).ptr + 1;
+      }
+      else if (implementation == "std")
+      {
+        first = std::from_chars(first, end, value).ptr + 1;
+      }
+      else
+      {
+        char* last{};
+        value = parse_strto<T>(first, &last);
+        first = last + 1;
+      }
+      sum += value;
+    }
+  });
+
+  // Keep the conversions alive
+  if (sum == T{})
+  {
+    state.skip("No input");
+  }
+}
+
+NVBENCH_BENCH_TYPES(from_chars_int, NVBENCH_TYPE_AXES(int_types))
+  .set_name("from_chars_int")
+  .set_type_axes_names({"T{ct}"})
+  .add_string_axis("Implementation", {"cuda", "std", "strto"})
+  .add_int64_axis("Elements", {1 << 16});
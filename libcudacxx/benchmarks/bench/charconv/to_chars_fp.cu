@@ -0,0 +1,161 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Throughput of the floating-point cuda::std::to_chars on the host against snprintf and std::to_chars, for the
+// shortest representation and for the precisions of the common printf conversions
+
+#include <cuda/std/charconv>
+
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "nvbench_helper.cuh"
+
+using fp_types = nvbench::type_list<float, double>;
+
+struct fp_format
+{
+  cuda::std::chars_format cuda_fmt;
+  std::chars_format std_fmt;
+  const char* printf_fmt;
+  int precision; // -1 for the shortest representation
+};
+
+static fp_format get_format(const std::string& format)
+{
+  if (format == "shortest")
+  {
+    // snprintf has no shortest round-trip conversion, %.17g is the closest equivalent
+    return {cuda::std::chars_format{}, std::chars_format{}, "%.17g", -1};
+  }
+  else if (format == "e")
+  {
+    return {cuda::std::chars_format::scientific, std::chars_format::scientific, "%.6e", 6};
+  }
+  else if (format == "f")
+  {
+    return {cuda::std::chars_format::fixed, std::chars_format::fixed, "%.6f", 6};
+  }
+  else if (format == "g")
+  {
+    return {cuda::std::chars_format::general, std::chars_format::general, "%.6g", 6};
+  }
+  else
+  {
+    return {cuda::std::chars_format::hex, std::chars_format::hex, "%a", -1};
+  }
+}
+
+template <typename T>
+static std::size_t to_chars_cuda(char* first, char* last, T value, const fp_format& fmt)
+{
+  cuda::std::to_chars_result r{};
+  if (fmt.precision >= 0)
+  {
+    r = cuda::std::to_chars(first, last, value, fmt.cuda_fmt, fmt.precision);
+  }
+  else if (fmt.cuda_fmt == cuda::std::chars_format{})
+  {
+    r = cuda::std::to_chars(first, last, value);
+  }
+  else
+  {
+    r = cuda::std::to_chars(first, last, value, fmt.cuda_fmt);
+  }
+  return static_cast<std::size_t>(r.ptr - first);
+}
+
+template <typename T>
+static std::size_t to_chars_std(char* first, char* last, T value, const fp_format& fmt)
+{
+  std::to_chars_result r{};
+  if (fmt.precision >= 0)
+  {
+    r = std::to_chars(first, last, value, fmt.std_fmt, fmt.precision);
+  }
+  else if (fmt.std_fmt == std::chars_format{})
+  {
+    r = std::to_chars(first, last, value);
+  }
+  else
+  {
+    r = std::to_chars(first, last, value, fmt.std_fmt);
+  }
+  return static_cast<std::size_t>(r.ptr - first);
+}
+
+template <typename T>
+static std::size_t to_chars_snprintf(char* first, char* last, T value, const fp_format& fmt)
+{
+  return static_cast<std::size_t>(std::snprintf(first, static_cast<std::size_t>(last - first), fmt.printf_fmt, value));
+}
+
+template <typename T>
+static void to_chars_fp(nvbench::state& state, nvbench::type_list<T>)
+{
+  const std::string implementation = state.get_string("Implementation");
+  const fp_format fmt              = get_format(state.get_string("Format"));
+  const auto elements              = static_cast<std::size_t>(state.get_int64("Elements"));
+
+  // Random bit patterns cover all the exponents, the values of the fixed format stay in a printable range
+  std::mt19937_64 engine{42};
+  std::vector<T> input(elements);
+  for (T& x : input)
+  {
+    do
+    {
+      const auto bits = engine();
+      std::memcpy(&x, &bits, sizeof(T));
+    } while (!(x == x) || x - x != T{0} || (fmt.std_fmt == std::chars_format::fixed && !(x < T{1e30} && x > T{-1e30})));
+  }
+
+  constexpr std::size_t buffer_size = 128;
+  std::vector<char> output(buffer_size);
+  std::size_t chars = 0;
+
+  state.add_element_count(elements, "Elements");
+
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    char* const first = output.data();
+    char* const last  = first + buffer_size;
+    for (const T x : input)
+    {
+      if (implementation == "cuda")
+      {
+        chars += to_chars_cuda(first, last, x, fmt);
+      }
+      else if (implementation == "std")
+      {
+        chars += to_chars_std(first, last, x, fmt);
+      }
+      else
+      {
+        chars += to_chars_snprintf(first, last, x, fmt);
+      }
+    }
+  });
+
+  // Keep the conversions alive
+  if (chars == 0)
+  {
+    state.skip("No output");
+  }
+}
+
+NVBENCH_BENCH_TYPES(to_chars_fp, NVBENCH_TYPE_AXES(fp_types))
+  .set_name("to_chars_fp")
+  .set_type_axes_names({"T{ct}"})
+  .add_string_axis("Format", {"shortest", "e", "f", "g", "a"})
+  .add_string_axis("Implementation", {"cuda", "std", "snprintf"})
+  .add_int64_axis("Elements", {1 << 16});
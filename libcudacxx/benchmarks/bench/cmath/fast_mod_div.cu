@@ -0,0 +1,76 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Throughput on the host of the delinearization of the linear indices of a rank 3 array into coordinates, as done by
+// the loops over the elements of an mdspan, with the extents only known at run time. cuda::fast_mod_div replaces the
+// two divisions per index by multiplications.
+
+#include <cuda/cmath>
+
+#include <cstdint>
+#include <string>
+
+#include "nvbench_helper.cuh"
+
+using index_types = nvbench::type_list<std::int32_t, std::uint32_t, std::int64_t, std::uint64_t>;
+
+// The coordinates of the indices [0, elements) of an array of extents {elements / (ext1 * ext2), ext1, ext2}, summed up
+// with weights so that none of them can be left out
+template <typename T, typename Divisor>
+static T delinearize(T elements, Divisor ext1, Divisor ext2)
+{
+  T sum = 0;
+  for (T i = 0; i < elements; ++i)
+  {
+    const T i2 = i % ext2;
+    const T j  = i / ext2;
+    const T i1 = j % ext1;
+    const T i0 = j / ext1;
+    sum += i0 + 3 * i1 + 7 * i2;
+  }
+  return sum;
+}
+
+template <typename T>
+static void fast_mod_div(nvbench::state& state, nvbench::type_list<T>)
+{
+  const std::string implementation = state.get_string("Implementation");
+  const auto elements              = static_cast<T>(state.get_int64("Elements"));
+
+  // Extents that are neither powers of two nor known to the compiler
+  const T ext1 = static_cast<T>(state.get_int64("Elements") % 7 + 61);
+  const T ext2 = static_cast<T>(state.get_int64("Elements") % 5 + 37);
+  T sum        = 0;
+
+  state.add_element_count(elements, "Indices");
+
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    if (implementation == "division")
+    {
+      sum = delinearize(elements, ext1, ext2);
+    }
+    else
+    {
+      sum = delinearize(elements, cuda::fast_mod_div<T>{ext1}, cuda::fast_mod_div<T>{ext2});
+    }
+  });
+
+  // Keep the results alive
+  if (sum == 0)
+  {
+    state.skip("Unexpected result");
+  }
+}
+
+NVBENCH_BENCH_TYPES(fast_mod_div, NVBENCH_TYPE_AXES(index_types))
+  .set_name("fast_mod_div_delinearize")
+  .set_type_axes_names({"T{ct}"})
+  .add_string_axis("Implementation", {"division", "fast_mod_div"})
+  .add_int64_axis("Elements", {1 << 16, 1 << 24});
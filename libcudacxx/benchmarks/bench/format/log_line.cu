@@ -0,0 +1,106 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Throughput of cuda::std::format_to formatting log lines on the host, with the format string compiled by its
+// compile-time validation against the same format string parsed at runtime
+
+#include <cuda/std/__format_>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "nvbench_helper.cuh"
+
+struct log_record
+{
+  std::uint64_t timestamp;
+  const char* level;
+  unsigned thread;
+  int status;
+  const char* message;
+};
+
+static std::vector<log_record> make_records(std::size_t elements)
+{
+  constexpr const char* levels[]   = {"DEBUG", "INFO", "WARN", "ERROR"};
+  constexpr const char* messages[] = {"request served", "cache miss", "retrying connection", "queue full"};
+
+  std::mt19937_64 engine{42};
+  std::vector<log_record> records(elements);
+  std::uint64_t timestamp = 1700000000000;
+  for (log_record& r : records)
+  {
+    timestamp += engine() % 1000;
+    r = {timestamp,
+         levels[engine() % 4],
+         static_cast<unsigned>(engine() % 256),
+         static_cast<int>(engine() % 600) - 100,
+         messages[engine() % 4]};
+  }
+  return records;
+}
+
+#define LOG_LINE_FORMAT "[{}] {:<5} thread={:#06x} status={:>4}: {}\n"
+
+static void format_log_line(nvbench::state& state)
+{
+  const std::string implementation = state.get_string("Implementation");
+  const auto elements              = static_cast<std::size_t>(state.get_int64("Elements"));
+
+  const std::vector<log_record> records = make_records(elements);
+  std::vector<char> output(elements * 96);
+  std::size_t size = 0;
+
+  state.add_element_count(elements, "Lines");
+
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    char* it = output.data();
+    for (const log_record& r : records)
+    {
+      if (implementation == "compiled")
+      {
+        it = cuda::std::format_to(it, LOG_LINE_FORMAT, r.timestamp, r.level, r.thread, r.status, r.message);
+      }
+      else if (implementation == "runtime")
+      {
+        it = cuda::std::format_to(
+          it, cuda::std::dynamic_format(LOG_LINE_FORMAT), r.timestamp, r.level, r.thread, r.status, r.message);
+      }
+      else
+      {
+        // Sizes a stack buffer up front, before formatting into it
+        char buffer[128];
+        const auto n = cuda::std::formatted_size(LOG_LINE_FORMAT, r.timestamp, r.level, r.thread, r.status, r.message);
+        if (n <= sizeof(buffer))
+        {
+          it = std::copy_n(
+            buffer,
+            cuda::std::format_to(buffer, LOG_LINE_FORMAT, r.timestamp, r.level, r.thread, r.status, r.message) - buffer,
+            it);
+        }
+      }
+    }
+    size = static_cast<std::size_t>(it - output.data());
+  });
+
+  // Keep the formatting alive
+  if (size == 0)
+  {
+    state.skip("No output");
+  }
+}
+
+NVBENCH_BENCH(format_log_line)
+  .set_name("format_log_line")
+  .add_string_axis("Implementation", {"compiled", "runtime", "sized_stack_buffer"})
+  .add_int64_axis("Elements", {1 << 16});
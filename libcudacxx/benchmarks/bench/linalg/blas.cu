@@ -0,0 +1,132 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Throughput in FLOP/s of the host implementations of cuda::std::linalg::matrix_product (GEMM) and
+// cuda::std::linalg::matrix_vector_product (GEMV), serial and with cuda::execution::threads_par, compared to the
+// textbook loops over row-major matrices
+
+#include <cuda/execution>
+#include <cuda/std/execution>
+#include <cuda/std/linalg>
+#include <cuda/std/mdspan>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "nvbench_helper.cuh"
+
+using matrix_type = cuda::std::mdspan<float, cuda::std::dextents<int, 2>>;
+using vector_type = cuda::std::mdspan<float, cuda::std::dextents<int, 1>>;
+
+// C = A * B with the dot product of a row of A and a column of B in the inner loop
+static void naive_gemm(matrix_type A, matrix_type B, matrix_type C)
+{
+  for (int i = 0; i != C.extent(0); ++i)
+  {
+    for (int j = 0; j != C.extent(1); ++j)
+    {
+      float sum = 0.0f;
+      for (int k = 0; k != A.extent(1); ++k)
+      {
+        sum += A(i, k) * B(k, j);
+      }
+      C(i, j) = sum;
+    }
+  }
+}
+
+// y = A * x
+static void naive_gemv(matrix_type A, vector_type x, vector_type y)
+{
+  for (int i = 0; i != A.extent(0); ++i)
+  {
+    float sum = 0.0f;
+    for (int j = 0; j != A.extent(1); ++j)
+    {
+      sum += A(i, j) * x(j);
+    }
+    y(i) = sum;
+  }
+}
+
+static void blas(nvbench::state& state)
+{
+  const std::string implementation = state.get_string("Implementation");
+  const std::string kernel         = state.get_string("Kernel");
+  const auto extent                = static_cast<int>(state.get_int64("Extent"));
+  const auto elements              = static_cast<std::size_t>(extent) * extent;
+  const auto policy                = cuda::execution::threads_par;
+
+  std::vector<float> a(elements, 1.0f);
+  std::vector<float> b(elements, 2.0f);
+  std::vector<float> c(elements);
+  const matrix_type A{a.data(), extent, extent};
+  const matrix_type B{b.data(), extent, extent};
+  const matrix_type C{c.data(), extent, extent};
+  const vector_type x{b.data(), extent};
+  const vector_type y{c.data(), extent};
+
+  if (kernel == "gemm")
+  {
+    state.add_element_count(2 * elements * extent, "FLOP");
+    state.add_global_memory_reads<float>(2 * elements);
+  }
+  else
+  {
+    state.add_element_count(2 * elements, "FLOP");
+    state.add_global_memory_reads<float>(elements + extent);
+  }
+
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    if (kernel == "gemm")
+    {
+      if (implementation == "naive")
+      {
+        naive_gemm(A, B, C);
+      }
+      else if (implementation == "linalg")
+      {
+        cuda::std::linalg::matrix_product(A, B, C);
+      }
+      else
+      {
+        cuda::std::linalg::matrix_product(policy, A, B, C);
+      }
+    }
+    else
+    {
+      if (implementation == "naive")
+      {
+        naive_gemv(A, x, y);
+      }
+      else if (implementation == "linalg")
+      {
+        cuda::std::linalg::matrix_vector_product(A, x, y);
+      }
+      else
+      {
+        cuda::std::linalg::matrix_vector_product(policy, A, x, y);
+      }
+    }
+  });
+
+  // Keep the results alive
+  if (c[extent / 2] < 0.0f)
+  {
+    state.skip("Unexpected result");
+  }
+}
+
+NVBENCH_BENCH(blas)
+  .set_name("blas")
+  .add_string_axis("Implementation", {"naive", "linalg", "linalg_threads_par"})
+  .add_string_axis("Kernel", {"gemm", "gemv"})
+  .add_int64_axis("Extent", {256, 1024, 2048});
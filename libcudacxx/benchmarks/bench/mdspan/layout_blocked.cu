@@ -0,0 +1,114 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Throughput of a matrix transpose and of a 5-point stencil on the host, with the matrices stored with
+// cuda::std::layout_right, cuda::layout_blocked and cuda::layout_morton
+
+#include <cuda/mdspan>
+#include <cuda/std/linalg>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "nvbench_helper.cuh"
+
+using extents_type = cuda::std::dextents<int, 2>;
+
+template <class Layout>
+static auto make_mapping(int extent)
+{
+  return typename Layout::template mapping<extents_type>{extents_type{extent, extent}};
+}
+
+// out = transposed(in), with both loops in the row-major order of out
+template <class Layout>
+static void transpose(const std::vector<float>& in_data, std::vector<float>& out_data, int extent)
+{
+  const cuda::std::mdspan<const float, extents_type, Layout> in{in_data.data(), make_mapping<Layout>(extent)};
+  const cuda::std::mdspan<float, extents_type, Layout> out{out_data.data(), make_mapping<Layout>(extent)};
+  const auto in_t = cuda::std::linalg::transposed(in);
+  for (int i = 0; i != extent; ++i)
+  {
+    for (int j = 0; j != extent; ++j)
+    {
+      out(i, j) = in_t(i, j);
+    }
+  }
+}
+
+// out(i, j) = the average of in(i, j) and of its four neighbors, on the interior of the matrix
+template <class Layout>
+static void stencil(const std::vector<float>& in_data, std::vector<float>& out_data, int extent)
+{
+  const cuda::std::mdspan<const float, extents_type, Layout> in{in_data.data(), make_mapping<Layout>(extent)};
+  const cuda::std::mdspan<float, extents_type, Layout> out{out_data.data(), make_mapping<Layout>(extent)};
+  for (int i = 1; i != extent - 1; ++i)
+  {
+    for (int j = 1; j != extent - 1; ++j)
+    {
+      out(i, j) = 0.2f * (in(i, j) + in(i - 1, j) + in(i + 1, j) + in(i, j - 1) + in(i, j + 1));
+    }
+  }
+}
+
+template <class Layout>
+static void run(nvbench::state& state, const std::string& kernel, int extent)
+{
+  const auto size = static_cast<std::size_t>(make_mapping<Layout>(extent).required_span_size());
+  std::vector<float> in(size, 1.0f);
+  std::vector<float> out(size);
+
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    if (kernel == "transpose")
+    {
+      transpose<Layout>(in, out, extent);
+    }
+    else
+    {
+      stencil<Layout>(in, out, extent);
+    }
+  });
+
+  // Keep the results alive
+  if (out[size / 2] < 0.0f)
+  {
+    state.skip("Unexpected result");
+  }
+}
+
+static void layout_blocked(nvbench::state& state)
+{
+  const std::string implementation = state.get_string("Implementation");
+  const std::string kernel         = state.get_string("Kernel");
+  const auto extent                = static_cast<int>(state.get_int64("Extent"));
+
+  state.add_element_count(static_cast<std::size_t>(extent) * extent, "Elements");
+  state.add_global_memory_reads<float>(static_cast<std::size_t>(extent) * extent);
+
+  if (implementation == "layout_right")
+  {
+    run<cuda::std::layout_right>(state, kernel, extent);
+  }
+  else if (implementation == "layout_blocked")
+  {
+    run<cuda::layout_blocked<32, 32>>(state, kernel, extent);
+  }
+  else
+  {
+    run<cuda::layout_morton>(state, kernel, extent);
+  }
+}
+
+NVBENCH_BENCH(layout_blocked)
+  .set_name("layout_blocked")
+  .add_string_axis("Implementation", {"layout_right", "layout_blocked", "layout_morton"})
+  .add_string_axis("Kernel", {"transpose", "stencil"})
+  .add_int64_axis("Extent", {1024, 2048, 4096});
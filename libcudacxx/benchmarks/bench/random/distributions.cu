@@ -0,0 +1,162 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Throughput in samples/s of cuda::std::normal_distribution, cuda::std::exponential_distribution and
+// cuda::std::gamma_distribution, which use the ziggurat method for double, compared to the previous implementations:
+// the Marsaglia polar method, the inversion with a logarithm and the rejection method of Cheng
+
+#include <cuda/std/cmath>
+#include <cuda/std/random>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "nvbench_helper.cuh"
+
+using engine_type = cuda::std::philox4x64;
+
+static double uniform(engine_type& g)
+{
+  return cuda::std::generate_canonical<double, 53>(g);
+}
+
+// Generates two samples per iteration, and returns the second one on the next call
+static double polar_normal(engine_type& g, double& cached, bool& hot)
+{
+  if (hot)
+  {
+    hot = false;
+    return cached;
+  }
+  double u, v, s;
+  do
+  {
+    u = 2.0 * uniform(g) - 1.0;
+    v = 2.0 * uniform(g) - 1.0;
+    s = u * u + v * v;
+  } while (s > 1.0 || s == 0.0);
+  const double fp = cuda::std::sqrt(-2.0 * cuda::std::log(s) / s);
+  cached          = v * fp;
+  hot             = true;
+  return u * fp;
+}
+
+static double log_exponential(engine_type& g)
+{
+  return -cuda::std::log(1.0 - uniform(g));
+}
+
+// Shape a > 1
+static double cheng_gamma(engine_type& g, double a)
+{
+  const double b = a - 1.0;
+  const double c = 3.0 * a - 0.75;
+  while (true)
+  {
+    const double u = uniform(g);
+    const double v = uniform(g);
+    const double w = u * (1.0 - u);
+    if (w != 0.0)
+    {
+      const double y = cuda::std::sqrt(c / w) * (u - 0.5);
+      const double x = b + y;
+      if (x >= 0.0)
+      {
+        const double z = 64.0 * w * w * w * v * v;
+        if (z <= 1.0 - 2.0 * y * y / x || cuda::std::log(z) <= 2.0 * (b * cuda::std::log(x / b) - y))
+        {
+          return x;
+        }
+      }
+    }
+  }
+}
+
+static void distributions(nvbench::state& state)
+{
+  const std::string implementation = state.get_string("Implementation");
+  const std::string kernel         = state.get_string("Kernel");
+  const auto samples               = static_cast<std::size_t>(state.get_int64("Samples"));
+  const double shape               = 2.5;
+
+  std::vector<double> out(samples);
+  engine_type g{};
+  cuda::std::normal_distribution<double> normal;
+  cuda::std::exponential_distribution<double> exponential;
+  cuda::std::gamma_distribution<double> gamma(shape);
+  double cached = 0.0;
+  bool hot      = false;
+
+  state.add_element_count(samples, "Samples");
+
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    if (implementation == "previous")
+    {
+      if (kernel == "normal")
+      {
+        for (auto& x : out)
+        {
+          x = polar_normal(g, cached, hot);
+        }
+      }
+      else if (kernel == "exponential")
+      {
+        for (auto& x : out)
+        {
+          x = log_exponential(g);
+        }
+      }
+      else
+      {
+        for (auto& x : out)
+        {
+          x = cheng_gamma(g, shape);
+        }
+      }
+    }
+    else
+    {
+      if (kernel == "normal")
+      {
+        for (auto& x : out)
+        {
+          x = normal(g);
+        }
+      }
+      else if (kernel == "exponential")
+      {
+        for (auto& x : out)
+        {
+          x = exponential(g);
+        }
+      }
+      else
+      {
+        for (auto& x : out)
+        {
+          x = gamma(g);
+        }
+      }
+    }
+  });
+
+  // Keep the results alive
+  if (cuda::std::isnan(out[samples / 2]))
+  {
+    state.skip("Unexpected result");
+  }
+}
+
+NVBENCH_BENCH(distributions)
+  .set_name("distributions")
+  .add_string_axis("Implementation", {"previous", "ziggurat"})
+  .add_string_axis("Kernel", {"normal", "exponential", "gamma"})
+  .add_int64_axis("Samples", {1 << 16, 1 << 20});
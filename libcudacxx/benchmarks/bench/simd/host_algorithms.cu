@@ -0,0 +1,135 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Throughput of the non-modifying algorithms with cuda::std::execution::unseq on the host, which compare a vector
+// register of elements at a time, against the serial algorithms. The searches do not find a match, so that both scan
+// the whole range.
+
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "nvbench_helper.cuh"
+
+using element_types = nvbench::type_list<std::int8_t, std::int32_t, float, double>;
+
+// Values in [0, 100) without two equal neighbors
+template <typename T>
+static std::vector<T> make_input(std::size_t elements)
+{
+  std::vector<T> input(elements);
+  unsigned state    = 42;
+  unsigned previous = 100;
+  for (T& x : input)
+  {
+    state          = state * 1103515245u + 12345u;
+    unsigned value = (state >> 16) % 100;
+    if (value == previous)
+    {
+      value = (value + 1) % 100;
+    }
+    x        = static_cast<T>(value);
+    previous = value;
+  }
+  return input;
+}
+
+// Runs the serial algorithm without a policy, and the unsequenced algorithm with cuda::std::execution::unseq
+template <typename T, typename... Policy>
+static std::ptrdiff_t
+run(const std::string& algorithm, const std::vector<T>& input, const std::vector<T>& copy, const Policy&... policy)
+{
+  const T* first = input.data();
+  const T* last  = input.data() + input.size();
+  if (algorithm == "find")
+  {
+    return cuda::std::find(policy..., first, last, T{100}) - first;
+  }
+  else if (algorithm == "count")
+  {
+    return cuda::std::count(policy..., first, last, T{42});
+  }
+  else if (algorithm == "mismatch")
+  {
+    return cuda::std::mismatch(policy..., first, last, copy.data()).first - first;
+  }
+  else if (algorithm == "equal")
+  {
+    return cuda::std::equal(policy..., first, last, copy.data());
+  }
+  else if (algorithm == "adjacent_find")
+  {
+    return cuda::std::adjacent_find(policy..., first, last) - first;
+  }
+  else if (algorithm == "min_element")
+  {
+    return cuda::std::min_element(policy..., first, last) - first;
+  }
+  else if (algorithm == "max_element")
+  {
+    return cuda::std::max_element(policy..., first, last) - first;
+  }
+  else
+  {
+    const auto result = cuda::std::minmax_element(policy..., first, last);
+    return (result.first - first) + (result.second - first);
+  }
+}
+
+template <typename T>
+static void host_algorithms(nvbench::state& state, nvbench::type_list<T>)
+{
+  const std::string algorithm      = state.get_string("Algorithm");
+  const std::string implementation = state.get_string("Implementation");
+  const auto elements              = static_cast<std::size_t>(state.get_int64("Elements"));
+
+  const std::vector<T> input = make_input<T>(elements);
+  const std::vector<T> copy  = input;
+  std::ptrdiff_t result      = 0;
+
+  state.add_element_count(elements, "Elements");
+  state.add_global_memory_reads<T>(algorithm == "mismatch" || algorithm == "equal" ? 2 * elements : elements);
+
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    if (implementation == "serial")
+    {
+      result = run(algorithm, input, copy);
+    }
+    else
+    {
+      result = run(algorithm, input, copy, cuda::std::execution::unseq);
+    }
+  });
+
+  // Keep the results alive
+  if (result < 0)
+  {
+    state.skip("Unexpected result");
+  }
+}
+
+NVBENCH_BENCH_TYPES(host_algorithms, NVBENCH_TYPE_AXES(element_types))
+  .set_name("host_algorithms")
+  .set_type_axes_names({"T{ct}"})
+  .add_string_axis("Algorithm",
+                   {"find",
+                    "count",
+                    "mismatch",
+                    "equal",
+                    "adjacent_find",
+                    "min_element",
+                    "max_element",
+                    "minmax_element"})
+  .add_string_axis("Implementation", {"serial", "unseq"})
+  .add_int64_axis("Elements", {1 << 16, 1 << 22});
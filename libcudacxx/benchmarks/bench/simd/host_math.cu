@@ -0,0 +1,139 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Throughput of the math functions of cuda::std::simd on the host, for vectors of the native ABI against a loop over
+// the scalar functions of cuda::std
+
+#include <cuda/std/__simd_>
+#include <cuda/std/cmath>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "nvbench_helper.cuh"
+
+using math_types = nvbench::type_list<float, double>;
+
+template <typename T, typename Fn>
+static void apply_scalar(const std::vector<T>& input, std::vector<T>& output, Fn fn)
+{
+  for (std::size_t i = 0; i != input.size(); ++i)
+  {
+    output[i] = fn(input[i]);
+  }
+}
+
+// The size of the input is a multiple of the size of the native vectors
+template <typename T, typename Fn>
+static void apply_simd(const std::vector<T>& input, std::vector<T>& output, Fn fn)
+{
+  using vec = cuda::std::simd::basic_vec<T, cuda::std::simd::native<T>>;
+  for (std::size_t i = 0; i != input.size(); i += vec::size())
+  {
+    const vec x = cuda::std::simd::unchecked_load<vec>(input.data() + i, vec::size());
+    cuda::std::simd::unchecked_store(fn(x), output.data() + i, vec::size());
+  }
+}
+
+template <typename T, typename Apply>
+static void
+apply_function(const std::string& function, const std::vector<T>& input, std::vector<T>& output, Apply apply)
+{
+  if (function == "exp")
+  {
+    apply(input, output, [](const auto& x) {
+      return cuda::std::exp(x);
+    });
+  }
+  else if (function == "log")
+  {
+    apply(input, output, [](const auto& x) {
+      return cuda::std::log(x);
+    });
+  }
+  else if (function == "sqrt")
+  {
+    apply(input, output, [](const auto& x) {
+      return cuda::std::sqrt(x);
+    });
+  }
+  else if (function == "sin")
+  {
+    apply(input, output, [](const auto& x) {
+      return cuda::std::sin(x);
+    });
+  }
+  else if (function == "cos")
+  {
+    apply(input, output, [](const auto& x) {
+      return cuda::std::cos(x);
+    });
+  }
+  else if (function == "tanh")
+  {
+    apply(input, output, [](const auto& x) {
+      return cuda::std::tanh(x);
+    });
+  }
+  else if (function == "erf")
+  {
+    apply(input, output, [](const auto& x) {
+      return cuda::std::erf(x);
+    });
+  }
+  else
+  {
+    apply(input, output, [](const auto& x) {
+      return cuda::std::pow(x, T{1.5});
+    });
+  }
+}
+
+template <typename T>
+static void host_math(nvbench::state& state, nvbench::type_list<T>)
+{
+  const std::string function       = state.get_string("Function");
+  const std::string implementation = state.get_string("Implementation");
+  const auto elements              = static_cast<std::size_t>(state.get_int64("Elements"));
+
+  std::mt19937 engine{42};
+  std::uniform_real_distribution<T> distribution{T{0.01}, T{20}};
+  std::vector<T> input(elements);
+  std::vector<T> output(elements);
+  for (T& x : input)
+  {
+    x = distribution(engine);
+  }
+
+  state.add_element_count(elements, "Elements");
+
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    if (implementation == "scalar")
+    {
+      apply_function(function, input, output, [](const auto& in, auto& out, auto fn) {
+        apply_scalar(in, out, fn);
+      });
+    }
+    else
+    {
+      apply_function(function, input, output, [](const auto& in, auto& out, auto fn) {
+        apply_simd(in, out, fn);
+      });
+    }
+  });
+}
+
+NVBENCH_BENCH_TYPES(host_math, NVBENCH_TYPE_AXES(math_types))
+  .set_name("host_math")
+  .set_type_axes_names({"T{ct}"})
+  .add_string_axis("Function", {"exp", "log", "sqrt", "sin", "cos", "tanh", "erf", "pow"})
+  .add_string_axis("Implementation", {"scalar", "simd"})
+  .add_int64_axis("Elements", {1 << 16, 1 << 22});
@@ -0,0 +1,183 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Throughput in bytes/s of the host searches of cuda::std::string_view over a log file and a CSV file, compared to the
+// previous algorithms: memchr of the first byte followed by memcmp for the substrings, and an element-wise scan for
+// rfind and the sets of bytes. Every kernel splits the text in lines or fields, as a parser does.
+
+#include <cuda/std/string_view>
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+#include "nvbench_helper.cuh"
+
+using sv_type = cuda::std::string_view;
+
+// About 100 bytes per line, with the frequent bytes of a text
+static std::string make_log(std::size_t size)
+{
+  static const char* const levels[]   = {"INFO", "INFO", "INFO", "WARN", "DEBUG", "ERROR"};
+  static const char* const messages[] = {
+    "request served", "cache miss for key", "retrying after timeout", "connection reset by peer", "slow query"};
+  std::string text;
+  unsigned state = 1;
+  while (text.size() < size)
+  {
+    state = state * 1103515245u + 12345u;
+    text += "2026-10-18T12:";
+    text += std::to_string(10 + (state >> 8) % 50) + ":" + std::to_string(10 + (state >> 16) % 50);
+    text += std::string{" "} + levels[(state >> 4) % 6] + " worker-" + std::to_string((state >> 12) % 64);
+    text += std::string{" "} + messages[(state >> 20) % 5] + " id=" + std::to_string(state);
+    text += " status=" + std::to_string(((state >> 24) % 16) ? 200 : 503);
+    text += " latency_ms=" + std::to_string((state >> 6) % 1000) + "\n";
+  }
+  return text;
+}
+
+// Rows of 8 fields, some of them quoted
+static std::string make_csv(std::size_t size)
+{
+  std::string text;
+  unsigned state = 7;
+  while (text.size() < size)
+  {
+    for (int field = 0; field < 8; ++field)
+    {
+      state = state * 1103515245u + 12345u;
+      if (field % 3 == 2)
+      {
+        text += "\"Customer " + std::to_string(state % 100000) + ", Inc.\"";
+      }
+      else
+      {
+        text += std::to_string(state >> 8);
+      }
+      text += field == 7 ? '\n' : ',';
+    }
+  }
+  return text;
+}
+
+static std::size_t previous_find(sv_type sv, sv_type str, std::size_t pos)
+{
+  const char* first = sv.data() + pos;
+  const char* last  = sv.data() + sv.size();
+  while (static_cast<std::size_t>(last - first) >= str.size())
+  {
+    first = static_cast<const char*>(std::memchr(first, str[0], (last - first) - str.size() + 1));
+    if (first == nullptr)
+    {
+      return sv_type::npos;
+    }
+    if (std::memcmp(first, str.data(), str.size()) == 0)
+    {
+      return first - sv.data();
+    }
+    ++first;
+  }
+  return sv_type::npos;
+}
+
+static std::size_t previous_rfind(sv_type sv, char c, std::size_t pos)
+{
+  for (std::size_t i = pos + 1; i-- > 0;)
+  {
+    if (sv[i] == c)
+    {
+      return i;
+    }
+  }
+  return sv_type::npos;
+}
+
+static std::size_t previous_find_first_of(sv_type sv, sv_type set, std::size_t pos)
+{
+  for (std::size_t i = pos; i < sv.size(); ++i)
+  {
+    if (std::memchr(set.data(), sv[i], set.size()) != nullptr)
+    {
+      return i;
+    }
+  }
+  return sv_type::npos;
+}
+
+static void find(nvbench::state& state)
+{
+  const std::string implementation = state.get_string("Implementation");
+  const std::string kernel         = state.get_string("Kernel");
+  const auto size                  = static_cast<std::size_t>(state.get_int64("Bytes"));
+  const bool previous              = implementation == "previous";
+
+  const std::string text = kernel == "find_first_of" ? make_csv(size) : make_log(size);
+  const sv_type sv{text};
+  std::size_t count = 0;
+
+  state.add_element_count(sv.size(), "Bytes");
+  state.add_global_memory_reads<char>(sv.size());
+
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    count = 0;
+    if (kernel == "find")
+    {
+      // The lines with an error status
+      const sv_type str = "status=503";
+      for (std::size_t pos = 0;; ++count)
+      {
+        pos = previous ? previous_find(sv, str, pos) : sv.find(str, pos);
+        if (pos == sv_type::npos)
+        {
+          break;
+        }
+        pos += str.size();
+      }
+    }
+    else if (kernel == "rfind")
+    {
+      // The lines from the end of the text
+      for (std::size_t pos = sv.size() - 1; pos != 0 && pos != sv_type::npos; ++count)
+      {
+        pos = previous ? previous_rfind(sv, '\n', pos - 1) : sv.rfind('\n', pos - 1);
+      }
+    }
+    else
+    {
+      // The fields of the rows, skipping the quoted separators
+      const sv_type separators = ",\n\"";
+      for (std::size_t pos = 0;; ++count)
+      {
+        pos = previous ? previous_find_first_of(sv, separators, pos) : sv.find_first_of(separators, pos);
+        if (pos == sv_type::npos)
+        {
+          break;
+        }
+        if (sv[pos] == '"')
+        {
+          pos = sv.find('"', pos + 1);
+        }
+        ++pos;
+      }
+    }
+  });
+
+  // Keep the results alive
+  if (count == 0)
+  {
+    state.skip("Unexpected result");
+  }
+}
+
+NVBENCH_BENCH(find)
+  .set_name("string_view_find")
+  .add_string_axis("Implementation", {"previous", "string_view"})
+  .add_string_axis("Kernel", {"find", "rfind", "find_first_of"})
+  .add_int64_axis("Bytes", {1 << 16, 1 << 24});
@@ -0,0 +1,189 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA___ATOMIC_PRIVATIZING_ACCUMULATOR_H
+#define _CUDA___ATOMIC_PRIVATIZING_ACCUMULATOR_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HOSTED() && !_CCCL_COMPILER(NVRTC)
+
+#  include <cuda/__atomic/atomic.h>
+#  include <cuda/__cmath/round_up.h>
+#  include <cuda/std/__algorithm/max.h>
+#  include <cuda/std/__new/allocate.h>
+#  include <cuda/std/__type_traits/is_arithmetic.h>
+#  include <cuda/std/__type_traits/is_same.h>
+#  include <cuda/std/cstddef>
+#  include <cuda/std/limits>
+#  include <cuda/std/span>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA
+
+//! @brief Accumulates the additions of one host thread to a range of values in a private copy of the range, and adds
+//! the private sums to the range with one atomic per changed element when flushed.
+//!
+//! Histograms and other reductions into a small range contend heavily when many threads update the same elements
+//! with @c cuda::atomic_ref::fetch_add. Every thread instead constructs its own accumulator over the shared range,
+//! adds through it with the same call, and the sums reach the shared range on @c flush, when the number of additions
+//! since the last flush reaches the flush threshold, or when the accumulator is destroyed. The private copy is padded
+//! to whole cache lines, so that the copies of different threads never share one.
+//!
+//! @tparam _Tp The arithmetic type of the elements of the range
+//! @tparam _Sco The scope of the atomics that add the private sums to the range
+template <class _Tp, thread_scope _Sco = thread_scope::thread_scope_system>
+class privatizing_accumulator
+{
+  static_assert(::cuda::std::is_arithmetic_v<_Tp> && !::cuda::std::is_same_v<_Tp, bool>,
+                "privatizing_accumulator requires an arithmetic element type");
+
+  static constexpr ::cuda::std::size_t __cache_line_size = 64;
+
+  ::cuda::std::span<_Tp> __target_;
+  _Tp* __private_;
+  ::cuda::std::size_t __private_bytes_;
+  ::cuda::std::size_t __flush_threshold_;
+  ::cuda::std::size_t __pending_ = 0;
+
+public:
+  using value_type = _Tp;
+
+  //! @brief A reference to an element of the range that adds to the private copy with the interface of
+  //! @c cuda::atomic_ref
+  class reference
+  {
+    privatizing_accumulator* __acc_;
+    ::cuda::std::size_t __index_;
+
+    friend class privatizing_accumulator;
+
+    _CCCL_HOST_API reference(privatizing_accumulator* __acc, ::cuda::std::size_t __index) noexcept
+        : __acc_{__acc}
+        , __index_{__index}
+    {}
+
+  public:
+    //! @brief Adds @p __v to the element. Unlike for @c cuda::atomic_ref there is no previous value to return, and
+    //! the memory order is ignored, as the addition only reaches the range when the accumulator flushes.
+    _CCCL_HOST_API void fetch_add(_Tp __v, memory_order = memory_order_relaxed) const noexcept
+    {
+      __acc_->add(__index_, __v);
+    }
+
+    _CCCL_HOST_API void operator+=(_Tp __v) const noexcept
+    {
+      __acc_->add(__index_, __v);
+    }
+
+    _CCCL_HOST_API void operator++() const noexcept
+    {
+      __acc_->add(__index_, _Tp(1));
+    }
+
+    _CCCL_HOST_API void operator++(int) const noexcept
+    {
+      __acc_->add(__index_, _Tp(1));
+    }
+  };
+
+  //! @brief Creates an accumulator for the calling thread over @p __target
+  //! @param __flush_threshold The number of additions after which the accumulator flushes on its own, e.g. to keep
+  //! the private sums of a narrow type from overflowing. By default it only flushes when asked to or when destroyed.
+  //! @throws std::bad_alloc if the private copy cannot be allocated
+  _CCCL_HOST_API explicit privatizing_accumulator(
+    ::cuda::std::span<_Tp> __target,
+    ::cuda::std::size_t __flush_threshold = ::cuda::std::numeric_limits<::cuda::std::size_t>::max())
+      : __target_{__target}
+      , __private_bytes_{::cuda::round_up((::cuda::std::max) (__target.size(), ::cuda::std::size_t{1}) * sizeof(_Tp),
+                                          __cache_line_size)}
+      , __flush_threshold_{__flush_threshold}
+  {
+    _CCCL_ASSERT(__flush_threshold > 0, "privatizing_accumulator requires a positive flush threshold");
+    __private_ = static_cast<_Tp*>(::cuda::std::__cccl_allocate(__private_bytes_, __cache_line_size));
+    for (::cuda::std::size_t __i = 0; __i != __target_.size(); ++__i)
+    {
+      __private_[__i] = _Tp(0);
+    }
+  }
+
+  privatizing_accumulator(const privatizing_accumulator&)            = delete;
+  privatizing_accumulator& operator=(const privatizing_accumulator&) = delete;
+
+  //! @brief Flushes the private sums to the range
+  _CCCL_HOST_API ~privatizing_accumulator()
+  {
+    flush();
+    ::cuda::std::__cccl_deallocate(__private_, __private_bytes_, __cache_line_size);
+  }
+
+  //! @brief Adds @p __v to the element @p __index of the range
+  _CCCL_HOST_API void add(::cuda::std::size_t __index, _Tp __v) noexcept
+  {
+    _CCCL_ASSERT(__index < __target_.size(), "privatizing_accumulator index out of range");
+    __private_[__index] += __v;
+    if (++__pending_ == __flush_threshold_)
+    {
+      flush();
+    }
+  }
+
+  [[nodiscard]] _CCCL_HOST_API reference operator[](::cuda::std::size_t __index) noexcept
+  {
+    return reference{this, __index};
+  }
+
+  //! @brief Adds the private sums to the range with one relaxed atomic per element that changed, and resets them.
+  //! Other threads see the sums once they synchronize with the calling thread, e.g. by joining it.
+  _CCCL_HOST_API void flush() noexcept
+  {
+    if (__pending_ == 0)
+    {
+      return;
+    }
+    for (::cuda::std::size_t __i = 0; __i != __target_.size(); ++__i)
+    {
+      if (__private_[__i] != _Tp(0))
+      {
+        ::cuda::atomic_ref<_Tp, _Sco>{__target_[__i]}.fetch_add(__private_[__i], memory_order_relaxed);
+        __private_[__i] = _Tp(0);
+      }
+    }
+    __pending_ = 0;
+  }
+
+  //! @brief Returns the number of additions since the last flush
+  [[nodiscard]] _CCCL_HOST_API ::cuda::std::size_t pending() const noexcept
+  {
+    return __pending_;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API ::cuda::std::size_t size() const noexcept
+  {
+    return __target_.size();
+  }
+};
+
+_CCCL_END_NAMESPACE_CUDA
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HOSTED() && !_CCCL_COMPILER(NVRTC)
+
+#endif // _CUDA___ATOMIC_PRIVATIZING_ACCUMULATOR_H
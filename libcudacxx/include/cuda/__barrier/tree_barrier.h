@@ -0,0 +1,187 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA___BARRIER_TREE_BARRIER_H
+#define _CUDA___BARRIER_TREE_BARRIER_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HOSTED() && !_CCCL_COMPILER(NVRTC)
+
+#  include <cuda/std/__algorithm/max.h>
+#  include <cuda/std/__barrier/empty_completion.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/atomic>
+#  include <cuda/std/cstddef>
+#  include <cuda/std/cstdint>
+#  include <cuda/std/limits>
+
+#  include <functional>
+#  include <memory>
+#  include <thread>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA
+
+//! @brief A host barrier with the interface of @c cuda::std::barrier whose arrivals combine in a binary tree instead
+//! of a single counter, so that many threads arriving at once do not contend on one cache line.
+//!
+//! Every phase, the arriving threads pair up at the leaves of the tree, starting at a leaf selected by the identifier
+//! of the thread. The first thread of a pair leaves, the second one continues to the parent node, and the thread
+//! that reaches the root completes the phase. Each node is on its own cache line. This pays off for dozens of host
+//! threads or more, while @c cuda::std::barrier is faster for a few threads and can also be used on the device.
+//!
+//! @tparam _CompletionF The completion function run by the last thread arriving in a phase
+template <class _CompletionF = ::cuda::std::__empty_completion>
+class tree_barrier
+{
+  // The phase advances in steps of two, a ticket of a node goes through the odd value in between when the first
+  // thread of a pair arrives
+  using __phase_t = ::cuda::std::uint8_t;
+
+  //! @brief A node of the tree with one ticket per round, as a thread may reach the same node in several rounds
+  struct alignas(64) __node
+  {
+    ::cuda::std::atomic<__phase_t> __tickets_[64];
+  };
+
+  ::cuda::std::ptrdiff_t __expected_;
+  ::cuda::std::atomic<::cuda::std::ptrdiff_t> __expected_adjustment_{0};
+  ::std::unique_ptr<__node[]> __nodes_;
+  ::cuda::std::atomic<__phase_t> __phase_{0};
+  _CompletionF __completion_;
+
+  //! @brief Arrives once at the tree, returns whether the calling thread completes the phase
+  [[nodiscard]] _CCCL_HOST_API bool __arrive_at_tree(const __phase_t __old_phase)
+  {
+    const __phase_t __half_step = static_cast<__phase_t>(__old_phase + 1);
+    const __phase_t __full_step = static_cast<__phase_t>(__old_phase + 2);
+
+    ::cuda::std::size_t __current_expected = static_cast<::cuda::std::size_t>(__expected_);
+    if (__current_expected <= 1)
+    {
+      return true;
+    }
+    ::cuda::std::size_t __current =
+      ::std::hash<::std::thread::id>{}(::std::this_thread::get_id()) % ((__current_expected + 1) >> 1);
+    for (int __round = 0;; ++__round)
+    {
+      if (__current_expected <= 1)
+      {
+        return true;
+      }
+      const ::cuda::std::size_t __end_node  = (__current_expected + 1) >> 1;
+      const ::cuda::std::size_t __last_node = __end_node - 1;
+      for (;; ++__current)
+      {
+        if (__current == __end_node)
+        {
+          __current = 0;
+        }
+        ::cuda::std::atomic<__phase_t>& __ticket = __nodes_[__current].__tickets_[__round];
+        __phase_t __expect                       = __old_phase;
+        if (__current == __last_node && (__current_expected & 1))
+        {
+          // The last node of an odd level has a single arrival, which goes on to the next round
+          if (__ticket.compare_exchange_strong(__expect, __full_step, ::cuda::std::memory_order_acq_rel))
+          {
+            break;
+          }
+        }
+        else if (__ticket.compare_exchange_strong(__expect, __half_step, ::cuda::std::memory_order_acq_rel))
+        {
+          // First of a pair, the second one carries this arrival up the tree
+          return false;
+        }
+        else if (__expect == __half_step)
+        {
+          // Second of a pair, goes on to the next round
+          if (__ticket.compare_exchange_strong(__expect, __full_step, ::cuda::std::memory_order_acq_rel))
+          {
+            break;
+          }
+        }
+      }
+      __current_expected = __last_node + 1;
+      __current >>= 1;
+    }
+  }
+
+public:
+  using arrival_token = __phase_t;
+
+  _CCCL_HOST_API explicit tree_barrier(const ::cuda::std::ptrdiff_t __expected,
+                                       _CompletionF __completion = _CompletionF())
+      : __expected_{__expected}
+      , __nodes_{new __node[(::cuda::std::max) (::cuda::std::ptrdiff_t{1}, (__expected + 1) >> 1)]}
+      , __completion_{::cuda::std::move(__completion)}
+  {
+    _CCCL_ASSERT(__expected >= 0, "Cannot initialize barrier with negative arrival count");
+  }
+
+  tree_barrier(const tree_barrier&)            = delete;
+  tree_barrier& operator=(const tree_barrier&) = delete;
+
+  /*discard*/ _CCCL_HOST_API arrival_token arrive(::cuda::std::ptrdiff_t __update = 1)
+  {
+    _CCCL_ASSERT(__update > 0, "Barrier arrive update must be positive");
+    const __phase_t __old_phase = __phase_.load(::cuda::std::memory_order_relaxed);
+    for (; __update != 0; --__update)
+    {
+      if (__arrive_at_tree(__old_phase))
+      {
+        __completion_();
+        __expected_ += __expected_adjustment_.load(::cuda::std::memory_order_relaxed);
+        __expected_adjustment_.store(0, ::cuda::std::memory_order_relaxed);
+        __phase_.store(static_cast<__phase_t>(__old_phase + 2), ::cuda::std::memory_order_release);
+        __phase_.notify_all();
+      }
+    }
+    return __old_phase;
+  }
+
+  _CCCL_HOST_API void wait(arrival_token&& __old_phase) const
+  {
+    __phase_.wait(__old_phase, ::cuda::std::memory_order_acquire);
+  }
+
+  _CCCL_HOST_API void arrive_and_wait()
+  {
+    wait(arrive());
+  }
+
+  _CCCL_HOST_API void arrive_and_drop()
+  {
+    __expected_adjustment_.fetch_sub(1, ::cuda::std::memory_order_relaxed);
+    (void) arrive();
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static constexpr ::cuda::std::ptrdiff_t max() noexcept
+  {
+    return ::cuda::std::numeric_limits<::cuda::std::ptrdiff_t>::max();
+  }
+};
+
+_CCCL_END_NAMESPACE_CUDA
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HOSTED() && !_CCCL_COMPILER(NVRTC)
+
+#endif // _CUDA___BARRIER_TREE_BARRIER_H
@@ -0,0 +1,112 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA___CHARCONV_TO_CHARS_BATCH_H
+#define _CUDA___CHARCONV_TO_CHARS_BATCH_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__cmath/uabs.h>
+#include <cuda/std/__charconv/to_chars.h>
+#include <cuda/std/__charconv/to_chars_result.h>
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__limits/numeric_limits.h>
+#include <cuda/std/__type_traits/is_integer.h>
+#include <cuda/std/__type_traits/is_signed.h>
+#include <cuda/std/__type_traits/make_unsigned.h>
+#include <cuda/std/__type_traits/remove_cv.h>
+#include <cuda/std/span>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA
+
+//! @brief Writes the text representations of a range of integers one after another, without separators, and the
+//! offsets of their first characters, as in the string columns of columnar data formats.
+//!
+//! The conversion of each value is the one of @c cuda::std::to_chars in the given base. The decimal conversions only
+//! check the size of the output once the remaining space may not hold the longest value, which saves the per call
+//! overhead of @c cuda::std::to_chars.
+//!
+//! @param __values The integers to convert
+//! @param __offsets The offsets in @p __first of the representations, followed by their total size. It must hold at
+//! least one more element than @p __values.
+//! @return The end of the output and @c errc{} on success. Otherwise the end of the output range and
+//! @c errc::value_too_large, the values before the first one that does not fit being written with their offsets.
+_CCCL_TEMPLATE(class _Tp, ::cuda::std::size_t _Extent, class _Offset, ::cuda::std::size_t _OffsetExtent)
+_CCCL_REQUIRES(::cuda::std::__cccl_is_cv_integer_v<_Tp> _CCCL_AND ::cuda::std::__cccl_is_integer_v<_Offset>)
+[[nodiscard]] _CCCL_API constexpr ::cuda::std::to_chars_result to_chars_batch(
+  char* __first,
+  char* __last,
+  ::cuda::std::span<_Tp, _Extent> __values,
+  ::cuda::std::span<_Offset, _OffsetExtent> __offsets,
+  int __base = 10) noexcept
+{
+  using _Up = ::cuda::std::make_unsigned_t<::cuda::std::remove_cv_t<_Tp>>;
+
+  _CCCL_ASSERT(__base >= 2 && __base <= 36, "base must be in the range [2, 36]");
+  _CCCL_ASSERT(__first <= __last, "output range must be a valid range");
+  _CCCL_ASSERT(__offsets.size() > __values.size(), "offsets must hold one more element than values");
+
+  // The sign and the digits of the longest decimal value
+  constexpr int __max_width = 1 + ::cuda::std::numeric_limits<_Up>::digits10 + 1;
+
+  const ::cuda::std::size_t __n = __values.size();
+  ::cuda::std::size_t __i       = 0;
+  char* __it                    = __first;
+  __offsets[0]                  = _Offset{0};
+
+  if (__base == 10)
+  {
+    for (; __i < __n && __last - __it >= __max_width; ++__i)
+    {
+      const auto __value = __values[__i];
+      if constexpr (::cuda::std::is_signed_v<_Tp>)
+      {
+        if (__value < 0)
+        {
+          *__it++ = '-';
+        }
+      }
+      const auto __uvalue = static_cast<_Up>(::cuda::uabs(__value));
+      const int __width   = ::cuda::std::__to_chars_int_width<10>(__uvalue);
+      __it += __width;
+      ::cuda::std::__to_chars_int_base10(__it, __uvalue, __width);
+      __offsets[__i + 1] = static_cast<_Offset>(__it - __first);
+    }
+  }
+
+  for (; __i < __n; ++__i)
+  {
+    const auto __result = ::cuda::std::to_chars(__it, __last, __values[__i], __base);
+    if (__result.ec != ::cuda::std::errc{})
+    {
+      return {__last, ::cuda::std::errc::value_too_large};
+    }
+    __it               = __result.ptr;
+    __offsets[__i + 1] = static_cast<_Offset>(__it - __first);
+  }
+  return {__it, ::cuda::std::errc{}};
+}
+
+_CCCL_END_NAMESPACE_CUDA
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA___CHARCONV_TO_CHARS_BATCH_H
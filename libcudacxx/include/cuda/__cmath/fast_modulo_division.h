@@ -28,6 +28,7 @@
 #include <cuda/std/__type_traits/common_type.h>
 #include <cuda/std/__type_traits/is_integer.h>
 #include <cuda/std/__type_traits/is_signed.h>
+#include <cuda/std/__type_traits/make_nbit_int.h>
 #include <cuda/std/__type_traits/make_unsigned.h>
 #include <cuda/std/__type_traits/num_bits.h>
 #include <cuda/std/__utility/cmp.h>
@@ -47,10 +48,19 @@ _CCCL_BEGIN_NAMESPACE_CUDA
 //   https://ridiculousfish.com/blog/posts/labor-of-division-episode-iii.html
 // - Classic Round-Up Variant of Fast Unsigned Division by Constants
 //   https://arxiv.org/pdf/2412.03680
+//
+// Every divisor is reduced to a multiplier m, an addend a and a shift s, such that the quotient is the upper half of
+// n * m + a shifted right by s. The division is therefore branch-free, which matters for the loops that delinearize
+// indices with divisors only known at run time:
+// - unsigned divisors that are not powers of two use the round-down algorithm, where a is m or 0
+// - signed divisors, whose dividends are non-negative and have one bit less, use the round-up algorithm with a = 0
+// - powers of two 2^k > 1 use m = 2^(N-1) and s = k - 1
+// - one uses m = 2^N - 1 and a = m, since (n + 1) * (2^N - 1) / 2^N rounds down to n for every n < 2^N
 
 //! @brief Fast modulo and division by precomputation
 //! @tparam _Tp The integer type of the divisor
-//! @tparam _DivisorIsNeverOne If \c true, the divisor is guaranteed to never be one, enabling optimizations
+//! @tparam _DivisorIsNeverOne If \c true, the divisor is guaranteed to never be one. The division is branch-free for
+//! every divisor, so that this only adds a precondition check
 template <typename _Tp, bool _DivisorIsNeverOne = false>
 class fast_mod_div
 {
@@ -71,6 +81,12 @@ public:
     _CCCL_ASSERT(__divisor > 0, "divisor must be positive");
     _CCCL_ASSERT(!_DivisorIsNeverOne || __divisor1 != 1, "cuda::fast_mod_div: divisor must not be one");
     const auto __u_divisor = static_cast<__unsigned_t>(__divisor);
+    if (__divisor == 1)
+    {
+      __multiplier = ::cuda::std::numeric_limits<__unsigned_t>::max();
+      __add        = __multiplier;
+      return;
+    }
     if constexpr (::cuda::std::is_signed_v<_Tp>)
     {
       __shift        = ::cuda::ceil_ilog2(__divisor) - 1; // is_pow2(x) ? log2(x) : ceil(log2(x))
@@ -85,7 +101,8 @@ public:
       __shift = ::cuda::ilog2(__divisor); // floor(log2(divisor))
       if (::cuda::is_power_of_two(__divisor))
       {
-        __multiplier = 0;
+        __multiplier = __unsigned_t{1} << (__num_bits - 1);
+        __shift -= 1;
         return;
       }
       const auto __k        = __num_bits + __shift;
@@ -97,7 +114,7 @@ public:
       //  where (divisor - 2^shift) is the threshold
       const auto __threshold = __u_divisor - (__unsigned_t{1} << __shift);
       __multiplier           = __pow2_div.first + (__pow2_div.second >= __threshold);
-      __add                  = (__pow2_div.second < __threshold);
+      __add                  = (__pow2_div.second < __threshold) ? __multiplier : __unsigned_t{0};
     }
   }
 
@@ -109,43 +126,20 @@ public:
   [[nodiscard]] _CCCL_API friend ::cuda::std::common_type_t<_Tp, _Lhs>
   operator/(_Lhs __dividend, fast_mod_div __divisor1) noexcept
   {
-    using ::cuda::std::is_same_v;
-    using ::cuda::std::is_signed_v;
-    using ::cuda::std::is_unsigned_v;
     static_assert(::cuda::std::__cccl_is_integer_v<_Lhs>, "cuda::fast_mod_div: T is required to be an integer type");
     static_assert(
       ::cuda::std::cmp_less_equal(::cuda::std::numeric_limits<_Lhs>::max(), ::cuda::std::numeric_limits<_Tp>::max()),
       "cuda::fast_mod_div: dividend type must be less than or equal to divisor type");
-    if constexpr (is_signed_v<_Lhs>)
+    if constexpr (::cuda::std::is_signed_v<_Lhs>)
     {
       _CCCL_ASSERT(__dividend >= 0, "dividend must be non-negative");
     }
-    using __common_t       = ::cuda::std::common_type_t<_Tp, _Lhs>;
-    using __ucommon_t      = ::cuda::std::make_unsigned_t<__common_t>;
-    using __unsigned_lhs_t = ::cuda::std::make_unsigned_t<_Lhs>;
-    const auto __div       = __divisor1.__divisor; // cannot use structure binding because of clang-14
-    const auto __mul       = __divisor1.__multiplier;
-    const auto __shift_    = __divisor1.__shift;
-    auto __udividend       = static_cast<__unsigned_lhs_t>(__dividend);
-    if constexpr (is_unsigned_v<_Tp>)
-    {
-      if (__mul == 0) // divisor is a power of two
-      {
-        return static_cast<__common_t>(static_cast<__ucommon_t>(__udividend) >> __shift_);
-      }
-      // if dividend is a signed type, overflow is not possible
-      if (is_signed_v<_Lhs> || __udividend != ::cuda::std::numeric_limits<__unsigned_lhs_t>::max()) // avoid overflow
-      {
-        __udividend += static_cast<__unsigned_lhs_t>(__divisor1.__add);
-      }
-    }
-    else if (!_DivisorIsNeverOne && __div == 1)
-    {
-      return static_cast<__common_t>(__dividend);
-    }
-    const auto __higher_bits = ::cuda::mul_hi(static_cast<__ucommon_t>(__udividend), static_cast<__ucommon_t>(__mul));
-    const auto __quotient    = static_cast<__common_t>(__higher_bits >> __shift_);
-    _CCCL_ASSERT(__quotient == static_cast<__common_t>(__dividend / __div), "wrong __quotient");
+    using __common_t = ::cuda::std::common_type_t<_Tp, _Lhs>;
+    // The dividend is representable as _Tp, so that the quotient is computed with the width of the divisor
+    const auto __higher_bits = fast_mod_div::__mul_hi_add(
+      static_cast<__unsigned_t>(__dividend), __divisor1.__multiplier, __divisor1.__add);
+    const auto __quotient = static_cast<__common_t>(__higher_bits >> __divisor1.__shift);
+    _CCCL_ASSERT(__quotient == static_cast<__common_t>(__dividend / __divisor1.__divisor), "wrong __quotient");
     return __quotient;
   }
 
@@ -168,6 +162,33 @@ public:
   }
 
 private:
+  //! @brief Computes the upper half of __lhs * __rhs + __add
+  //!
+  //! @pre \p __add is at most \p __rhs, so that the sum is less than 2^(2*N) and only the carry out of the lower half
+  //! has to be added to the upper half of the product
+  [[nodiscard]] _CCCL_API static __unsigned_t
+  __mul_hi_add(__unsigned_t __lhs, __unsigned_t __rhs, __unsigned_t __add) noexcept
+  {
+    constexpr int __num_bits = ::cuda::std::__num_bits_v<__unsigned_t>;
+    if constexpr (__num_bits <= 32)
+    {
+      using __larger_t = ::cuda::std::__make_nbit_uint_t<__num_bits * 2>;
+      return static_cast<__unsigned_t>((static_cast<__larger_t>(__lhs) * __rhs + __add) >> __num_bits);
+    }
+    else
+    {
+#if _CCCL_HAS_INT128()
+      if constexpr (__num_bits == 64)
+      {
+        NV_IF_TARGET(NV_IS_HOST, (return static_cast<__unsigned_t>((__uint128_t{__lhs} * __rhs + __add) >> 64);));
+      }
+#endif // _CCCL_HAS_INT128()
+      const auto __lower = static_cast<__unsigned_t>(__lhs * __rhs);
+      const bool __carry = static_cast<__unsigned_t>(__lower + __add) < __lower;
+      return static_cast<__unsigned_t>(::cuda::mul_hi(__lhs, __rhs) + __carry);
+    }
+  }
+
   //! @brief Computes {2^power / divisor, 2^power % divisor}
   //!
   //! @param[in] __power The exponent, in the range [0, 2*N) where N is the bit-width of \c __unsigned_t
@@ -209,7 +230,7 @@ private:
 
   _Tp __divisor             = 1;
   __unsigned_t __multiplier = 0;
-  unsigned __add            = 0;
+  __unsigned_t __add        = 0;
   int __shift               = 0;
 };
 
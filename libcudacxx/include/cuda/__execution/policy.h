@@ -20,24 +20,42 @@
 #  pragma system_header
 #endif // no system header
 
-#if _CCCL_HAS_BACKEND_CUDA()
-
-#  include <cuda/std/__execution/policy.h>
+#include <cuda/std/__execution/policy.h>
 
-#  include <cuda/std/__cccl/prologue.h>
+#include <cuda/std/__cccl/prologue.h>
 
 _CCCL_BEGIN_NAMESPACE_CUDA_EXECUTION
 
+#if _CCCL_HAS_BACKEND_CUDA()
 using __cub_parallel_unsequenced_policy =
   ::cuda::std::execution::__execution_policy_base<::cuda::std::execution::__with_backend<
     static_cast<uint32_t>(::cuda::std::execution::__execution_policy::__parallel_unsequenced),
     ::cuda::std::execution::__execution_backend::__cuda>()>;
 _CCCL_GLOBAL_CONSTANT __cub_parallel_unsequenced_policy gpu{};
+#endif // _CCCL_HAS_BACKEND_CUDA()
 
-_CCCL_END_NAMESPACE_CUDA_EXECUTION
+#if _CCCL_HAS_BACKEND_TBB()
+//! @brief Runs the parallel algorithms on the host with oneTBB, regardless of the other available host backends
+using __tbb_parallel_policy =
+  ::cuda::std::execution::__execution_policy_base<::cuda::std::execution::__with_backend<
+    static_cast<uint32_t>(::cuda::std::execution::__execution_policy::__parallel),
+    ::cuda::std::execution::__execution_backend::__tbb>()>;
+_CCCL_GLOBAL_CONSTANT __tbb_parallel_policy tbb_par{};
+#endif // _CCCL_HAS_BACKEND_TBB()
+
+#if _CCCL_HAS_BACKEND_THREADS()
+//! @brief Runs the parallel algorithms on the host with the thread pool backend, regardless of the other available host
+//! backends. The number of threads and their pinning can be set with `threads_par.with(num_threads(__n))` and
+//! `threads_par.with(pin_threads())`
+using __threads_parallel_policy =
+  ::cuda::std::execution::__execution_policy_base<::cuda::std::execution::__with_backend<
+    static_cast<uint32_t>(::cuda::std::execution::__execution_policy::__parallel),
+    ::cuda::std::execution::__execution_backend::__threads>()>;
+_CCCL_GLOBAL_CONSTANT __threads_parallel_policy threads_par{};
+#endif // _CCCL_HAS_BACKEND_THREADS()
 
-#  include <cuda/std/__cccl/epilogue.h>
+_CCCL_END_NAMESPACE_CUDA_EXECUTION
 
-#endif // _CCCL_HAS_BACKEND_CUDA()
+#include <cuda/std/__cccl/epilogue.h>
 
 #endif // _CUDA___EXECUTION_POLICY_H
@@ -0,0 +1,347 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA___MDSPAN_LAYOUT_BLOCKED_H
+#define _CUDA___MDSPAN_LAYOUT_BLOCKED_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/__numeric/mul_overflow.h>
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__concepts/convertible_to.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__mdspan/concepts.h>
+#include <cuda/std/__mdspan/extents.h>
+#include <cuda/std/__mdspan/submdspan_extents.h>
+#include <cuda/std/__mdspan/submdspan_helper.h>
+#include <cuda/std/__mdspan/submdspan_mapping.h>
+#include <cuda/std/__type_traits/conjunction.h>
+#include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/__type_traits/is_nothrow_constructible.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/__type_traits/make_unsigned.h>
+#include <cuda/std/__utility/integer_sequence.h>
+#include <cuda/std/array>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA
+
+//! @brief The slices of submdspan that keep a dimension and select a contiguous range of its indices.
+template <class _SliceType, class _IndexType>
+_CCCL_CONCEPT __layout_tiled_range_slice =
+  !::cuda::std::convertible_to<_SliceType, _IndexType>
+  && (::cuda::std::is_same_v<_SliceType, ::cuda::std::full_extent_t>
+      || ::cuda::std::__index_pair_like<_SliceType, _IndexType>
+      || ::cuda::std::__is_strided_slice_stride_of_one<_SliceType>);
+
+//! @brief Layout policy that stores the elements in tiles of extents `_TileExtents...`.
+//!
+//! The tiles are stored one after the other in row-major order, and the elements of a tile in row-major order, so that
+//! neighboring elements along any dimension are likely in the same cache lines. The tiles at the end of a dimension
+//! that is not a multiple of the tile extent are padded.
+//!
+//! A mapping can also describe a window of a larger blocked array, whose index 0 is at a position `origins()` of the
+//! larger array. submdspan returns such windows for slices that select contiguous ranges of indices.
+//!
+//! @tparam _TileExtents The extents of the tiles, one per dimension. Powers of two make the mapping cheapest.
+template <::cuda::std::size_t... _TileExtents>
+struct layout_blocked
+{
+  static_assert(((_TileExtents > 0) && ... && true), "layout_blocked: the tile extents must be positive");
+
+  template <class _Extents>
+  class mapping;
+};
+
+template <::cuda::std::size_t... _TileExtents>
+template <class _Extents>
+class layout_blocked<_TileExtents...>::mapping
+{
+public:
+  static_assert(::cuda::std::__is_cuda_std_extents_v<_Extents>,
+                "layout_blocked::mapping template argument must be a specialization of extents.");
+  static_assert(_Extents::rank() == sizeof...(_TileExtents),
+                "layout_blocked::mapping: the extents must have one dimension per tile extent");
+
+  using extents_type = _Extents;
+  using index_type   = typename extents_type::index_type;
+  using size_type    = typename extents_type::size_type;
+  using rank_type    = typename extents_type::rank_type;
+  using layout_type  = layout_blocked;
+
+private:
+  static constexpr rank_type __rank_    = extents_type::rank();
+  static constexpr auto __rank_sequence = ::cuda::std::make_index_sequence<__rank_>();
+
+  using __unsigned_index = ::cuda::std::make_unsigned_t<index_type>;
+
+  //! @brief The distance between two consecutive elements of a tile along dimension __r
+  [[nodiscard]] _CCCL_API static constexpr ::cuda::std::size_t __element_stride(rank_type __r) noexcept
+  {
+    constexpr ::cuda::std::size_t __tiles[] = {_TileExtents..., 1};
+    ::cuda::std::size_t __stride            = 1;
+    for (rank_type __s = __r + 1; __s < __rank_; ++__s)
+    {
+      __stride *= __tiles[__s];
+    }
+    return __stride;
+  }
+
+  [[nodiscard]] _CCCL_API static constexpr ::cuda::std::array<index_type, __rank_>
+  __make_tile_strides(const extents_type& __ext) noexcept
+  {
+    ::cuda::std::array<index_type, __rank_> __strides{};
+    if constexpr (__rank_ > 0)
+    {
+      index_type __stride = static_cast<index_type>(__element_stride(0) * tile_extent(0));
+      for (rank_type __r = __rank_; __r-- > 0;)
+      {
+        __strides[__r] = __stride;
+        const auto __tiles =
+          static_cast<index_type>(::cuda::ceil_div(__ext.extent(__r), static_cast<index_type>(tile_extent(__r))));
+        _CCCL_ASSERT(!::cuda::mul_overflow<index_type>(__stride, __tiles),
+                     "layout_blocked::mapping: required_span_size() is not representable as index_type");
+        __stride *= __tiles;
+      }
+    }
+    return __strides;
+  }
+
+public:
+  //! @brief Returns the extent of the tiles along dimension __r
+  [[nodiscard]] _CCCL_API static constexpr ::cuda::std::size_t tile_extent(rank_type __r) noexcept
+  {
+    constexpr ::cuda::std::size_t __tiles[] = {_TileExtents..., 1};
+    return __tiles[__r];
+  }
+
+  _CCCL_API constexpr mapping() noexcept
+      : mapping(extents_type{})
+  {}
+
+  _CCCL_HIDE_FROM_ABI constexpr mapping(const mapping&) noexcept            = default;
+  _CCCL_HIDE_FROM_ABI constexpr mapping& operator=(const mapping&) noexcept = default;
+
+  //! @brief Constructs the mapping of a blocked array of extents __ext
+  _CCCL_API constexpr mapping(const extents_type& __ext) noexcept
+      : __extents_{__ext}
+      , __tile_strides_{__make_tile_strides(__ext)}
+      , __origins_{}
+  {}
+
+  //! @brief Constructs the mapping of a window of extents __ext of a larger blocked array
+  //!
+  //! @param __tile_strides The distance between two consecutive tiles of the larger array along each dimension
+  //! @param __origins The position in the larger array of the index 0 of the window
+  _CCCL_API constexpr mapping(const extents_type& __ext,
+                              const ::cuda::std::array<index_type, __rank_>& __tile_strides,
+                              const ::cuda::std::array<index_type, __rank_>& __origins) noexcept
+      : __extents_{__ext}
+      , __tile_strides_{__tile_strides}
+      , __origins_{__origins}
+  {
+    _CCCL_ASSERT((static_cast<void>(required_span_size()), true),
+                 "layout_blocked::mapping: required_span_size() is not representable as index_type");
+  }
+
+  _CCCL_TEMPLATE(class _OtherExtents)
+  _CCCL_REQUIRES(::cuda::std::is_constructible_v<extents_type, _OtherExtents> _CCCL_AND
+                   ::cuda::std::is_convertible_v<_OtherExtents, extents_type>)
+  _CCCL_API constexpr mapping(const mapping<_OtherExtents>& __other) noexcept
+      : mapping(extents_type{__other.extents()}, __convert(__other.tile_strides()), __convert(__other.origins()))
+  {}
+
+  _CCCL_TEMPLATE(class _OtherExtents)
+  _CCCL_REQUIRES(::cuda::std::is_constructible_v<extents_type, _OtherExtents> _CCCL_AND(
+    !::cuda::std::is_convertible_v<_OtherExtents, extents_type>))
+  _CCCL_API explicit constexpr mapping(const mapping<_OtherExtents>& __other) noexcept
+      : mapping(extents_type{__other.extents()}, __convert(__other.tile_strides()), __convert(__other.origins()))
+  {}
+
+  [[nodiscard]] _CCCL_API constexpr const extents_type& extents() const noexcept
+  {
+    return __extents_;
+  }
+
+  //! @brief Returns the distance between two consecutive tiles along each dimension
+  [[nodiscard]] _CCCL_API constexpr const ::cuda::std::array<index_type, __rank_>& tile_strides() const noexcept
+  {
+    return __tile_strides_;
+  }
+
+  //! @brief Returns the position of the index 0 in the blocked array, which is not zero for the windows of submdspan
+  [[nodiscard]] _CCCL_API constexpr const ::cuda::std::array<index_type, __rank_>& origins() const noexcept
+  {
+    return __origins_;
+  }
+
+  //! @brief Returns the required span size, the mapped index of the last element plus one
+  [[nodiscard]] _CCCL_API constexpr index_type required_span_size() const noexcept
+  {
+    for (rank_type __r = 0; __r != __rank_; ++__r)
+    {
+      if (__extents_.extent(__r) == 0)
+      {
+        return 0;
+      }
+    }
+    // The mapping increases along each dimension, so the last element has the largest index
+    return __last_index(__rank_sequence) + 1;
+  }
+
+  //! @brief Maps multidimensional indices to a linear index
+  _CCCL_TEMPLATE(class... _Indices)
+  _CCCL_REQUIRES(
+    (sizeof...(_Indices) == __rank_) //
+    _CCCL_AND(::cuda::std::conjunction_v<::cuda::std::is_convertible<_Indices, index_type>...>)
+      _CCCL_AND(::cuda::std::conjunction_v<::cuda::std::is_nothrow_constructible<index_type, _Indices>...>))
+  [[nodiscard]] _CCCL_API constexpr index_type operator()(_Indices... __indices) const noexcept
+  {
+    return __compute_index(__rank_sequence, static_cast<index_type>(__indices)...);
+  }
+
+  [[nodiscard]] _CCCL_API static constexpr bool is_always_unique() noexcept
+  {
+    return true;
+  }
+
+  //! @brief Returns false - the tiles at the end of a dimension can be padded
+  [[nodiscard]] _CCCL_API static constexpr bool is_always_exhaustive() noexcept
+  {
+    return false;
+  }
+
+  [[nodiscard]] _CCCL_API static constexpr bool is_always_strided() noexcept
+  {
+    return false;
+  }
+
+  [[nodiscard]] _CCCL_API static constexpr bool is_unique() noexcept
+  {
+    return true;
+  }
+
+  //! @brief Returns true if the elements fill the required span, without padding
+  [[nodiscard]] _CCCL_API constexpr bool is_exhaustive() const noexcept
+  {
+    index_type __size = 1;
+    for (rank_type __r = 0; __r != __rank_; ++__r)
+    {
+      __size *= __extents_.extent(__r);
+    }
+    return __size == required_span_size();
+  }
+
+  //! @brief Returns false - the distance between consecutive elements changes at the tile boundaries
+  [[nodiscard]] _CCCL_API static constexpr bool is_strided() noexcept
+  {
+    return false;
+  }
+
+  template <class _OtherExtents>
+  [[nodiscard]] _CCCL_API friend constexpr bool
+  operator==(const mapping& __lhs, const mapping<_OtherExtents>& __rhs) noexcept
+  {
+    return __lhs.extents() == __rhs.extents() && __lhs.tile_strides() == __convert(__rhs.tile_strides())
+        && __lhs.origins() == __convert(__rhs.origins());
+  }
+
+#if _CCCL_STD_VER <= 2017
+  template <class _OtherExtents>
+  [[nodiscard]] _CCCL_API friend constexpr bool
+  operator!=(const mapping& __lhs, const mapping<_OtherExtents>& __rhs) noexcept
+  {
+    return !(__lhs == __rhs);
+  }
+#endif // _CCCL_STD_VER <= 2017
+
+  //! @brief Returns the window of the slices, which select contiguous ranges of indices of each dimension
+  _CCCL_TEMPLATE(class... _Slices)
+  _CCCL_REQUIRES((sizeof...(_Slices) == __rank_) _CCCL_AND((__layout_tiled_range_slice<_Slices, index_type> && ...)))
+  [[nodiscard]] _CCCL_API friend constexpr auto submdspan_mapping(const mapping& __mapping, _Slices... __slices)
+  {
+    using _SubExtents = ::cuda::std::__get_subextents_t<extents_type, _Slices...>;
+    using _SubMapping = typename layout_blocked::template mapping<_SubExtents>;
+    return ::cuda::std::submdspan_mapping_result<_SubMapping>{
+      _SubMapping{::cuda::std::submdspan_extents(__mapping.extents(), __slices...),
+                  __mapping.tile_strides(),
+                  __mapping.__window_origins(__rank_sequence, __slices...)},
+      0};
+  }
+
+private:
+  template <class _OtherIndexType>
+  [[nodiscard]] _CCCL_API static constexpr ::cuda::std::array<index_type, __rank_>
+  __convert(const ::cuda::std::array<_OtherIndexType, __rank_>& __values) noexcept
+  {
+    ::cuda::std::array<index_type, __rank_> __result{};
+    for (rank_type __r = 0; __r != __rank_; ++__r)
+    {
+      __result[__r] = static_cast<index_type>(__values[__r]);
+    }
+    return __result;
+  }
+
+  //! @brief The contribution of the index __i of dimension _Pos to the linear index
+  template <::cuda::std::size_t _Pos>
+  [[nodiscard]] _CCCL_API constexpr index_type __index_along(index_type __i) const noexcept
+  {
+    constexpr auto __tile           = static_cast<__unsigned_index>(tile_extent(_Pos));
+    constexpr auto __element_stride = static_cast<__unsigned_index>(mapping::__element_stride(_Pos));
+    const auto __x                  = static_cast<__unsigned_index>(__origins_[_Pos] + __i);
+    return static_cast<index_type>((__x / __tile) * static_cast<__unsigned_index>(__tile_strides_[_Pos])
+                                   + (__x % __tile) * __element_stride);
+  }
+
+  template <::cuda::std::size_t... _Pos, class... _Indices>
+  [[nodiscard]] _CCCL_API constexpr index_type
+  __compute_index(::cuda::std::index_sequence<_Pos...>, _Indices... __indices) const noexcept
+  {
+    _CCCL_ASSERT(((static_cast<__unsigned_index>(__indices) < static_cast<__unsigned_index>(__extents_.extent(_Pos)))
+                  && ... && true),
+                 "layout_blocked::mapping: index is out of bounds");
+    return static_cast<index_type>((index_type{0} + ... + __index_along<_Pos>(__indices)));
+  }
+
+  template <::cuda::std::size_t... _Pos>
+  [[nodiscard]] _CCCL_API constexpr index_type __last_index(::cuda::std::index_sequence<_Pos...>) const noexcept
+  {
+    return static_cast<index_type>(
+      (index_type{0} + ... + __index_along<_Pos>(static_cast<index_type>(__extents_.extent(_Pos) - 1))));
+  }
+
+  template <::cuda::std::size_t... _Pos, class... _Slices>
+  [[nodiscard]] _CCCL_API constexpr ::cuda::std::array<index_type, __rank_>
+  __window_origins(::cuda::std::index_sequence<_Pos...>, _Slices... __slices) const noexcept
+  {
+    return {static_cast<index_type>(
+      __origins_[_Pos] + ::cuda::std::__first_extent_from_slice<index_type, _Pos>(__slices...))...};
+  }
+
+  extents_type __extents_;
+  ::cuda::std::array<index_type, __rank_> __tile_strides_;
+  ::cuda::std::array<index_type, __rank_> __origins_;
+};
+
+_CCCL_END_NAMESPACE_CUDA
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA___MDSPAN_LAYOUT_BLOCKED_H
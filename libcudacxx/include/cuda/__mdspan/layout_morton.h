@@ -0,0 +1,403 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA___MDSPAN_LAYOUT_MORTON_H
+#define _CUDA___MDSPAN_LAYOUT_MORTON_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/__mdspan/layout_blocked.h>
+#include <cuda/__numeric/mul_overflow.h>
+#include <cuda/std/__bit/countr.h>
+#include <cuda/std/__bit/has_single_bit.h>
+#include <cuda/std/__bit/integral.h>
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__limits/numeric_limits.h>
+#include <cuda/std/__mdspan/concepts.h>
+#include <cuda/std/__mdspan/extents.h>
+#include <cuda/std/__mdspan/submdspan_extents.h>
+#include <cuda/std/__mdspan/submdspan_helper.h>
+#include <cuda/std/__mdspan/submdspan_mapping.h>
+#include <cuda/std/__type_traits/conjunction.h>
+#include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/__type_traits/is_nothrow_constructible.h>
+#include <cuda/std/__type_traits/make_unsigned.h>
+#include <cuda/std/__utility/integer_sequence.h>
+#include <cuda/std/array>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA
+
+//! @brief Spreads the low 32 bits of __x to the even bits of the result
+[[nodiscard]] _CCCL_API constexpr ::cuda::std::uint64_t __morton_dilate_2(::cuda::std::uint64_t __x) noexcept
+{
+  __x &= 0x00000000FFFFFFFFull;
+  __x = (__x | (__x << 16)) & 0x0000FFFF0000FFFFull;
+  __x = (__x | (__x << 8)) & 0x00FF00FF00FF00FFull;
+  __x = (__x | (__x << 4)) & 0x0F0F0F0F0F0F0F0Full;
+  __x = (__x | (__x << 2)) & 0x3333333333333333ull;
+  __x = (__x | (__x << 1)) & 0x5555555555555555ull;
+  return __x;
+}
+
+//! @brief Spreads the low 21 bits of __x to every third bit of the result
+[[nodiscard]] _CCCL_API constexpr ::cuda::std::uint64_t __morton_dilate_3(::cuda::std::uint64_t __x) noexcept
+{
+  __x &= 0x00000000001FFFFFull;
+  __x = (__x | (__x << 32)) & 0x001F00000000FFFFull;
+  __x = (__x | (__x << 16)) & 0x001F0000FF0000FFull;
+  __x = (__x | (__x << 8)) & 0x100F00F00F00F00Full;
+  __x = (__x | (__x << 4)) & 0x10C30C30C30C30C3ull;
+  __x = (__x | (__x << 2)) & 0x1249249249249249ull;
+  return __x;
+}
+
+//! @brief Layout policy that stores the elements of 2D and 3D arrays in Morton (Z-order) order.
+//!
+//! The array is split in square tiles whose extent is by default the largest power of two up to 32 that pads every
+//! dimension by at most an eighth of its extent. The elements of a tile are stored in Morton order, which interleaves
+//! the bits of the indices with the first dimension in the most significant bit, so that any aligned sub-block of a
+//! power of two extent is contiguous. The tiles are stored one after the other in row-major order, and the tiles at the
+//! end of a dimension that is not a multiple of the tile extent are padded.
+//!
+//! Like layout_blocked, a mapping can also describe a window of a larger array, which submdspan returns for slices that
+//! select contiguous ranges of indices.
+struct layout_morton
+{
+  template <class _Extents>
+  class mapping;
+};
+
+template <class _Extents>
+class layout_morton::mapping
+{
+public:
+  static_assert(::cuda::std::__is_cuda_std_extents_v<_Extents>,
+                "layout_morton::mapping template argument must be a specialization of extents.");
+  static_assert(_Extents::rank() == 2 || _Extents::rank() == 3, "layout_morton::mapping: the rank must be 2 or 3");
+
+  using extents_type = _Extents;
+  using index_type   = typename extents_type::index_type;
+  using size_type    = typename extents_type::size_type;
+  using rank_type    = typename extents_type::rank_type;
+  using layout_type  = layout_morton;
+
+private:
+  static constexpr rank_type __rank_    = extents_type::rank();
+  static constexpr auto __rank_sequence = ::cuda::std::make_index_sequence<__rank_>();
+
+  using __unsigned_index = ::cuda::std::make_unsigned_t<index_type>;
+
+  //! The dilated indices of a tile must fit in index_type and in the 64 bits of the dilation
+  static constexpr int __max_tile_bits =
+    ::cuda::std::numeric_limits<__unsigned_index>::digits / static_cast<int>(__rank_) < (__rank_ == 2 ? 32 : 21)
+      ? ::cuda::std::numeric_limits<__unsigned_index>::digits / static_cast<int>(__rank_)
+      : (__rank_ == 2 ? 32 : 21);
+
+  //! The largest default tile extent, a tile of 32 x 32 floats already fills a page of 4 KiB
+  static constexpr int __max_default_tile_bits = 5 < __max_tile_bits ? 5 : __max_tile_bits;
+
+  //! @brief Returns the largest tile extent up to 32 that pads every dimension by at most an eighth of its extent
+  [[nodiscard]] _CCCL_API static constexpr index_type __make_tile_extent(const extents_type& __ext) noexcept
+  {
+    for (int __bits = __max_default_tile_bits; __bits > 0; --__bits)
+    {
+      const auto __tile = static_cast<index_type>(__unsigned_index{1} << __bits);
+      bool __fits       = true;
+      for (rank_type __r = 0; __r != __rank_; ++__r)
+      {
+        const index_type __extent = __ext.extent(__r);
+        const auto __padding      = static_cast<index_type>((__tile - __extent % __tile) % __tile);
+        __fits                    = __fits && __tile <= __extent && __padding <= __extent / 8;
+      }
+      if (__fits)
+      {
+        return __tile;
+      }
+    }
+    return 1;
+  }
+
+  [[nodiscard]] _CCCL_API static constexpr ::cuda::std::array<index_type, __rank_>
+  __make_tile_strides(const extents_type& __ext, index_type __tile_extent) noexcept
+  {
+    ::cuda::std::array<index_type, __rank_> __strides{};
+    index_type __stride = 1;
+    for (rank_type __r = 0; __r != __rank_; ++__r)
+    {
+      __stride *= __tile_extent;
+    }
+    for (rank_type __r = __rank_; __r-- > 0;)
+    {
+      __strides[__r]     = __stride;
+      const auto __tiles = static_cast<index_type>(::cuda::ceil_div(__ext.extent(__r), __tile_extent));
+      _CCCL_ASSERT(!::cuda::mul_overflow<index_type>(__stride, __tiles),
+                   "layout_morton::mapping: required_span_size() is not representable as index_type");
+      __stride *= __tiles;
+    }
+    return __strides;
+  }
+
+public:
+  _CCCL_API constexpr mapping() noexcept
+      : mapping(extents_type{})
+  {}
+
+  _CCCL_HIDE_FROM_ABI constexpr mapping(const mapping&) noexcept            = default;
+  _CCCL_HIDE_FROM_ABI constexpr mapping& operator=(const mapping&) noexcept = default;
+
+  //! @brief Constructs the mapping of an array of extents __ext
+  _CCCL_API constexpr mapping(const extents_type& __ext) noexcept
+      : mapping(__ext, __make_tile_extent(__ext))
+  {}
+
+  //! @brief Constructs the mapping of an array of extents __ext with tiles of extent __tile_extent
+  _CCCL_API constexpr mapping(const extents_type& __ext, index_type __tile_extent) noexcept
+      : mapping(__ext, __tile_extent, __make_tile_strides(__ext, __tile_extent), {})
+  {}
+
+  //! @brief Constructs the mapping of a window of extents __ext of a larger array
+  //!
+  //! @param __tile_extent The extent of the tiles of the larger array, a power of two
+  //! @param __tile_strides The distance between two consecutive tiles of the larger array along each dimension
+  //! @param __origins The position in the larger array of the index 0 of the window
+  _CCCL_API constexpr mapping(const extents_type& __ext,
+                              index_type __tile_extent,
+                              const ::cuda::std::array<index_type, __rank_>& __tile_strides,
+                              const ::cuda::std::array<index_type, __rank_>& __origins) noexcept
+      : __extents_{__ext}
+      , __tile_strides_{__tile_strides}
+      , __origins_{__origins}
+      , __tile_bits_{::cuda::std::countr_zero(static_cast<__unsigned_index>(__tile_extent))}
+  {
+    _CCCL_ASSERT(__tile_extent > 0 && ::cuda::std::has_single_bit(static_cast<__unsigned_index>(__tile_extent))
+                   && __tile_bits_ <= __max_tile_bits,
+                 "layout_morton::mapping: the tile extent must be a power of two");
+  }
+
+  _CCCL_TEMPLATE(class _OtherExtents)
+  _CCCL_REQUIRES(::cuda::std::is_constructible_v<extents_type, _OtherExtents> _CCCL_AND
+                   ::cuda::std::is_convertible_v<_OtherExtents, extents_type>)
+  _CCCL_API constexpr mapping(const mapping<_OtherExtents>& __other) noexcept
+      : mapping(extents_type{__other.extents()},
+                static_cast<index_type>(__other.tile_extent()),
+                __convert(__other.tile_strides()),
+                __convert(__other.origins()))
+  {}
+
+  _CCCL_TEMPLATE(class _OtherExtents)
+  _CCCL_REQUIRES(::cuda::std::is_constructible_v<extents_type, _OtherExtents> _CCCL_AND(
+    !::cuda::std::is_convertible_v<_OtherExtents, extents_type>))
+  _CCCL_API explicit constexpr mapping(const mapping<_OtherExtents>& __other) noexcept
+      : mapping(extents_type{__other.extents()},
+                static_cast<index_type>(__other.tile_extent()),
+                __convert(__other.tile_strides()),
+                __convert(__other.origins()))
+  {}
+
+  [[nodiscard]] _CCCL_API constexpr const extents_type& extents() const noexcept
+  {
+    return __extents_;
+  }
+
+  //! @brief Returns the extent of the tiles along every dimension
+  [[nodiscard]] _CCCL_API constexpr index_type tile_extent() const noexcept
+  {
+    return static_cast<index_type>(__unsigned_index{1} << __tile_bits_);
+  }
+
+  //! @brief Returns the distance between two consecutive tiles along each dimension
+  [[nodiscard]] _CCCL_API constexpr const ::cuda::std::array<index_type, __rank_>& tile_strides() const noexcept
+  {
+    return __tile_strides_;
+  }
+
+  //! @brief Returns the position of the index 0 in the array, which is not zero for the windows of submdspan
+  [[nodiscard]] _CCCL_API constexpr const ::cuda::std::array<index_type, __rank_>& origins() const noexcept
+  {
+    return __origins_;
+  }
+
+  //! @brief Returns the required span size, the mapped index of the last element plus one
+  [[nodiscard]] _CCCL_API constexpr index_type required_span_size() const noexcept
+  {
+    for (rank_type __r = 0; __r != __rank_; ++__r)
+    {
+      if (__extents_.extent(__r) == 0)
+      {
+        return 0;
+      }
+    }
+    // The mapping increases along each dimension, so the last element has the largest index
+    return __last_index(__rank_sequence) + 1;
+  }
+
+  //! @brief Maps multidimensional indices to a linear index
+  _CCCL_TEMPLATE(class... _Indices)
+  _CCCL_REQUIRES(
+    (sizeof...(_Indices) == __rank_) //
+    _CCCL_AND(::cuda::std::conjunction_v<::cuda::std::is_convertible<_Indices, index_type>...>)
+      _CCCL_AND(::cuda::std::conjunction_v<::cuda::std::is_nothrow_constructible<index_type, _Indices>...>))
+  [[nodiscard]] _CCCL_API constexpr index_type operator()(_Indices... __indices) const noexcept
+  {
+    return __compute_index(__rank_sequence, static_cast<index_type>(__indices)...);
+  }
+
+  [[nodiscard]] _CCCL_API static constexpr bool is_always_unique() noexcept
+  {
+    return true;
+  }
+
+  //! @brief Returns false - the tiles at the end of a dimension can be padded
+  [[nodiscard]] _CCCL_API static constexpr bool is_always_exhaustive() noexcept
+  {
+    return false;
+  }
+
+  [[nodiscard]] _CCCL_API static constexpr bool is_always_strided() noexcept
+  {
+    return false;
+  }
+
+  [[nodiscard]] _CCCL_API static constexpr bool is_unique() noexcept
+  {
+    return true;
+  }
+
+  //! @brief Returns true if the elements fill the required span, without padding
+  [[nodiscard]] _CCCL_API constexpr bool is_exhaustive() const noexcept
+  {
+    index_type __size = 1;
+    for (rank_type __r = 0; __r != __rank_; ++__r)
+    {
+      __size *= __extents_.extent(__r);
+    }
+    return __size == required_span_size();
+  }
+
+  //! @brief Returns false - the distance between consecutive elements changes with the interleaved bits
+  [[nodiscard]] _CCCL_API static constexpr bool is_strided() noexcept
+  {
+    return false;
+  }
+
+  template <class _OtherExtents>
+  [[nodiscard]] _CCCL_API friend constexpr bool
+  operator==(const mapping& __lhs, const mapping<_OtherExtents>& __rhs) noexcept
+  {
+    return __lhs.extents() == __rhs.extents() && __lhs.tile_extent() == __rhs.tile_extent()
+        && __lhs.tile_strides() == __convert(__rhs.tile_strides()) && __lhs.origins() == __convert(__rhs.origins());
+  }
+
+#if _CCCL_STD_VER <= 2017
+  template <class _OtherExtents>
+  [[nodiscard]] _CCCL_API friend constexpr bool
+  operator!=(const mapping& __lhs, const mapping<_OtherExtents>& __rhs) noexcept
+  {
+    return !(__lhs == __rhs);
+  }
+#endif // _CCCL_STD_VER <= 2017
+
+  //! @brief Returns the window of the slices, which select contiguous ranges of indices of each dimension
+  _CCCL_TEMPLATE(class... _Slices)
+  _CCCL_REQUIRES((sizeof...(_Slices) == __rank_) _CCCL_AND((__layout_tiled_range_slice<_Slices, index_type> && ...)))
+  [[nodiscard]] _CCCL_API friend constexpr auto submdspan_mapping(const mapping& __mapping, _Slices... __slices)
+  {
+    using _SubExtents = ::cuda::std::__get_subextents_t<extents_type, _Slices...>;
+    using _SubMapping = layout_morton::mapping<_SubExtents>;
+    return ::cuda::std::submdspan_mapping_result<_SubMapping>{
+      _SubMapping{::cuda::std::submdspan_extents(__mapping.extents(), __slices...),
+                  __mapping.tile_extent(),
+                  __mapping.tile_strides(),
+                  __mapping.__window_origins(__rank_sequence, __slices...)},
+      0};
+  }
+
+private:
+  template <class _OtherIndexType>
+  [[nodiscard]] _CCCL_API static constexpr ::cuda::std::array<index_type, __rank_>
+  __convert(const ::cuda::std::array<_OtherIndexType, __rank_>& __values) noexcept
+  {
+    ::cuda::std::array<index_type, __rank_> __result{};
+    for (rank_type __r = 0; __r != __rank_; ++__r)
+    {
+      __result[__r] = static_cast<index_type>(__values[__r]);
+    }
+    return __result;
+  }
+
+  //! @brief The contribution of the index __i of dimension _Pos to the linear index
+  template <::cuda::std::size_t _Pos>
+  [[nodiscard]] _CCCL_API constexpr index_type __index_along(index_type __i) const noexcept
+  {
+    const auto __x    = static_cast<__unsigned_index>(__origins_[_Pos] + __i);
+    const auto __tile = __x >> __tile_bits_;
+    const auto __bits = static_cast<::cuda::std::uint64_t>(__x & ((__unsigned_index{1} << __tile_bits_) - 1));
+    ::cuda::std::uint64_t __dilated{};
+    if constexpr (__rank_ == 2)
+    {
+      __dilated = ::cuda::__morton_dilate_2(__bits);
+    }
+    else
+    {
+      __dilated = ::cuda::__morton_dilate_3(__bits);
+    }
+    return static_cast<index_type>(__tile * static_cast<__unsigned_index>(__tile_strides_[_Pos])
+                                   + static_cast<__unsigned_index>(__dilated << (__rank_ - 1 - _Pos)));
+  }
+
+  template <::cuda::std::size_t... _Pos, class... _Indices>
+  [[nodiscard]] _CCCL_API constexpr index_type
+  __compute_index(::cuda::std::index_sequence<_Pos...>, _Indices... __indices) const noexcept
+  {
+    _CCCL_ASSERT(((static_cast<__unsigned_index>(__indices) < static_cast<__unsigned_index>(__extents_.extent(_Pos)))
+                  && ... && true),
+                 "layout_morton::mapping: index is out of bounds");
+    return static_cast<index_type>((index_type{0} + ... + __index_along<_Pos>(__indices)));
+  }
+
+  template <::cuda::std::size_t... _Pos>
+  [[nodiscard]] _CCCL_API constexpr index_type __last_index(::cuda::std::index_sequence<_Pos...>) const noexcept
+  {
+    return static_cast<index_type>(
+      (index_type{0} + ... + __index_along<_Pos>(static_cast<index_type>(__extents_.extent(_Pos) - 1))));
+  }
+
+  template <::cuda::std::size_t... _Pos, class... _Slices>
+  [[nodiscard]] _CCCL_API constexpr ::cuda::std::array<index_type, __rank_>
+  __window_origins(::cuda::std::index_sequence<_Pos...>, _Slices... __slices) const noexcept
+  {
+    return {static_cast<index_type>(
+      __origins_[_Pos] + ::cuda::std::__first_extent_from_slice<index_type, _Pos>(__slices...))...};
+  }
+
+  extents_type __extents_;
+  ::cuda::std::array<index_type, __rank_> __tile_strides_;
+  ::cuda::std::array<index_type, __rank_> __origins_;
+  int __tile_bits_;
+};
+
+_CCCL_END_NAMESPACE_CUDA
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA___MDSPAN_LAYOUT_MORTON_H
@@ -27,7 +27,7 @@
 #define _LIBCUDACXX_ATOMIC_COMMON_IMPL(_CONST, _VOLATILE)                                                             \
   _CCCL_HOST_DEVICE_API inline bool is_lock_free() const _VOLATILE noexcept                                           \
   {                                                                                                                   \
-    return _LIBCUDACXX_ATOMIC_IS_LOCK_FREE(sizeof(_Tp));                                                              \
+    return _LIBCUDACXX_ATOMIC_IS_LOCK_FREE(sizeof(_Tp)) || __atomic_is_host_dwcas<_Tp>;                              \
   }                                                                                                                   \
   _CCCL_HOST_DEVICE_API inline void store(_Tp __d, memory_order __m = memory_order_seq_cst)                           \
     _CONST _VOLATILE noexcept _LIBCUDACXX_CHECK_STORE_MEMORY_ORDER(__m)                                               \
@@ -45,7 +45,7 @@ struct __atomic_common
   __atomic_storage_t<_Tp> __a;
 
 #if defined(_CCCL_ATOMIC_ALWAYS_LOCK_FREE)
-  static constexpr bool is_always_lock_free = _CCCL_ATOMIC_ALWAYS_LOCK_FREE(sizeof(_Tp), nullptr);
+  static constexpr bool is_always_lock_free = __atomic_is_always_lock_free<_Tp>::__value;
 #endif // defined(_CCCL_ATOMIC_ALWAYS_LOCK_FREE)
 
   _LIBCUDACXX_ATOMIC_COMMON_IMPL(, )
@@ -64,7 +64,7 @@ struct __atomic_arithmetic
   __atomic_storage_t<_Tp> __a;
 
 #if defined(_CCCL_ATOMIC_ALWAYS_LOCK_FREE)
-  static constexpr bool is_always_lock_free = _CCCL_ATOMIC_ALWAYS_LOCK_FREE(sizeof(_Tp), nullptr);
+  static constexpr bool is_always_lock_free = __atomic_is_always_lock_free<_Tp>::__value;
 #endif // defined(_CCCL_ATOMIC_ALWAYS_LOCK_FREE)
 
   _LIBCUDACXX_ATOMIC_COMMON_IMPL(, )
@@ -86,7 +86,7 @@ struct __atomic_bitwise
   __atomic_storage_t<_Tp> __a;
 
 #if defined(_CCCL_ATOMIC_ALWAYS_LOCK_FREE)
-  static constexpr bool is_always_lock_free = _CCCL_ATOMIC_ALWAYS_LOCK_FREE(sizeof(_Tp), nullptr);
+  static constexpr bool is_always_lock_free = __atomic_is_always_lock_free<_Tp>::__value;
 #endif // defined(_CCCL_ATOMIC_ALWAYS_LOCK_FREE)
 
   _LIBCUDACXX_ATOMIC_COMMON_IMPL(, )
@@ -111,7 +111,7 @@ struct __atomic_pointer
   __atomic_storage_t<_Tp> __a;
 
 #if defined(_CCCL_ATOMIC_ALWAYS_LOCK_FREE)
-  static constexpr bool is_always_lock_free = _CCCL_ATOMIC_ALWAYS_LOCK_FREE(sizeof(_Tp), nullptr);
+  static constexpr bool is_always_lock_free = __atomic_is_always_lock_free<_Tp>::__value;
 #endif // defined(_CCCL_ATOMIC_ALWAYS_LOCK_FREE)
 
   _LIBCUDACXX_ATOMIC_COMMON_IMPL(, )
@@ -43,7 +43,7 @@ struct __atomic_ref_common
   __atomic_ref_storage<_Tp> __a;
 
 #if defined(_CCCL_ATOMIC_ALWAYS_LOCK_FREE)
-  static constexpr bool is_always_lock_free = _CCCL_ATOMIC_ALWAYS_LOCK_FREE(sizeof(_Tp), nullptr);
+  static constexpr bool is_always_lock_free = __atomic_is_always_lock_free<_Tp>::__value;
 #endif // defined(_CCCL_ATOMIC_ALWAYS_LOCK_FREE)
 
   _LIBCUDACXX_ATOMIC_COMMON_IMPL(const, )
@@ -59,7 +59,7 @@ struct __atomic_ref_arithmetic
   __atomic_ref_storage<_Tp> __a;
 
 #if defined(_CCCL_ATOMIC_ALWAYS_LOCK_FREE)
-  static constexpr bool is_always_lock_free = _CCCL_ATOMIC_ALWAYS_LOCK_FREE(sizeof(_Tp), nullptr);
+  static constexpr bool is_always_lock_free = __atomic_is_always_lock_free<_Tp>::__value;
 #endif // defined(_CCCL_ATOMIC_ALWAYS_LOCK_FREE)
 
   _LIBCUDACXX_ATOMIC_COMMON_IMPL(const, )
@@ -76,7 +76,7 @@ struct __atomic_ref_bitwise
   __atomic_ref_storage<_Tp> __a;
 
 #if defined(_CCCL_ATOMIC_ALWAYS_LOCK_FREE)
-  static constexpr bool is_always_lock_free = _CCCL_ATOMIC_ALWAYS_LOCK_FREE(sizeof(_Tp), nullptr);
+  static constexpr bool is_always_lock_free = __atomic_is_always_lock_free<_Tp>::__value;
 #endif // defined(_CCCL_ATOMIC_ALWAYS_LOCK_FREE)
 
   _LIBCUDACXX_ATOMIC_COMMON_IMPL(const, )
@@ -94,7 +94,7 @@ struct __atomic_ref_pointer
   __atomic_ref_storage<_Tp> __a;
 
 #if defined(_CCCL_ATOMIC_ALWAYS_LOCK_FREE)
-  static constexpr bool is_always_lock_free = _CCCL_ATOMIC_ALWAYS_LOCK_FREE(sizeof(_Tp), nullptr);
+  static constexpr bool is_always_lock_free = __atomic_is_always_lock_free<_Tp>::__value;
 #endif // defined(_CCCL_ATOMIC_ALWAYS_LOCK_FREE)
 
   _LIBCUDACXX_ATOMIC_COMMON_IMPL(const, )
@@ -44,7 +44,7 @@ _CCCL_DIAG_SUPPRESS_CLANG("-Watomic-alignment")
 #  elif _CCCL_HOST_128_ATOMICS_MAYBE()
 #    define _LIBCUDACXX_INT128_WARN(TYPE)                                                                        \
       static_assert(                                                                                             \
-        sizeof(TYPE) < 16,                                                                                       \
+        sizeof(TYPE) < 16 || __atomic_is_host_dwcas<TYPE>,                                                       \
         "CCCL has detected possible support for 128 bit atomics. However this feature is experimental. You can " \
         "define CCCL_ENABLE_EXPERIMENTAL_HOST_ATOMICS_128B to ignore and acknowledge that runtime corruption "   \
         "may occur if you link with libatomic and use locked atomics.");
@@ -79,29 +79,136 @@ inline void __atomic_signal_fence_host(memory_order __order)
   __atomic_signal_fence(__atomic_order_to_int(__order));
 }
 
+#  if _CCCL_HOST_ATOMICS_DWCAS()
+// The __sync builtins inline the double width compare and swap, where the __atomic builtins call into libatomic. They
+// are full barriers, which satisfies every memory order.
+template <typename _Tp>
+inline __int128_t __atomic_dwcas_host(_Tp* __a, __int128_t __expected, __int128_t __desired)
+{
+  return __sync_val_compare_and_swap(
+    reinterpret_cast<__int128_t*>(const_cast<remove_cv_t<_Tp>*>(__a)), __expected, __desired);
+}
+
+// Processors with AVX perform aligned 16 byte vector loads atomically, and unlike a compare and swap they do not write
+// to the atomic, which may be in read-only memory. Every store is a locked compare and swap, so a plain load is also
+// sequentially consistent on x86-64.
+template <typename _Tp>
+inline __int128_t __atomic_dwcas_load_host(_Tp* __a)
+{
+  using __vector_t = long long __attribute__((__vector_size__(16)));
+  __vector_t __vec;
+  __asm__ __volatile__("vmovdqa %1, %0"
+                       : "=x"(__vec)
+                       : "m"(*reinterpret_cast<const volatile __vector_t*>(__a))
+                       : "memory");
+  __int128_t __bits;
+  __builtin_memcpy(&__bits, &__vec, sizeof(__bits));
+  return __bits;
+}
+
+template <typename _Tp>
+inline __int128_t __atomic_dwcas_to_bits_host(const _Tp& __val)
+{
+  __int128_t __bits;
+  __builtin_memcpy(&__bits, &__val, sizeof(__bits));
+  return __bits;
+}
+
+template <typename _Tp>
+inline remove_cv_t<_Tp> __atomic_dwcas_from_bits_host(__int128_t __bits)
+{
+  remove_cv_t<_Tp> __val;
+  __builtin_memcpy(&__val, &__bits, sizeof(__bits));
+  return __val;
+}
+
+// Replaces the value with __update(old) and returns the old value
+template <typename _Tp, typename _Fn>
+inline remove_cv_t<_Tp> __atomic_dwcas_update_host(_Tp* __a, _Fn __update)
+{
+  __int128_t __expected = ::cuda::std::__atomic_dwcas_load_host(__a);
+  while (true)
+  {
+    const auto __old         = ::cuda::std::__atomic_dwcas_from_bits_host<_Tp>(__expected);
+    const __int128_t __found =
+      ::cuda::std::__atomic_dwcas_host(__a, __expected, ::cuda::std::__atomic_dwcas_to_bits_host(__update(__old)));
+    if (__found == __expected)
+    {
+      return __old;
+    }
+    __expected = __found;
+  }
+}
+
+template <typename _Tp, typename _Up>
+inline bool __atomic_dwcas_compare_exchange_host(_Tp* __a, _Up* __expected, _Up __desired)
+{
+  const __int128_t __expected_bits = ::cuda::std::__atomic_dwcas_to_bits_host(*__expected);
+  const __int128_t __found =
+    ::cuda::std::__atomic_dwcas_host(__a, __expected_bits, ::cuda::std::__atomic_dwcas_to_bits_host(__desired));
+  if (__found == __expected_bits)
+  {
+    return true;
+  }
+  *__expected = ::cuda::std::__atomic_dwcas_from_bits_host<_Up>(__found);
+  return false;
+}
+#  endif // _CCCL_HOST_ATOMICS_DWCAS()
+
 template <typename _Tp, typename _Up>
 inline void __atomic_store_host(_Tp* __a, _Up __val, memory_order __order)
 {
   _LIBCUDACXX_INT128_WARN(_Tp)
-  __atomic_store(&__atomic_force_align_host(__a)->__atom, &__val, __atomic_order_to_int(__order));
+#  if _CCCL_HOST_ATOMICS_DWCAS()
+  if constexpr (__atomic_is_host_dwcas<_Tp>)
+  {
+    ::cuda::std::__atomic_dwcas_update_host(__a, [__val](remove_cv_t<_Tp>) {
+      return static_cast<remove_cv_t<_Tp>>(__val);
+    });
+  }
+  else
+#  endif // _CCCL_HOST_ATOMICS_DWCAS()
+  {
+    __atomic_store(&__atomic_force_align_host(__a)->__atom, &__val, __atomic_order_to_int(__order));
+  }
 }
 
 template <typename _Tp>
 inline auto __atomic_load_host(_Tp* __a, memory_order __order) -> remove_cv_t<_Tp>
 {
   _LIBCUDACXX_INT128_WARN(_Tp)
-  remove_cv_t<_Tp> __ret;
-  __atomic_load(&__atomic_force_align_host(__a)->__atom, &__ret, __atomic_order_to_int(__order));
-  return __ret;
+#  if _CCCL_HOST_ATOMICS_DWCAS()
+  if constexpr (__atomic_is_host_dwcas<_Tp>)
+  {
+    return ::cuda::std::__atomic_dwcas_from_bits_host<_Tp>(::cuda::std::__atomic_dwcas_load_host(__a));
+  }
+  else
+#  endif // _CCCL_HOST_ATOMICS_DWCAS()
+  {
+    remove_cv_t<_Tp> __ret;
+    __atomic_load(&__atomic_force_align_host(__a)->__atom, &__ret, __atomic_order_to_int(__order));
+    return __ret;
+  }
 }
 
 template <typename _Tp, typename _Up>
 inline auto __atomic_exchange_host(_Tp* __a, _Up __val, memory_order __order) -> remove_cv_t<_Tp>
 {
   _LIBCUDACXX_INT128_WARN(_Tp)
-  remove_cv_t<_Tp> __ret;
-  __atomic_exchange(&__atomic_force_align_host(__a)->__atom, &__val, &__ret, __atomic_order_to_int(__order));
-  return __ret;
+#  if _CCCL_HOST_ATOMICS_DWCAS()
+  if constexpr (__atomic_is_host_dwcas<_Tp>)
+  {
+    return ::cuda::std::__atomic_dwcas_update_host(__a, [__val](remove_cv_t<_Tp>) {
+      return static_cast<remove_cv_t<_Tp>>(__val);
+    });
+  }
+  else
+#  endif // _CCCL_HOST_ATOMICS_DWCAS()
+  {
+    remove_cv_t<_Tp> __ret;
+    __atomic_exchange(&__atomic_force_align_host(__a)->__atom, &__val, &__ret, __atomic_order_to_int(__order));
+    return __ret;
+  }
 }
 
 template <typename _Tp, typename _Up>
@@ -109,14 +216,23 @@ inline bool __atomic_compare_exchange_strong_host(
   _Tp* __a, _Up* __expected, _Up __desired, memory_order __success, memory_order __failure)
 {
   _LIBCUDACXX_INT128_WARN(_Tp)
-  return __atomic_compare_exchange(
-    &__atomic_force_align_host(__a)->__atom,
-    // This is only alignment wrapped in order to prevent GCC-6 from triggering unused warning
-    &__atomic_force_align_host(__expected)->__atom,
-    &__desired,
-    false,
-    __atomic_order_to_int(__success),
-    __atomic_failure_order_to_int(__failure));
+#  if _CCCL_HOST_ATOMICS_DWCAS()
+  if constexpr (__atomic_is_host_dwcas<_Tp>)
+  {
+    return ::cuda::std::__atomic_dwcas_compare_exchange_host(__a, __expected, __desired);
+  }
+  else
+#  endif // _CCCL_HOST_ATOMICS_DWCAS()
+  {
+    return __atomic_compare_exchange(
+      &__atomic_force_align_host(__a)->__atom,
+      // This is only alignment wrapped in order to prevent GCC-6 from triggering unused warning
+      &__atomic_force_align_host(__expected)->__atom,
+      &__desired,
+      false,
+      __atomic_order_to_int(__success),
+      __atomic_failure_order_to_int(__failure));
+  }
 }
 
 template <typename _Tp, typename _Up>
@@ -124,22 +240,42 @@ inline bool __atomic_compare_exchange_weak_host(
   _Tp* __a, _Up* __expected, _Up __desired, memory_order __success, memory_order __failure)
 {
   _LIBCUDACXX_INT128_WARN(_Tp)
-  return __atomic_compare_exchange(
-    &__atomic_force_align_host(__a)->__atom,
-    // This is only alignment wrapped in order to prevent GCC-6 from triggering unused warning
-    &__atomic_force_align_host(__expected)->__atom,
-    &__desired,
-    true,
-    __atomic_order_to_int(__success),
-    __atomic_failure_order_to_int(__failure));
+#  if _CCCL_HOST_ATOMICS_DWCAS()
+  if constexpr (__atomic_is_host_dwcas<_Tp>)
+  {
+    return ::cuda::std::__atomic_dwcas_compare_exchange_host(__a, __expected, __desired);
+  }
+  else
+#  endif // _CCCL_HOST_ATOMICS_DWCAS()
+  {
+    return __atomic_compare_exchange(
+      &__atomic_force_align_host(__a)->__atom,
+      // This is only alignment wrapped in order to prevent GCC-6 from triggering unused warning
+      &__atomic_force_align_host(__expected)->__atom,
+      &__desired,
+      true,
+      __atomic_order_to_int(__success),
+      __atomic_failure_order_to_int(__failure));
+  }
 }
 
 template <typename _Tp, typename _Td, enable_if_t<!is_floating_point_v<_Tp>, int> = 0>
 inline remove_cv_t<_Tp> __atomic_fetch_add_host(_Tp* __a, _Td __delta, memory_order __order)
 {
   _LIBCUDACXX_INT128_WARN(_Tp)
-  constexpr auto __skip_v = __atomic_ptr_skip_t<_Tp>::__skip;
-  return __atomic_fetch_add(__a, __delta * __skip_v, __atomic_order_to_int(__order));
+#  if _CCCL_HOST_ATOMICS_DWCAS()
+  if constexpr (__atomic_is_host_dwcas<_Tp>)
+  {
+    return ::cuda::std::__atomic_dwcas_update_host(__a, [__delta](remove_cv_t<_Tp> __old) {
+      return static_cast<remove_cv_t<_Tp>>(__old + __delta);
+    });
+  }
+  else
+#  endif // _CCCL_HOST_ATOMICS_DWCAS()
+  {
+    constexpr auto __skip_v = __atomic_ptr_skip_t<_Tp>::__skip;
+    return __atomic_fetch_add(__a, __delta * __skip_v, __atomic_order_to_int(__order));
+  }
 }
 
 template <typename _Tp, typename _Td, enable_if_t<is_floating_point_v<_Tp>, int> = 0>
@@ -161,8 +297,19 @@ template <typename _Tp, typename _Td, enable_if_t<!is_floating_point_v<_Tp>, int
 inline remove_cv_t<_Tp> __atomic_fetch_sub_host(_Tp* __a, _Td __delta, memory_order __order)
 {
   _LIBCUDACXX_INT128_WARN(_Tp)
-  constexpr auto __skip_v = __atomic_ptr_skip_t<_Tp>::__skip;
-  return __atomic_fetch_sub(__a, __delta * __skip_v, __atomic_order_to_int(__order));
+#  if _CCCL_HOST_ATOMICS_DWCAS()
+  if constexpr (__atomic_is_host_dwcas<_Tp>)
+  {
+    return ::cuda::std::__atomic_dwcas_update_host(__a, [__delta](remove_cv_t<_Tp> __old) {
+      return static_cast<remove_cv_t<_Tp>>(__old - __delta);
+    });
+  }
+  else
+#  endif // _CCCL_HOST_ATOMICS_DWCAS()
+  {
+    constexpr auto __skip_v = __atomic_ptr_skip_t<_Tp>::__skip;
+    return __atomic_fetch_sub(__a, __delta * __skip_v, __atomic_order_to_int(__order));
+  }
 }
 
 template <typename _Tp, typename _Td, enable_if_t<is_floating_point_v<_Tp>, int> = 0>
@@ -184,21 +331,54 @@ template <typename _Tp, typename _Td>
 inline remove_cv_t<_Tp> __atomic_fetch_and_host(_Tp* __a, _Td __pattern, memory_order __order)
 {
   _LIBCUDACXX_INT128_WARN(_Tp)
-  return __atomic_fetch_and(__a, __pattern, __atomic_order_to_int(__order));
+#  if _CCCL_HOST_ATOMICS_DWCAS()
+  if constexpr (__atomic_is_host_dwcas<_Tp>)
+  {
+    return ::cuda::std::__atomic_dwcas_update_host(__a, [__pattern](remove_cv_t<_Tp> __old) {
+      return static_cast<remove_cv_t<_Tp>>(__old & __pattern);
+    });
+  }
+  else
+#  endif // _CCCL_HOST_ATOMICS_DWCAS()
+  {
+    return __atomic_fetch_and(__a, __pattern, __atomic_order_to_int(__order));
+  }
 }
 
 template <typename _Tp, typename _Td>
 inline remove_cv_t<_Tp> __atomic_fetch_or_host(_Tp* __a, _Td __pattern, memory_order __order)
 {
   _LIBCUDACXX_INT128_WARN(_Tp)
-  return __atomic_fetch_or(__a, __pattern, __atomic_order_to_int(__order));
+#  if _CCCL_HOST_ATOMICS_DWCAS()
+  if constexpr (__atomic_is_host_dwcas<_Tp>)
+  {
+    return ::cuda::std::__atomic_dwcas_update_host(__a, [__pattern](remove_cv_t<_Tp> __old) {
+      return static_cast<remove_cv_t<_Tp>>(__old | __pattern);
+    });
+  }
+  else
+#  endif // _CCCL_HOST_ATOMICS_DWCAS()
+  {
+    return __atomic_fetch_or(__a, __pattern, __atomic_order_to_int(__order));
+  }
 }
 
 template <typename _Tp, typename _Td>
 inline remove_cv_t<_Tp> __atomic_fetch_xor_host(_Tp* __a, _Td __pattern, memory_order __order)
 {
   _LIBCUDACXX_INT128_WARN(_Tp)
-  return __atomic_fetch_xor(__a, __pattern, __atomic_order_to_int(__order));
+#  if _CCCL_HOST_ATOMICS_DWCAS()
+  if constexpr (__atomic_is_host_dwcas<_Tp>)
+  {
+    return ::cuda::std::__atomic_dwcas_update_host(__a, [__pattern](remove_cv_t<_Tp> __old) {
+      return static_cast<remove_cv_t<_Tp>>(__old ^ __pattern);
+    });
+  }
+  else
+#  endif // _CCCL_HOST_ATOMICS_DWCAS()
+  {
+    return __atomic_fetch_xor(__a, __pattern, __atomic_order_to_int(__order));
+  }
 }
 
 template <typename _Tp, typename _Td>
@@ -62,17 +62,26 @@
 
 #define _LIBCUDACXX_ATOMIC_IS_LOCK_FREE(size) (size <= 8)
 
+#include <cuda/std/__type_traits/is_floating_point.h>
+#include <cuda/std/__type_traits/remove_cv.h>
+
 #include <cuda/std/__cccl/prologue.h>
 
 _CCCL_BEGIN_NAMESPACE_CUDA_STD
 
+// 16 byte atomics that are implemented with the double width compare and swap of the host. Floating point types are
+// excluded, as e.g. the padding bytes of long double would make the bitwise comparison fail for equal values.
+template <typename _Tp>
+inline constexpr bool __atomic_is_host_dwcas =
+  _CCCL_HOST_ATOMICS_DWCAS() && sizeof(_Tp) == 16 && !is_floating_point_v<remove_cv_t<_Tp>>;
+
 #if defined(_CCCL_ATOMIC_ALWAYS_LOCK_FREE)
 template <typename _Tp>
 struct __atomic_is_always_lock_free
 {
   enum
   {
-    __value = _CCCL_ATOMIC_ALWAYS_LOCK_FREE(sizeof(_Tp), nullptr)
+    __value = _CCCL_ATOMIC_ALWAYS_LOCK_FREE(sizeof(_Tp), nullptr) || __atomic_is_host_dwcas<_Tp>
   };
 };
 #else
@@ -25,12 +25,27 @@
 #include <cuda/std/__atomic/scopes.h>
 #include <cuda/std/__atomic/types/base.h>
 #include <cuda/std/__atomic/types/common.h>
+#include <cuda/std/__thread/threading_support.h>
 #include <cuda/std/__type_traits/remove_cv.h>
 
 #include <cuda/std/__cccl/prologue.h>
 
 _CCCL_BEGIN_NAMESPACE_CUDA_STD
 
+// Waits until a taken lock is released before the next attempt to take it. Only reading the lock keeps the cache line
+// shared between the waiting threads instead of moving it on every attempt, and the backoff leaves the processor to
+// the owner of the lock, learning per locked type how long the lock is usually held.
+template <typename _Site, typename _Lock, typename _Sco>
+_CCCL_HOST_DEVICE_API void __atomic_locked_backoff(_Lock* __lock, _Sco)
+{
+  ::cuda::std::__cccl_thread_poll_with_backoff(
+    [__lock]() {
+      return 0 == __atomic_load_dispatch(__lock, memory_order_relaxed, _Sco{});
+    },
+    ::cuda::std::chrono::nanoseconds::zero(),
+    __cccl_adaptive_backoff<_Site>{});
+}
+
 // Locked atomics must override the dispatch to be able to implement RMW primitives around the embedded lock.
 template <typename _Tp>
 struct __atomic_locked_storage
@@ -52,13 +67,17 @@ struct __atomic_locked_storage
   _CCCL_HOST_DEVICE_API void __lock(_Sco) const volatile noexcept
   {
     while (1 == __atomic_exchange_dispatch(&__a_lock, _CCCL_ATOMIC_FLAG_TYPE(true), memory_order_acquire, _Sco{}))
-      /*spin*/;
+    {
+      ::cuda::std::__atomic_locked_backoff<__atomic_locked_storage>(&__a_lock, _Sco{});
+    }
   }
   template <typename _Sco>
   _CCCL_HOST_DEVICE_API void __lock(_Sco) const noexcept
   {
     while (1 == __atomic_exchange_dispatch(&__a_lock, _CCCL_ATOMIC_FLAG_TYPE(true), memory_order_acquire, _Sco{}))
-      /*spin*/;
+    {
+      ::cuda::std::__atomic_locked_backoff<__atomic_locked_storage>(&__a_lock, _Sco{});
+    }
   }
   template <typename _Sco>
   _CCCL_HOST_DEVICE_API void __unlock(_Sco) const volatile noexcept
@@ -119,7 +138,7 @@ _CCCL_HOST_DEVICE_API bool __atomic_compare_exchange_strong_dispatch(
   _Tp __temp;
   __a->__lock(_Sco{});
   __atomic_assign_volatile(&__temp, __a->__a_value);
-  bool __ret = __temp == *__expected;
+  bool __ret = 0 == __atomic_memcmp(&__temp, __expected, sizeof(_Tp));
   if (__ret)
   {
     __atomic_assign_volatile(&__a->__a_value, __value);
@@ -140,7 +159,7 @@ __atomic_compare_exchange_weak_dispatch(_Sto* __a, _Up* __expected, _Up __value,
   _Tp __temp;
   __a->__lock(_Sco{});
   __atomic_assign_volatile(&__temp, __a->__a_value);
-  bool __ret = __temp == *__expected;
+  bool __ret = 0 == __atomic_memcmp(&__temp, __expected, sizeof(_Tp));
   if (__ret)
   {
     __atomic_assign_volatile(&__a->__a_value, __value);
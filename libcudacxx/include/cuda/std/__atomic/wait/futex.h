@@ -0,0 +1,210 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___ATOMIC_WAIT_FUTEX_H
+#define _CUDA_STD___ATOMIC_WAIT_FUTEX_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+// Blocking host waits require the futex system call of Linux, every other host keeps polling with a backoff
+#if defined(__linux__) && !_CCCL_OS(ANDROID) && !_CCCL_COMPILER(NVRTC) && !defined(CCCL_DISABLE_ATOMIC_HOST_FUTEX)
+#  define _CCCL_HAS_ATOMIC_HOST_FUTEX() 1
+#else // ^^^ __linux__ ^^^ / vvv !__linux__ vvv
+#  define _CCCL_HAS_ATOMIC_HOST_FUTEX() 0
+#endif // !__linux__
+
+#if _CCCL_HAS_ATOMIC_HOST_FUTEX()
+
+#  include <cuda/std/__algorithm/min.h>
+#  include <cuda/std/__atomic/functions/host.h>
+#  include <cuda/std/__atomic/order.h>
+#  include <cuda/std/__atomic/scopes.h>
+#  include <cuda/std/__atomic/types.h>
+#  include <cuda/std/__atomic/wait/polling.h>
+#  include <cuda/std/__type_traits/is_same.h>
+#  include <cuda/std/climits>
+#  include <cuda/std/cstddef>
+#  include <cuda/std/cstdint>
+#  include <cuda/std/cstring>
+
+#  include <linux/futex.h>
+#  include <sys/syscall.h>
+#  include <time.h>
+#  include <unistd.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+//! @brief An entry of the process wide table of host waiters, which the addresses that are waited on hash onto.
+//! Notifying an address whose entry has no waiters only costs a fence and a load instead of a system call.
+struct alignas(64) __atomic_host_wait_slot
+{
+  //! The number of threads blocked on any of the addresses of this entry
+  uint32_t __waiters_;
+  //! The futex word for atomics that cannot be waited on directly, bumped by every notification of such an atomic
+  uint32_t __version_;
+};
+
+inline constexpr size_t __atomic_host_wait_slot_count = 64;
+
+// Device threads and other processes cannot wake a host futex, so waits on system scope atomics time out after at
+// most that many milliseconds to observe their updates, starting at the longest sleep of the polling fallback.
+inline constexpr long __atomic_host_wait_min_timeout_ms = 1;
+inline constexpr long __atomic_host_wait_max_timeout_ms = 16;
+
+//! @brief Returns the entry of @p __address. The table has default visibility so that all shared objects of a
+//! process share it, otherwise a notification from one library could miss the waiters of another one.
+[[nodiscard]] _CCCL_HOST _CCCL_VISIBILITY_DEFAULT inline __atomic_host_wait_slot&
+__atomic_host_wait_slot_for(const volatile void* __address) noexcept
+{
+  static __atomic_host_wait_slot __slots[__atomic_host_wait_slot_count]{};
+  const auto __key = reinterpret_cast<uintptr_t>(__address);
+  return __slots[((__key >> 2) ^ (__key >> 12)) % __atomic_host_wait_slot_count];
+}
+
+//! @brief Atomics that hold exactly one 32 bit word are futex words themselves, all others wait on the version of
+//! their entry in the table of waiters
+template <typename _Tp>
+inline constexpr bool __atomic_host_wait_is_direct =
+  _Tp::__tag == __atomic_tag::__atomic_base_tag && sizeof(__atomic_underlying_remove_cv_t<_Tp>) == sizeof(uint32_t);
+
+//! @brief Returns the address of the value of @p __a, which is the same for all atomic references to an object
+template <typename _Tp>
+[[nodiscard]] _CCCL_HOST_API const volatile void* __atomic_host_wait_address(_Tp const volatile* __a) noexcept
+{
+  if constexpr (_Tp::__tag == __atomic_tag::__atomic_base_tag)
+  {
+    return __a->get();
+  }
+  else
+  {
+    return __a;
+  }
+}
+
+//! @brief Only waits on system scope atomics time out, since only those can be updated without a host notification
+template <typename _Sco>
+inline constexpr bool __atomic_host_wait_is_timed = is_same_v<_Sco, __thread_scope_system_tag>;
+
+// The kernel keys process private and shared futexes differently, so a waiter never sees a wake up of the other kind.
+// Atomics of any scope may refer to the same object, thus atomics wait on shared futexes regardless of their scope,
+// which also reach the waiters of other processes. Only the version of the table of waiters is process private.
+_CCCL_HOST_API inline void __atomic_host_futex_wait(
+  const volatile void* __address, const uint32_t __expected, const bool __shared, const ::timespec* __timeout) noexcept
+{
+  ::syscall(SYS_futex,
+            const_cast<void*>(__address),
+            __shared ? FUTEX_WAIT : FUTEX_WAIT_PRIVATE,
+            __expected,
+            __timeout,
+            nullptr,
+            0);
+}
+
+_CCCL_HOST_API inline void
+__atomic_host_futex_wake(const volatile void* __address, const int __count, const bool __shared) noexcept
+{
+  ::syscall(
+    SYS_futex, const_cast<void*>(__address), __shared ? FUTEX_WAKE : FUTEX_WAKE_PRIVATE, __count, nullptr, nullptr, 0);
+}
+
+//! @brief Blocks the calling thread until the value of @p __a differs from @p __val
+template <typename _Tp, typename _Sco>
+_CCCL_HOST_API void __atomic_try_wait_slow_futex(
+  _Tp const volatile* __a, __atomic_underlying_remove_cv_t<_Tp> __val, memory_order __order, _Sco)
+{
+  const auto __changed = [&] {
+    return !::cuda::std::__nonatomic_compare_equal(__atomic_load_dispatch(__a, __order, _Sco{}), __val);
+  };
+
+  constexpr bool __timed = __atomic_host_wait_is_timed<_Sco>;
+  long __timeout_ms      = __atomic_host_wait_min_timeout_ms;
+  ::timespec __timeout{};
+
+  const volatile void* __address  = ::cuda::std::__atomic_host_wait_address(__a);
+  __atomic_host_wait_slot& __slot = ::cuda::std::__atomic_host_wait_slot_for(__address);
+  // Pairs with the fence in __atomic_notify_futex: either the notifier sees this waiter, or the waiter sees the value
+  // stored before the notification
+  ::cuda::std::__atomic_fetch_add_host(&__slot.__waiters_, 1u, memory_order_seq_cst);
+  ::cuda::std::__atomic_thread_fence_host(memory_order_seq_cst);
+  while (true)
+  {
+    if constexpr (__timed)
+    {
+      __timeout.tv_sec  = __timeout_ms / 1000;
+      __timeout.tv_nsec = (__timeout_ms % 1000) * 1000000;
+      __timeout_ms      = (::cuda::std::min) (2 * __timeout_ms, __atomic_host_wait_max_timeout_ms);
+    }
+
+    if constexpr (__atomic_host_wait_is_direct<_Tp>)
+    {
+      if (__changed())
+      {
+        break;
+      }
+      // The kernel compares the futex word with the expected value, so that a store in between is never missed
+      uint32_t __expected;
+      ::cuda::std::memcpy(&__expected, &__val, sizeof(uint32_t));
+      ::cuda::std::__atomic_host_futex_wait(__address, __expected, true, __timed ? &__timeout : nullptr);
+    }
+    else
+    {
+      // The version is read before the value, so that a notification after the comparison changes the version
+      const uint32_t __version = ::cuda::std::__atomic_load_host(&__slot.__version_, memory_order_acquire);
+      if (__changed())
+      {
+        break;
+      }
+      ::cuda::std::__atomic_host_futex_wait(&__slot.__version_, __version, false, __timed ? &__timeout : nullptr);
+    }
+  }
+  ::cuda::std::__atomic_fetch_sub_host(&__slot.__waiters_, 1u, memory_order_release);
+}
+
+//! @brief Wakes one or all threads blocked on @p __a, does not enter the kernel if no thread waits on its entry
+template <typename _Tp, typename _Sco>
+_CCCL_HOST_API void __atomic_notify_futex(_Tp const volatile* __a, const bool __all, _Sco)
+{
+  const volatile void* __address  = ::cuda::std::__atomic_host_wait_address(__a);
+  __atomic_host_wait_slot& __slot = ::cuda::std::__atomic_host_wait_slot_for(__address);
+  ::cuda::std::__atomic_thread_fence_host(memory_order_seq_cst);
+  if (::cuda::std::__atomic_load_host(&__slot.__waiters_, memory_order_relaxed) == 0)
+  {
+    return;
+  }
+
+  if constexpr (__atomic_host_wait_is_direct<_Tp>)
+  {
+    ::cuda::std::__atomic_host_futex_wake(__address, __all ? INT_MAX : 1, true);
+  }
+  else
+  {
+    // Other atomics of the same entry wait on the same version, so a single wake up could pick the wrong thread
+    ::cuda::std::__atomic_fetch_add_host(&__slot.__version_, 1u, memory_order_seq_cst);
+    ::cuda::std::__atomic_host_futex_wake(&__slot.__version_, INT_MAX, false);
+  }
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_ATOMIC_HOST_FUTEX()
+
+#endif // _CUDA_STD___ATOMIC_WAIT_FUTEX_H
@@ -23,8 +23,8 @@
 
 #include <cuda/std/__atomic/order.h>
 #include <cuda/std/__atomic/scopes.h>
+#include <cuda/std/__atomic/wait/futex.h>
 #include <cuda/std/__atomic/wait/polling.h>
-#include <cuda/std/cstring>
 
 #include <cuda/std/__cccl/prologue.h>
 
@@ -36,51 +36,48 @@ template <typename _Tp, typename _Sco>
 _CCCL_HOST_DEVICE_API inline void
 __atomic_try_wait_slow(_Tp const volatile* __a, __atomic_underlying_remove_cv_t<_Tp> __val, memory_order __order, _Sco)
 {
+#if _CCCL_HAS_ATOMIC_HOST_FUTEX()
+  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, __atomic_try_wait_slow_fallback(__a, __val, __order, _Sco{});
+                     , NV_IS_HOST, __atomic_try_wait_slow_futex(__a, __val, __order, _Sco{});
+                     , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
+#else // ^^^ _CCCL_HAS_ATOMIC_HOST_FUTEX() ^^^ / vvv !_CCCL_HAS_ATOMIC_HOST_FUTEX() vvv
   NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, __atomic_try_wait_slow_fallback(__a, __val, __order, _Sco{});
                      , NV_IS_HOST, __atomic_try_wait_slow_fallback(__a, __val, __order, _Sco{});
                      , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
+#endif // ^^^ !_CCCL_HAS_ATOMIC_HOST_FUTEX() ^^^
 }
 
 template <typename _Tp, typename _Sco>
-_CCCL_HOST_DEVICE_API inline void __atomic_notify_one(_Tp const volatile*, _Sco)
+_CCCL_HOST_DEVICE_API inline void __atomic_notify_one([[maybe_unused]] _Tp const volatile* __a, _Sco)
 {
+#if _CCCL_HAS_ATOMIC_HOST_FUTEX()
+  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, , NV_IS_HOST, __atomic_notify_futex(__a, false, _Sco{});
+                     , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
+#else // ^^^ _CCCL_HAS_ATOMIC_HOST_FUTEX() ^^^ / vvv !_CCCL_HAS_ATOMIC_HOST_FUTEX() vvv
   NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, , NV_IS_HOST, , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
+#endif // ^^^ !_CCCL_HAS_ATOMIC_HOST_FUTEX() ^^^
 }
 
 template <typename _Tp, typename _Sco>
-_CCCL_HOST_DEVICE_API inline void __atomic_notify_all(_Tp const volatile*, _Sco)
+_CCCL_HOST_DEVICE_API inline void __atomic_notify_all([[maybe_unused]] _Tp const volatile* __a, _Sco)
 {
+#if _CCCL_HAS_ATOMIC_HOST_FUTEX()
+  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, , NV_IS_HOST, __atomic_notify_futex(__a, true, _Sco{});
+                     , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
+#else // ^^^ _CCCL_HAS_ATOMIC_HOST_FUTEX() ^^^ / vvv !_CCCL_HAS_ATOMIC_HOST_FUTEX() vvv
   NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, , NV_IS_HOST, , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
-}
-
-template <typename _Tp>
-_CCCL_HOST_DEVICE_API inline bool __nonatomic_compare_equal(_Tp const& __lhs, _Tp const& __rhs)
-{
-#if _CCCL_CUDA_COMPILATION()
-  return __lhs == __rhs;
-#else // ^^^ _CCCL_CUDA_COMPILATION() ^^^ / vvv !_CCCL_CUDA_COMPILATION() vvv
-  return ::cuda::std::memcmp(&__lhs, &__rhs, sizeof(_Tp)) == 0;
-#endif // ^^^ !_CCCL_CUDA_COMPILATION() ^^^
+#endif // ^^^ !_CCCL_HAS_ATOMIC_HOST_FUTEX() ^^^
 }
 
 template <typename _Tp, typename _Sco>
 _CCCL_HOST_DEVICE_API inline void __atomic_wait(
   _Tp const volatile* __a, __atomic_underlying_remove_cv_t<_Tp> const __val, memory_order __order, _Sco = {})
 {
-  for (int __i = 0; __i < _LIBCUDACXX_POLLING_COUNT; ++__i)
+  using __tester_t = __atomic_poll_tester<_Tp, _Sco>;
+  if (::cuda::std::__cccl_thread_spin_with_backoff(
+        __tester_t(__a, __val, __order), __cccl_adaptive_backoff<__tester_t>{}))
   {
-    if (!__nonatomic_compare_equal(__atomic_load_dispatch(__a, __order, _Sco{}), __val))
-    {
-      return;
-    }
-    if (__i < 12)
-    {
-      ::cuda::std::__cccl_thread_yield_processor();
-    }
-    else
-    {
-      ::cuda::std::__cccl_thread_yield();
-    }
+    return;
   }
   while (__nonatomic_compare_equal(__atomic_load_dispatch(__a, __order, _Sco{}), __val))
   {
@@ -25,11 +25,22 @@
 #include <cuda/std/__atomic/scopes.h>
 #include <cuda/std/__atomic/types.h>
 #include <cuda/std/__thread/threading_support.h>
+#include <cuda/std/cstring>
 
 #include <cuda/std/__cccl/prologue.h>
 
 _CCCL_BEGIN_NAMESPACE_CUDA_STD
 
+template <typename _Tp>
+_CCCL_HOST_DEVICE_API inline bool __nonatomic_compare_equal(_Tp const& __lhs, _Tp const& __rhs)
+{
+#if _CCCL_CUDA_COMPILATION()
+  return __lhs == __rhs;
+#else // ^^^ _CCCL_CUDA_COMPILATION() ^^^ / vvv !_CCCL_CUDA_COMPILATION() vvv
+  return ::cuda::std::memcmp(&__lhs, &__rhs, sizeof(_Tp)) == 0;
+#endif // ^^^ !_CCCL_CUDA_COMPILATION() ^^^
+}
+
 template <typename _Tp, typename _Sco>
 struct __atomic_poll_tester
 {
@@ -47,7 +58,7 @@ struct __atomic_poll_tester
 
   _CCCL_HOST_DEVICE_API bool operator()() const
   {
-    return !(__atomic_load_dispatch(__atom, __order, _Sco{}) == __val);
+    return !::cuda::std::__nonatomic_compare_equal(__atomic_load_dispatch(__atom, __order, _Sco{}), __val);
   }
 };
 
@@ -55,7 +66,11 @@ template <typename _Tp, typename _Sco>
 _CCCL_HOST_DEVICE_API void __atomic_try_wait_slow_fallback(
   _Tp const volatile* __a, __atomic_underlying_remove_cv_t<_Tp> __val, memory_order __order, _Sco)
 {
-  ::cuda::std::__cccl_thread_poll_with_backoff(__atomic_poll_tester<_Tp, _Sco>(__a, __val, __order));
+  // __atomic_wait already spun before it got here
+  ::cuda::std::__cccl_thread_poll_with_backoff(
+    __atomic_poll_tester<_Tp, _Sco>(__a, __val, __order),
+    ::cuda::std::chrono::nanoseconds::zero(),
+    __cccl_fixed_backoff{0});
 }
 
 _CCCL_END_NAMESPACE_CUDA_STD
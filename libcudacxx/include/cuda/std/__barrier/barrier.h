@@ -161,6 +161,20 @@ private:
     return __try_wait_phase(__parity ? __phase_bit : 0);
   }
 
+  // Every arrival changes the value, but only the one completing the phase notifies the waiters
+  _CCCL_HOST_API void __wait_phase(uint64_t __phase) const
+  {
+    while (true)
+    {
+      uint64_t const __current = __phase_arrived_expected.load(memory_order_acquire);
+      if ((__current & __phase_bit) != __phase)
+      {
+        return;
+      }
+      __phase_arrived_expected.wait(__current, memory_order_relaxed);
+    }
+  }
+
 public:
   _CCCL_HIDE_FROM_ABI __barrier_base() = default;
 
@@ -188,12 +202,17 @@ public:
   }
   _CCCL_HOST_DEVICE_API void wait(arrival_token&& __phase) const
   {
-    ::cuda::std::__cccl_thread_poll_with_backoff(
-      __barrier_poll_tester_phase<__barrier_base>(this, ::cuda::std::move(__phase)));
+    NV_IF_ELSE_TARGET(NV_IS_HOST,
+                      (__wait_phase(__phase & __phase_bit);),
+                      (::cuda::std::__cccl_thread_poll_with_backoff(
+                         __barrier_poll_tester_phase<__barrier_base>(this, ::cuda::std::move(__phase)));))
   }
   _CCCL_HOST_DEVICE_API void wait_parity(bool __parity) const
   {
-    ::cuda::std::__cccl_thread_poll_with_backoff(__barrier_poll_tester_parity<__barrier_base>(this, __parity));
+    NV_IF_ELSE_TARGET(
+      NV_IS_HOST,
+      (__wait_phase(__parity ? __phase_bit : 0);),
+      (::cuda::std::__cccl_thread_poll_with_backoff(__barrier_poll_tester_parity<__barrier_base>(this, __parity));))
   }
   _CCCL_HOST_DEVICE_API void arrive_and_wait()
   {
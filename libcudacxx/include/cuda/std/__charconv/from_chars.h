@@ -22,12 +22,14 @@
 
 #include <cuda/__cmath/neg.h>
 #include <cuda/__cmath/uabs.h>
+#include <cuda/std/__bit/countr.h>
 #include <cuda/std/__charconv/chars_format.h>
+#include <cuda/std/__charconv/from_chars_fp.h>
 #include <cuda/std/__charconv/from_chars_result.h>
 #include <cuda/std/__concepts/concept_macros.h>
 #include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__floating_point/format.h>
 #include <cuda/std/__limits/numeric_limits.h>
-#include <cuda/std/__type_traits/always_false.h>
 #include <cuda/std/__type_traits/conditional.h>
 #include <cuda/std/__type_traits/is_floating_point.h>
 #include <cuda/std/__type_traits/is_integer.h>
@@ -71,6 +73,10 @@ template <class _Tp>
 [[nodiscard]] _CCCL_API constexpr from_chars_result
 __from_chars_int_generic(const char* __first, const char* __last, _Tp& __value, int __base) noexcept
 {
+  // value * base + digit overflows when value is above max / base, or equal to it with a digit above max % base
+  const auto __max_quotient  = static_cast<_Tp>(numeric_limits<_Tp>::max() / static_cast<_Tp>(__base));
+  const auto __max_remainder = static_cast<int>(numeric_limits<_Tp>::max() % static_cast<_Tp>(__base));
+
   bool __overflow  = false;
   const char* __it = __first;
   for (; __it != __last; ++__it)
@@ -82,17 +88,126 @@ __from_chars_int_generic(const char* __first, const char* __last, _Tp& __value,
     }
     if (!__overflow)
     {
-      const auto __new_value = static_cast<_Tp>(__value * _Tp(__base) + _Tp(__digit.__value_));
-      if (__new_value < __value)
+      if (__value > __max_quotient || (__value == __max_quotient && __digit.__value_ > __max_remainder))
       {
         __overflow = true;
       }
-      __value = __new_value;
+      __value = static_cast<_Tp>(__value * _Tp(__base) + _Tp(__digit.__value_));
     }
   }
   return {__it, (__overflow) ? errc::result_out_of_range : ((__it == __first) ? errc::invalid_argument : errc{})};
 }
 
+// The 8 characters at __p packed in an integer, the first one in the lowest byte
+[[nodiscard]] _CCCL_API constexpr uint64_t __from_chars_load_eight_chars(const char* __p) noexcept
+{
+  using _Up = unsigned char;
+  return uint64_t{_Up(__p[0])} | (uint64_t{_Up(__p[1])} << 8) | (uint64_t{_Up(__p[2])} << 16)
+       | (uint64_t{_Up(__p[3])} << 24) | (uint64_t{_Up(__p[4])} << 32) | (uint64_t{_Up(__p[5])} << 40)
+       | (uint64_t{_Up(__p[6])} << 48) | (uint64_t{_Up(__p[7])} << 56);
+}
+
+// The number of decimal digits at the start of the 8 packed characters, found without a branch per character
+[[nodiscard]] _CCCL_API constexpr int __from_chars_count_eight_digits(uint64_t __v) noexcept
+{
+  // The non zero bytes are the characters whose high nibble is not 3, or whose low nibble carries when adding 6
+  const uint64_t __x = ((__v & 0xF0F0F0F0F0F0F0F0) ^ 0x3030303030303030)
+                     | (((__v & 0x0F0F0F0F0F0F0F0F) + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0);
+  const uint64_t __non_digits = (((__x & 0x7F7F7F7F7F7F7F7F) + 0x7F7F7F7F7F7F7F7F) | __x) & 0x8080808080808080;
+  return (__non_digits == 0) ? 8 : ::cuda::std::countr_zero(__non_digits) / 8;
+}
+
+// The value of 8 packed decimal digits, combining pairs of digits, then of 2 digit numbers, then of 4 digit numbers
+[[nodiscard]] _CCCL_API constexpr uint32_t __from_chars_parse_eight_digits(uint64_t __v) noexcept
+{
+  __v = ((__v & 0x0F0F0F0F0F0F0F0F) * (10 * 256 + 1)) >> 8;
+  __v = ((__v & 0x00FF00FF00FF00FF) * (100 * 65536 + 1)) >> 16;
+  return static_cast<uint32_t>(((__v & 0x0000FFFF0000FFFF) * (10000 * 4294967296 + 1)) >> 32);
+}
+
+_CCCL_GLOBAL_CONSTANT uint32_t __from_chars_pow10_32[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000};
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr from_chars_result
+__from_chars_int_base10_result(const char* __it, uint64_t __result, _Tp& __value) noexcept
+{
+  if (__result > numeric_limits<_Tp>::max())
+  {
+    return {__it, errc::result_out_of_range};
+  }
+  __value = static_cast<_Tp>(__result);
+  return {__it, errc{}};
+}
+
+// The decimal parsing of the integers of at most 64 bits, up to 8 digits at a time for the first 19 digits that cannot
+// overflow 64 bits
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr from_chars_result
+__from_chars_int_base10(const char* __first, const char* __last, _Tp& __value) noexcept
+{
+  constexpr int __max_digits = 19;
+
+  uint64_t __result = 0;
+  const char* __it  = __first;
+  while (__last - __it >= 8 && __it - __first <= __max_digits - 8)
+  {
+    // The n leading digits are moved to the top of the chunk, so that the zero bytes shifted in are leading zeros
+    const uint64_t __chars = ::cuda::std::__from_chars_load_eight_chars(__it);
+    const int __n          = ::cuda::std::__from_chars_count_eight_digits(__chars);
+    if (__n == 0)
+    {
+      break;
+    }
+    __result = __result * __from_chars_pow10_32[__n]
+             + ::cuda::std::__from_chars_parse_eight_digits(__chars << (64 - 8 * __n));
+    __it += __n;
+    if (__n < 8)
+    {
+      // The digits end inside the chunk, which is the usual case of the numbers of less than 8 digits
+      return ::cuda::std::__from_chars_int_base10_result(__it, __result, __value);
+    }
+  }
+  for (; __it != __last && __it - __first < __max_digits && '0' <= *__it && *__it <= '9'; ++__it)
+  {
+    __result = __result * 10 + static_cast<uint64_t>(*__it - '0');
+  }
+  if (__it == __first)
+  {
+    return {__first, errc::invalid_argument};
+  }
+
+  // The remaining digits, which overflow unless they follow leading zeros
+  constexpr uint64_t __max_quotient  = numeric_limits<uint64_t>::max() / 10;
+  constexpr uint64_t __max_remainder = numeric_limits<uint64_t>::max() % 10;
+
+  bool __overflow = false;
+  for (; __it != __last && '0' <= *__it && *__it <= '9'; ++__it)
+  {
+    const auto __digit = static_cast<uint64_t>(*__it - '0');
+    __overflow = __overflow || __result > __max_quotient || (__result == __max_quotient && __digit > __max_remainder);
+    __result   = __result * 10 + __digit;
+  }
+  if (__overflow)
+  {
+    return {__it, errc::result_out_of_range};
+  }
+  return ::cuda::std::__from_chars_int_base10_result(__it, __result, __value);
+}
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr from_chars_result
+__from_chars_int(const char* __first, const char* __last, _Tp& __value, int __base) noexcept
+{
+  if constexpr (sizeof(_Tp) <= sizeof(uint64_t))
+  {
+    if (__base == 10)
+    {
+      return ::cuda::std::__from_chars_int_base10(__first, __last, __value);
+    }
+  }
+  return ::cuda::std::__from_chars_int_generic(__first, __last, __value, __base);
+}
+
 _CCCL_TEMPLATE(class _Tp)
 _CCCL_REQUIRES(__cccl_is_integer_v<_Tp>)
 [[nodiscard]] _CCCL_API constexpr from_chars_result
@@ -107,7 +222,7 @@ from_chars(const char* __first, const char* __last, _Tp& __value, int __base = 1
   if constexpr (is_signed_v<_Tp>)
   {
     bool __neg = (__first < __last && *__first == '-');
-    __ret      = ::cuda::std::__from_chars_int_generic(__first + __neg, __last, __result, __base);
+    __ret      = ::cuda::std::__from_chars_int(__first + __neg, __last, __result, __base);
     if (__ret.ec == errc{})
     {
       const auto __max = ::cuda::uabs((__neg) ? numeric_limits<_Tp>::min() : numeric_limits<_Tp>::max());
@@ -123,7 +238,7 @@ from_chars(const char* __first, const char* __last, _Tp& __value, int __base = 1
   }
   else
   {
-    __ret = ::cuda::std::__from_chars_int_generic(__first, __last, __result, __base);
+    __ret = ::cuda::std::__from_chars_int(__first, __last, __result, __base);
   }
 
   if (__ret.ec == errc{})
@@ -150,18 +265,24 @@ from_chars(const char* __first, const char* __last, char& __value, int __base =
   return __ret;
 }
 
+template <class _Tp>
+inline constexpr bool __from_chars_fp_is_supported_v =
+  is_same_v<_Tp, float> || is_same_v<_Tp, double> || __fp_format_of_v<_Tp> == __fp_format::__binary64;
+
 _CCCL_TEMPLATE(class _Tp)
 _CCCL_REQUIRES(is_floating_point_v<_Tp>)
 [[nodiscard]] _CCCL_API constexpr from_chars_result
 from_chars(const char* __first, const char* __last, _Tp& __value, chars_format __fmt = chars_format::general) noexcept
 {
-  static_assert(::cuda::std::__always_false_v<_Tp>,
-                "cuda::std::from_chars for floating point types is not yet implemented");
-  (void) __first;
-  (void) __last;
-  (void) __value;
-  (void) __fmt;
-  return {};
+  static_assert(__from_chars_fp_is_supported_v<_Tp>, "cuda::std::from_chars for long double is not yet implemented");
+  using _Up = conditional_t<is_same_v<_Tp, float>, float, double>;
+  _Up __value_tmp{};
+  const auto __ret = ::cuda::std::__from_chars_fp(__first, __last, __value_tmp, __fmt);
+  if (__ret.ec == errc{})
+  {
+    __value = static_cast<_Tp>(__value_tmp);
+  }
+  return __ret;
 }
 
 _CCCL_END_NAMESPACE_CUDA_STD
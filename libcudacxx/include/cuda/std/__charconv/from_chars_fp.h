@@ -0,0 +1,848 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___CHARCONV_FROM_CHARS_FP_H
+#define _CUDA_STD___CHARCONV_FROM_CHARS_FP_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__cmath/mul_hi.h>
+#include <cuda/std/__bit/countl.h>
+#include <cuda/std/__charconv/chars_format.h>
+#include <cuda/std/__charconv/from_chars_fp_tables.h>
+#include <cuda/std/__charconv/from_chars_result.h>
+#include <cuda/std/__floating_point/format.h>
+#include <cuda/std/__floating_point/properties.h>
+#include <cuda/std/__floating_point/storage.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+// The floating point from_chars of float and double. The decimal values with at most 19 significant digits are
+// converted with the Eisel-Lemire algorithm of Daniel Lemire, which multiplies them by a 128 bit approximation of a
+// power of 5 and is exact for them. The rare longer inputs that it cannot decide fall back to the simple decimal
+// conversion of Nigel Tao, which shifts the decimal digits by powers of 2. Both use integers only, so the results are
+// correctly rounded on the host and on the device whatever the floating point compilation flags.
+
+template <class _Tp>
+inline constexpr int __from_chars_fp_mant_nbits_v = __fp_mant_nbits_v<__fp_format_of_v<_Tp>>;
+
+template <class _Tp>
+inline constexpr int __from_chars_fp_exp_bias_v = __fp_exp_bias_v<__fp_format_of_v<_Tp>>;
+
+// The biased exponent of infinity and NaN
+template <class _Tp>
+inline constexpr int __from_chars_fp_inf_exponent_v = (1 << __fp_exp_nbits_v<__fp_format_of_v<_Tp>>) - 1;
+
+// The value of a floating point number given by its stored mantissa and biased exponent
+struct __from_chars_fp_binary
+{
+  uint64_t __mantissa_;
+  int __exponent_;
+
+  [[nodiscard]] _CCCL_API friend constexpr bool
+  operator==(const __from_chars_fp_binary& __lhs, const __from_chars_fp_binary& __rhs) noexcept
+  {
+    return __lhs.__mantissa_ == __rhs.__mantissa_ && __lhs.__exponent_ == __rhs.__exponent_;
+  }
+};
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr _Tp __from_chars_fp_make(bool __negative, __from_chars_fp_binary __b) noexcept
+{
+  constexpr int __mant_nbits = __from_chars_fp_mant_nbits_v<_Tp>;
+  constexpr int __sign_bit   = __mant_nbits + __fp_exp_nbits_v<__fp_format_of_v<_Tp>>;
+
+  // The mantissa of a subnormal value rounded up to the smallest normal one has the lowest bit of the exponent set
+  const uint64_t __storage = __b.__mantissa_ | (static_cast<uint64_t>(__b.__exponent_) << __mant_nbits)
+                           | (static_cast<uint64_t>(__negative) << __sign_bit);
+  return ::cuda::std::__fp_from_storage<_Tp>(static_cast<__fp_storage_of_t<_Tp>>(__storage));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Eisel-Lemire
+
+// The powers of 10 below and above which every decimal value of at most 19 digits rounds to 0 and to infinity
+template <class _Tp>
+inline constexpr int __from_chars_fp_min_pow10_v = is_same_v<_Tp, float> ? -65 : -342;
+
+template <class _Tp>
+inline constexpr int __from_chars_fp_max_pow10_v = is_same_v<_Tp, float> ? 38 : 308;
+
+// The powers of 10 for which w 10^q can be exactly halfway between two floating point numbers
+template <class _Tp>
+inline constexpr int __from_chars_fp_min_pow10_tie_v = is_same_v<_Tp, float> ? -17 : -4;
+
+template <class _Tp>
+inline constexpr int __from_chars_fp_max_pow10_tie_v = is_same_v<_Tp, float> ? 10 : 23;
+
+// The nearest floating point number to w 10^q, for a non zero w
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr __from_chars_fp_binary
+__from_chars_fp_eisel_lemire(uint64_t __w, int64_t __q) noexcept
+{
+  constexpr int __mant_nbits     = __from_chars_fp_mant_nbits_v<_Tp>;
+  constexpr int __inf_exponent   = __from_chars_fp_inf_exponent_v<_Tp>;
+  constexpr uint64_t __hidden    = uint64_t{1} << __mant_nbits;
+  constexpr uint64_t __prec_mask = ~uint64_t{0} >> (__mant_nbits + 3);
+
+  if (__q < __from_chars_fp_min_pow10_v<_Tp>)
+  {
+    return {0, 0};
+  }
+  if (__q > __from_chars_fp_max_pow10_v<_Tp>)
+  {
+    return {0, __inf_exponent};
+  }
+
+  const int __lz = ::cuda::std::countl_zero(__w);
+  __w <<= __lz;
+
+  // The high bits of w 5^q, with the next 64 bits of 5^q only when the bits that matter may be affected by them
+  const uint64_t* __pow5 = __from_chars_fp_pow5_128[__q - __from_chars_fp_min_pow10_v<double>];
+  uint64_t __low         = __w * __pow5[1];
+  uint64_t __high        = ::cuda::mul_hi(__w, __pow5[1]);
+  if ((__high & __prec_mask) == __prec_mask)
+  {
+    const uint64_t __next_high = ::cuda::mul_hi(__w, __pow5[0]);
+    __low += __next_high;
+    __high += __next_high > __low;
+  }
+
+  const int __upper_bit = static_cast<int>(__high >> 63);
+  const int __shift     = __upper_bit + 64 - __mant_nbits - 3;
+  uint64_t __mantissa   = __high >> __shift;
+  // floor(log2(10^q)) + 63, then the bias
+  int __exponent = static_cast<int>(((152170 + 65536) * __q) >> 16) + 63 + __upper_bit - __lz
+                 + __from_chars_fp_exp_bias_v<_Tp>;
+
+  if (__exponent <= 0)
+  {
+    // Subnormal, rounded half up since w 10^q is never halfway between two subnormal numbers
+    if (-__exponent + 1 >= 64)
+    {
+      return {0, 0};
+    }
+    __mantissa >>= -__exponent + 1;
+    __mantissa += __mantissa & 1;
+    __mantissa >>= 1;
+    return {__mantissa, __mantissa < __hidden ? 0 : 1};
+  }
+
+  // The mantissa has 2 more bits than needed and rounds half up, unless w 10^q is exactly halfway, which rounds to even
+  if (__low <= 1 && __q >= __from_chars_fp_min_pow10_tie_v<_Tp> && __q <= __from_chars_fp_max_pow10_tie_v<_Tp>
+      && (__mantissa & 3) == 1 && (__mantissa << __shift) == __high)
+  {
+    __mantissa &= ~uint64_t{1};
+  }
+  __mantissa += __mantissa & 1;
+  __mantissa >>= 1;
+  if (__mantissa >= (__hidden << 1))
+  {
+    __mantissa = __hidden;
+    ++__exponent;
+  }
+  __mantissa &= ~__hidden;
+  if (__exponent >= __inf_exponent)
+  {
+    return {0, __inf_exponent};
+  }
+  return {__mantissa, __exponent};
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// simple decimal conversion
+
+// A decimal number 0.d1d2d3... 10^dp with up to 800 significant digits, enough for the digits that may decide the
+// rounding of a double, that is shifted by powers of 2 until its integer part is the mantissa
+class __from_chars_fp_decimal
+{
+  static constexpr int __max_digits = 800;
+  // The largest shift, for which 5^k fits in 64 bits
+  static constexpr int __max_shift = 27;
+
+  uint8_t __digits_[__max_digits];
+  int __count_;
+  int __dp_;
+  bool __truncated_; // whether non zero digits were dropped after the last one
+
+  _CCCL_API constexpr void __trim() noexcept
+  {
+    while (__count_ > 0 && __digits_[__count_ - 1] == 0)
+    {
+      --__count_;
+    }
+    if (__count_ == 0)
+    {
+      __dp_ = 0;
+    }
+  }
+
+  // Whether the digits are less than the ones of 5^k
+  [[nodiscard]] _CCCL_API constexpr bool __less_than_pow5(int __k) const noexcept
+  {
+    uint64_t __pow5 = 1;
+    for (int __i = 0; __i < __k; ++__i)
+    {
+      __pow5 *= 5;
+    }
+    uint8_t __pow5_digits[20]{};
+    int __n = 0;
+    for (uint64_t __v = __pow5; __v != 0; __v /= 10)
+    {
+      ++__n;
+    }
+    for (int __i = __n - 1; __i >= 0; --__i, __pow5 /= 10)
+    {
+      __pow5_digits[__i] = static_cast<uint8_t>(__pow5 % 10);
+    }
+    for (int __i = 0; __i < __n; ++__i)
+    {
+      if (__i >= __count_)
+      {
+        return true;
+      }
+      if (__digits_[__i] != __pow5_digits[__i])
+      {
+        return __digits_[__i] < __pow5_digits[__i];
+      }
+    }
+    return false;
+  }
+
+  // Multiplies the number by 2^k
+  _CCCL_API constexpr void __left_shift(int __k) noexcept
+  {
+    // The number of new digits is the one of 2^k, or one less if the digits are less than the ones of 5^k
+    int __delta = 0;
+    for (uint64_t __pow2 = uint64_t{1} << __k; __pow2 != 0; __pow2 /= 10)
+    {
+      ++__delta;
+    }
+    __delta -= __less_than_pow5(__k);
+
+    int __read  = __count_;
+    int __write = __count_ + __delta;
+    uint64_t __n = 0;
+    for (--__read; __read >= 0; --__read)
+    {
+      __n += uint64_t{__digits_[__read]} << __k;
+      const uint64_t __quotient = __n / 10;
+      const uint64_t __rest     = __n - 10 * __quotient;
+      if (--__write < __max_digits)
+      {
+        __digits_[__write] = static_cast<uint8_t>(__rest);
+      }
+      else if (__rest != 0)
+      {
+        __truncated_ = true;
+      }
+      __n = __quotient;
+    }
+    while (__n > 0)
+    {
+      const uint64_t __quotient = __n / 10;
+      const uint64_t __rest     = __n - 10 * __quotient;
+      if (--__write < __max_digits)
+      {
+        __digits_[__write] = static_cast<uint8_t>(__rest);
+      }
+      else if (__rest != 0)
+      {
+        __truncated_ = true;
+      }
+      __n = __quotient;
+    }
+    __count_ = __count_ + __delta < __max_digits ? __count_ + __delta : __max_digits;
+    __dp_ += __delta;
+    __trim();
+  }
+
+  // Divides the number by 2^k
+  _CCCL_API constexpr void __right_shift(int __k) noexcept
+  {
+    int __read       = 0;
+    int __write      = 0;
+    uint64_t __n     = 0;
+    const uint64_t __mask = (uint64_t{1} << __k) - 1;
+
+    // The leading digits that are not less than 2^k
+    for (; (__n >> __k) == 0; ++__read)
+    {
+      if (__read >= __count_)
+      {
+        if (__n == 0)
+        {
+          __count_ = 0;
+          return;
+        }
+        for (; (__n >> __k) == 0; ++__read)
+        {
+          __n *= 10;
+        }
+        break;
+      }
+      __n = __n * 10 + __digits_[__read];
+    }
+    __dp_ -= __read - 1;
+
+    for (; __read < __count_; ++__read)
+    {
+      __digits_[__write++] = static_cast<uint8_t>(__n >> __k);
+      __n                  = (__n & __mask) * 10 + __digits_[__read];
+    }
+    while (__n > 0)
+    {
+      const auto __digit = static_cast<uint8_t>(__n >> __k);
+      if (__write < __max_digits)
+      {
+        __digits_[__write++] = __digit;
+      }
+      else if (__digit > 0)
+      {
+        __truncated_ = true;
+      }
+      __n = (__n & __mask) * 10;
+    }
+    __count_ = __write;
+    __trim();
+  }
+
+  // Multiplies the number by 2^k, or divides it by 2^-k for a negative k
+  _CCCL_API constexpr void __shift(int __k) noexcept
+  {
+    if (__count_ == 0)
+    {
+      return;
+    }
+    for (; __k > __max_shift; __k -= __max_shift)
+    {
+      __left_shift(__max_shift);
+    }
+    for (; __k < -__max_shift; __k += __max_shift)
+    {
+      __right_shift(__max_shift);
+    }
+    if (__k > 0)
+    {
+      __left_shift(__k);
+    }
+    else if (__k < 0)
+    {
+      __right_shift(-__k);
+    }
+  }
+
+  // The integer part, rounded to nearest with ties to even
+  [[nodiscard]] _CCCL_API constexpr uint64_t __rounded_integer() const noexcept
+  {
+    uint64_t __n = 0;
+    int __i      = 0;
+    for (; __i < __dp_ && __i < __count_; ++__i)
+    {
+      __n = __n * 10 + __digits_[__i];
+    }
+    for (; __i < __dp_; ++__i)
+    {
+      __n *= 10;
+    }
+    if (__dp_ >= 0 && __dp_ < __count_)
+    {
+      // Trailing zeros are trimmed, so a 5 that is the last digit is exactly halfway
+      const bool __halfway = __digits_[__dp_] == 5 && __dp_ + 1 == __count_;
+      if (__halfway ? (__truncated_ || (__dp_ > 0 && __digits_[__dp_ - 1] % 2 != 0)) : __digits_[__dp_] >= 5)
+      {
+        ++__n;
+      }
+    }
+    return __n;
+  }
+
+public:
+  // The digits of [first, last), which holds decimal digits and at most one decimal point, times 10^exponent
+  _CCCL_API constexpr __from_chars_fp_decimal(const char* __first, const char* __last, int64_t __exponent) noexcept
+      : __digits_{}
+      , __count_{0}
+      , __dp_{0}
+      , __truncated_{false}
+  {
+    bool __point = false;
+    for (; __first != __last; ++__first)
+    {
+      if (*__first == '.')
+      {
+        __point = true;
+        continue;
+      }
+      const auto __digit = static_cast<uint8_t>(*__first - '0');
+      if (__count_ == 0 && __digit == 0)
+      {
+        __dp_ -= __point;
+        continue;
+      }
+      __dp_ += !__point;
+      if (__count_ < __max_digits)
+      {
+        __digits_[__count_++] = __digit;
+      }
+      else if (__digit != 0)
+      {
+        __truncated_ = true;
+      }
+    }
+    __trim();
+    // Far beyond the range of double, the exponent only needs to stay far beyond it
+    if (__count_ != 0)
+    {
+      __exponent = __exponent < -100000 ? -100000 : __exponent > 100000 ? 100000 : __exponent;
+      __dp_ += static_cast<int>(__exponent);
+    }
+  }
+
+  // The nearest floating point number
+  template <class _Tp>
+  [[nodiscard]] _CCCL_API constexpr __from_chars_fp_binary __to_binary() noexcept
+  {
+    constexpr int __mant_nbits   = __from_chars_fp_mant_nbits_v<_Tp>;
+    constexpr int __bias         = __from_chars_fp_exp_bias_v<_Tp>;
+    constexpr int __inf_exponent = __from_chars_fp_inf_exponent_v<_Tp>;
+    // The shifts of a number with the decimal exponent dp that keep its integer part below 10
+    constexpr int __pow2_shifts[] = {1, 3, 6, 9, 13, 16, 19, 23, 26};
+
+    if (__count_ == 0 || __dp_ < -330)
+    {
+      return {0, 0};
+    }
+    if (__dp_ > 310)
+    {
+      return {0, __inf_exponent};
+    }
+
+    // Scales the number to [0.5, 1) times 2^exponent
+    int __exponent = 0;
+    while (__dp_ > 0)
+    {
+      const int __n = __dp_ >= 9 ? __max_shift : __pow2_shifts[__dp_];
+      __shift(-__n);
+      __exponent += __n;
+    }
+    while (__dp_ < 0 || (__dp_ == 0 && __digits_[0] < 5))
+    {
+      const int __n = -__dp_ >= 9 ? __max_shift : __pow2_shifts[-__dp_];
+      __shift(__n);
+      __exponent -= __n;
+    }
+
+    // The mantissa is in [1, 2), and subnormal numbers have the smallest exponent
+    --__exponent;
+    if (__exponent < 1 - __bias)
+    {
+      __shift(-(1 - __bias - __exponent));
+      __exponent = 1 - __bias;
+    }
+    if (__exponent + __bias >= __inf_exponent)
+    {
+      return {0, __inf_exponent};
+    }
+
+    __shift(1 + __mant_nbits);
+    uint64_t __mantissa = __rounded_integer();
+    if (__mantissa == uint64_t{2} << __mant_nbits)
+    {
+      __mantissa >>= 1;
+      if (++__exponent + __bias >= __inf_exponent)
+      {
+        return {0, __inf_exponent};
+      }
+    }
+    if ((__mantissa & (uint64_t{1} << __mant_nbits)) == 0)
+    {
+      return {__mantissa, 0};
+    }
+    return {__mantissa & ((uint64_t{1} << __mant_nbits) - 1), __exponent + __bias};
+  }
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+// parsing
+
+[[nodiscard]] _CCCL_API constexpr bool __from_chars_fp_is_digit(char __c) noexcept
+{
+  return __c >= '0' && __c <= '9';
+}
+
+[[nodiscard]] _CCCL_API constexpr int __from_chars_fp_hex_digit(char __c) noexcept
+{
+  if (__c >= '0' && __c <= '9')
+  {
+    return __c - '0';
+  }
+  if (__c >= 'a' && __c <= 'f')
+  {
+    return __c - 'a' + 10;
+  }
+  if (__c >= 'A' && __c <= 'F')
+  {
+    return __c - 'A' + 10;
+  }
+  return -1;
+}
+
+// Whether [first, last) starts with the lower case str, ignoring the case
+[[nodiscard]] _CCCL_API constexpr bool
+__from_chars_fp_starts_with(const char* __first, const char* __last, const char* __str) noexcept
+{
+  for (; *__str != '\0'; ++__first, ++__str)
+  {
+    if (__first == __last || (*__first != *__str && *__first != *__str - 'a' + 'A'))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// The exponent that follows e or p, with an optional sign, saturated far beyond the range of double. Returns first
+// if there is no digit.
+[[nodiscard]] _CCCL_API constexpr const char*
+__from_chars_fp_parse_exponent(const char* __first, const char* __last, int64_t& __exponent) noexcept
+{
+  const char* __p       = __first;
+  const bool __negative = __p != __last && *__p == '-';
+  if (__p != __last && (*__p == '-' || *__p == '+'))
+  {
+    ++__p;
+  }
+  if (__p == __last || !::cuda::std::__from_chars_fp_is_digit(*__p))
+  {
+    return __first;
+  }
+  int64_t __value = 0;
+  for (; __p != __last && ::cuda::std::__from_chars_fp_is_digit(*__p); ++__p)
+  {
+    if (__value < 1000000000)
+    {
+      __value = __value * 10 + (*__p - '0');
+    }
+  }
+  __exponent = __negative ? -__value : __value;
+  return __p;
+}
+
+// inf, infinity or nan with an optional (n-char-sequence), ignoring the case
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr from_chars_result
+__from_chars_fp_non_finite(const char* __first, const char* __last, bool __negative, _Tp& __value) noexcept
+{
+  constexpr int __inf_exponent = __from_chars_fp_inf_exponent_v<_Tp>;
+
+  if (::cuda::std::__from_chars_fp_starts_with(__first, __last, "inf"))
+  {
+    __value = ::cuda::std::__from_chars_fp_make<_Tp>(__negative, {0, __inf_exponent});
+    return {__first + (::cuda::std::__from_chars_fp_starts_with(__first, __last, "infinity") ? 8 : 3), errc{}};
+  }
+  if (::cuda::std::__from_chars_fp_starts_with(__first, __last, "nan"))
+  {
+    const char* __p = __first + 3;
+    if (__p != __last && *__p == '(')
+    {
+      const char* __q = __p + 1;
+      for (; __q != __last
+             && (::cuda::std::__from_chars_fp_is_digit(*__q) || (*__q >= 'a' && *__q <= 'z')
+                 || (*__q >= 'A' && *__q <= 'Z') || *__q == '_');
+           ++__q)
+      {
+      }
+      if (__q != __last && *__q == ')')
+      {
+        __p = __q + 1;
+      }
+    }
+    __value = ::cuda::std::__from_chars_fp_make<_Tp>(
+      __negative, {uint64_t{1} << (__from_chars_fp_mant_nbits_v<_Tp> - 1), __inf_exponent});
+    return {__p, errc{}};
+  }
+  return {__first, errc::invalid_argument};
+}
+
+// Stores the value unless it is out of range, that is infinite or 0 for a non zero input
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr from_chars_result __from_chars_fp_store(
+  const char* __ptr, bool __negative, __from_chars_fp_binary __b, bool __zero, _Tp& __value) noexcept
+{
+  if (__b.__exponent_ == __from_chars_fp_inf_exponent_v<_Tp> || (!__zero && __b == __from_chars_fp_binary{0, 0}))
+  {
+    return {__ptr, errc::result_out_of_range};
+  }
+  __value = ::cuda::std::__from_chars_fp_make<_Tp>(__negative, __b);
+  return {__ptr, errc{}};
+}
+
+// Digits with an optional decimal point and, depending on the format, an exponent
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr from_chars_result __from_chars_fp_decimal_value(
+  const char* __first, const char* __last, bool __negative, chars_format __fmt, _Tp& __value) noexcept
+{
+  constexpr int __max_digits = 19;
+
+  // The first 19 significant digits times 10^exponent, and whether the dropped digits are not all 0
+  uint64_t __w       = 0;
+  int __count        = 0;
+  int64_t __exponent = 0;
+  bool __truncated   = false;
+  bool __any_digit   = false;
+
+  const char* __p = __first;
+  for (; __p != __last && ::cuda::std::__from_chars_fp_is_digit(*__p); ++__p)
+  {
+    __any_digit = true;
+    const int __digit = *__p - '0';
+    if (__count == 0 && __digit == 0)
+    {
+      continue;
+    }
+    if (__count < __max_digits)
+    {
+      __w = __w * 10 + __digit;
+      ++__count;
+    }
+    else
+    {
+      ++__exponent;
+      __truncated |= __digit != 0;
+    }
+  }
+  if (__p != __last && *__p == '.')
+  {
+    for (++__p; __p != __last && ::cuda::std::__from_chars_fp_is_digit(*__p); ++__p)
+    {
+      __any_digit = true;
+      const int __digit = *__p - '0';
+      if (__count == 0 && __digit == 0)
+      {
+        --__exponent;
+        continue;
+      }
+      if (__count < __max_digits)
+      {
+        __w = __w * 10 + __digit;
+        ++__count;
+        --__exponent;
+      }
+      else
+      {
+        __truncated |= __digit != 0;
+      }
+    }
+  }
+  if (!__any_digit)
+  {
+    return {__first, errc::invalid_argument};
+  }
+  const char* const __digits_last = __p;
+
+  // The scientific format requires the exponent and the fixed format does not allow it
+  int64_t __explicit_exponent = 0;
+  if ((__fmt & chars_format::scientific) == chars_format::scientific && __p != __last && (*__p == 'e' || *__p == 'E'))
+  {
+    const char* __exponent_last = ::cuda::std::__from_chars_fp_parse_exponent(__p + 1, __last, __explicit_exponent);
+    __p                         = __exponent_last != __p + 1 ? __exponent_last : __p;
+  }
+  if (__fmt == chars_format::scientific && __p == __digits_last)
+  {
+    return {__first, errc::invalid_argument};
+  }
+
+  if (__w == 0)
+  {
+    return ::cuda::std::__from_chars_fp_store(__p, __negative, {0, 0}, true, __value);
+  }
+  __exponent += __explicit_exponent;
+
+  // With dropped digits, the value is between w 10^q and (w + 1) 10^q
+  auto __b = ::cuda::std::__from_chars_fp_eisel_lemire<_Tp>(__w, __exponent);
+  if (__truncated && !(__b == ::cuda::std::__from_chars_fp_eisel_lemire<_Tp>(__w + 1, __exponent)))
+  {
+    __from_chars_fp_decimal __decimal{__first, __digits_last, __explicit_exponent};
+    __b = __decimal.__to_binary<_Tp>();
+  }
+  return ::cuda::std::__from_chars_fp_store(__p, __negative, __b, false, __value);
+}
+
+// Hex digits with an optional point and an optional binary exponent, without 0x
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr from_chars_result
+__from_chars_fp_hex_value(const char* __first, const char* __last, bool __negative, _Tp& __value) noexcept
+{
+  constexpr int __mant_nbits   = __from_chars_fp_mant_nbits_v<_Tp>;
+  constexpr int __bias         = __from_chars_fp_exp_bias_v<_Tp>;
+  constexpr int __inf_exponent = __from_chars_fp_inf_exponent_v<_Tp>;
+  constexpr int __max_digits   = 16;
+
+  // The first 16 significant digits times 2^exponent, and whether the dropped digits are not all 0
+  uint64_t __m       = 0;
+  int __count        = 0;
+  int64_t __exponent = 0;
+  bool __truncated   = false;
+  bool __any_digit   = false;
+
+  const char* __p = __first;
+  for (; __p != __last && ::cuda::std::__from_chars_fp_hex_digit(*__p) >= 0; ++__p)
+  {
+    __any_digit = true;
+    const int __digit = ::cuda::std::__from_chars_fp_hex_digit(*__p);
+    if (__count == 0 && __digit == 0)
+    {
+      continue;
+    }
+    if (__count < __max_digits)
+    {
+      __m = __m * 16 + static_cast<uint64_t>(__digit);
+      ++__count;
+    }
+    else
+    {
+      __exponent += 4;
+      __truncated |= __digit != 0;
+    }
+  }
+  if (__p != __last && *__p == '.')
+  {
+    for (++__p; __p != __last && ::cuda::std::__from_chars_fp_hex_digit(*__p) >= 0; ++__p)
+    {
+      __any_digit = true;
+      const int __digit = ::cuda::std::__from_chars_fp_hex_digit(*__p);
+      if (__count == 0 && __digit == 0)
+      {
+        __exponent -= 4;
+        continue;
+      }
+      if (__count < __max_digits)
+      {
+        __m = __m * 16 + static_cast<uint64_t>(__digit);
+        ++__count;
+        __exponent -= 4;
+      }
+      else
+      {
+        __truncated |= __digit != 0;
+      }
+    }
+  }
+  if (!__any_digit)
+  {
+    return {__first, errc::invalid_argument};
+  }
+  if (__p != __last && (*__p == 'p' || *__p == 'P'))
+  {
+    int64_t __explicit_exponent = 0;
+    const char* __exponent_last = ::cuda::std::__from_chars_fp_parse_exponent(__p + 1, __last, __explicit_exponent);
+    if (__exponent_last != __p + 1)
+    {
+      __p = __exponent_last;
+      __exponent += __explicit_exponent;
+    }
+  }
+
+  if (__m == 0)
+  {
+    return ::cuda::std::__from_chars_fp_store(__p, __negative, {0, 0}, true, __value);
+  }
+
+  // m 2^exponent with the highest bit of m set, whose binary exponent is x
+  const int __lz = ::cuda::std::countl_zero(__m);
+  __m <<= __lz;
+  const int64_t __x = __exponent - __lz + 63;
+  if (__x > __bias)
+  {
+    return {__p, errc::result_out_of_range};
+  }
+  // The number of low bits of m that are dropped, more for the subnormal numbers
+  const int64_t __dropped = 63 - __mant_nbits + (__x < 1 - __bias ? 1 - __bias - __x : 0);
+  if (__dropped > 64)
+  {
+    return {__p, errc::result_out_of_range};
+  }
+
+  uint64_t __mantissa = __dropped == 64 ? 0 : __m >> __dropped;
+  const uint64_t __rest = __dropped == 64 ? __m : __m & ((uint64_t{1} << __dropped) - 1);
+  const uint64_t __half = uint64_t{1} << (__dropped - 1);
+  if (__rest > __half || (__rest == __half && (__truncated || (__mantissa & 1) != 0)))
+  {
+    ++__mantissa;
+  }
+
+  int __biased = __x < 1 - __bias ? 0 : static_cast<int>(__x) + __bias;
+  if (__biased == 0)
+  {
+    // A subnormal number rounded up to the smallest normal one has the lowest bit of the exponent set
+    return ::cuda::std::__from_chars_fp_store(__p, __negative, {__mantissa, 0}, false, __value);
+  }
+  if (__mantissa == uint64_t{2} << __mant_nbits)
+  {
+    __mantissa >>= 1;
+    ++__biased;
+  }
+  if (__biased >= __inf_exponent)
+  {
+    return {__p, errc::result_out_of_range};
+  }
+  return ::cuda::std::__from_chars_fp_store(
+    __p, __negative, {__mantissa & ((uint64_t{1} << __mant_nbits) - 1), __biased}, false, __value);
+}
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr from_chars_result
+__from_chars_fp(const char* __first, const char* __last, _Tp& __value, chars_format __fmt) noexcept
+{
+  _CCCL_ASSERT(__fmt == chars_format::scientific || __fmt == chars_format::fixed || __fmt == chars_format::general
+                 || __fmt == chars_format::hex,
+               "the format must be one of the values of chars_format");
+
+  const bool __negative = __first != __last && *__first == '-';
+  const char* __p       = __first + __negative;
+
+  from_chars_result __ret{};
+  if (__p != __last && (*__p == 'i' || *__p == 'I' || *__p == 'n' || *__p == 'N'))
+  {
+    __ret = ::cuda::std::__from_chars_fp_non_finite(__p, __last, __negative, __value);
+  }
+  else if (__fmt == chars_format::hex)
+  {
+    __ret = ::cuda::std::__from_chars_fp_hex_value(__p, __last, __negative, __value);
+  }
+  else
+  {
+    __ret = ::cuda::std::__from_chars_fp_decimal_value(__p, __last, __negative, __fmt, __value);
+  }
+
+  if (__ret.ec == errc::invalid_argument)
+  {
+    __ret.ptr = __first;
+  }
+  return __ret;
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___CHARCONV_FROM_CHARS_FP_H
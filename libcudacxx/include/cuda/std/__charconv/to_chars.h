@@ -26,10 +26,11 @@
 #include <cuda/__cmath/uabs.h>
 #include <cuda/std/__bit/countl.h>
 #include <cuda/std/__charconv/chars_format.h>
+#include <cuda/std/__charconv/to_chars_fp.h>
 #include <cuda/std/__charconv/to_chars_result.h>
 #include <cuda/std/__concepts/concept_macros.h>
 #include <cuda/std/__cstddef/types.h>
-#include <cuda/std/__type_traits/always_false.h>
+#include <cuda/std/__floating_point/format.h>
 #include <cuda/std/__type_traits/conditional.h>
 #include <cuda/std/__type_traits/is_floating_point.h>
 #include <cuda/std/__type_traits/is_integer.h>
@@ -103,9 +104,34 @@ template <int _Base, class _Tp>
     // If value == 0 still need one digit, so we always set the least significant bit.
     return ::cuda::ceil_div(__num_bits_v<_Tp> - ::cuda::std::countl_zero(static_cast<_Tp>(__v | 1)), __base_ilog2);
   }
+  else if constexpr (_Base == 10 && sizeof(_Tp) <= sizeof(uint64_t))
+  {
+    // Comparisons with the powers of 10 avoid the bit scan of ilog10, whose result register the host compilers may
+    // chain to the digits of the previous conversion
+    int __n = 1;
+    for (;; __v /= 10000, __n += 4)
+    {
+      if (__v < 10)
+      {
+        return __n;
+      }
+      if (__v < 100)
+      {
+        return __n + 1;
+      }
+      if (__v < 1000)
+      {
+        return __n + 2;
+      }
+      if (__v < 10000)
+      {
+        return __n + 3;
+      }
+    }
+  }
   else if constexpr (_Base == 10)
   {
-    return (__v > 1) ? ::cuda::ceil_ilog10(__v) : 1;
+    return (__v > 0) ? ::cuda::ilog10(__v) + 1 : 1;
   }
   else
   {
@@ -124,6 +150,87 @@ _CCCL_API constexpr void __to_chars_int_generic(char* __last, _Tp __value, int _
   } while (__value != 0);
 }
 
+// The decimal digits of the numbers from 0 to 99, two per number
+_CCCL_GLOBAL_CONSTANT char __to_chars_digit_pairs[] =
+  "0001020304050607080910111213141516171819"
+  "2021222324252627282930313233343536373839"
+  "4041424344454647484950515253545556575859"
+  "6061626364656667686970717273747576777879"
+  "8081828384858687888990919293949596979899";
+
+// Writes the last n decimal digits of the value, two per division
+_CCCL_API constexpr void __to_chars_int_base10_pairs(char* __last, uint64_t __value, int __n) noexcept
+{
+  for (; __n >= 2; __n -= 2)
+  {
+    const auto __i = static_cast<int>(__value % 100) * 2;
+    __value /= 100;
+    *--__last = __to_chars_digit_pairs[__i + 1];
+    *--__last = __to_chars_digit_pairs[__i];
+  }
+  if (__n == 1)
+  {
+    *--__last = static_cast<char>('0' + __value % 10);
+  }
+}
+
+// Writes the n decimal digits of the value
+template <class _Tp>
+_CCCL_API constexpr void __to_chars_int_base10(char* __last, _Tp __value, int __n) noexcept
+{
+  if constexpr (sizeof(_Tp) > sizeof(uint64_t))
+  {
+    // The 128 bit divisions are slow, so the value is split into chunks of 19 digits with 64 bit divisions
+    constexpr uint64_t __pow10_19 = 10000000000000000000ull;
+    for (; __n > 19; __n -= 19, __last -= 19)
+    {
+      ::cuda::std::__to_chars_int_base10_pairs(__last, static_cast<uint64_t>(__value % __pow10_19), 19);
+      __value /= __pow10_19;
+    }
+  }
+  if constexpr (sizeof(_Tp) <= sizeof(uint32_t))
+  {
+    for (; __n >= 2; __n -= 2)
+    {
+      const auto __i = static_cast<int>(static_cast<uint32_t>(__value) % 100) * 2;
+      __value        = static_cast<_Tp>(static_cast<uint32_t>(__value) / 100);
+      *--__last      = __to_chars_digit_pairs[__i + 1];
+      *--__last      = __to_chars_digit_pairs[__i];
+    }
+    if (__n == 1)
+    {
+      *--__last = static_cast<char>('0' + __value);
+    }
+  }
+  else
+  {
+    ::cuda::std::__to_chars_int_base10_pairs(__last, static_cast<uint64_t>(__value), __n);
+  }
+}
+
+// The conversion of an unsigned value in a base known at compile time, whose divisions become multiplications and
+// shifts
+template <int _Base, class _Tp>
+[[nodiscard]] _CCCL_API constexpr to_chars_result __to_chars_int(char* __first, char* __last, _Tp __value) noexcept
+{
+  const int __n = ::cuda::std::__to_chars_int_width<_Base>(__value);
+  if (__n > __last - __first)
+  {
+    return {__last, errc::value_too_large};
+  }
+
+  char* __new_last = __first + __n;
+  if constexpr (_Base == 10)
+  {
+    ::cuda::std::__to_chars_int_base10(__new_last, __value, __n);
+  }
+  else
+  {
+    ::cuda::std::__to_chars_int_generic(__new_last, __value, _Base);
+  }
+  return {__new_last, errc{}};
+}
+
 _CCCL_TEMPLATE(class _Tp)
 _CCCL_REQUIRES(__cccl_is_integer_v<_Tp>)
 [[nodiscard]] _CCCL_API constexpr to_chars_result
@@ -142,35 +249,26 @@ to_chars(char* __first, char* __last, _Tp __value, int __base = 10) noexcept
   }
   else
   {
-    const ptrdiff_t __cap = __last - __first;
-
-    int __n{};
     switch (__base)
     {
       case 2:
-        __n = ::cuda::std::__to_chars_int_width<2>(__value);
-        break;
+        return ::cuda::std::__to_chars_int<2>(__first, __last, __value);
       case 4:
-        __n = ::cuda::std::__to_chars_int_width<4>(__value);
-        break;
+        return ::cuda::std::__to_chars_int<4>(__first, __last, __value);
       case 8:
-        __n = ::cuda::std::__to_chars_int_width<8>(__value);
-        break;
+        return ::cuda::std::__to_chars_int<8>(__first, __last, __value);
       case 10:
-        __n = ::cuda::std::__to_chars_int_width<10>(__value);
-        break;
+        return ::cuda::std::__to_chars_int<10>(__first, __last, __value);
       case 16:
-        __n = ::cuda::std::__to_chars_int_width<16>(__value);
-        break;
+        return ::cuda::std::__to_chars_int<16>(__first, __last, __value);
       case 32:
-        __n = ::cuda::std::__to_chars_int_width<32>(__value);
-        break;
+        return ::cuda::std::__to_chars_int<32>(__first, __last, __value);
       default:
-        __n = ::cuda::std::__to_chars_int_width(__value, __base);
         break;
     }
 
-    if (__n > __cap)
+    const int __n = ::cuda::std::__to_chars_int_width(__value, __base);
+    if (__n > __last - __first)
     {
       return {__last, errc::value_too_large};
     }
@@ -198,16 +296,18 @@ to_chars(char* __first, char* __last, char __value, int __base = 10) noexcept
 
 _CCCL_API constexpr to_chars_result to_chars(char*, char*, bool, int = 10) noexcept = delete;
 
+// long double is supported where it has the format of double
+template <class _Tp>
+inline constexpr bool __to_chars_fp_is_supported_v =
+  is_same_v<_Tp, float> || is_same_v<_Tp, double> || __fp_format_of_v<_Tp> == __fp_format::__binary64;
+
 _CCCL_TEMPLATE(class _Tp)
 _CCCL_REQUIRES(is_floating_point_v<_Tp>)
 [[nodiscard]] _CCCL_API constexpr to_chars_result to_chars(char* __first, char* __last, _Tp __value) noexcept
 {
-  static_assert(::cuda::std::__always_false_v<_Tp>,
-                "cuda::std::to_chars for floating point types is not yet implemented");
-  (void) __first;
-  (void) __last;
-  (void) __value;
-  return {};
+  static_assert(__to_chars_fp_is_supported_v<_Tp>, "cuda::std::to_chars for long double is not yet implemented");
+  using _Up = conditional_t<is_same_v<_Tp, float>, float, double>;
+  return ::cuda::std::__to_chars_fp_shortest(__first, __last, static_cast<_Up>(__value), chars_format{});
 }
 
 _CCCL_TEMPLATE(class _Tp)
@@ -215,13 +315,9 @@ _CCCL_REQUIRES(is_floating_point_v<_Tp>)
 [[nodiscard]] _CCCL_API constexpr to_chars_result
 to_chars(char* __first, char* __last, _Tp __value, chars_format __fmt) noexcept
 {
-  static_assert(::cuda::std::__always_false_v<_Tp>,
-                "cuda::std::to_chars for floating point types is not yet implemented");
-  (void) __first;
-  (void) __last;
-  (void) __value;
-  (void) __fmt;
-  return {};
+  static_assert(__to_chars_fp_is_supported_v<_Tp>, "cuda::std::to_chars for long double is not yet implemented");
+  using _Up = conditional_t<is_same_v<_Tp, float>, float, double>;
+  return ::cuda::std::__to_chars_fp_shortest(__first, __last, static_cast<_Up>(__value), __fmt);
 }
 
 _CCCL_TEMPLATE(class _Tp)
@@ -229,14 +325,9 @@ _CCCL_REQUIRES(is_floating_point_v<_Tp>)
 [[nodiscard]] _CCCL_API constexpr to_chars_result
 to_chars(char* __first, char* __last, _Tp __value, chars_format __fmt, int __prec) noexcept
 {
-  static_assert(::cuda::std::__always_false_v<_Tp>,
-                "cuda::std::to_chars for floating point types is not yet implemented");
-  (void) __first;
-  (void) __last;
-  (void) __value;
-  (void) __fmt;
-  (void) __prec;
-  return {};
+  static_assert(__to_chars_fp_is_supported_v<_Tp>, "cuda::std::to_chars for long double is not yet implemented");
+  using _Up = conditional_t<is_same_v<_Tp, float>, float, double>;
+  return ::cuda::std::__to_chars_fp_precision(__first, __last, static_cast<_Up>(__value), __fmt, __prec);
 }
 
 _CCCL_END_NAMESPACE_CUDA_STD
@@ -0,0 +1,1353 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___CHARCONV_TO_CHARS_FP_H
+#define _CUDA_STD___CHARCONV_TO_CHARS_FP_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__cmath/ilog.h>
+#include <cuda/__cmath/mul_hi.h>
+#include <cuda/std/__bit/integral.h>
+#include <cuda/std/__charconv/chars_format.h>
+#include <cuda/std/__charconv/to_chars_fp_tables.h>
+#include <cuda/std/__charconv/to_chars_result.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__floating_point/format.h>
+#include <cuda/std/__floating_point/properties.h>
+#include <cuda/std/__floating_point/storage.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+// The floating point to_chars of float and double. The shortest representations come from the Ryu algorithm of Ulf
+// Adams, and the representations with a precision round the exact floor of the value over a power of 10 that its
+// multiplications give when they have enough digits, or the exact decimal expansion of the value otherwise, so that
+// both match the output of the standard library of the host.
+
+template <class _Tp>
+inline constexpr int __to_chars_fp_mant_nbits_v = __fp_mant_nbits_v<__fp_format_of_v<_Tp>>;
+
+template <class _Tp>
+inline constexpr int __to_chars_fp_exp_nbits_v = __fp_exp_nbits_v<__fp_format_of_v<_Tp>>;
+
+template <class _Tp>
+inline constexpr int __to_chars_fp_exp_bias_v = __fp_exp_bias_v<__fp_format_of_v<_Tp>>;
+
+// The integers with at most this many decimal digits are exact, so their shortest digits followed by zeros are their
+// exact value
+template <class _Tp>
+inline constexpr int __to_chars_fp_int_digits_v = is_same_v<_Tp, float> ? 7 : 15;
+
+// The fields of the binary representation of a float or a double
+struct __to_chars_fp_bits
+{
+  uint64_t __mantissa_; // the stored mantissa, without the implicit bit
+  int __exponent_; // the biased exponent
+  bool __negative_;
+};
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr __to_chars_fp_bits __to_chars_fp_decompose(_Tp __value) noexcept
+{
+  constexpr int __mant_nbits = __to_chars_fp_mant_nbits_v<_Tp>;
+  constexpr int __exp_nbits  = __to_chars_fp_exp_nbits_v<_Tp>;
+
+  const uint64_t __storage = ::cuda::std::__fp_get_storage(__value);
+  return {__storage & ((uint64_t{1} << __mant_nbits) - 1),
+          static_cast<int>((__storage >> __mant_nbits) & ((uint64_t{1} << __exp_nbits) - 1)),
+          ((__storage >> (__mant_nbits + __exp_nbits)) & 1) != 0};
+}
+
+// The value of a finite floating point number as m 2^e
+struct __to_chars_fp_binary
+{
+  uint64_t __m_;
+  int __e_;
+};
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr __to_chars_fp_binary __to_chars_fp_to_binary(__to_chars_fp_bits __bits) noexcept
+{
+  constexpr int __mant_nbits = __to_chars_fp_mant_nbits_v<_Tp>;
+  constexpr int __bias       = __to_chars_fp_exp_bias_v<_Tp>;
+
+  if (__bits.__exponent_ == 0)
+  {
+    return {__bits.__mantissa_, 1 - __bias - __mant_nbits};
+  }
+  return {__bits.__mantissa_ | (uint64_t{1} << __mant_nbits), __bits.__exponent_ - __bias - __mant_nbits};
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// shortest digits
+
+// The value of a floating point number as digits 10^exponent
+struct __to_chars_fp_decimal
+{
+  uint64_t __digits_;
+  int __exponent_;
+};
+
+// The bit width of 5^e for e in [0, 3528]
+[[nodiscard]] _CCCL_API constexpr int __to_chars_fp_pow5_bits(int __e) noexcept
+{
+  return static_cast<int>((static_cast<uint32_t>(__e) * 1217359u) >> 19) + 1;
+}
+
+// floor(log10(2^e)) for e in [0, 1650]
+[[nodiscard]] _CCCL_API constexpr int __to_chars_fp_log10_pow2(int __e) noexcept
+{
+  return static_cast<int>((static_cast<uint32_t>(__e) * 78913u) >> 18);
+}
+
+// floor(log10(5^e)) for e in [0, 2620]
+[[nodiscard]] _CCCL_API constexpr int __to_chars_fp_log10_pow5(int __e) noexcept
+{
+  return static_cast<int>((static_cast<uint32_t>(__e) * 732923u) >> 20);
+}
+
+[[nodiscard]] _CCCL_API constexpr bool __to_chars_fp_multiple_of_pow5(uint64_t __v, int __p) noexcept
+{
+  int __count = 0;
+  for (; __v % 5 == 0 && __count < __p; __v /= 5)
+  {
+    ++__count;
+  }
+  return __count >= __p;
+}
+
+[[nodiscard]] _CCCL_API constexpr bool __to_chars_fp_multiple_of_pow2(uint64_t __v, int __p) noexcept
+{
+  return (__v & ((uint64_t{1} << __p) - 1)) == 0;
+}
+
+// (m * mul) >> j for a 128 bit multiplier {low, high} and j in (64, 128)
+[[nodiscard]] _CCCL_API constexpr uint64_t
+__to_chars_fp_mul_shift64(uint64_t __m, const uint64_t* __mul, int __j) noexcept
+{
+  const uint64_t __low_high  = ::cuda::mul_hi(__m, __mul[0]);
+  const uint64_t __high_low  = __m * __mul[1];
+  const uint64_t __high_high = ::cuda::mul_hi(__m, __mul[1]);
+  const uint64_t __sum       = __low_high + __high_low;
+  const uint64_t __high      = __high_high + (__sum < __low_high);
+  const int __shift          = __j - 64;
+  return (__high << (64 - __shift)) | (__sum >> __shift);
+}
+
+// (m * factor) >> shift for a 64 bit factor and shift in [32, 96)
+[[nodiscard]] _CCCL_API constexpr uint32_t
+__to_chars_fp_mul_shift32(uint32_t __m, uint64_t __factor, int __shift) noexcept
+{
+  const uint64_t __low  = uint64_t{__m} * static_cast<uint32_t>(__factor);
+  const uint64_t __high = uint64_t{__m} * static_cast<uint32_t>(__factor >> 32);
+  const uint64_t __sum  = (__low >> 32) + __high;
+  return static_cast<uint32_t>(__sum >> (__shift - 32));
+}
+
+// Removes the digits of vr that are shared by all the numbers in the interval [vm, vp], the rare case where the bounds
+// of the interval or the exact value end in zeros after the removal
+template <class _Up>
+[[nodiscard]] _CCCL_API constexpr __to_chars_fp_decimal __to_chars_fp_remove_digits_exact(
+  _Up __vr,
+  _Up __vp,
+  _Up __vm,
+  int __e10,
+  bool __vm_is_trailing_zeros,
+  bool __vr_is_trailing_zeros,
+  bool __accept_bounds,
+  int __last_removed_digit) noexcept
+{
+  int __removed = 0;
+  for (; __vp / 10 > __vm / 10; ++__removed)
+  {
+    __vm_is_trailing_zeros &= __vm % 10 == 0;
+    __vr_is_trailing_zeros &= __last_removed_digit == 0;
+    __last_removed_digit = static_cast<int>(__vr % 10);
+    __vr /= 10;
+    __vp /= 10;
+    __vm /= 10;
+  }
+  if (__vm_is_trailing_zeros)
+  {
+    for (; __vm % 10 == 0; ++__removed)
+    {
+      __vr_is_trailing_zeros &= __last_removed_digit == 0;
+      __last_removed_digit = static_cast<int>(__vr % 10);
+      __vr /= 10;
+      __vp /= 10;
+      __vm /= 10;
+    }
+  }
+  // An exact tie rounds to even
+  if (__vr_is_trailing_zeros && __last_removed_digit == 5 && __vr % 2 == 0)
+  {
+    __last_removed_digit = 4;
+  }
+  const bool __round_up =
+    (__vr == __vm && (!__accept_bounds || !__vm_is_trailing_zeros)) || __last_removed_digit >= 5;
+  return {static_cast<uint64_t>(__vr + __round_up), __e10 + __removed};
+}
+
+// The shortest digits of a double given by its stored mantissa and biased exponent, which must not be both 0
+[[nodiscard]] _CCCL_API constexpr __to_chars_fp_decimal
+__to_chars_fp_shortest_double(uint64_t __ieee_mantissa, int __ieee_exponent) noexcept
+{
+  constexpr int __mant_nbits      = 52;
+  constexpr int __bias            = 1023;
+  constexpr int __pow5_inv_nbits  = 125;
+  constexpr int __pow5_nbits      = 125;
+  constexpr uint64_t __hidden_bit = uint64_t{1} << __mant_nbits;
+
+  // The integers below 2^53 are their own shortest representation, without their trailing zeros
+  if (__ieee_exponent != 0)
+  {
+    const int __e2 = __ieee_exponent - __bias - __mant_nbits;
+    const uint64_t __m2 = __hidden_bit | __ieee_mantissa;
+    if (__e2 <= 0 && __e2 >= -__mant_nbits && (__m2 & ((uint64_t{1} << -__e2) - 1)) == 0)
+    {
+      uint64_t __v = __m2 >> -__e2;
+      int __e      = 0;
+      for (; __v % 10 == 0; __v /= 10)
+      {
+        ++__e;
+      }
+      return {__v, __e};
+    }
+  }
+
+  // The bounds of the interval of the numbers that round to the value are halfway to the neighbours, so the value is
+  // scaled by 4 to keep them integers
+  const int __e2 = (__ieee_exponent == 0 ? 1 : __ieee_exponent) - __bias - __mant_nbits - 2;
+  const uint64_t __m2 = __ieee_exponent == 0 ? __ieee_mantissa : (__hidden_bit | __ieee_mantissa);
+  const bool __accept_bounds = (__m2 & 1) == 0;
+  const uint64_t __mv        = 4 * __m2;
+  const uint64_t __mm_shift  = __ieee_mantissa != 0 || __ieee_exponent <= 1;
+
+  uint64_t __vr                = 0;
+  uint64_t __vp                = 0;
+  uint64_t __vm                = 0;
+  int __e10                    = 0;
+  bool __vm_is_trailing_zeros = false;
+  bool __vr_is_trailing_zeros = false;
+  if (__e2 >= 0)
+  {
+    const int __q          = ::cuda::std::__to_chars_fp_log10_pow2(__e2) - (__e2 > 3);
+    const int __k          = __pow5_inv_nbits + ::cuda::std::__to_chars_fp_pow5_bits(__q) - 1;
+    const int __i          = -__e2 + __q + __k;
+    const uint64_t* __mul = __to_chars_fp_double_pow5_inv_split[__q];
+    __e10                  = __q;
+    __vr                   = ::cuda::std::__to_chars_fp_mul_shift64(__mv, __mul, __i);
+    __vp                   = ::cuda::std::__to_chars_fp_mul_shift64(__mv + 2, __mul, __i);
+    __vm                   = ::cuda::std::__to_chars_fp_mul_shift64(__mv - 1 - __mm_shift, __mul, __i);
+    if (__q <= 21)
+    {
+      // At most one of mp, mv and mm is a multiple of 5
+      if (__mv % 5 == 0)
+      {
+        __vr_is_trailing_zeros = ::cuda::std::__to_chars_fp_multiple_of_pow5(__mv, __q);
+      }
+      else if (__accept_bounds)
+      {
+        __vm_is_trailing_zeros = ::cuda::std::__to_chars_fp_multiple_of_pow5(__mv - 1 - __mm_shift, __q);
+      }
+      else
+      {
+        __vp -= ::cuda::std::__to_chars_fp_multiple_of_pow5(__mv + 2, __q);
+      }
+    }
+  }
+  else
+  {
+    const int __q          = ::cuda::std::__to_chars_fp_log10_pow5(-__e2) - (-__e2 > 1);
+    const int __i          = -__e2 - __q;
+    const int __k          = ::cuda::std::__to_chars_fp_pow5_bits(__i) - __pow5_nbits;
+    const int __j          = __q - __k;
+    const uint64_t* __mul = __to_chars_fp_double_pow5_split[__i];
+    __e10                  = __q + __e2;
+    __vr                   = ::cuda::std::__to_chars_fp_mul_shift64(__mv, __mul, __j);
+    __vp                   = ::cuda::std::__to_chars_fp_mul_shift64(__mv + 2, __mul, __j);
+    __vm                   = ::cuda::std::__to_chars_fp_mul_shift64(__mv - 1 - __mm_shift, __mul, __j);
+    if (__q <= 1)
+    {
+      // mv has at least two trailing zero bits
+      __vr_is_trailing_zeros = true;
+      if (__accept_bounds)
+      {
+        __vm_is_trailing_zeros = __mm_shift == 1;
+      }
+      else
+      {
+        --__vp;
+      }
+    }
+    else if (__q < 63)
+    {
+      __vr_is_trailing_zeros = ::cuda::std::__to_chars_fp_multiple_of_pow2(__mv, __q);
+    }
+  }
+
+  if (__vm_is_trailing_zeros || __vr_is_trailing_zeros)
+  {
+    return ::cuda::std::__to_chars_fp_remove_digits_exact(
+      __vr, __vp, __vm, __e10, __vm_is_trailing_zeros, __vr_is_trailing_zeros, __accept_bounds, 0);
+  }
+
+  // The common case removes two digits at a time first
+  int __removed   = 0;
+  bool __round_up = false;
+  if (__vp / 100 > __vm / 100)
+  {
+    __round_up = __vr % 100 >= 50;
+    __vr /= 100;
+    __vp /= 100;
+    __vm /= 100;
+    __removed += 2;
+  }
+  for (; __vp / 10 > __vm / 10; ++__removed)
+  {
+    __round_up = __vr % 10 >= 5;
+    __vr /= 10;
+    __vp /= 10;
+    __vm /= 10;
+  }
+  return {__vr + (__vr == __vm || __round_up), __e10 + __removed};
+}
+
+// The shortest digits of a float given by its stored mantissa and biased exponent, which must not be both 0
+[[nodiscard]] _CCCL_API constexpr __to_chars_fp_decimal
+__to_chars_fp_shortest_float(uint32_t __ieee_mantissa, int __ieee_exponent) noexcept
+{
+  constexpr int __mant_nbits     = 23;
+  constexpr int __bias           = 127;
+  constexpr int __pow5_inv_nbits = 59;
+  constexpr int __pow5_nbits     = 61;
+
+  const int __e2 = (__ieee_exponent == 0 ? 1 : __ieee_exponent) - __bias - __mant_nbits - 2;
+  const uint32_t __m2 = __ieee_exponent == 0 ? __ieee_mantissa : ((uint32_t{1} << __mant_nbits) | __ieee_mantissa);
+  const bool __accept_bounds = (__m2 & 1) == 0;
+  const uint32_t __mv        = 4 * __m2;
+  const uint32_t __mp        = 4 * __m2 + 2;
+  const uint32_t __mm        = 4 * __m2 - 1 - (__ieee_mantissa != 0 || __ieee_exponent <= 1);
+
+  uint32_t __vr                = 0;
+  uint32_t __vp                = 0;
+  uint32_t __vm                = 0;
+  int __e10                    = 0;
+  bool __vm_is_trailing_zeros = false;
+  bool __vr_is_trailing_zeros = false;
+  int __last_removed_digit     = 0;
+  if (__e2 >= 0)
+  {
+    const int __q = ::cuda::std::__to_chars_fp_log10_pow2(__e2);
+    const int __k = __pow5_inv_nbits + ::cuda::std::__to_chars_fp_pow5_bits(__q) - 1;
+    const int __i = -__e2 + __q + __k;
+    __e10         = __q;
+    __vr          = ::cuda::std::__to_chars_fp_mul_shift32(__mv, __to_chars_fp_float_pow5_inv_split[__q], __i);
+    __vp          = ::cuda::std::__to_chars_fp_mul_shift32(__mp, __to_chars_fp_float_pow5_inv_split[__q], __i);
+    __vm          = ::cuda::std::__to_chars_fp_mul_shift32(__mm, __to_chars_fp_float_pow5_inv_split[__q], __i);
+    if (__q != 0 && (__vp - 1) / 10 <= __vm / 10)
+    {
+      // The loop below removes no digit, but the rounding needs the digit after the last one of vr
+      const int __l = __pow5_inv_nbits + ::cuda::std::__to_chars_fp_pow5_bits(__q - 1) - 1;
+      __last_removed_digit = static_cast<int>(
+        ::cuda::std::__to_chars_fp_mul_shift32(__mv, __to_chars_fp_float_pow5_inv_split[__q - 1], -__e2 + __q - 1 + __l)
+        % 10);
+    }
+    if (__q <= 9)
+    {
+      // At most one of mp, mv and mm is a multiple of 5
+      if (__mv % 5 == 0)
+      {
+        __vr_is_trailing_zeros = ::cuda::std::__to_chars_fp_multiple_of_pow5(__mv, __q);
+      }
+      else if (__accept_bounds)
+      {
+        __vm_is_trailing_zeros = ::cuda::std::__to_chars_fp_multiple_of_pow5(__mm, __q);
+      }
+      else
+      {
+        __vp -= ::cuda::std::__to_chars_fp_multiple_of_pow5(__mp, __q);
+      }
+    }
+  }
+  else
+  {
+    const int __q = ::cuda::std::__to_chars_fp_log10_pow5(-__e2);
+    const int __i = -__e2 - __q;
+    const int __k = ::cuda::std::__to_chars_fp_pow5_bits(__i) - __pow5_nbits;
+    const int __j = __q - __k;
+    __e10         = __q + __e2;
+    __vr          = ::cuda::std::__to_chars_fp_mul_shift32(__mv, __to_chars_fp_float_pow5_split[__i], __j);
+    __vp          = ::cuda::std::__to_chars_fp_mul_shift32(__mp, __to_chars_fp_float_pow5_split[__i], __j);
+    __vm          = ::cuda::std::__to_chars_fp_mul_shift32(__mm, __to_chars_fp_float_pow5_split[__i], __j);
+    if (__q != 0 && (__vp - 1) / 10 <= __vm / 10)
+    {
+      const int __l = __q - 1 - (::cuda::std::__to_chars_fp_pow5_bits(__i + 1) - __pow5_nbits);
+      const uint32_t __vr_more =
+        ::cuda::std::__to_chars_fp_mul_shift32(__mv, __to_chars_fp_float_pow5_split[__i + 1], __l);
+      __last_removed_digit = static_cast<int>(__vr_more % 10);
+    }
+    if (__q <= 1)
+    {
+      // mv has at least two trailing zero bits
+      __vr_is_trailing_zeros = true;
+      if (__accept_bounds)
+      {
+        __vm_is_trailing_zeros = __mm == __mv - 2;
+      }
+      else
+      {
+        --__vp;
+      }
+    }
+    else if (__q < 31)
+    {
+      __vr_is_trailing_zeros = ::cuda::std::__to_chars_fp_multiple_of_pow2(__mv, __q - 1);
+    }
+  }
+
+  if (__vm_is_trailing_zeros || __vr_is_trailing_zeros)
+  {
+    return ::cuda::std::__to_chars_fp_remove_digits_exact(
+      __vr, __vp, __vm, __e10, __vm_is_trailing_zeros, __vr_is_trailing_zeros, __accept_bounds, __last_removed_digit);
+  }
+
+  int __removed = 0;
+  for (; __vp / 10 > __vm / 10; ++__removed)
+  {
+    __last_removed_digit = static_cast<int>(__vr % 10);
+    __vr /= 10;
+    __vp /= 10;
+    __vm /= 10;
+  }
+  return {uint64_t{__vr} + (__vr == __vm || __last_removed_digit >= 5), __e10 + __removed};
+}
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr __to_chars_fp_decimal
+__to_chars_fp_shortest_digits(__to_chars_fp_bits __bits) noexcept
+{
+  if (__bits.__mantissa_ == 0 && __bits.__exponent_ == 0)
+  {
+    return {0, 0};
+  }
+  if constexpr (is_same_v<_Tp, float>)
+  {
+    return ::cuda::std::__to_chars_fp_shortest_float(static_cast<uint32_t>(__bits.__mantissa_), __bits.__exponent_);
+  }
+  else
+  {
+    return ::cuda::std::__to_chars_fp_shortest_double(__bits.__mantissa_, __bits.__exponent_);
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// rounded digits
+
+// floor(v / 10^e) for a value v, with 17 to 20 digits, and whether the division is exact
+struct __to_chars_fp_floor_digits
+{
+  uint64_t __digits_;
+  int __exponent_;
+  bool __exact_;
+};
+
+// The multiplications of the shortest digits of a double give the exact floor of its value over a power of 10, which
+// also holds for the doubles with the value of a float. Returns false for 0 and for the subnormal doubles, whose
+// normalized exponent is out of the range of the tables.
+[[nodiscard]] _CCCL_API constexpr bool
+__to_chars_fp_floor(__to_chars_fp_binary __b, __to_chars_fp_floor_digits& __floor) noexcept
+{
+  constexpr int __pow5_inv_nbits = 125;
+  constexpr int __pow5_nbits     = 125;
+
+  if (__b.__m_ == 0)
+  {
+    return false;
+  }
+  const int __shift   = 52 - static_cast<int>(::cuda::std::__bit_log2(__b.__m_));
+  const uint64_t __mv = __b.__m_ << (__shift + 2);
+  const int __e2      = __b.__e_ - __shift - 2;
+  if (__e2 < -1076)
+  {
+    return false;
+  }
+
+  if (__e2 >= 0)
+  {
+    const int __q = ::cuda::std::__to_chars_fp_log10_pow2(__e2) - (__e2 > 3);
+    const int __k = __pow5_inv_nbits + ::cuda::std::__to_chars_fp_pow5_bits(__q) - 1;
+    const int __i = -__e2 + __q + __k;
+    // mv 2^e2 is a multiple of 2^q since q <= e2
+    __floor = {::cuda::std::__to_chars_fp_mul_shift64(__mv, __to_chars_fp_double_pow5_inv_split[__q], __i),
+               __q,
+               ::cuda::std::__to_chars_fp_multiple_of_pow5(__mv, __q)};
+  }
+  else
+  {
+    const int __q = ::cuda::std::__to_chars_fp_log10_pow5(-__e2) - (-__e2 > 1);
+    const int __i = -__e2 - __q;
+    const int __k = ::cuda::std::__to_chars_fp_pow5_bits(__i) - __pow5_nbits;
+    const int __j = __q - __k;
+    // v / 10^(q + e2) = mv 5^i / 2^q
+    __floor = {::cuda::std::__to_chars_fp_mul_shift64(__mv, __to_chars_fp_double_pow5_split[__i], __j),
+               __q + __e2,
+               __q < 64 && ::cuda::std::__to_chars_fp_multiple_of_pow2(__mv, __q)};
+  }
+  return true;
+}
+
+// 10^n for n in [0, 19]
+[[nodiscard]] _CCCL_API constexpr uint64_t __to_chars_fp_pow10(int __n) noexcept
+{
+  uint64_t __pow10 = 1;
+  for (int __i = 0; __i < __n; ++__i)
+  {
+    __pow10 *= 10;
+  }
+  return __pow10;
+}
+
+// Rounds the value to its n first digits, n being less than the digits of the floor, to nearest with ties to even.
+// The result has n digits, or n + 1 if the rounding carries past the first digit.
+[[nodiscard]] _CCCL_API constexpr __to_chars_fp_decimal
+__to_chars_fp_round(__to_chars_fp_floor_digits __floor, int __n) noexcept
+{
+  const int __removed    = ::cuda::ilog10(__floor.__digits_) + 1 - __n;
+  const uint64_t __scale = ::cuda::std::__to_chars_fp_pow10(__removed);
+  const uint64_t __rest  = __floor.__digits_ % __scale;
+  const uint64_t __half  = __scale / 2;
+  uint64_t __digits      = __floor.__digits_ / __scale;
+  if (__rest > __half || (__rest == __half && (!__floor.__exact_ || __digits % 2 != 0)))
+  {
+    ++__digits;
+  }
+  return {__digits, __floor.__exponent_ + __removed};
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// exact digits
+
+// An unsigned integer of _Words 32 bit words, least significant first
+template <int _Words>
+struct __to_chars_fp_bigint
+{
+  uint32_t __words_[_Words];
+  int __size_; // the number of words up to the most significant non zero word
+
+  // Sets the value to v 2^shift
+  _CCCL_API constexpr void __assign(uint64_t __v, int __shift) noexcept
+  {
+    for (auto& __word : __words_)
+    {
+      __word = 0;
+    }
+    const int __offset  = __shift / 32;
+    const int __bit     = __shift % 32;
+    const uint64_t __lo = __v << __bit;
+    const uint32_t __hi = __bit == 0 ? 0 : static_cast<uint32_t>(__v >> (64 - __bit));
+    __words_[__offset]     = static_cast<uint32_t>(__lo);
+    __words_[__offset + 1] = static_cast<uint32_t>(__lo >> 32);
+    if (__offset + 2 < _Words)
+    {
+      __words_[__offset + 2] = __hi;
+    }
+    __size_ = __offset + 3 < _Words ? __offset + 3 : _Words;
+    __trim();
+  }
+
+  _CCCL_API constexpr void __trim() noexcept
+  {
+    while (__size_ > 0 && __words_[__size_ - 1] == 0)
+    {
+      --__size_;
+    }
+  }
+
+  [[nodiscard]] _CCCL_API constexpr bool __is_zero() const noexcept
+  {
+    return __size_ == 0;
+  }
+
+  // The value must stay below 2^(32 _Words)
+  _CCCL_API constexpr void __multiply(uint32_t __x) noexcept
+  {
+    uint64_t __carry = 0;
+    for (int __i = 0; __i < __size_; ++__i)
+    {
+      const uint64_t __product = uint64_t{__words_[__i]} * __x + __carry;
+      __words_[__i]            = static_cast<uint32_t>(__product);
+      __carry                  = __product >> 32;
+    }
+    if (__carry != 0)
+    {
+      __words_[__size_++] = static_cast<uint32_t>(__carry);
+    }
+  }
+
+  // Multiplies the value by 5^k, 5^13 being the largest power of 5 that fits in a word
+  _CCCL_API constexpr void __multiply_pow5(int __k) noexcept
+  {
+    for (; __k >= 13; __k -= 13)
+    {
+      __multiply(1220703125);
+    }
+    uint32_t __pow5 = 1;
+    for (; __k > 0; --__k)
+    {
+      __pow5 *= 5;
+    }
+    __multiply(__pow5);
+  }
+
+  // Divides the value by x and returns the remainder
+  _CCCL_API constexpr uint32_t __divide(uint32_t __x) noexcept
+  {
+    uint64_t __remainder = 0;
+    for (int __i = __size_ - 1; __i >= 0; --__i)
+    {
+      const uint64_t __dividend = (__remainder << 32) | __words_[__i];
+      __words_[__i]             = static_cast<uint32_t>(__dividend / __x);
+      __remainder               = __dividend % __x;
+    }
+    __trim();
+    return static_cast<uint32_t>(__remainder);
+  }
+
+  // Removes and returns the bits from the given bit up, which must fit in 32 bits
+  _CCCL_API constexpr uint32_t __split(int __bit) noexcept
+  {
+    const int __word  = __bit / 32;
+    const int __shift = __bit % 32;
+    uint64_t __high   = 0;
+    for (int __i = __size_ - 1; __i >= __word; --__i)
+    {
+      __high = (__high << 32) | __words_[__i];
+    }
+    if (__word < __size_)
+    {
+      __words_[__word] &= (uint32_t{1} << __shift) - 1;
+      __size_ = __word + 1;
+      __trim();
+    }
+    return static_cast<uint32_t>(__high >> __shift);
+  }
+};
+
+// The decimal digits of the exact value of a floating point number, most significant first. The integer part is
+// converted to chunks of 9 digits up front, and the fraction is multiplied by 10^9 for each following chunk.
+template <class _Tp>
+class __to_chars_fp_exact_digits
+{
+  static constexpr int __frac_nbits_max = __to_chars_fp_exp_bias_v<_Tp> - 1 + __to_chars_fp_mant_nbits_v<_Tp>;
+  static constexpr int __words          = (__frac_nbits_max + 30) / 32 + 1;
+  static constexpr uint32_t __chunk_base = 1000000000;
+  static constexpr uint32_t __chunk_pow5 = 1953125; // 5^9
+
+  uint32_t __int_chunks_[__words]; // the integer part in base 10^9, least significant first
+  int __next_int_chunk_; // the index of the next chunk of the integer part, or -1 after the integer part
+  int __zero_chunks_; // the number of chunks of the fraction known to be 0 that precede __frac_
+  __to_chars_fp_bigint<__words> __frac_; // the numerator of the fraction over 2^__frac_nbits_
+  int __frac_nbits_;
+  uint32_t __chunk_; // the remaining digits of the current chunk
+  uint32_t __chunk_scale_; // the place value of the next digit of the current chunk, or 0 at the end of the chunk
+
+  _CCCL_API constexpr void __load() noexcept
+  {
+    __chunk_scale_ = __chunk_base / 10;
+    if (__next_int_chunk_ >= 0)
+    {
+      __chunk_ = __int_chunks_[__next_int_chunk_--];
+    }
+    else if (__zero_chunks_ > 0 || __frac_.__is_zero())
+    {
+      __zero_chunks_ -= __zero_chunks_ > 0;
+      __chunk_ = 0;
+    }
+    else if (__frac_nbits_ >= 9)
+    {
+      // f / 2^n 10^9 = f 5^9 / 2^(n - 9), which keeps the numerator and the fraction that remains after the split
+      // shorter than a multiplication by 10^9
+      __frac_.__multiply(__chunk_pow5);
+      __frac_nbits_ -= 9;
+      __chunk_ = __frac_.__split(__frac_nbits_);
+    }
+    else
+    {
+      __frac_.__multiply(__chunk_base);
+      __chunk_ = __frac_.__split(__frac_nbits_);
+    }
+  }
+
+public:
+  int __int_digits_; // the number of digits of the integer part, 0 for values below 1
+
+  _CCCL_API constexpr __to_chars_fp_exact_digits(__to_chars_fp_binary __b) noexcept
+      : __int_chunks_{}
+      , __next_int_chunk_{-1}
+      , __zero_chunks_{0}
+      , __frac_{}
+      , __frac_nbits_{0}
+      , __chunk_{0}
+      , __chunk_scale_{0}
+      , __int_digits_{0}
+  {
+    __to_chars_fp_bigint<__words> __int{};
+    if (__b.__e_ >= 0)
+    {
+      __int.__assign(__b.__m_, __b.__e_);
+      __frac_.__assign(0, 0);
+    }
+    else
+    {
+      __frac_nbits_ = -__b.__e_;
+      if (__frac_nbits_ < 64)
+      {
+        __int.__assign(__b.__m_ >> __frac_nbits_, 0);
+        __frac_.__assign(__b.__m_ & ((uint64_t{1} << __frac_nbits_) - 1), 0);
+      }
+      else
+      {
+        // The value is below 2^(64 - n) <= 10^-z for z = floor((n - 64) log10(2)), so its first z digits are 0. The
+        // whole chunks among them are skipped at once: f / 2^n 10^9k = f 5^9k / 2^(n - 9k).
+        __int.__assign(0, 0);
+        __frac_.__assign(__b.__m_, 0);
+        __zero_chunks_ = ::cuda::std::__to_chars_fp_log10_pow2(__frac_nbits_ - 64) / 9;
+        __frac_.__multiply_pow5(9 * __zero_chunks_);
+        __frac_nbits_ -= 9 * __zero_chunks_;
+      }
+    }
+
+    int __count = 0;
+    while (!__int.__is_zero())
+    {
+      __int_chunks_[__count++] = __int.__divide(__chunk_base);
+    }
+    if (__count > 0)
+    {
+      __next_int_chunk_ = __count - 2;
+      __chunk_          = __int_chunks_[__count - 1];
+      __chunk_scale_    = 1;
+      __int_digits_     = 9 * (__count - 1) + 1;
+      for (; __chunk_ / __chunk_scale_ >= 10; __chunk_scale_ *= 10)
+      {
+        ++__int_digits_;
+      }
+    }
+  }
+
+  // Returns the next digit
+  [[nodiscard]] _CCCL_API constexpr int __next() noexcept
+  {
+    if (__chunk_scale_ == 0)
+    {
+      __load();
+    }
+    const int __digit = static_cast<int>(__chunk_ / __chunk_scale_);
+    __chunk_ %= __chunk_scale_;
+    __chunk_scale_ /= 10;
+    return __digit;
+  }
+
+  // Whether all the following digits are 0
+  [[nodiscard]] _CCCL_API constexpr bool __rest_is_zero() const noexcept
+  {
+    if (__chunk_ != 0 || !__frac_.__is_zero())
+    {
+      return false;
+    }
+    for (int __i = 0; __i <= __next_int_chunk_; ++__i)
+    {
+      if (__int_chunks_[__i] != 0)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Whether the digits so far, the last of which is odd or not, round up when the following ones are dropped
+  [[nodiscard]] _CCCL_API constexpr bool __round_up(bool __odd) noexcept
+  {
+    const int __digit = __next();
+    return __digit > 5 || (__digit == 5 && (__odd || !__rest_is_zero()));
+  }
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+// output
+
+// Writes the n decimal digits of v to [first, first + n)
+_CCCL_API constexpr void __to_chars_fp_write_digits(char* __first, int __n, uint64_t __v) noexcept
+{
+  for (char* __p = __first + __n; __p != __first; __v /= 10)
+  {
+    *--__p = static_cast<char>('0' + __v % 10);
+  }
+}
+
+// Writes the n decimal digits of v to [first, first + n + 1) with a decimal point after the first int_digits digits,
+// which must be less than n
+_CCCL_API constexpr void
+__to_chars_fp_write_digits_with_point(char* __first, int __n, int __int_digits, uint64_t __v) noexcept
+{
+  char* __p = __first + __n + 1;
+  for (int __i = __int_digits; __i < __n; ++__i, __v /= 10)
+  {
+    *--__p = static_cast<char>('0' + __v % 10);
+  }
+  *--__p = '.';
+  ::cuda::std::__to_chars_fp_write_digits(__first, __int_digits, __v);
+}
+
+[[nodiscard]] _CCCL_API constexpr int __to_chars_fp_digit_count(uint64_t __v) noexcept
+{
+  return __v == 0 ? 1 : ::cuda::ilog10(__v) + 1;
+}
+
+// The length of the exponent e±dd or e±ddd of a decimal exponent
+[[nodiscard]] _CCCL_API constexpr int __to_chars_fp_exponent_length(int __x) noexcept
+{
+  return (__x <= -100 || __x >= 100) ? 5 : 4;
+}
+
+_CCCL_API constexpr char* __to_chars_fp_write_exponent(char* __p, int __x) noexcept
+{
+  *__p++         = 'e';
+  *__p++         = __x < 0 ? '-' : '+';
+  const int __ax = __x < 0 ? -__x : __x;
+  if (__ax >= 100)
+  {
+    *__p++ = static_cast<char>('0' + __ax / 100);
+  }
+  *__p++ = static_cast<char>('0' + __ax / 10 % 10);
+  *__p++ = static_cast<char>('0' + __ax % 10);
+  return __p;
+}
+
+// Adds 1 to the last digit of [first, p), skipping the decimal point, and returns whether the carry goes past the first
+// digit, in which case all the digits are 0
+_CCCL_API constexpr bool __to_chars_fp_increment(char* __first, char* __p) noexcept
+{
+  while (__p != __first)
+  {
+    --__p;
+    if (*__p == '.')
+    {
+      continue;
+    }
+    if (*__p != '9')
+    {
+      ++*__p;
+      return false;
+    }
+    *__p = '0';
+  }
+  return true;
+}
+
+_CCCL_API constexpr to_chars_result __to_chars_fp_non_finite(char* __first, char* __last, bool __is_nan) noexcept
+{
+  if (__last - __first < 3)
+  {
+    return {__last, errc::value_too_large};
+  }
+  __first[0] = __is_nan ? 'n' : 'i';
+  __first[1] = __is_nan ? 'a' : 'n';
+  __first[2] = __is_nan ? 'n' : 'f';
+  return {__first + 3, errc{}};
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// formatting of decimal digits
+
+// d.ddde±xx for the n digits of the value with the decimal exponent x of the first digit
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_fp_digits_scientific(char* __first, char* __last, uint64_t __digits, int __n, int __x) noexcept
+{
+  const ptrdiff_t __len = __n + (__n > 1) + ::cuda::std::__to_chars_fp_exponent_length(__x);
+  if (__last - __first < __len)
+  {
+    return {__last, errc::value_too_large};
+  }
+  char* __p = __first + 1;
+  if (__n > 1)
+  {
+    ::cuda::std::__to_chars_fp_write_digits_with_point(__first, __n, 1, __digits);
+    __p = __first + __n + 1;
+  }
+  else
+  {
+    *__first = static_cast<char>('0' + __digits);
+  }
+  return {::cuda::std::__to_chars_fp_write_exponent(__p, __x), errc{}};
+}
+
+// ddd.ddd for the n digits of the value times 10^e
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_fp_digits_fixed(char* __first, char* __last, uint64_t __digits, int __n, int __e) noexcept
+{
+  if (__e >= 0)
+  {
+    if (__last - __first < __n + __e)
+    {
+      return {__last, errc::value_too_large};
+    }
+    ::cuda::std::__to_chars_fp_write_digits(__first, __n, __digits);
+    for (int __i = 0; __i < __e; ++__i)
+    {
+      __first[__n + __i] = '0';
+    }
+    return {__first + __n + __e, errc{}};
+  }
+
+  const int __x = __e + __n - 1;
+  if (__x >= 0)
+  {
+    if (__last - __first < __n + 1)
+    {
+      return {__last, errc::value_too_large};
+    }
+    ::cuda::std::__to_chars_fp_write_digits_with_point(__first, __n, __x + 1, __digits);
+    return {__first + __n + 1, errc{}};
+  }
+
+  // 0.000ddd
+  const int __zeros = -__x - 1;
+  if (__last - __first < 2 + __zeros + __n)
+  {
+    return {__last, errc::value_too_large};
+  }
+  __first[0] = '0';
+  __first[1] = '.';
+  for (int __i = 0; __i < __zeros; ++__i)
+  {
+    __first[2 + __i] = '0';
+  }
+  ::cuda::std::__to_chars_fp_write_digits(__first + 2 + __zeros, __n, __digits);
+  return {__first + 2 + __zeros + __n, errc{}};
+}
+
+// The length of the fixed representation of n digits times 10^e, for the comparison with the scientific one
+[[nodiscard]] _CCCL_API constexpr int __to_chars_fp_digits_fixed_length(int __n, int __e) noexcept
+{
+  const int __x = __e + __n - 1;
+  return __e >= 0 ? __n + __e : __x >= 0 ? __n + 1 : __n + 1 - __x;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// formatting with a precision
+
+// d.ddde±xx with precision digits after the decimal point
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_fp_scientific_precision(char* __first, char* __last, __to_chars_fp_bits __bits, int __precision) noexcept
+{
+  const auto __b = ::cuda::std::__to_chars_fp_to_binary<_Tp>(__bits);
+
+  // The floor of the value over a power of 10 has more than the precision + 1 digits that are kept
+  __to_chars_fp_floor_digits __floor{};
+  if (__precision < 16 && ::cuda::std::__to_chars_fp_floor(__b, __floor))
+  {
+    auto __rounded = ::cuda::std::__to_chars_fp_round(__floor, __precision + 1);
+    if (__rounded.__digits_ == ::cuda::std::__to_chars_fp_pow10(__precision + 1))
+    {
+      __rounded = {__rounded.__digits_ / 10, __rounded.__exponent_ + 1};
+    }
+    return ::cuda::std::__to_chars_fp_digits_scientific(
+      __first, __last, __rounded.__digits_, __precision + 1, __rounded.__exponent_ + __precision);
+  }
+
+  __to_chars_fp_exact_digits<_Tp> __digits{__b};
+  int __x       = 0;
+  int __leading = 0;
+  if (__b.__m_ != 0)
+  {
+    __x       = __digits.__int_digits_ > 0 ? __digits.__int_digits_ - 1 : -1;
+    __leading = __digits.__next();
+    for (; __leading == 0; --__x)
+    {
+      __leading = __digits.__next();
+    }
+  }
+
+  const ptrdiff_t __mantissa_len = __precision > 0 ? 2 + ptrdiff_t{__precision} : 1;
+  if (__last - __first < __mantissa_len + ::cuda::std::__to_chars_fp_exponent_length(__x))
+  {
+    return {__last, errc::value_too_large};
+  }
+
+  char* __p        = __first;
+  *__p++           = static_cast<char>('0' + __leading);
+  int __last_digit = __leading;
+  if (__precision > 0)
+  {
+    *__p++ = '.';
+    for (int __i = 0; __i < __precision; ++__i)
+    {
+      __last_digit = __digits.__next();
+      *__p++       = static_cast<char>('0' + __last_digit);
+    }
+  }
+  if (__b.__m_ != 0 && __digits.__round_up(__last_digit % 2 != 0)
+      && ::cuda::std::__to_chars_fp_increment(__first, __p))
+  {
+    __first[0] = '1';
+    ++__x;
+    if (__last - __first < __mantissa_len + ::cuda::std::__to_chars_fp_exponent_length(__x))
+    {
+      return {__last, errc::value_too_large};
+    }
+  }
+  return {::cuda::std::__to_chars_fp_write_exponent(__p, __x), errc{}};
+}
+
+// ddd.ddd with precision digits after the decimal point
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_fp_fixed_precision(char* __first, char* __last, __to_chars_fp_bits __bits, int __precision) noexcept
+{
+  const auto __b = ::cuda::std::__to_chars_fp_to_binary<_Tp>(__bits);
+
+  // Unless the value is too large or too small, the floor of the value over a power of 10 has the digits up to the one
+  // of 10^-precision and more
+  __to_chars_fp_floor_digits __floor{};
+  if (__precision < 20 && ::cuda::std::__to_chars_fp_floor(__b, __floor))
+  {
+    const int __floor_n = ::cuda::ilog10(__floor.__digits_) + 1;
+    const int __n       = __floor.__exponent_ + __floor_n + __precision;
+    if (__n > 0 && __n < __floor_n)
+    {
+      const auto __rounded = ::cuda::std::__to_chars_fp_round(__floor, __n);
+      return ::cuda::std::__to_chars_fp_digits_fixed(
+        __first, __last, __rounded.__digits_, ::cuda::ilog10(__rounded.__digits_) + 1, -__precision);
+    }
+  }
+
+  __to_chars_fp_exact_digits<_Tp> __digits{__b};
+  const int __int_digits = __digits.__int_digits_ > 0 ? __digits.__int_digits_ : 1;
+  const ptrdiff_t __len  = __int_digits + (__precision > 0 ? 1 + ptrdiff_t{__precision} : 0);
+  if (__last - __first < __len)
+  {
+    return {__last, errc::value_too_large};
+  }
+
+  char* __p        = __first;
+  int __last_digit = 0;
+  if (__digits.__int_digits_ == 0)
+  {
+    *__p++ = '0';
+  }
+  for (int __i = 0; __i < __digits.__int_digits_; ++__i)
+  {
+    __last_digit = __digits.__next();
+    *__p++       = static_cast<char>('0' + __last_digit);
+  }
+  if (__precision > 0)
+  {
+    *__p++ = '.';
+    for (int __i = 0; __i < __precision; ++__i)
+    {
+      __last_digit = __digits.__next();
+      *__p++       = static_cast<char>('0' + __last_digit);
+    }
+  }
+  if (__digits.__round_up(__last_digit % 2 != 0) && ::cuda::std::__to_chars_fp_increment(__first, __p))
+  {
+    // All the digits were 9, so the integer part gains a leading 1
+    if (__last - __first < __len + 1)
+    {
+      return {__last, errc::value_too_large};
+    }
+    for (char* __q = __p; __q != __first; --__q)
+    {
+      *__q = __q[-1];
+    }
+    *__first = '1';
+    ++__p;
+  }
+  return {__p, errc{}};
+}
+
+// The significant digits that matter for the general format, which every double has fewer of
+inline constexpr int __to_chars_fp_general_precision_max = 1100;
+
+// The fixed format if the decimal exponent x after the rounding to precision significant digits satisfies
+// precision > x >= -4, the scientific format otherwise, without the trailing zeros of the significant digits
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_fp_general_precision(char* __first, char* __last, __to_chars_fp_bits __bits, int __precision) noexcept
+{
+  const auto __b = ::cuda::std::__to_chars_fp_to_binary<_Tp>(__bits);
+  int __p        = __precision == 0 ? 1 : __precision;
+  __p            = __p < __to_chars_fp_general_precision_max ? __p : __to_chars_fp_general_precision_max;
+
+  // The exponent and the number of significant digits after the rounding
+  int __x = 0;
+  int __n = 1;
+  // The floor of the value over a power of 10 has more than the p digits that are kept
+  __to_chars_fp_floor_digits __floor{};
+  if (__p < 17 && ::cuda::std::__to_chars_fp_floor(__b, __floor))
+  {
+    auto __rounded = ::cuda::std::__to_chars_fp_round(__floor, __p);
+    __x            = __rounded.__exponent_ + __p - 1;
+    if (__rounded.__digits_ == ::cuda::std::__to_chars_fp_pow10(__p))
+    {
+      __rounded = {__rounded.__digits_ / 10, __rounded.__exponent_ + 1};
+      ++__x;
+    }
+    __n = __p;
+    for (; __n > 1 && __rounded.__digits_ % 10 == 0; --__n)
+    {
+      __rounded = {__rounded.__digits_ / 10, __rounded.__exponent_ + 1};
+    }
+    if (__p > __x && __x >= -4)
+    {
+      return ::cuda::std::__to_chars_fp_digits_fixed(__first, __last, __rounded.__digits_, __n, __rounded.__exponent_);
+    }
+    return ::cuda::std::__to_chars_fp_digits_scientific(__first, __last, __rounded.__digits_, __n, __x);
+  }
+  if (__b.__m_ != 0)
+  {
+    __to_chars_fp_exact_digits<_Tp> __digits{__b};
+    __x              = __digits.__int_digits_ > 0 ? __digits.__int_digits_ - 1 : -1;
+    int __last_digit = __digits.__next();
+    for (; __last_digit == 0; --__x)
+    {
+      __last_digit = __digits.__next();
+    }
+    int __last_non_zero = 1;
+    int __last_non_nine = __last_digit != 9 ? 1 : 0;
+    for (int __i = 2; __i <= __p; ++__i)
+    {
+      __last_digit    = __digits.__next();
+      __last_non_zero = __last_digit != 0 ? __i : __last_non_zero;
+      __last_non_nine = __last_digit != 9 ? __i : __last_non_nine;
+    }
+    if (!__digits.__round_up(__last_digit % 2 != 0))
+    {
+      __n = __last_non_zero;
+    }
+    else if (__last_non_nine == 0)
+    {
+      ++__x;
+    }
+    else
+    {
+      __n = __last_non_nine;
+    }
+  }
+
+  if (__p > __x && __x >= -4)
+  {
+    const int __fraction_digits = __n - 1 - __x;
+    return ::cuda::std::__to_chars_fp_fixed_precision<_Tp>(
+      __first, __last, __bits, __fraction_digits > 0 ? __fraction_digits : 0);
+  }
+  return ::cuda::std::__to_chars_fp_scientific_precision<_Tp>(__first, __last, __bits, __n - 1);
+}
+
+// h.hhhp±d with precision hex digits after the point, or as few as represent the value exactly if precision is
+// negative
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_fp_hex(char* __first, char* __last, __to_chars_fp_bits __bits, int __precision) noexcept
+{
+  constexpr int __mant_nbits  = __to_chars_fp_mant_nbits_v<_Tp>;
+  constexpr int __bias        = __to_chars_fp_exp_bias_v<_Tp>;
+  constexpr int __mant_digits = (__mant_nbits + 3) / 4;
+
+  uint64_t __mantissa = __bits.__mantissa_ << (4 * __mant_digits - __mant_nbits);
+  int __leading       = __bits.__exponent_ != 0;
+  const int __exp2    = (__bits.__exponent_ == 0 && __bits.__mantissa_ == 0) ? 0
+                      : __bits.__exponent_ == 0                            ? 1 - __bias
+                                                                           : __bits.__exponent_ - __bias;
+
+  // The number of hex digits after the point, of which the first digits are in the mantissa
+  int __n      = __precision;
+  int __digits = __mant_digits;
+  if (__precision < 0)
+  {
+    for (; __digits > 0 && (__mantissa & 0xf) == 0; --__digits)
+    {
+      __mantissa >>= 4;
+    }
+    __n = __digits;
+  }
+  else if (__precision < __mant_digits)
+  {
+    const int __drop      = 4 * (__mant_digits - __precision);
+    const uint64_t __rest = __mantissa & ((uint64_t{1} << __drop) - 1);
+    const uint64_t __half = uint64_t{1} << (__drop - 1);
+    __mantissa >>= __drop;
+    __digits = __precision;
+    if (__rest > __half || (__rest == __half && ((__precision == 0 ? __leading : __mantissa) & 1) != 0))
+    {
+      ++__mantissa;
+      if ((__mantissa >> (4 * __precision)) != 0)
+      {
+        __mantissa &= (uint64_t{1} << (4 * __precision)) - 1;
+        ++__leading;
+      }
+    }
+  }
+
+  const int __abs_exp2        = __exp2 < 0 ? -__exp2 : __exp2;
+  const int __exp_digits      = __abs_exp2 >= 1000 ? 4 : __abs_exp2 >= 100 ? 3 : __abs_exp2 >= 10 ? 2 : 1;
+  const ptrdiff_t __len       = (__n > 0 ? 2 + ptrdiff_t{__n} : 1) + 2 + __exp_digits;
+  if (__last - __first < __len)
+  {
+    return {__last, errc::value_too_large};
+  }
+
+  char* __p = __first;
+  *__p++    = static_cast<char>('0' + __leading);
+  if (__n > 0)
+  {
+    *__p++ = '.';
+    for (int __i = __digits - 1; __i >= 0; --__i)
+    {
+      const int __nibble = static_cast<int>((__mantissa >> (4 * __i)) & 0xf);
+      *__p++             = static_cast<char>(__nibble < 10 ? '0' + __nibble : 'a' - 10 + __nibble);
+    }
+    for (int __i = __digits; __i < __n; ++__i)
+    {
+      *__p++ = '0';
+    }
+  }
+  *__p++ = 'p';
+  *__p++ = __exp2 < 0 ? '-' : '+';
+  ::cuda::std::__to_chars_fp_write_digits(__p, __exp_digits, static_cast<uint64_t>(__abs_exp2));
+  return {__p + __exp_digits, errc{}};
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// entry points
+
+// The shortest representation that round trips, in the given format or in the shorter of the fixed and the scientific
+// formats for an empty format
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_fp_shortest(char* __first, char* __last, _Tp __value, chars_format __fmt) noexcept
+{
+  _CCCL_ASSERT(__fmt == chars_format{} || __fmt == chars_format::scientific || __fmt == chars_format::fixed
+                 || __fmt == chars_format::general || __fmt == chars_format::hex,
+               "the format must be one of the values of chars_format");
+
+  const auto __bits = ::cuda::std::__to_chars_fp_decompose(__value);
+  if (__bits.__negative_)
+  {
+    if (__first == __last)
+    {
+      return {__last, errc::value_too_large};
+    }
+    *__first++ = '-';
+  }
+  if (__bits.__exponent_ == (1 << __to_chars_fp_exp_nbits_v<_Tp>) - 1)
+  {
+    return ::cuda::std::__to_chars_fp_non_finite(__first, __last, __bits.__mantissa_ != 0);
+  }
+  if (__fmt == chars_format::hex)
+  {
+    return ::cuda::std::__to_chars_fp_hex<_Tp>(__first, __last, __bits, -1);
+  }
+
+  const auto __decimal = ::cuda::std::__to_chars_fp_shortest_digits<_Tp>(__bits);
+  const int __n        = ::cuda::std::__to_chars_fp_digit_count(__decimal.__digits_);
+  const int __x        = __decimal.__exponent_ + __n - 1;
+
+  bool __fixed = __fmt == chars_format::fixed;
+  if (__fmt == chars_format{})
+  {
+    // A tie goes to the fixed format
+    __fixed = ::cuda::std::__to_chars_fp_digits_fixed_length(__n, __decimal.__exponent_)
+           <= __n + (__n > 1) + ::cuda::std::__to_chars_fp_exponent_length(__x);
+  }
+  else if (__fmt == chars_format::general)
+  {
+    // The general format with the precision of 6 digits of printf, given shortest digits
+    __fixed = __x >= -4 && __x < 6;
+  }
+
+  if (__fixed)
+  {
+    // The zeros after the shortest digits of a large integer would not round trip to the same digits, and the standard
+    // asks for the exact value there
+    if (__decimal.__exponent_ >= 0 && __n + __decimal.__exponent_ > __to_chars_fp_int_digits_v<_Tp>)
+    {
+      return ::cuda::std::__to_chars_fp_fixed_precision<_Tp>(__first, __last, __bits, 0);
+    }
+    return ::cuda::std::__to_chars_fp_digits_fixed(__first, __last, __decimal.__digits_, __n, __decimal.__exponent_);
+  }
+  return ::cuda::std::__to_chars_fp_digits_scientific(__first, __last, __decimal.__digits_, __n, __x);
+}
+
+// The representation with the given precision, as with printf
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_fp_precision(char* __first, char* __last, _Tp __value, chars_format __fmt, int __precision) noexcept
+{
+  _CCCL_ASSERT(__fmt == chars_format::scientific || __fmt == chars_format::fixed || __fmt == chars_format::general
+                 || __fmt == chars_format::hex,
+               "the format must be one of the values of chars_format");
+
+  if (__precision < 0)
+  {
+    if (__fmt == chars_format::hex)
+    {
+      return ::cuda::std::__to_chars_fp_shortest(__first, __last, __value, __fmt);
+    }
+    __precision = 6;
+  }
+
+  const auto __bits = ::cuda::std::__to_chars_fp_decompose(__value);
+  if (__bits.__negative_)
+  {
+    if (__first == __last)
+    {
+      return {__last, errc::value_too_large};
+    }
+    *__first++ = '-';
+  }
+  if (__bits.__exponent_ == (1 << __to_chars_fp_exp_nbits_v<_Tp>) - 1)
+  {
+    return ::cuda::std::__to_chars_fp_non_finite(__first, __last, __bits.__mantissa_ != 0);
+  }
+
+  switch (__fmt)
+  {
+    case chars_format::scientific:
+      return ::cuda::std::__to_chars_fp_scientific_precision<_Tp>(__first, __last, __bits, __precision);
+    case chars_format::fixed:
+      return ::cuda::std::__to_chars_fp_fixed_precision<_Tp>(__first, __last, __bits, __precision);
+    case chars_format::hex:
+      return ::cuda::std::__to_chars_fp_hex<_Tp>(__first, __last, __bits, __precision);
+    default:
+      return ::cuda::std::__to_chars_fp_general_precision<_Tp>(__first, __last, __bits, __precision);
+  }
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___CHARCONV_TO_CHARS_FP_H
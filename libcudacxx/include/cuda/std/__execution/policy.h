@@ -38,6 +38,7 @@
 #include <cuda/std/__type_traits/is_same.h>
 #include <cuda/std/__type_traits/remove_cvref.h>
 #include <cuda/std/__utility/forward.h>
+#include <cuda/std/__utility/integer_sequence.h>
 #include <cuda/std/__utility/move.h>
 #include <cuda/std/cstdint>
 
@@ -50,6 +51,16 @@ _CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
   return ::cuda::std::has_single_bit(static_cast<uint32_t>(__backends));
 }
 
+[[nodiscard]] _CCCL_API constexpr bool __is_parallel_policy(const __execution_policy __policy) noexcept
+{
+  return (static_cast<uint8_t>(__policy) & static_cast<uint8_t>(__execution_policy::__parallel)) != 0;
+}
+
+[[nodiscard]] _CCCL_API constexpr bool __is_unsequenced_policy(const __execution_policy __policy) noexcept
+{
+  return (static_cast<uint8_t>(__policy) & static_cast<uint8_t>(__execution_policy::__unsequenced)) != 0;
+}
+
 //! @brief Base class for our execution policies.
 //! It takes an untagged uint32_t because we want to be able to store 3 different enumerations in it.
 template <uint32_t _Policy, class... _Envs>
@@ -73,7 +84,7 @@ struct __execution_policy_base : env<__unwrap_reference_t<_Envs>...>
   //! Forwards queries to the env
   using env<__unwrap_reference_t<_Envs>...>::query;
 
-#if _CCCL_HAS_CTK() && !_CCCL_COMPILER(NVRTC)
+#if !_CCCL_COMPILER(NVRTC)
   //! @brief create a new policy with additional environments attached
   template <class _Env, size_t... _Indices>
   [[nodiscard]] _CCCL_HOST_API constexpr __execution_policy_base<_Policy, _Env, _Envs...>
@@ -95,6 +106,7 @@ struct __execution_policy_base : env<__unwrap_reference_t<_Envs>...>
   template <class _Env>
   [[nodiscard]] _CCCL_HOST_API constexpr auto with(_Env&& __env) const
   {
+#  if _CCCL_HAS_CTK()
     if constexpr (__convertible_to_stream_ref<_Env>
                   && (is_lvalue_reference_v<_Env> || is_same_v<remove_cvref_t<_Env>, ::cudaStream_t>) )
     { // streams are special in that they are their own environment, but we always want to store a stream_ref
@@ -125,6 +137,7 @@ struct __execution_policy_base : env<__unwrap_reference_t<_Envs>...>
       }
     }
     else
+#  endif // _CCCL_HAS_CTK()
     {
       return __with(::cuda::std::forward<_Env>(__env), ::cuda::std::make_index_sequence<sizeof...(_Envs)>());
     }
@@ -134,6 +147,7 @@ struct __execution_policy_base : env<__unwrap_reference_t<_Envs>...>
   template <class _Tag, class _Value>
   [[nodiscard]] _CCCL_HOST_API constexpr auto with(const _Tag& __tag, _Value&& __value) const
   {
+#  if _CCCL_HAS_CTK()
     if constexpr (is_same_v<remove_cvref_t<_Tag>, ::cuda::get_stream_t>)
     { // We want to force the use of ::cuda::stream_ref
       // We must reject prvalue cuda::stream because they are not copyable
@@ -163,12 +177,13 @@ struct __execution_policy_base : env<__unwrap_reference_t<_Envs>...>
       }
     }
     else
+#  endif // _CCCL_HAS_CTK()
     {
       return __with(prop{__tag, ::cuda::std::forward<_Value>(__value)},
                     ::cuda::std::make_index_sequence<sizeof...(_Envs)>());
     }
   }
-#endif // _CCCL_HAS_CTK() && !_CCCL_COMPILER(NVRTC)
+#endif // !_CCCL_COMPILER(NVRTC)
 };
 
 using sequenced_policy = __execution_policy_base<static_cast<uint32_t>(__execution_policy::__sequenced)>;
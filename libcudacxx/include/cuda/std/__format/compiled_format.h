@@ -0,0 +1,261 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___FORMAT_COMPILED_FORMAT_H
+#define _CUDA_STD___FORMAT_COMPILED_FORMAT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__format/format_arg.h>
+#include <cuda/std/__format/format_error.h>
+#include <cuda/std/__format/format_parse_context.h>
+#include <cuda/std/__format/format_spec_parser.h>
+#include <cuda/std/__format/formatter.h>
+#include <cuda/std/__format/output_utils.h>
+#include <cuda/std/__format/parse_arg_id.h>
+#include <cuda/std/__format/validation.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/__type_traits/remove_cvref.h>
+#include <cuda/std/__utility/monostate.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/cstdint>
+#include <cuda/std/string_view>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+//! @brief The kinds of steps of a compiled format string.
+enum class __fmt_compiled_op_kind : uint8_t
+{
+  __literal, //!< Copies a run of the format string, without the escaping braces.
+  __field, //!< Formats an argument without format specification.
+  __field_spec, //!< Formats an argument with the format specification parsed at compile time.
+};
+
+//! @brief The maximum size of a compiled format string, which fits the offsets of its steps.
+inline constexpr size_t __fmt_compiled_max_size = 0xffff;
+
+//! @brief A step of a compiled format string.
+template <class _CharT>
+struct __fmt_compiled_op
+{
+  __fmt_compiled_op_kind __kind_;
+  uint16_t __arg_id_;
+  //! The offset in the format string of the literal, or of the end of the arg-id of the field.
+  uint16_t __begin_;
+  uint16_t __size_;
+  __fmt_spec_parser<_CharT> __parser_;
+};
+
+//! @brief Stands for the steps of a format string that is not compiled, either a runtime format string or any format
+//!        string when consteval is not available.
+struct __fmt_not_compiled_t
+{};
+
+//! @brief The literals and replacement fields of a format string, parsed once by its compile-time validation.
+//!
+//! The format strings with more steps than the capacity, longer than 65535 characters, or that have a format
+//! specification for an argument with a user-defined formatter, are not compiled and are parsed again by each
+//! formatting function.
+//!
+//! @tparam _Capacity The maximum number of steps. Each argument formatted once takes up to two steps and each escaped
+//!         brace splits a literal in two.
+template <class _CharT, size_t _Capacity>
+struct __fmt_compiled_format
+{
+  //! The steps are left uninitialized for the runtime format strings, which are never compiled.
+  union
+  {
+    char __none_;
+    __fmt_compiled_op<_CharT> __ops_[_Capacity];
+  };
+  size_t __size_{0};
+  bool __valid_{false};
+
+  _CCCL_API constexpr __fmt_compiled_format() noexcept
+      : __ops_{}
+  {}
+
+  _CCCL_API constexpr explicit __fmt_compiled_format(__fmt_not_compiled_t) noexcept
+      : __none_{}
+  {}
+
+  _CCCL_API constexpr void __push(const __fmt_compiled_op<_CharT>& __op) noexcept
+  {
+    if (__size_ == _Capacity)
+    {
+      __valid_ = false;
+      return;
+    }
+    __ops_[__size_++] = __op;
+  }
+
+  _CCCL_API constexpr void __push_literal(const _CharT* __fmt, const _CharT* __first, const _CharT* __last) noexcept
+  {
+    if (__first != __last)
+    {
+      __push({__fmt_compiled_op_kind::__literal,
+              0,
+              static_cast<uint16_t>(__first - __fmt),
+              static_cast<uint16_t>(__last - __first),
+              {}});
+    }
+  }
+};
+
+//! @brief Compiles a format string that passed the validation.
+template <size_t _Capacity, class _CharT>
+[[nodiscard]] _CCCL_API constexpr __fmt_compiled_format<_CharT, _Capacity> __fmt_compile_format_string(
+  basic_string_view<_CharT> __fmt, __fmt_validation_format_context<_CharT> __ctx, size_t __num_args)
+{
+  __fmt_compiled_format<_CharT, _Capacity> __result{};
+  __result.__valid_ = __fmt.size() <= __fmt_compiled_max_size;
+  if (!__result.__valid_)
+  {
+    return __result;
+  }
+
+  basic_format_parse_context<_CharT> __parse_ctx{__fmt, __num_args};
+  const _CharT* const __first = __fmt.data();
+  const _CharT* const __end   = __first + __fmt.size();
+  const _CharT* __begin       = __first;
+  const _CharT* __literal     = __first;
+  while (__begin != __end)
+  {
+    if (*__begin != _CharT{'{'} && *__begin != _CharT{'}'})
+    {
+      ++__begin;
+      continue;
+    }
+
+    // The validation guarantees that '}' starts an escape sequence and that '{' is followed by another character.
+    const bool __escape = (*__begin == _CharT{'}'}) || (__begin[1] == _CharT{'{'});
+    __result.__push_literal(__first, __literal, __begin + __escape);
+    if (__escape)
+    {
+      __begin += 2;
+      __literal = __begin;
+      continue;
+    }
+
+    const auto __r = ::cuda::std::__fmt_parse_arg_id(__begin + 1, __end, __parse_ctx);
+    __fmt_compiled_op<_CharT> __op{__fmt_compiled_op_kind::__field,
+                                   static_cast<uint16_t>(__r.__value),
+                                   static_cast<uint16_t>(__r.__last - __first),
+                                   0,
+                                   {}};
+    __begin = __r.__last;
+    if (*__r.__last == _CharT{':'})
+    {
+      const __fmt_arg_t __type = __ctx.arg(__r.__value);
+      if (__type == __fmt_arg_t::__handle)
+      {
+        __result.__valid_ = false;
+        return __result;
+      }
+      __parse_ctx.advance_to(__r.__last + 1);
+      __op.__kind_   = __fmt_compiled_op_kind::__field_spec;
+      __op.__parser_ = ::cuda::std::__fmt_validate_visit_format_arg(__parse_ctx, __ctx, __type);
+      __begin        = __parse_ctx.begin();
+    }
+    __result.__push(__op);
+
+    // Skips the closing brace of the replacement field.
+    __literal = ++__begin;
+  }
+  __result.__push_literal(__first, __literal, __end);
+  return __result;
+}
+
+template <class _CharT, class _Ctx>
+struct __fmt_compiled_field_visitor
+{
+  basic_string_view<_CharT> __fmt_;
+  const __fmt_compiled_op<_CharT>& __op_;
+  size_t __num_args_;
+  _Ctx& __ctx_;
+
+  template <class _Tp>
+  _CCCL_API void operator()([[maybe_unused]] _Tp __arg)
+  {
+    if constexpr (is_same_v<_Tp, monostate>)
+    {
+      ::cuda::std::__throw_format_error("The argument index value is too large for the number of arguments supplied");
+    }
+    else if constexpr (is_same_v<_Tp, typename basic_format_arg<_Ctx>::handle>)
+    {
+      // A user-defined formatter parses its empty format specification, which starts at the closing brace.
+      basic_format_parse_context<_CharT> __parse_ctx{
+        basic_string_view<_CharT>{__fmt_.data() + __op_.__begin_, __fmt_.size() - __op_.__begin_}, __num_args_};
+      __arg.format(__parse_ctx, __ctx_);
+    }
+    else
+    {
+      formatter<_Tp, _CharT> __formatter;
+      if (__op_.__kind_ == __fmt_compiled_op_kind::__field_spec)
+      {
+        __formatter.__parser_ = __op_.__parser_;
+      }
+      __ctx_.advance_to(__formatter.format(__arg, __ctx_));
+    }
+  }
+};
+
+// NVHPC warns about using __attribute__((noinline)) on an inline function.
+_CCCL_DIAG_PUSH
+_CCCL_DIAG_SUPPRESS_NVHPC(inline_gnu_noinline_conflict)
+
+//! @brief Formats the arguments with the steps of a compiled format string, without parsing it.
+template <class _CharT, size_t _Capacity, class _Ctx>
+[[nodiscard]] _CCCL_API _CCCL_NOINLINE_DEVICE typename _Ctx::iterator
+__fmt_format_compiled(basic_string_view<_CharT> __fmt,
+                      const __fmt_compiled_format<_CharT, _Capacity>& __compiled,
+                      size_t __num_args,
+                      _Ctx&& __ctx)
+{
+  using _FmtCtx = remove_cvref_t<_Ctx>;
+
+  typename _FmtCtx::iterator __out_it = __ctx.out();
+  for (size_t __i = 0; __i != __compiled.__size_; ++__i)
+  {
+    const __fmt_compiled_op<_CharT>& __op = __compiled.__ops_[__i];
+    if (__op.__kind_ == __fmt_compiled_op_kind::__literal)
+    {
+      __out_it = ::cuda::std::__fmt_copy(
+        basic_string_view<_CharT>{__fmt.data() + __op.__begin_, __op.__size_}, ::cuda::std::move(__out_it));
+    }
+    else
+    {
+      __ctx.advance_to(::cuda::std::move(__out_it));
+      ::cuda::std::visit_format_arg(
+        __fmt_compiled_field_visitor<_CharT, _FmtCtx>{__fmt, __op, __num_args, __ctx}, __ctx.arg(__op.__arg_id_));
+      __out_it = __ctx.out();
+    }
+  }
+  return __out_it;
+}
+
+_CCCL_DIAG_POP
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___FORMAT_COMPILED_FORMAT_H
@@ -0,0 +1,256 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD__FORMAT_FORMAT_FLOATING_POINT_H
+#define _CUDA_STD__FORMAT_FORMAT_FLOATING_POINT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__charconv/chars_format.h>
+#include <cuda/std/__charconv/to_chars.h>
+#include <cuda/std/__format/format_integral.h>
+#include <cuda/std/__format/format_spec_parser.h>
+#include <cuda/std/__format/output_utils.h>
+#include <cuda/std/__limits/numeric_limits.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/__utility/to_underlying.h>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+//! The number of fractional digits of the exact value of the floating-point type with the most of them, which is its
+//! smallest subnormal value. Any digit after them is 0, so larger precisions only append zeros to the output.
+template <class _Tp>
+inline constexpr int __fmt_fp_fraction_digits_v = __to_chars_fp_exp_bias_v<_Tp> - 1 + __to_chars_fp_mant_nbits_v<_Tp>;
+
+//! The number of hexadecimal digits of the mantissa, after which the hexfloat output only appends zeros.
+template <class _Tp>
+inline constexpr int __fmt_fp_hex_digits_v = (__to_chars_fp_mant_nbits_v<_Tp> + 3) / 4;
+
+//! The buffer size to output a floating-point value, whose longest output is the fixed one of its largest value with
+//! all its fractional digits.
+template <class _Tp>
+inline constexpr int __fmt_fp_buffer_size_v =
+  1 // Reserve space for the sign.
+  + numeric_limits<_Tp>::max_exponent10 + 1 // The number of integral digits.
+  + 1 // Reserve space for the decimal point.
+  + __fmt_fp_fraction_digits_v<_Tp> // The number of fractional digits.
+  + 1; // Reserve space for the decimal point added by the alternate form.
+
+//! Converts the letters of the output to upper case for the upper case types.
+struct __fmt_fp_case
+{
+  bool __upper_case_;
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr char operator()(char __c) const noexcept
+  {
+    return (__upper_case_ && __c >= 'a' && __c <= 'z') ? static_cast<char>(__c - 'a' + 'A') : __c;
+  }
+};
+
+//! Writes [__first, __exponent) followed by __zeros zeros and [__exponent, __last), with the required padding.
+template <class _CharT, class _OutIt>
+[[nodiscard]] _CCCL_HOST_DEVICE_API _OutIt __fmt_write_fp(
+  const char* __first,
+  const char* __exponent,
+  const char* __last,
+  size_t __zeros,
+  _OutIt __out_it,
+  __fmt_parsed_spec<_CharT> __specs,
+  bool __upper_case)
+{
+  const size_t __size = static_cast<size_t>(__last - __first) + __zeros;
+  if (__zeros == 0)
+  {
+    if (!__upper_case)
+    {
+      return ::cuda::std::__fmt_write(__first, __last, ::cuda::std::move(__out_it), __specs);
+    }
+    return ::cuda::std::__fmt_write_transformed(
+      __first, __last, ::cuda::std::move(__out_it), __specs, __fmt_fp_case{true});
+  }
+
+  __fmt_padding_size_result __padding{0, 0};
+  if (__size < __specs.__width_)
+  {
+    __padding =
+      ::cuda::std::__fmt_padding_size(__size, __specs.__width_, __fmt_spec_alignment{__specs.__std_.__alignment_});
+  }
+  __out_it = ::cuda::std::__fmt_fill(::cuda::std::move(__out_it), __padding.__before_, __specs.__fill_);
+  const __fmt_fp_case __case{__upper_case};
+  __out_it = ::cuda::std::__fmt_transform(__first, __exponent, ::cuda::std::move(__out_it), __case);
+  __out_it = ::cuda::std::__fmt_fill(::cuda::std::move(__out_it), __zeros, _CharT{'0'});
+  __out_it = ::cuda::std::__fmt_transform(__exponent, __last, ::cuda::std::move(__out_it), __case);
+  return ::cuda::std::__fmt_fill(::cuda::std::move(__out_it), __padding.__after_, __specs.__fill_);
+}
+
+template <class _Tp, class _CharT, class _OutIt>
+[[nodiscard]] _CCCL_HOST_DEVICE_API _OutIt
+__fmt_format_fp(_Tp __value, _OutIt __out_it, __fmt_parsed_spec<_CharT> __specs)
+{
+  constexpr int __buffer_size = __fmt_fp_buffer_size_v<_Tp>;
+  char __buffer[__buffer_size];
+
+  const auto __bits     = ::cuda::std::__to_chars_fp_decompose(__value);
+  const bool __finite   = __bits.__exponent_ != (1 << __to_chars_fp_exp_nbits_v<_Tp>) - 1;
+  const __fmt_spec_type __type = __specs.__std_.__type_;
+  const bool __hexfloat =
+    __type == __fmt_spec_type::__hexfloat_lower_case || __type == __fmt_spec_type::__hexfloat_upper_case;
+  const bool __upper_case = __type == __fmt_spec_type::__hexfloat_upper_case
+                         || __type == __fmt_spec_type::__scientific_upper_case
+                         || __type == __fmt_spec_type::__fixed_upper_case
+                         || __type == __fmt_spec_type::__general_upper_case;
+
+  char* __first = ::cuda::std::__fmt_insert_sign(__buffer, __bits.__negative_, __fmt_spec_sign{__specs.__std_.__sign_});
+  const _Tp __abs_value = __bits.__negative_ ? -__value : __value;
+
+  // The precision is limited to the digits that are not always 0, the remaining zeros are appended to the output
+  int __precision = __specs.__precision_;
+  int __zeros     = 0;
+  const int __precision_max = __hexfloat ? __fmt_fp_hex_digits_v<_Tp> : __fmt_fp_fraction_digits_v<_Tp>;
+  if (__precision > __precision_max)
+  {
+    __zeros     = __precision - __precision_max;
+    __precision = __precision_max;
+  }
+
+  char* const __end = __buffer + __buffer_size - 1;
+  to_chars_result __r{};
+  switch (__type)
+  {
+    case __fmt_spec_type::__default:
+      __r = __specs.__has_precision()
+            ? ::cuda::std::to_chars(__first, __end, __abs_value, chars_format::general, __precision)
+            : ::cuda::std::to_chars(__first, __end, __abs_value);
+      // The general format with a precision has no zeros after the last significant digit
+      __zeros = 0;
+      break;
+    case __fmt_spec_type::__hexfloat_lower_case:
+    case __fmt_spec_type::__hexfloat_upper_case:
+      __r = __specs.__has_precision()
+            ? ::cuda::std::to_chars(__first, __end, __abs_value, chars_format::hex, __precision)
+            : ::cuda::std::to_chars(__first, __end, __abs_value, chars_format::hex);
+      break;
+    case __fmt_spec_type::__scientific_lower_case:
+    case __fmt_spec_type::__scientific_upper_case:
+      __r = ::cuda::std::to_chars(__first, __end, __abs_value, chars_format::scientific, __precision);
+      break;
+    case __fmt_spec_type::__fixed_lower_case:
+    case __fmt_spec_type::__fixed_upper_case:
+      __r = ::cuda::std::to_chars(__first, __end, __abs_value, chars_format::fixed, __precision);
+      break;
+    case __fmt_spec_type::__general_lower_case:
+    case __fmt_spec_type::__general_upper_case:
+      __r = ::cuda::std::to_chars(__first, __end, __abs_value, chars_format::general, __precision);
+      __zeros = 0;
+      break;
+    default:
+      _CCCL_UNREACHABLE();
+  }
+  _CCCL_ASSERT(__r.ec == errc(0), "Internal buffer too small");
+  char* __last = __r.ptr;
+
+  if (!__finite)
+  {
+    // [format.string.std]/13: the zero-padding does not apply to infinity and NaN
+    if (__fmt_spec_alignment{__specs.__alignment_} == __fmt_spec_alignment::__zero_padding)
+    {
+      __specs.__alignment_ = ::cuda::std::to_underlying(__fmt_spec_alignment::__right);
+    }
+    return ::cuda::std::__fmt_write_fp(__buffer, __last, __last, 0, ::cuda::std::move(__out_it), __specs, __upper_case);
+  }
+
+  // The zeros appended for the precision go before the exponent, which starts with p for the hexfloat output whose
+  // digits contain e
+  const char __exponent_char = __hexfloat ? 'p' : 'e';
+  char* __exponent           = __first;
+  char* __point              = nullptr;
+  for (; __exponent != __last && *__exponent != __exponent_char; ++__exponent)
+  {
+    if (*__exponent == '.')
+    {
+      __point = __exponent;
+    }
+  }
+
+  if (__specs.__std_.__alternate_form_)
+  {
+    // The alternate form always has a decimal point
+    if (__point == nullptr)
+    {
+      for (char* __it = __last; __it != __exponent; --__it)
+      {
+        *__it = __it[-1];
+      }
+      __point = __exponent;
+      *__exponent++ = '.';
+      ++__last;
+    }
+    // and the general format keeps its trailing zeros, but not the default format which is not a g conversion
+    if (__type == __fmt_spec_type::__general_lower_case || __type == __fmt_spec_type::__general_upper_case)
+    {
+      const int __p = __specs.__precision_ == 0 ? 1 : __specs.__precision_;
+      int __expected = 0;
+      if (__exponent != __last)
+      {
+        __expected = __p - 1;
+      }
+      else if (*__first != '0')
+      {
+        __expected = __p - static_cast<int>(__point - __first);
+      }
+      else
+      {
+        // P - 1 - X for the decimal exponent X of the first significant digit of 0.000ddd, or 0 for 0
+        __expected = __p - 1;
+        for (const char* __it = __point + 1; __it != __exponent; ++__it)
+        {
+          if (*__it != '0')
+          {
+            __expected = __p + static_cast<int>(__it - __point) - 1;
+            break;
+          }
+        }
+      }
+      const int __actual = static_cast<int>(__exponent - __point) - 1;
+      __zeros            = __expected > __actual ? __expected - __actual : 0;
+    }
+  }
+
+  if (__fmt_spec_alignment{__specs.__alignment_} == __fmt_spec_alignment::__zero_padding)
+  {
+    // The zero padding goes between the sign and the digits
+    __out_it                  = ::cuda::std::__fmt_copy(__buffer, __first, ::cuda::std::move(__out_it));
+    __specs.__alignment_      = ::cuda::std::to_underlying(__fmt_spec_alignment::__right);
+    __specs.__fill_.__data[0] = _CharT{'0'};
+    __specs.__width_ -= ::cuda::std::min(static_cast<uint32_t>(__first - __buffer), __specs.__width_);
+    return ::cuda::std::__fmt_write_fp(
+      __first, __exponent, __last, __zeros, ::cuda::std::move(__out_it), __specs, __upper_case);
+  }
+  return ::cuda::std::__fmt_write_fp(
+    __buffer, __exponent, __last, __zeros, ::cuda::std::move(__out_it), __specs, __upper_case);
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD__FORMAT_FORMAT_FLOATING_POINT_H
@@ -206,6 +206,7 @@ struct __fmt_spec_fields
   __ret.__sign_                 = true;
   __ret.__alternate_form_       = true;
   __ret.__zero_padding_         = true;
+  __ret.__precision_            = true;
   __ret.__locale_specific_form_ = true;
   __ret.__type_                 = true;
   __ret.__consume_all_          = true;
@@ -22,6 +22,8 @@
 
 #include <cuda/std/__concepts/concept_macros.h>
 #include <cuda/std/__concepts/convertible_to.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__format/compiled_format.h>
 #include <cuda/std/__format/dynamic_format.h>
 #include <cuda/std/__format/format_arg.h>
 #include <cuda/std/__format/format_arg_store.h>
@@ -49,18 +51,19 @@ struct _CCCL_TYPE_VISIBILITY_DEFAULT basic_format_string
       constexpr _FmtArgHandle __handles[] = {
         ::cuda::std::__fmt_make_validation_format_arg_handle<_FmtContext, remove_cvref_t<_Args>>()...};
 
-      (void) ::cuda::std::__fmt_vformat_to(basic_format_parse_context<_CharT>{__str_, sizeof...(_Args)},
-                                           _FmtContext{__types, __handles, sizeof...(_Args)});
+      __validate_and_compile(_FmtContext{__types, __handles, sizeof...(_Args)});
     }
     else
     {
-      (void) ::cuda::std::__fmt_vformat_to(
-        basic_format_parse_context<_CharT>{__str_, sizeof...(_Args)}, _FmtContext{nullptr, nullptr, sizeof...(_Args)});
+      __validate_and_compile(_FmtContext{nullptr, nullptr, sizeof...(_Args)});
     }
   }
 
   _CCCL_API constexpr basic_format_string(__dynamic_format_string<_CharT> __s) noexcept
       : __str_{__s.__get()}
+#if !defined(_CCCL_NO_CONSTEVAL)
+      , __compiled_{__fmt_not_compiled_t{}}
+#endif // !_CCCL_NO_CONSTEVAL
   {}
 
   [[nodiscard]] _CCCL_API constexpr basic_string_view<_CharT> get() const noexcept
@@ -68,11 +71,48 @@ struct _CCCL_TYPE_VISIBILITY_DEFAULT basic_format_string
     return __str_;
   }
 
-private:
-  basic_string_view<_CharT> __str_;
+#if !defined(_CCCL_NO_CONSTEVAL)
+  //! @brief The steps of the format string compiled by its compile-time validation, which are invalid for the runtime
+  //!        format strings.
+  [[nodiscard]] _CCCL_API constexpr const auto& __get_compiled() const noexcept
+  {
+    return __compiled_;
+  }
+#else // ^^^ !_CCCL_NO_CONSTEVAL ^^^ / vvv _CCCL_NO_CONSTEVAL vvv
+  //! @brief Without consteval the validation mostly runs at runtime, where compiling would only slow it down, so the
+  //!        format strings are parsed by each formatting function and carry no steps.
+  [[nodiscard]] _CCCL_API constexpr __fmt_not_compiled_t __get_compiled() const noexcept
+  {
+    return {};
+  }
+#endif // ^^^ _CCCL_NO_CONSTEVAL ^^^
 
+private:
   using _FmtContext   = __fmt_validation_format_context<_CharT>;
   using _FmtArgHandle = __fmt_validation_format_arg_handle<_CharT>;
+
+#if !defined(_CCCL_NO_CONSTEVAL)
+  static constexpr size_t __compiled_capacity = 2 * sizeof...(_Args) + 3;
+#endif // !_CCCL_NO_CONSTEVAL
+
+  _CCCL_API _CCCL_CONSTEVAL void __validate_and_compile(_FmtContext __ctx)
+  {
+    (void) ::cuda::std::__fmt_vformat_to(
+      basic_format_parse_context<_CharT>{__str_, sizeof...(_Args)}, _FmtContext{__ctx});
+
+#if !defined(_CCCL_NO_CONSTEVAL)
+    // Compiling the format string only pays off when it is done at compile time.
+    _CCCL_IF_CONSTEVAL
+    {
+      __compiled_ = ::cuda::std::__fmt_compile_format_string<__compiled_capacity>(__str_, __ctx, sizeof...(_Args));
+    }
+#endif // !_CCCL_NO_CONSTEVAL
+  }
+
+  basic_string_view<_CharT> __str_;
+#if !defined(_CCCL_NO_CONSTEVAL)
+  __fmt_compiled_format<_CharT, __compiled_capacity> __compiled_{};
+#endif // !_CCCL_NO_CONSTEVAL
 };
 
 _CCCL_END_NAMESPACE_CUDA_STD
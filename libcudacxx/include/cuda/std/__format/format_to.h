@@ -35,7 +35,11 @@ _CCCL_TEMPLATE(class _OutIt, class... _Args)
 _CCCL_REQUIRES(output_iterator<_OutIt, const char&>)
 /*discard*/ _CCCL_API _OutIt format_to(_OutIt __out_it, format_string<_Args...> __fmt, _Args&&... __args)
 {
-  return ::cuda::std::vformat_to(::cuda::std::move(__out_it), __fmt.get(), ::cuda::std::make_format_args(__args...));
+  return ::cuda::std::__vformat_to_impl(
+    ::cuda::std::move(__out_it),
+    __fmt.get(),
+    format_args{::cuda::std::make_format_args(__args...)},
+    __fmt.__get_compiled());
 }
 
 #if _CCCL_HAS_WCHAR_T()
@@ -43,7 +47,11 @@ _CCCL_TEMPLATE(class _OutIt, class... _Args)
 _CCCL_REQUIRES(output_iterator<_OutIt, const wchar_t&>)
 /*discard*/ _CCCL_API _OutIt format_to(_OutIt __out_it, wformat_string<_Args...> __fmt, _Args&&... __args)
 {
-  return ::cuda::std::vformat_to(::cuda::std::move(__out_it), __fmt.get(), ::cuda::std::make_wformat_args(__args...));
+  return ::cuda::std::__vformat_to_impl(
+    ::cuda::std::move(__out_it),
+    __fmt.get(),
+    wformat_args{::cuda::std::make_wformat_args(__args...)},
+    __fmt.__get_compiled());
 }
 #endif // _CCCL_HAS_WCHAR_T()
 
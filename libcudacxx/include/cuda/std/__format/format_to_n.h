@@ -24,7 +24,7 @@
 #include <cuda/std/__format/buffer.h>
 #include <cuda/std/__format/format_args.h>
 #include <cuda/std/__format/format_context.h>
-#include <cuda/std/__format/format_parse_context.h>
+#include <cuda/std/__format/format_string.h>
 #include <cuda/std/__format/vformat_to.h>
 #include <cuda/std/__iterator/incrementable_traits.h>
 #include <cuda/std/__memory/addressof.h>
@@ -71,14 +71,20 @@ public:
   }
 };
 
-template <class _Context, class _OutIt, class _CharT>
+template <class _Context, class _OutIt, class _CharT, class _Compiled>
 [[nodiscard]] _CCCL_API format_to_n_result<_OutIt> __format_to_n_impl(
-  _OutIt __out_it, iter_difference_t<_OutIt> __n, basic_string_view<_CharT> __fmt, basic_format_args<_Context> __args)
+  _OutIt __out_it,
+  iter_difference_t<_OutIt> __n,
+  basic_string_view<_CharT> __fmt,
+  const _Compiled& __compiled,
+  basic_format_args<_Context> __args)
 {
   __fmt_format_to_n_buffer<_OutIt, _CharT> __buffer{::cuda::std::move(__out_it), __n};
-  (void) ::cuda::std::__fmt_vformat_to(
-    basic_format_parse_context{__fmt, __args.__size()},
-    ::cuda::std::__fmt_make_format_context(__buffer.__make_output_iterator(), __args));
+  (void) ::cuda::std::__fmt_vformat_to_dispatch(
+    __fmt,
+    __args.__size(),
+    ::cuda::std::__fmt_make_format_context(__buffer.__make_output_iterator(), __args),
+    __compiled);
   return ::cuda::std::move(__buffer).__result();
 }
 
@@ -88,7 +94,7 @@ _CCCL_REQUIRES(output_iterator<_OutIt, const char&>)
 format_to_n(_OutIt __out_it, iter_difference_t<_OutIt> __n, format_string<_Args...> __fmt, _Args&&... __args)
 {
   return ::cuda::std::__format_to_n_impl<format_context>(
-    ::cuda::std::move(__out_it), __n, __fmt.get(), ::cuda::std::make_format_args(__args...));
+    ::cuda::std::move(__out_it), __n, __fmt.get(), __fmt.__get_compiled(), ::cuda::std::make_format_args(__args...));
 }
 
 #if _CCCL_HAS_WCHAR_T()
@@ -98,7 +104,7 @@ _CCCL_REQUIRES(output_iterator<_OutIt, const wchar_t&>)
 format_to_n(_OutIt __out_it, iter_difference_t<_OutIt> __n, wformat_string<_Args...> __fmt, _Args&&... __args)
 {
   return ::cuda::std::__format_to_n_impl<wformat_context>(
-    ::cuda::std::move(__out_it), __n, __fmt.get(), ::cuda::std::make_wformat_args(__args...));
+    ::cuda::std::move(__out_it), __n, __fmt.get(), __fmt.__get_compiled(), ::cuda::std::make_wformat_args(__args...));
 }
 #endif // _CCCL_HAS_WCHAR_T()
 
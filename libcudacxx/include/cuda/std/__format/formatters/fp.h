@@ -20,8 +20,12 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/std/__charconv/to_chars.h>
+#include <cuda/std/__format/format_floating_point.h>
 #include <cuda/std/__format/format_spec_parser.h>
 #include <cuda/std/__format/formatter.h>
+#include <cuda/std/__type_traits/conditional.h>
+#include <cuda/std/__type_traits/is_same.h>
 
 #include <cuda/std/__cccl/prologue.h>
 
@@ -59,9 +63,18 @@ struct __fmt_formatter_fp
   template <class _Tp, class _FmtCtx>
   _CCCL_HOST_DEVICE_API typename _FmtCtx::iterator format(_Tp __value, _FmtCtx& __ctx) const
   {
-    _CCCL_ASSERT(false, "formatter</*floating-point-type*/>::format() is not implemented");
-    (void) __value;
-    return __ctx.out();
+    if constexpr (__to_chars_fp_is_supported_v<_Tp>)
+    {
+      using _Up = conditional_t<is_same_v<_Tp, float>, float, double>;
+      return ::cuda::std::__fmt_format_fp(
+        static_cast<_Up>(__value), __ctx.out(), __parser_.__get_parsed_std_spec(__ctx));
+    }
+    else
+    {
+      _CCCL_ASSERT(false, "formatter<long double>::format() is not implemented");
+      (void) __value;
+      return __ctx.out();
+    }
   }
 
   __fmt_spec_parser<_CharT> __parser_; //!< The parser for format specifications.
@@ -25,6 +25,7 @@
 #include <cuda/std/__format/format_arg_store.h>
 #include <cuda/std/__format/format_error.h>
 #include <cuda/std/__format/format_parse_context.h>
+#include <cuda/std/__format/format_spec_parser.h>
 #include <cuda/std/__format/formatter.h>
 
 #include <cuda/std/__cccl/prologue.h>
@@ -145,9 +146,11 @@ public:
 // width, an exception of type format_error is thrown.
 //
 // _HasPrecision does the formatter have a precision?
+//
+// Returns the parsed format specification, which the compiled format strings store to format without parsing.
 template <class _CharT, class _Tp, bool _HasPrecision = false>
-_CCCL_API constexpr void __fmt_validate_format_arg(basic_format_parse_context<_CharT>& __parse_ctx,
-                                                   __fmt_validation_format_context<_CharT>& __ctx)
+_CCCL_API constexpr __fmt_spec_parser<_CharT> __fmt_validate_format_arg(
+  basic_format_parse_context<_CharT>& __parse_ctx, __fmt_validation_format_context<_CharT>& __ctx)
 {
   // LWG3720 originally allowed "signed or unsigned integer types", however
   // the final version explicitly changed it to "*standard* signed or unsigned
@@ -188,10 +191,11 @@ _CCCL_API constexpr void __fmt_validate_format_arg(basic_format_parse_context<_C
       }
     }
   }
+  return __formatter.__parser_;
 }
 
 template <class _CharT>
-_CCCL_API constexpr void __fmt_validate_visit_format_arg(
+_CCCL_API constexpr __fmt_spec_parser<_CharT> __fmt_validate_visit_format_arg(
   basic_format_parse_context<_CharT>& __parse_ctx, __fmt_validation_format_context<_CharT>& __ctx, __fmt_arg_t __type)
 {
   switch (__type)
@@ -22,6 +22,7 @@
 
 #include <cuda/std/__concepts/concept_macros.h>
 #include <cuda/std/__format/buffer.h>
+#include <cuda/std/__format/compiled_format.h>
 #include <cuda/std/__format/format_arg.h>
 #include <cuda/std/__format/format_args.h>
 #include <cuda/std/__format/format_context.h>
@@ -184,21 +185,46 @@ __fmt_vformat_to(_ParseCtx&& __parse_ctx, _Ctx&& __ctx)
 
 _CCCL_DIAG_POP
 
-template <class _OutIt, class _CharT, class _FormatOutIt>
+//! @brief Formats with the steps of the format string compiled by its validation, when there is one and the validation
+//!        could compile it, and otherwise parses the format string. Without consteval the format strings pass
+//!        __fmt_not_compiled_t instead of the steps.
+template <class _CharT, class _Ctx, class... _Compiled>
+[[nodiscard]] _CCCL_API typename _Ctx::iterator __fmt_vformat_to_dispatch(
+  basic_string_view<_CharT> __fmt, size_t __num_args, _Ctx&& __ctx, const _Compiled&... __compiled)
+{
+  if constexpr (sizeof...(_Compiled) != 0 && (!is_same_v<_Compiled, __fmt_not_compiled_t> && ...))
+  {
+    if ((__compiled.__valid_ && ...))
+    {
+      return ::cuda::std::__fmt_format_compiled(__fmt, __compiled..., __num_args, ::cuda::std::move(__ctx));
+    }
+  }
+  return ::cuda::std::__fmt_vformat_to(basic_format_parse_context{__fmt, __num_args}, ::cuda::std::move(__ctx));
+}
+
+template <class _OutIt, class _CharT, class _FormatOutIt, class... _Compiled>
 [[nodiscard]] _CCCL_API _OutIt __vformat_to_impl(
-  _OutIt __out_it, basic_string_view<_CharT> __fmt, basic_format_args<basic_format_context<_FormatOutIt, _CharT>> __args)
+  _OutIt __out_it,
+  basic_string_view<_CharT> __fmt,
+  basic_format_args<basic_format_context<_FormatOutIt, _CharT>> __args,
+  const _Compiled&... __compiled)
 {
   if constexpr (is_same_v<_OutIt, _FormatOutIt>)
   {
-    return ::cuda::std::__fmt_vformat_to(basic_format_parse_context{__fmt, __args.__size()},
-                                         ::cuda::std::__fmt_make_format_context(::cuda::std::move(__out_it), __args));
+    return ::cuda::std::__fmt_vformat_to_dispatch(
+      __fmt,
+      __args.__size(),
+      ::cuda::std::__fmt_make_format_context(::cuda::std::move(__out_it), __args),
+      __compiled...);
   }
   else
   {
     __fmt_buffer_select_t<_OutIt, _CharT> __buffer{::cuda::std::move(__out_it)};
-    (void) ::cuda::std::__fmt_vformat_to(
-      basic_format_parse_context{__fmt, __args.__size()},
-      ::cuda::std::__fmt_make_format_context(__buffer.__make_output_iterator(), __args));
+    (void) ::cuda::std::__fmt_vformat_to_dispatch(
+      __fmt,
+      __args.__size(),
+      ::cuda::std::__fmt_make_format_context(__buffer.__make_output_iterator(), __args),
+      __compiled...);
     return ::cuda::std::move(__buffer).__out_it();
   }
 }
@@ -56,6 +56,9 @@ enum __execution_backend : uint8_t
 #if _CCCL_HAS_BACKEND_TBB()
   __tbb = 1 << 2,
 #endif // _CCCL_HAS_BACKEND_TBB()
+#if _CCCL_HAS_BACKEND_THREADS()
+  __threads = 1 << 3,
+#endif // _CCCL_HAS_BACKEND_THREADS()
 };
 
 //! @brief Extracts the execution backend from the stored _Policy
@@ -51,6 +51,7 @@ enum class __simd_operations_kind
   __default,
   __fixed_size_float,
   __fixed_size_integral,
+  __fixed_size_host_vector,
 };
 
 template <typename _Tp, typename _Abi>
@@ -65,6 +66,8 @@ struct __mask_storage;
 template <size_t _Bytes, typename _Abi>
 struct __mask_operations;
 
+struct __simd_access;
+
 _CCCL_END_NAMESPACE_CUDA_STD_SIMD
 
 #include <cuda/std/__cccl/epilogue.h>
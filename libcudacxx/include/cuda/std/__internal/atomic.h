@@ -52,4 +52,21 @@
 #  define _CCCL_HOST_128_ATOMICS_MAYBE()   0
 #endif
 
+// Host compilations can opt into lock free 16 byte atomics on top of the double width compare and swap of x86-64 by
+// defining CCCL_ENABLE_HOST_ATOMICS_DWCAS. This changes the layout of these atomics, so the macro must be defined the
+// same way in all translation units that share them, and CUDA compilations reject it, as the device has no 16 byte
+// compare and swap on all architectures. Loads are single 16 byte vector loads, which processors with AVX perform
+// atomically, so that they do not need a compare and swap that writes to the atomic.
+#if defined(CCCL_ENABLE_HOST_ATOMICS_DWCAS)
+#  if _CCCL_CUDA_COMPILATION()
+#    error "CCCL_ENABLE_HOST_ATOMICS_DWCAS is not supported in CUDA compilations."
+#  elif !(_CCCL_COMPILER(CLANG) || _CCCL_COMPILER(GCC)) || !_CCCL_HOST_ARCH(X86_64) || !defined(__SIZEOF_INT128__) \
+    || !defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16) || !defined(__AVX__)
+#    error "CCCL_ENABLE_HOST_ATOMICS_DWCAS requires GCC or Clang on x86-64 with -mcx16 and -mavx."
+#  endif
+#  define _CCCL_HOST_ATOMICS_DWCAS() 1
+#else // ^^^ CCCL_ENABLE_HOST_ATOMICS_DWCAS ^^^ / vvv !CCCL_ENABLE_HOST_ATOMICS_DWCAS vvv
+#  define _CCCL_HOST_ATOMICS_DWCAS() 0
+#endif // ^^^ !CCCL_ENABLE_HOST_ATOMICS_DWCAS ^^^
+
 #endif // _CUDA_STD___INTERNAL_ATOMIC_H
@@ -111,6 +111,24 @@
 #define _CCCL_HAS_SIMD_8BIT() \
   ((_CCCL_HAS_SIMD_8BIT_PTX() || _CCCL_HAS_SIMD_8BIT_INTRINSICS()) && !_CCCL_TILE_COMPILATION())
 
+// cuda::std::simd computes the operations of vectors that fill a vector register of an x86-64 host with GCC and Clang
+// vector extensions, whose width is given by the widest instruction set enabled for the translation unit. The vectors
+// keep their array storage, so their size and alignment do not depend on it. CUDA compilations keep the element loops.
+#if !_CCCL_CUDA_COMPILATION() && (_CCCL_COMPILER(GCC) || _CCCL_COMPILER(CLANG)) && _CCCL_HOST_ARCH(X86_64) \
+  && !defined(CCCL_DISABLE_SIMD_HOST_VECTOR)
+#  define _CCCL_HAS_SIMD_HOST_VECTOR() 1
+#  if defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512DQ__)
+#    define _CCCL_SIMD_HOST_VECTOR_BYTES 64
+#  elif defined(__AVX2__)
+#    define _CCCL_SIMD_HOST_VECTOR_BYTES 32
+#  else // SSE2 is part of x86-64
+#    define _CCCL_SIMD_HOST_VECTOR_BYTES 16
+#  endif
+#else
+#  define _CCCL_HAS_SIMD_HOST_VECTOR() 0
+#  define _CCCL_SIMD_HOST_VECTOR_BYTES 0
+#endif
+
 // Third party libraries
 
 #if (__has_include(<dlpack/dlpack.h>) || __has_include(<dlpack.h>)) && \
@@ -24,10 +24,27 @@
 #include <cuda/std/__cccl/prologue.h>
 
 #define _CCCL_HAS_BACKEND_CUDA() _CCCL_CUDA_COMPILATION() && !_CCCL_COMPILER(NVRTC)
-#define _CCCL_HAS_BACKEND_OMP()  0
-#define _CCCL_HAS_BACKEND_TBB()  0
-
-#define _CCCL_HAS_PSTL_BACKEND() (_CCCL_HAS_BACKEND_CUDA() || _CCCL_HAS_BACKEND_OMP() || _CCCL_HAS_BACKEND_TBB())
+// The OpenMP backend is available whenever the host compiler has OpenMP enabled
+#if defined(_OPENMP) && !_CCCL_COMPILER(NVRTC) && !defined(CCCL_DISABLE_PSTL_OMP_BACKEND)
+#  define _CCCL_HAS_BACKEND_OMP() 1
+#else // ^^^ _OPENMP ^^^ / vvv !_OPENMP vvv
+#  define _CCCL_HAS_BACKEND_OMP() 0
+#endif // !_OPENMP
+// The oneTBB backend is opt-in, because there is no way to detect whether the program links against oneTBB
+#if defined(CCCL_ENABLE_PSTL_TBB_BACKEND) && !_CCCL_COMPILER(NVRTC)
+#  define _CCCL_HAS_BACKEND_TBB() 1
+#else // ^^^ CCCL_ENABLE_PSTL_TBB_BACKEND ^^^ / vvv !CCCL_ENABLE_PSTL_TBB_BACKEND vvv
+#  define _CCCL_HAS_BACKEND_TBB() 0
+#endif // !CCCL_ENABLE_PSTL_TBB_BACKEND
+// The thread pool backend only requires the host standard library
+#if _CCCL_HOSTED() && !_CCCL_COMPILER(NVRTC) && !defined(CCCL_DISABLE_PSTL_THREADS_BACKEND)
+#  define _CCCL_HAS_BACKEND_THREADS() 1
+#else // ^^^ _CCCL_HOSTED() ^^^ / vvv !_CCCL_HOSTED() vvv
+#  define _CCCL_HAS_BACKEND_THREADS() 0
+#endif // !_CCCL_HOSTED()
+
+#define _CCCL_HAS_PSTL_BACKEND() \
+  (_CCCL_HAS_BACKEND_CUDA() || _CCCL_HAS_BACKEND_OMP() || _CCCL_HAS_BACKEND_TBB() || _CCCL_HAS_BACKEND_THREADS())
 
 #include <cuda/std/__cccl/epilogue.h>
 
@@ -0,0 +1,106 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_ADD_H
+#define _CUDA_STD___LINALG_ADD_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__linalg/blocked_loops.h>
+#include <cuda/std/__linalg/concepts.h>
+#include <cuda/std/__type_traits/is_execution_policy.h>
+
+#if _CCCL_HOSTED()
+#  include <cuda/std/__linalg/parallel.h>
+#endif // _CCCL_HOSTED()
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+template <class _InObj1, class _InObj2, class _OutObj>
+_CCCL_API constexpr void
+__add_range(const _InObj1& __x, const _InObj2& __y, const _OutObj& __z, size_t __first, size_t __last)
+{
+  ::cuda::std::linalg::__linalg_for_each_element(__z, __first, __last, [&](auto... __indices) {
+    __z(__indices...) = __x(__indices...) + __y(__indices...);
+  });
+}
+
+template <class _InObj1, class _InObj2, class _OutObj>
+[[nodiscard]] _CCCL_API constexpr bool __add_same_extents(const _InObj1& __x, const _InObj2& __y, const _OutObj& __z)
+{
+  for (size_t __r = 0; __r != _OutObj::rank(); ++__r)
+  {
+    const size_t __extent = ::cuda::std::linalg::__linalg_extent(__z, __r);
+    if (::cuda::std::linalg::__linalg_extent(__x, __r) != __extent
+        || ::cuda::std::linalg::__linalg_extent(__y, __r) != __extent)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// [linalg.algs.blas1.add]
+
+//! @brief Computes __z = __x + __y element-wise, for vectors or matrices. __z may alias __x or __y.
+_CCCL_TEMPLATE(class _InObj1, class _InObj2, class _OutObj)
+_CCCL_REQUIRES(__in_object<_InObj1> _CCCL_AND __in_object<_InObj2> _CCCL_AND __out_object<_OutObj>)
+_CCCL_API constexpr void add(_InObj1 __x, _InObj2 __y, _OutObj __z)
+{
+  static_assert(_InObj1::rank() == _OutObj::rank() && _InObj2::rank() == _OutObj::rank(),
+                "cuda::std::linalg::add: the objects must have the same rank");
+  _CCCL_ASSERT(::cuda::std::linalg::__add_same_extents(__x, __y, __z),
+               "cuda::std::linalg::add: the objects must have the same extents");
+  ::cuda::std::linalg::__add_range(__x, __y, __z, 0, ::cuda::std::linalg::__linalg_outer_extent(__z));
+}
+
+#if _CCCL_HOSTED()
+
+_CCCL_TEMPLATE(class _Policy, class _InObj1, class _InObj2, class _OutObj)
+_CCCL_REQUIRES(is_execution_policy_v<_Policy> _CCCL_AND __in_object<_InObj1> _CCCL_AND __in_object<_InObj2> _CCCL_AND
+                 __out_object<_OutObj>)
+_CCCL_HOST_API void add(const _Policy& __policy, _InObj1 __x, _InObj2 __y, _OutObj __z)
+{
+  static_assert(_InObj1::rank() == _OutObj::rank() && _InObj2::rank() == _OutObj::rank(),
+                "cuda::std::linalg::add: the objects must have the same rank");
+  _CCCL_ASSERT(::cuda::std::linalg::__add_same_extents(__x, __y, __z),
+               "cuda::std::linalg::add: the objects must have the same extents");
+  const size_t __size  = ::cuda::std::linalg::__linalg_outer_extent(__z);
+  const size_t __block = _OutObj::rank() == 1 ? __linalg_vector_block : __linalg_matrix_block;
+  ::cuda::std::linalg::__linalg_for_each_block(
+    __policy, ::cuda::std::linalg::__linalg_num_blocks(__size, __block), [&](size_t __b) {
+      const size_t __first = __b * __block;
+      ::cuda::std::linalg::__add_range(
+        __x, __y, __z, __first, ::cuda::std::linalg::__linalg_min(__size, __first + __block));
+    });
+}
+
+#endif // _CCCL_HOSTED()
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_ADD_H
@@ -0,0 +1,153 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_BLOCKED_LOOPS_H
+#define _CUDA_STD___LINALG_BLOCKED_LOOPS_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__fwd/mdspan.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/mdspan>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+//! The number of elements of a vector processed by a task of the parallel algorithms
+inline constexpr size_t __linalg_vector_block = 16384;
+//! The number of rows or columns of a matrix processed by a task of the parallel algorithms
+inline constexpr size_t __linalg_matrix_block = 64;
+//! The extent of the blocks of the inner dimensions of matrix_product, whose blocks of B fit in the L2 cache
+inline constexpr size_t __linalg_product_inner_block = 128;
+inline constexpr size_t __linalg_product_columns_block = 256;
+//! The number of independent partial sums of the reductions, which the compilers map to SIMD registers
+inline constexpr size_t __linalg_sum_lanes = 8;
+
+[[nodiscard]] _CCCL_API constexpr size_t __linalg_num_blocks(size_t __size, size_t __block) noexcept
+{
+  return (__size + __block - 1) / __block;
+}
+
+[[nodiscard]] _CCCL_API constexpr size_t __linalg_min(size_t __lhs, size_t __rhs) noexcept
+{
+  return __lhs < __rhs ? __lhs : __rhs;
+}
+
+template <class _Mdspan>
+[[nodiscard]] _CCCL_API constexpr size_t __linalg_extent(const _Mdspan& __x, size_t __r) noexcept
+{
+  return static_cast<size_t>(__x.extent(__r));
+}
+
+//! @brief Whether the consecutive elements of the columns of the matrix are contiguous, which makes the algorithms
+//! iterate over the columns in the outer loops
+template <class _Matrix>
+inline constexpr bool __linalg_is_column_major = is_same_v<typename _Matrix::layout_type, layout_left>;
+
+//! @brief The extent of the dimension of the outer loop over the elements of a vector or a matrix
+template <class _Mdspan>
+[[nodiscard]] _CCCL_API constexpr size_t __linalg_outer_extent(const _Mdspan& __x) noexcept
+{
+  if constexpr (_Mdspan::rank() == 2 && __linalg_is_column_major<_Mdspan>)
+  {
+    return ::cuda::std::linalg::__linalg_extent(__x, 1);
+  }
+  else
+  {
+    return ::cuda::std::linalg::__linalg_extent(__x, 0);
+  }
+}
+
+//! @brief Calls __func with the indices of the elements of __x in the range [__first, __last) of the outer loop, in
+//! the storage order of __x
+template <class _Mdspan, class _Fn>
+_CCCL_API constexpr void __linalg_for_each_element(const _Mdspan& __x, size_t __first, size_t __last, _Fn&& __func)
+{
+  using _Index = typename _Mdspan::index_type;
+  if constexpr (_Mdspan::rank() == 1)
+  {
+    for (auto __i = static_cast<_Index>(__first); __i != static_cast<_Index>(__last); ++__i)
+    {
+      __func(__i);
+    }
+  }
+  else if constexpr (__linalg_is_column_major<_Mdspan>)
+  {
+    const auto __rows = static_cast<_Index>(__x.extent(0));
+    for (size_t __j = __first; __j != __last; ++__j)
+    {
+      for (_Index __i = 0; __i != __rows; ++__i)
+      {
+        __func(__i, static_cast<_Index>(__j));
+      }
+    }
+  }
+  else
+  {
+    const auto __columns = static_cast<_Index>(__x.extent(1));
+    for (size_t __i = __first; __i != __last; ++__i)
+    {
+      for (_Index __j = 0; __j != __columns; ++__j)
+      {
+        __func(static_cast<_Index>(__i), __j);
+      }
+    }
+  }
+}
+
+//! @brief Returns __init plus the sum of __term(__k) for __k in [__first, __last)
+//!
+//! The terms are accumulated in independent partial sums, so that the compilers vectorize the sum without reordering
+//! the floating point additions.
+template <class _Tp, class _Term>
+[[nodiscard]] _CCCL_API constexpr _Tp __linalg_sum(size_t __first, size_t __last, _Tp __init, _Term&& __term)
+{
+  _Tp __sums[__linalg_sum_lanes]{};
+  size_t __k = __first;
+  for (; __last - __k >= __linalg_sum_lanes; __k += __linalg_sum_lanes)
+  {
+    for (size_t __lane = 0; __lane != __linalg_sum_lanes; ++__lane)
+    {
+      __sums[__lane] += __term(__k + __lane);
+    }
+  }
+  for (size_t __lane = 0; __k != __last; ++__k, ++__lane)
+  {
+    __sums[__lane] += __term(__k);
+  }
+  for (size_t __width = __linalg_sum_lanes / 2; __width != 0; __width /= 2)
+  {
+    for (size_t __lane = 0; __lane != __width; ++__lane)
+    {
+      __sums[__lane] += __sums[__lane + __width];
+    }
+  }
+  return ::cuda::std::move(__init) + __sums[0];
+}
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_BLOCKED_LOOPS_H
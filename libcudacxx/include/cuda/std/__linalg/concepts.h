@@ -0,0 +1,93 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_CONCEPTS_H
+#define _CUDA_STD___LINALG_CONCEPTS_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__fwd/mdspan.h>
+#include <cuda/std/__linalg/tags.h>
+#include <cuda/std/__type_traits/is_assignable.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/mdspan>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+template <class _Tp, size_t _Rank>
+inline constexpr bool __is_mdspan_of_rank = false;
+
+template <class _ElementType, class _Extents, class _Layout, class _Accessor, size_t _Rank>
+inline constexpr bool __is_mdspan_of_rank<mdspan<_ElementType, _Extents, _Layout, _Accessor>, _Rank> =
+  _Extents::rank() == _Rank;
+
+template <class _Tp>
+inline constexpr bool __is_writable_mdspan = false;
+
+template <class _ElementType, class _Extents, class _Layout, class _Accessor>
+inline constexpr bool __is_writable_mdspan<mdspan<_ElementType, _Extents, _Layout, _Accessor>> =
+  is_same_v<_ElementType, typename _Accessor::element_type>
+  && is_assignable_v<typename _Accessor::reference, _ElementType>;
+
+// [linalg.helpers.concepts]
+template <class _Tp>
+_CCCL_CONCEPT __in_vector = __is_mdspan_of_rank<_Tp, 1>;
+
+template <class _Tp>
+_CCCL_CONCEPT __out_vector = __is_mdspan_of_rank<_Tp, 1> && __is_writable_mdspan<_Tp>;
+
+template <class _Tp>
+_CCCL_CONCEPT __inout_vector = __out_vector<_Tp>;
+
+template <class _Tp>
+_CCCL_CONCEPT __in_matrix = __is_mdspan_of_rank<_Tp, 2>;
+
+template <class _Tp>
+_CCCL_CONCEPT __out_matrix = __is_mdspan_of_rank<_Tp, 2> && __is_writable_mdspan<_Tp>;
+
+template <class _Tp>
+_CCCL_CONCEPT __inout_matrix = __out_matrix<_Tp>;
+
+template <class _Tp>
+_CCCL_CONCEPT __in_object = __is_mdspan_of_rank<_Tp, 1> || __is_mdspan_of_rank<_Tp, 2>;
+
+template <class _Tp>
+_CCCL_CONCEPT __out_object = __in_object<_Tp> && __is_writable_mdspan<_Tp>;
+
+template <class _Tp>
+_CCCL_CONCEPT __inout_object = __out_object<_Tp>;
+
+template <class _Triangle>
+_CCCL_CONCEPT __triangle = is_same_v<_Triangle, upper_triangle_t> || is_same_v<_Triangle, lower_triangle_t>;
+
+template <class _DiagonalStorage>
+_CCCL_CONCEPT __diagonal_storage =
+  is_same_v<_DiagonalStorage, implicit_unit_diagonal_t> || is_same_v<_DiagonalStorage, explicit_diagonal_t>;
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_CONCEPTS_H
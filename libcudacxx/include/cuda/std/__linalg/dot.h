@@ -0,0 +1,161 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_DOT_H
+#define _CUDA_STD___LINALG_DOT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__linalg/blocked_loops.h>
+#include <cuda/std/__linalg/concepts.h>
+#include <cuda/std/__linalg/conj_if_needed.h>
+#include <cuda/std/__type_traits/is_execution_policy.h>
+#include <cuda/std/__utility/declval.h>
+#include <cuda/std/__utility/move.h>
+
+#if _CCCL_HOSTED()
+#  include <cuda/std/__linalg/parallel.h>
+#endif // _CCCL_HOSTED()
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+template <class _InVec1, class _InVec2>
+using __dot_result_t =
+  decltype(::cuda::std::declval<typename _InVec1::value_type>() * ::cuda::std::declval<typename _InVec2::value_type>());
+
+//! @brief Returns __init plus the sum of the products of the elements of __v1 and __v2 in [__first, __last)
+template <bool _Conjugate, class _InVec1, class _InVec2, class _Scalar>
+[[nodiscard]] _CCCL_API constexpr _Scalar
+__dot_range(const _InVec1& __v1, const _InVec2& __v2, size_t __first, size_t __last, _Scalar __init)
+{
+  using _Index1 = typename _InVec1::index_type;
+  using _Index2 = typename _InVec2::index_type;
+  return ::cuda::std::linalg::__linalg_sum(__first, __last, ::cuda::std::move(__init), [&](size_t __k) {
+    if constexpr (_Conjugate)
+    {
+      return ::cuda::std::linalg::conj_if_needed(__v1(static_cast<_Index1>(__k))) * __v2(static_cast<_Index2>(__k));
+    }
+    else
+    {
+      return __v1(static_cast<_Index1>(__k)) * __v2(static_cast<_Index2>(__k));
+    }
+  });
+}
+
+// [linalg.algs.blas1.dot]
+
+//! @brief Returns __init plus the sum of the products of the elements of __v1 and __v2
+_CCCL_TEMPLATE(class _InVec1, class _InVec2, class _Scalar)
+_CCCL_REQUIRES(__in_vector<_InVec1> _CCCL_AND __in_vector<_InVec2>)
+[[nodiscard]] _CCCL_API constexpr _Scalar dot(_InVec1 __v1, _InVec2 __v2, _Scalar __init)
+{
+  _CCCL_ASSERT(::cuda::std::linalg::__linalg_extent(__v1, 0) == ::cuda::std::linalg::__linalg_extent(__v2, 0),
+               "cuda::std::linalg::dot: the vectors must have the same extent");
+  return ::cuda::std::linalg::__dot_range<false>(
+    __v1, __v2, 0, ::cuda::std::linalg::__linalg_extent(__v1, 0), ::cuda::std::move(__init));
+}
+
+_CCCL_TEMPLATE(class _InVec1, class _InVec2)
+_CCCL_REQUIRES(__in_vector<_InVec1> _CCCL_AND __in_vector<_InVec2>)
+[[nodiscard]] _CCCL_API constexpr auto dot(_InVec1 __v1, _InVec2 __v2)
+{
+  return ::cuda::std::linalg::dot(__v1, __v2, __dot_result_t<_InVec1, _InVec2>{});
+}
+
+//! @brief Returns __init plus the sum of the products of the conjugated elements of __v1 and the elements of __v2
+_CCCL_TEMPLATE(class _InVec1, class _InVec2, class _Scalar)
+_CCCL_REQUIRES(__in_vector<_InVec1> _CCCL_AND __in_vector<_InVec2>)
+[[nodiscard]] _CCCL_API constexpr _Scalar dotc(_InVec1 __v1, _InVec2 __v2, _Scalar __init)
+{
+  _CCCL_ASSERT(::cuda::std::linalg::__linalg_extent(__v1, 0) == ::cuda::std::linalg::__linalg_extent(__v2, 0),
+               "cuda::std::linalg::dotc: the vectors must have the same extent");
+  return ::cuda::std::linalg::__dot_range<true>(
+    __v1, __v2, 0, ::cuda::std::linalg::__linalg_extent(__v1, 0), ::cuda::std::move(__init));
+}
+
+_CCCL_TEMPLATE(class _InVec1, class _InVec2)
+_CCCL_REQUIRES(__in_vector<_InVec1> _CCCL_AND __in_vector<_InVec2>)
+[[nodiscard]] _CCCL_API constexpr auto dotc(_InVec1 __v1, _InVec2 __v2)
+{
+  return ::cuda::std::linalg::dotc(__v1, __v2, __dot_result_t<_InVec1, _InVec2>{});
+}
+
+#if _CCCL_HOSTED()
+
+template <bool _Conjugate, class _Policy, class _InVec1, class _InVec2, class _Scalar>
+[[nodiscard]] _CCCL_HOST_API _Scalar
+__dot_parallel(const _Policy& __policy, const _InVec1& __v1, const _InVec2& __v2, _Scalar __init)
+{
+  const size_t __size = ::cuda::std::linalg::__linalg_extent(__v1, 0);
+  return ::cuda::std::linalg::__linalg_reduce_blocks(
+    __policy,
+    ::cuda::std::linalg::__linalg_num_blocks(__size, __linalg_vector_block),
+    ::cuda::std::move(__init),
+    [&](size_t __block) {
+      const size_t __first = __block * __linalg_vector_block;
+      const size_t __last  = ::cuda::std::linalg::__linalg_min(__size, __first + __linalg_vector_block);
+      return ::cuda::std::linalg::__dot_range<_Conjugate>(__v1, __v2, __first, __last, _Scalar{});
+    });
+}
+
+_CCCL_TEMPLATE(class _Policy, class _InVec1, class _InVec2, class _Scalar)
+_CCCL_REQUIRES(is_execution_policy_v<_Policy> _CCCL_AND __in_vector<_InVec1> _CCCL_AND __in_vector<_InVec2>)
+[[nodiscard]] _CCCL_HOST_API _Scalar dot(const _Policy& __policy, _InVec1 __v1, _InVec2 __v2, _Scalar __init)
+{
+  _CCCL_ASSERT(::cuda::std::linalg::__linalg_extent(__v1, 0) == ::cuda::std::linalg::__linalg_extent(__v2, 0),
+               "cuda::std::linalg::dot: the vectors must have the same extent");
+  return ::cuda::std::linalg::__dot_parallel<false>(__policy, __v1, __v2, ::cuda::std::move(__init));
+}
+
+_CCCL_TEMPLATE(class _Policy, class _InVec1, class _InVec2)
+_CCCL_REQUIRES(is_execution_policy_v<_Policy> _CCCL_AND __in_vector<_InVec1> _CCCL_AND __in_vector<_InVec2>)
+[[nodiscard]] _CCCL_HOST_API auto dot(const _Policy& __policy, _InVec1 __v1, _InVec2 __v2)
+{
+  return ::cuda::std::linalg::dot(__policy, __v1, __v2, __dot_result_t<_InVec1, _InVec2>{});
+}
+
+_CCCL_TEMPLATE(class _Policy, class _InVec1, class _InVec2, class _Scalar)
+_CCCL_REQUIRES(is_execution_policy_v<_Policy> _CCCL_AND __in_vector<_InVec1> _CCCL_AND __in_vector<_InVec2>)
+[[nodiscard]] _CCCL_HOST_API _Scalar dotc(const _Policy& __policy, _InVec1 __v1, _InVec2 __v2, _Scalar __init)
+{
+  _CCCL_ASSERT(::cuda::std::linalg::__linalg_extent(__v1, 0) == ::cuda::std::linalg::__linalg_extent(__v2, 0),
+               "cuda::std::linalg::dotc: the vectors must have the same extent");
+  return ::cuda::std::linalg::__dot_parallel<true>(__policy, __v1, __v2, ::cuda::std::move(__init));
+}
+
+_CCCL_TEMPLATE(class _Policy, class _InVec1, class _InVec2)
+_CCCL_REQUIRES(is_execution_policy_v<_Policy> _CCCL_AND __in_vector<_InVec1> _CCCL_AND __in_vector<_InVec2>)
+[[nodiscard]] _CCCL_HOST_API auto dotc(const _Policy& __policy, _InVec1 __v1, _InVec2 __v2)
+{
+  return ::cuda::std::linalg::dotc(__policy, __v1, __v2, __dot_result_t<_InVec1, _InVec2>{});
+}
+
+#endif // _CCCL_HOSTED()
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_DOT_H
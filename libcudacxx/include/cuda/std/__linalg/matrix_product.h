@@ -0,0 +1,204 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_MATRIX_PRODUCT_H
+#define _CUDA_STD___LINALG_MATRIX_PRODUCT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__linalg/blocked_loops.h>
+#include <cuda/std/__linalg/concepts.h>
+#include <cuda/std/__type_traits/is_execution_policy.h>
+
+#if _CCCL_HOSTED()
+#  include <cuda/std/__linalg/parallel.h>
+#endif // _CCCL_HOSTED()
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+//! @brief Computes the rows [__first, __last) of __C = __E + __A * __B, or of __C = __A * __B if _Update is false. The
+//! columns are computed instead if __C is column-major.
+//!
+//! The inner dimension and the columns (rows) of __C are split in blocks, so that the block of __B (__A) reused by all
+//! the rows (columns) stays in the cache, and the inner loop is an axpy over contiguous elements of __B (__A) and __C.
+template <bool _Update, class _InMat1, class _InMat2, class _InMat3, class _OutMat>
+_CCCL_API constexpr void __matrix_product_range(
+  const _InMat1& __A, const _InMat2& __B, const _InMat3& __E, const _OutMat& __C, size_t __first, size_t __last)
+{
+  using _AIndex = typename _InMat1::index_type;
+  using _BIndex = typename _InMat2::index_type;
+  using _EIndex = typename _InMat3::index_type;
+  using _CIndex = typename _OutMat::index_type;
+  using _Value  = typename _OutMat::value_type;
+
+  ::cuda::std::linalg::__linalg_for_each_element(__C, __first, __last, [&](auto __i, auto __j) {
+    if constexpr (_Update)
+    {
+      __C(__i, __j) = __E(static_cast<_EIndex>(__i), static_cast<_EIndex>(__j));
+    }
+    else
+    {
+      __C(__i, __j) = _Value{};
+    }
+  });
+
+  const size_t __inner = ::cuda::std::linalg::__linalg_extent(__A, 1);
+  if constexpr (__linalg_is_column_major<_OutMat>)
+  {
+    const size_t __rows = ::cuda::std::linalg::__linalg_extent(__C, 0);
+    for (size_t __k0 = 0; __k0 < __inner; __k0 += __linalg_product_inner_block)
+    {
+      const size_t __k1 = ::cuda::std::linalg::__linalg_min(__inner, __k0 + __linalg_product_inner_block);
+      for (size_t __i0 = 0; __i0 < __rows; __i0 += __linalg_product_columns_block)
+      {
+        const size_t __i1 = ::cuda::std::linalg::__linalg_min(__rows, __i0 + __linalg_product_columns_block);
+        for (size_t __j = __first; __j != __last; ++__j)
+        {
+          for (size_t __k = __k0; __k != __k1; ++__k)
+          {
+            const auto __b = __B(static_cast<_BIndex>(__k), static_cast<_BIndex>(__j));
+            for (auto __i = static_cast<_CIndex>(__i0); __i != static_cast<_CIndex>(__i1); ++__i)
+            {
+              __C(__i, static_cast<_CIndex>(__j)) += __A(static_cast<_AIndex>(__i), static_cast<_AIndex>(__k)) * __b;
+            }
+          }
+        }
+      }
+    }
+  }
+  else
+  {
+    const size_t __columns = ::cuda::std::linalg::__linalg_extent(__C, 1);
+    for (size_t __k0 = 0; __k0 < __inner; __k0 += __linalg_product_inner_block)
+    {
+      const size_t __k1 = ::cuda::std::linalg::__linalg_min(__inner, __k0 + __linalg_product_inner_block);
+      for (size_t __j0 = 0; __j0 < __columns; __j0 += __linalg_product_columns_block)
+      {
+        const size_t __j1 = ::cuda::std::linalg::__linalg_min(__columns, __j0 + __linalg_product_columns_block);
+        for (size_t __i = __first; __i != __last; ++__i)
+        {
+          for (size_t __k = __k0; __k != __k1; ++__k)
+          {
+            const auto __a = __A(static_cast<_AIndex>(__i), static_cast<_AIndex>(__k));
+            for (auto __j = static_cast<_CIndex>(__j0); __j != static_cast<_CIndex>(__j1); ++__j)
+            {
+              __C(static_cast<_CIndex>(__i), __j) += __a * __B(static_cast<_BIndex>(__k), static_cast<_BIndex>(__j));
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+template <class _InMat1, class _InMat2, class _OutMat>
+[[nodiscard]] _CCCL_API constexpr bool
+__matrix_product_extents(const _InMat1& __A, const _InMat2& __B, const _OutMat& __C) noexcept
+{
+  return ::cuda::std::linalg::__linalg_extent(__A, 1) == ::cuda::std::linalg::__linalg_extent(__B, 0)
+      && ::cuda::std::linalg::__linalg_extent(__A, 0) == ::cuda::std::linalg::__linalg_extent(__C, 0)
+      && ::cuda::std::linalg::__linalg_extent(__B, 1) == ::cuda::std::linalg::__linalg_extent(__C, 1);
+}
+
+template <class _InMat, class _OutMat>
+[[nodiscard]] _CCCL_API constexpr bool __matrix_product_same_extents(const _InMat& __E, const _OutMat& __C) noexcept
+{
+  return ::cuda::std::linalg::__linalg_extent(__E, 0) == ::cuda::std::linalg::__linalg_extent(__C, 0)
+      && ::cuda::std::linalg::__linalg_extent(__E, 1) == ::cuda::std::linalg::__linalg_extent(__C, 1);
+}
+
+#if _CCCL_HOSTED()
+
+template <bool _Update, class _Policy, class _InMat1, class _InMat2, class _InMat3, class _OutMat>
+_CCCL_HOST_API void __matrix_product_parallel(
+  const _Policy& __policy, const _InMat1& __A, const _InMat2& __B, const _InMat3& __E, const _OutMat& __C)
+{
+  const size_t __size = ::cuda::std::linalg::__linalg_outer_extent(__C);
+  ::cuda::std::linalg::__linalg_for_each_block(
+    __policy, ::cuda::std::linalg::__linalg_num_blocks(__size, __linalg_matrix_block), [&](size_t __block) {
+      const size_t __first = __block * __linalg_matrix_block;
+      ::cuda::std::linalg::__matrix_product_range<_Update>(
+        __A, __B, __E, __C, __first, ::cuda::std::linalg::__linalg_min(__size, __first + __linalg_matrix_block));
+    });
+}
+
+#endif // _CCCL_HOSTED()
+
+// [linalg.algs.blas3.gemm]
+
+//! @brief Computes __C = __A * __B
+_CCCL_TEMPLATE(class _InMat1, class _InMat2, class _OutMat)
+_CCCL_REQUIRES(__in_matrix<_InMat1> _CCCL_AND __in_matrix<_InMat2> _CCCL_AND __out_matrix<_OutMat>)
+_CCCL_API constexpr void matrix_product(_InMat1 __A, _InMat2 __B, _OutMat __C)
+{
+  _CCCL_ASSERT(::cuda::std::linalg::__matrix_product_extents(__A, __B, __C),
+               "cuda::std::linalg::matrix_product: the extents do not match");
+  ::cuda::std::linalg::__matrix_product_range<false>(
+    __A, __B, __C, __C, 0, ::cuda::std::linalg::__linalg_outer_extent(__C));
+}
+
+//! @brief Computes __C = __E + __A * __B. __C may alias __E.
+_CCCL_TEMPLATE(class _InMat1, class _InMat2, class _InMat3, class _OutMat)
+_CCCL_REQUIRES(__in_matrix<_InMat1> _CCCL_AND __in_matrix<_InMat2> _CCCL_AND __in_matrix<_InMat3> _CCCL_AND
+                 __out_matrix<_OutMat>)
+_CCCL_API constexpr void matrix_product(_InMat1 __A, _InMat2 __B, _InMat3 __E, _OutMat __C)
+{
+  _CCCL_ASSERT(::cuda::std::linalg::__matrix_product_extents(__A, __B, __C)
+                 && ::cuda::std::linalg::__matrix_product_same_extents(__E, __C),
+               "cuda::std::linalg::matrix_product: the extents do not match");
+  ::cuda::std::linalg::__matrix_product_range<true>(
+    __A, __B, __E, __C, 0, ::cuda::std::linalg::__linalg_outer_extent(__C));
+}
+
+#if _CCCL_HOSTED()
+
+_CCCL_TEMPLATE(class _Policy, class _InMat1, class _InMat2, class _OutMat)
+_CCCL_REQUIRES(is_execution_policy_v<_Policy> _CCCL_AND __in_matrix<_InMat1> _CCCL_AND __in_matrix<_InMat2> _CCCL_AND
+                 __out_matrix<_OutMat>)
+_CCCL_HOST_API void matrix_product(const _Policy& __policy, _InMat1 __A, _InMat2 __B, _OutMat __C)
+{
+  _CCCL_ASSERT(::cuda::std::linalg::__matrix_product_extents(__A, __B, __C),
+               "cuda::std::linalg::matrix_product: the extents do not match");
+  ::cuda::std::linalg::__matrix_product_parallel<false>(__policy, __A, __B, __C, __C);
+}
+
+_CCCL_TEMPLATE(class _Policy, class _InMat1, class _InMat2, class _InMat3, class _OutMat)
+_CCCL_REQUIRES(is_execution_policy_v<_Policy> _CCCL_AND __in_matrix<_InMat1> _CCCL_AND __in_matrix<_InMat2> _CCCL_AND
+                 __in_matrix<_InMat3> _CCCL_AND __out_matrix<_OutMat>)
+_CCCL_HOST_API void matrix_product(const _Policy& __policy, _InMat1 __A, _InMat2 __B, _InMat3 __E, _OutMat __C)
+{
+  _CCCL_ASSERT(::cuda::std::linalg::__matrix_product_extents(__A, __B, __C)
+                 && ::cuda::std::linalg::__matrix_product_same_extents(__E, __C),
+               "cuda::std::linalg::matrix_product: the extents do not match");
+  ::cuda::std::linalg::__matrix_product_parallel<true>(__policy, __A, __B, __E, __C);
+}
+
+#endif // _CCCL_HOSTED()
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_MATRIX_PRODUCT_H
@@ -0,0 +1,153 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_MATRIX_RANK_1_UPDATE_H
+#define _CUDA_STD___LINALG_MATRIX_RANK_1_UPDATE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__linalg/blocked_loops.h>
+#include <cuda/std/__linalg/concepts.h>
+#include <cuda/std/__linalg/conj_if_needed.h>
+#include <cuda/std/__type_traits/is_execution_policy.h>
+
+#if _CCCL_HOSTED()
+#  include <cuda/std/__linalg/parallel.h>
+#endif // _CCCL_HOSTED()
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+//! @brief Computes __A += __x * __y^T for the rows, or the columns of a column-major matrix, in [__first, __last)
+template <bool _Conjugate, class _InVec1, class _InVec2, class _InOutMat>
+_CCCL_API constexpr void __matrix_rank_1_update_range(
+  const _InVec1& __x, const _InVec2& __y, const _InOutMat& __A, size_t __first, size_t __last)
+{
+  using _XIndex = typename _InVec1::index_type;
+  using _YIndex = typename _InVec2::index_type;
+  const auto __y_at = [&](auto __j) {
+    if constexpr (_Conjugate)
+    {
+      return ::cuda::std::linalg::conj_if_needed(__y(static_cast<_YIndex>(__j)));
+    }
+    else
+    {
+      return __y(static_cast<_YIndex>(__j));
+    }
+  };
+  if constexpr (__linalg_is_column_major<_InOutMat>)
+  {
+    ::cuda::std::linalg::__linalg_for_each_element(__A, __first, __last, [&](auto __i, auto __j) {
+      __A(__i, __j) += __x(static_cast<_XIndex>(__i)) * __y_at(__j);
+    });
+  }
+  else
+  {
+    using _Index         = typename _InOutMat::index_type;
+    const auto __columns = static_cast<_Index>(__A.extent(1));
+    for (size_t __i = __first; __i != __last; ++__i)
+    {
+      const auto __xi = __x(static_cast<_XIndex>(__i));
+      for (_Index __j = 0; __j != __columns; ++__j)
+      {
+        __A(static_cast<_Index>(__i), __j) += __xi * __y_at(__j);
+      }
+    }
+  }
+}
+
+template <class _InVec1, class _InVec2, class _InOutMat>
+[[nodiscard]] _CCCL_API constexpr bool
+__matrix_rank_1_update_extents(const _InVec1& __x, const _InVec2& __y, const _InOutMat& __A) noexcept
+{
+  return ::cuda::std::linalg::__linalg_extent(__A, 0) == ::cuda::std::linalg::__linalg_extent(__x, 0)
+      && ::cuda::std::linalg::__linalg_extent(__A, 1) == ::cuda::std::linalg::__linalg_extent(__y, 0);
+}
+
+// [linalg.algs.blas2.rank1]
+
+//! @brief Computes __A += __x * __y^T
+_CCCL_TEMPLATE(class _InVec1, class _InVec2, class _InOutMat)
+_CCCL_REQUIRES(__in_vector<_InVec1> _CCCL_AND __in_vector<_InVec2> _CCCL_AND __inout_matrix<_InOutMat>)
+_CCCL_API constexpr void matrix_rank_1_update(_InVec1 __x, _InVec2 __y, _InOutMat __A)
+{
+  _CCCL_ASSERT(::cuda::std::linalg::__matrix_rank_1_update_extents(__x, __y, __A),
+               "cuda::std::linalg::matrix_rank_1_update: the extents do not match");
+  ::cuda::std::linalg::__matrix_rank_1_update_range<false>(
+    __x, __y, __A, 0, ::cuda::std::linalg::__linalg_outer_extent(__A));
+}
+
+//! @brief Computes __A += __x * __y^H, the conjugate transpose of __y
+_CCCL_TEMPLATE(class _InVec1, class _InVec2, class _InOutMat)
+_CCCL_REQUIRES(__in_vector<_InVec1> _CCCL_AND __in_vector<_InVec2> _CCCL_AND __inout_matrix<_InOutMat>)
+_CCCL_API constexpr void matrix_rank_1_update_c(_InVec1 __x, _InVec2 __y, _InOutMat __A)
+{
+  _CCCL_ASSERT(::cuda::std::linalg::__matrix_rank_1_update_extents(__x, __y, __A),
+               "cuda::std::linalg::matrix_rank_1_update_c: the extents do not match");
+  ::cuda::std::linalg::__matrix_rank_1_update_range<true>(
+    __x, __y, __A, 0, ::cuda::std::linalg::__linalg_outer_extent(__A));
+}
+
+#if _CCCL_HOSTED()
+
+template <bool _Conjugate, class _Policy, class _InVec1, class _InVec2, class _InOutMat>
+_CCCL_HOST_API void
+__matrix_rank_1_update_parallel(const _Policy& __policy, const _InVec1& __x, const _InVec2& __y, const _InOutMat& __A)
+{
+  const size_t __size = ::cuda::std::linalg::__linalg_outer_extent(__A);
+  ::cuda::std::linalg::__linalg_for_each_block(
+    __policy, ::cuda::std::linalg::__linalg_num_blocks(__size, __linalg_matrix_block), [&](size_t __block) {
+      const size_t __first = __block * __linalg_matrix_block;
+      ::cuda::std::linalg::__matrix_rank_1_update_range<_Conjugate>(
+        __x, __y, __A, __first, ::cuda::std::linalg::__linalg_min(__size, __first + __linalg_matrix_block));
+    });
+}
+
+_CCCL_TEMPLATE(class _Policy, class _InVec1, class _InVec2, class _InOutMat)
+_CCCL_REQUIRES(is_execution_policy_v<_Policy> _CCCL_AND __in_vector<_InVec1> _CCCL_AND __in_vector<_InVec2> _CCCL_AND
+                 __inout_matrix<_InOutMat>)
+_CCCL_HOST_API void matrix_rank_1_update(const _Policy& __policy, _InVec1 __x, _InVec2 __y, _InOutMat __A)
+{
+  _CCCL_ASSERT(::cuda::std::linalg::__matrix_rank_1_update_extents(__x, __y, __A),
+               "cuda::std::linalg::matrix_rank_1_update: the extents do not match");
+  ::cuda::std::linalg::__matrix_rank_1_update_parallel<false>(__policy, __x, __y, __A);
+}
+
+_CCCL_TEMPLATE(class _Policy, class _InVec1, class _InVec2, class _InOutMat)
+_CCCL_REQUIRES(is_execution_policy_v<_Policy> _CCCL_AND __in_vector<_InVec1> _CCCL_AND __in_vector<_InVec2> _CCCL_AND
+                 __inout_matrix<_InOutMat>)
+_CCCL_HOST_API void matrix_rank_1_update_c(const _Policy& __policy, _InVec1 __x, _InVec2 __y, _InOutMat __A)
+{
+  _CCCL_ASSERT(::cuda::std::linalg::__matrix_rank_1_update_extents(__x, __y, __A),
+               "cuda::std::linalg::matrix_rank_1_update_c: the extents do not match");
+  ::cuda::std::linalg::__matrix_rank_1_update_parallel<true>(__policy, __x, __y, __A);
+}
+
+#endif // _CCCL_HOSTED()
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_MATRIX_RANK_1_UPDATE_H
@@ -0,0 +1,175 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_MATRIX_VECTOR_PRODUCT_H
+#define _CUDA_STD___LINALG_MATRIX_VECTOR_PRODUCT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__linalg/blocked_loops.h>
+#include <cuda/std/__linalg/concepts.h>
+#include <cuda/std/__type_traits/is_execution_policy.h>
+
+#if _CCCL_HOSTED()
+#  include <cuda/std/__linalg/parallel.h>
+#endif // _CCCL_HOSTED()
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+//! @brief Computes the rows [__first, __last) of __z = __y + __A * __x, or of __z = __A * __x if _Update is false
+//!
+//! The rows of a row-major matrix are reduced with independent partial sums, and the columns of a column-major matrix
+//! are accumulated into __z, so that the inner loop reads contiguous elements of __A.
+template <bool _Update, class _InMat, class _InVec1, class _InVec2, class _OutVec>
+_CCCL_API constexpr void __matrix_vector_product_rows(
+  const _InMat& __A, const _InVec1& __x, const _InVec2& __y, const _OutVec& __z, size_t __first, size_t __last)
+{
+  using _MatIndex = typename _InMat::index_type;
+  using _XIndex   = typename _InVec1::index_type;
+  using _YIndex   = typename _InVec2::index_type;
+  using _ZIndex   = typename _OutVec::index_type;
+  using _Value    = typename _OutVec::value_type;
+
+  const size_t __columns = ::cuda::std::linalg::__linalg_extent(__A, 1);
+  if constexpr (__linalg_is_column_major<_InMat>)
+  {
+    for (size_t __i = __first; __i != __last; ++__i)
+    {
+      if constexpr (_Update)
+      {
+        __z(static_cast<_ZIndex>(__i)) = __y(static_cast<_YIndex>(__i));
+      }
+      else
+      {
+        __z(static_cast<_ZIndex>(__i)) = _Value{};
+      }
+    }
+    for (size_t __j = 0; __j != __columns; ++__j)
+    {
+      const auto __xj = __x(static_cast<_XIndex>(__j));
+      for (auto __i = static_cast<_MatIndex>(__first); __i != static_cast<_MatIndex>(__last); ++__i)
+      {
+        __z(static_cast<_ZIndex>(__i)) += __A(__i, static_cast<_MatIndex>(__j)) * __xj;
+      }
+    }
+  }
+  else
+  {
+    for (size_t __i = __first; __i != __last; ++__i)
+    {
+      _Value __init{};
+      if constexpr (_Update)
+      {
+        __init = __y(static_cast<_YIndex>(__i));
+      }
+      __z(static_cast<_ZIndex>(__i)) =
+        ::cuda::std::linalg::__linalg_sum(0, __columns, __init, [&](size_t __j) {
+          return __A(static_cast<_MatIndex>(__i), static_cast<_MatIndex>(__j)) * __x(static_cast<_XIndex>(__j));
+        });
+    }
+  }
+}
+
+template <class _InMat, class _InVec, class _OutVec>
+[[nodiscard]] _CCCL_API constexpr bool
+__matrix_vector_product_extents(const _InMat& __A, const _InVec& __x, const _OutVec& __z) noexcept
+{
+  return ::cuda::std::linalg::__linalg_extent(__A, 1) == ::cuda::std::linalg::__linalg_extent(__x, 0)
+      && ::cuda::std::linalg::__linalg_extent(__A, 0) == ::cuda::std::linalg::__linalg_extent(__z, 0);
+}
+
+#if _CCCL_HOSTED()
+
+template <bool _Update, class _Policy, class _InMat, class _InVec1, class _InVec2, class _OutVec>
+_CCCL_HOST_API void __matrix_vector_product_parallel(
+  const _Policy& __policy, const _InMat& __A, const _InVec1& __x, const _InVec2& __y, const _OutVec& __z)
+{
+  const size_t __rows = ::cuda::std::linalg::__linalg_extent(__A, 0);
+  ::cuda::std::linalg::__linalg_for_each_block(
+    __policy, ::cuda::std::linalg::__linalg_num_blocks(__rows, __linalg_matrix_block), [&](size_t __block) {
+      const size_t __first = __block * __linalg_matrix_block;
+      ::cuda::std::linalg::__matrix_vector_product_rows<_Update>(
+        __A, __x, __y, __z, __first, ::cuda::std::linalg::__linalg_min(__rows, __first + __linalg_matrix_block));
+    });
+}
+
+#endif // _CCCL_HOSTED()
+
+// [linalg.algs.blas2.gemv]
+
+//! @brief Computes __y = __A * __x
+_CCCL_TEMPLATE(class _InMat, class _InVec, class _OutVec)
+_CCCL_REQUIRES(__in_matrix<_InMat> _CCCL_AND __in_vector<_InVec> _CCCL_AND __out_vector<_OutVec>)
+_CCCL_API constexpr void matrix_vector_product(_InMat __A, _InVec __x, _OutVec __y)
+{
+  _CCCL_ASSERT(::cuda::std::linalg::__matrix_vector_product_extents(__A, __x, __y),
+               "cuda::std::linalg::matrix_vector_product: the extents do not match");
+  ::cuda::std::linalg::__matrix_vector_product_rows<false>(
+    __A, __x, __y, __y, 0, ::cuda::std::linalg::__linalg_extent(__A, 0));
+}
+
+//! @brief Computes __z = __y + __A * __x. __z may alias __y.
+_CCCL_TEMPLATE(class _InMat, class _InVec1, class _InVec2, class _OutVec)
+_CCCL_REQUIRES(__in_matrix<_InMat> _CCCL_AND __in_vector<_InVec1> _CCCL_AND __in_vector<_InVec2> _CCCL_AND
+                 __out_vector<_OutVec>)
+_CCCL_API constexpr void matrix_vector_product(_InMat __A, _InVec1 __x, _InVec2 __y, _OutVec __z)
+{
+  _CCCL_ASSERT(::cuda::std::linalg::__matrix_vector_product_extents(__A, __x, __z)
+                 && ::cuda::std::linalg::__linalg_extent(__y, 0) == ::cuda::std::linalg::__linalg_extent(__z, 0),
+               "cuda::std::linalg::matrix_vector_product: the extents do not match");
+  ::cuda::std::linalg::__matrix_vector_product_rows<true>(
+    __A, __x, __y, __z, 0, ::cuda::std::linalg::__linalg_extent(__A, 0));
+}
+
+#if _CCCL_HOSTED()
+
+_CCCL_TEMPLATE(class _Policy, class _InMat, class _InVec, class _OutVec)
+_CCCL_REQUIRES(is_execution_policy_v<_Policy> _CCCL_AND __in_matrix<_InMat> _CCCL_AND __in_vector<_InVec> _CCCL_AND
+                 __out_vector<_OutVec>)
+_CCCL_HOST_API void matrix_vector_product(const _Policy& __policy, _InMat __A, _InVec __x, _OutVec __y)
+{
+  _CCCL_ASSERT(::cuda::std::linalg::__matrix_vector_product_extents(__A, __x, __y),
+               "cuda::std::linalg::matrix_vector_product: the extents do not match");
+  ::cuda::std::linalg::__matrix_vector_product_parallel<false>(__policy, __A, __x, __y, __y);
+}
+
+_CCCL_TEMPLATE(class _Policy, class _InMat, class _InVec1, class _InVec2, class _OutVec)
+_CCCL_REQUIRES(is_execution_policy_v<_Policy> _CCCL_AND __in_matrix<_InMat> _CCCL_AND __in_vector<_InVec1> _CCCL_AND
+                 __in_vector<_InVec2> _CCCL_AND __out_vector<_OutVec>)
+_CCCL_HOST_API void matrix_vector_product(const _Policy& __policy, _InMat __A, _InVec1 __x, _InVec2 __y, _OutVec __z)
+{
+  _CCCL_ASSERT(::cuda::std::linalg::__matrix_vector_product_extents(__A, __x, __z)
+                 && ::cuda::std::linalg::__linalg_extent(__y, 0) == ::cuda::std::linalg::__linalg_extent(__z, 0),
+               "cuda::std::linalg::matrix_vector_product: the extents do not match");
+  ::cuda::std::linalg::__matrix_vector_product_parallel<true>(__policy, __A, __x, __y, __z);
+}
+
+#endif // _CCCL_HOSTED()
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_MATRIX_VECTOR_PRODUCT_H
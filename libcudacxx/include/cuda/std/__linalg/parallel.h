@@ -0,0 +1,111 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_PARALLEL_H
+#define _CUDA_STD___LINALG_PARALLEL_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HOSTED()
+
+#  include <cuda/__iterator/counting_iterator.h>
+#  include <cuda/std/__cstddef/types.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__functional/operations.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/for_each_n.h>
+#  include <cuda/std/__pstl/transform_reduce.h>
+#  include <cuda/std/__utility/move.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+//! @brief Selects the host backend of the parallel algorithms that runs _Algorithm for a linalg algorithm
+//!
+//! The sequenced policies, and the builds without a host backend, get a dispatch that cannot run and the linalg
+//! algorithms run serially.
+template <::cuda::std::execution::__pstl_algorithm _Algorithm, class _Policy>
+[[nodiscard]] _CCCL_HOST_API _CCCL_CONSTEVAL auto __linalg_select_dispatch() noexcept
+{
+#  if _CCCL_HAS_BACKEND_CUDA()
+  static_assert((_Policy::__get_backend() & ::cuda::std::execution::__execution_backend::__cuda) == 0,
+                "cuda::std::linalg: the algorithms with an execution policy run on the host");
+#  endif // _CCCL_HAS_BACKEND_CUDA()
+  return ::cuda::std::execution::__pstl_select_dispatch<_Algorithm, _Policy>();
+}
+
+//! @brief Calls __func(__block) for every __block in [0, __num_blocks), in parallel if __policy allows it
+template <class _Policy, class _Fn>
+_CCCL_HOST_API void __linalg_for_each_block(const _Policy& __policy, size_t __num_blocks, _Fn __func)
+{
+  [[maybe_unused]] auto __dispatch =
+    ::cuda::std::linalg::__linalg_select_dispatch<::cuda::std::execution::__pstl_algorithm::__for_each_n, _Policy>();
+  if constexpr (::cuda::std::execution::__pstl_can_dispatch<decltype(__dispatch)>)
+  {
+    if (__num_blocks > 1)
+    {
+      (void) __dispatch(__policy, ::cuda::counting_iterator<size_t>{0}, __num_blocks, ::cuda::std::move(__func));
+      return;
+    }
+  }
+  for (size_t __block = 0; __block != __num_blocks; ++__block)
+  {
+    __func(__block);
+  }
+}
+
+//! @brief Returns __init plus the sum of __func(__block) for every __block in [0, __num_blocks), in parallel if
+//! __policy allows it
+template <class _Policy, class _Tp, class _Fn>
+[[nodiscard]] _CCCL_HOST_API _Tp
+__linalg_reduce_blocks(const _Policy& __policy, size_t __num_blocks, _Tp __init, _Fn __func)
+{
+  [[maybe_unused]] auto __dispatch =
+    ::cuda::std::linalg::__linalg_select_dispatch<::cuda::std::execution::__pstl_algorithm::__transform_reduce,
+                                                  _Policy>();
+  if constexpr (::cuda::std::execution::__pstl_can_dispatch<decltype(__dispatch)>)
+  {
+    if (__num_blocks > 1)
+    {
+      return __dispatch(
+        __policy,
+        ::cuda::counting_iterator<size_t>{0},
+        __num_blocks,
+        ::cuda::std::move(__init),
+        ::cuda::std::plus<_Tp>{},
+        ::cuda::std::move(__func));
+    }
+  }
+  for (size_t __block = 0; __block != __num_blocks; ++__block)
+  {
+    __init = ::cuda::std::move(__init) + __func(__block);
+  }
+  return __init;
+}
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HOSTED()
+
+#endif // _CUDA_STD___LINALG_PARALLEL_H
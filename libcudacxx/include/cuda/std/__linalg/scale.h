@@ -0,0 +1,81 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_SCALE_H
+#define _CUDA_STD___LINALG_SCALE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__linalg/blocked_loops.h>
+#include <cuda/std/__linalg/concepts.h>
+#include <cuda/std/__type_traits/is_execution_policy.h>
+
+#if _CCCL_HOSTED()
+#  include <cuda/std/__linalg/parallel.h>
+#endif // _CCCL_HOSTED()
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+template <class _Scalar, class _InOutObj>
+_CCCL_API constexpr void __scale_range(const _Scalar& __alpha, const _InOutObj& __x, size_t __first, size_t __last)
+{
+  ::cuda::std::linalg::__linalg_for_each_element(__x, __first, __last, [&](auto... __indices) {
+    __x(__indices...) = __alpha * __x(__indices...);
+  });
+}
+
+// [linalg.algs.blas1.scal]
+
+//! @brief Computes __x = __alpha * __x element-wise, for vectors or matrices
+_CCCL_TEMPLATE(class _Scalar, class _InOutObj)
+_CCCL_REQUIRES(__inout_object<_InOutObj>)
+_CCCL_API constexpr void scale(_Scalar __alpha, _InOutObj __x)
+{
+  ::cuda::std::linalg::__scale_range(__alpha, __x, 0, ::cuda::std::linalg::__linalg_outer_extent(__x));
+}
+
+#if _CCCL_HOSTED()
+
+_CCCL_TEMPLATE(class _Policy, class _Scalar, class _InOutObj)
+_CCCL_REQUIRES(is_execution_policy_v<_Policy> _CCCL_AND __inout_object<_InOutObj>)
+_CCCL_HOST_API void scale(const _Policy& __policy, _Scalar __alpha, _InOutObj __x)
+{
+  const size_t __size  = ::cuda::std::linalg::__linalg_outer_extent(__x);
+  const size_t __block = _InOutObj::rank() == 1 ? __linalg_vector_block : __linalg_matrix_block;
+  ::cuda::std::linalg::__linalg_for_each_block(
+    __policy, ::cuda::std::linalg::__linalg_num_blocks(__size, __block), [&](size_t __b) {
+      const size_t __first = __b * __block;
+      ::cuda::std::linalg::__scale_range(
+        __alpha, __x, __first, ::cuda::std::linalg::__linalg_min(__size, __first + __block));
+    });
+}
+
+#endif // _CCCL_HOSTED()
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_SCALE_H
@@ -0,0 +1,63 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_TAGS_H
+#define _CUDA_STD___LINALG_TAGS_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+//! @brief Selects the upper triangle of a matrix, including the diagonal
+struct upper_triangle_t
+{
+  _CCCL_HIDE_FROM_ABI explicit upper_triangle_t() = default;
+};
+inline constexpr upper_triangle_t upper_triangle{};
+
+//! @brief Selects the lower triangle of a matrix, including the diagonal
+struct lower_triangle_t
+{
+  _CCCL_HIDE_FROM_ABI explicit lower_triangle_t() = default;
+};
+inline constexpr lower_triangle_t lower_triangle{};
+
+//! @brief The diagonal of the triangular matrix is not accessed and its elements are assumed to be one
+struct implicit_unit_diagonal_t
+{
+  _CCCL_HIDE_FROM_ABI explicit implicit_unit_diagonal_t() = default;
+};
+inline constexpr implicit_unit_diagonal_t implicit_unit_diagonal{};
+
+//! @brief The diagonal of the triangular matrix is stored in the matrix
+struct explicit_diagonal_t
+{
+  _CCCL_HIDE_FROM_ABI explicit explicit_diagonal_t() = default;
+};
+inline constexpr explicit_diagonal_t explicit_diagonal{};
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_TAGS_H
@@ -231,8 +231,8 @@ struct __transposed_layout
   template <class __OriginalMapping>
   _CCCL_API static constexpr auto __mapping(const __OriginalMapping& __orig_map)
   {
-    using __extents_type        = __transpose_extents_t<typename __OriginalMapping::__extents_type>;
-    using __return_mapping_type = typename __layout_type::template __mapping<__extents_type>;
+    using __extents_type        = __transpose_extents_t<typename __OriginalMapping::extents_type>;
+    using __return_mapping_type = typename __layout_type::template mapping<__extents_type>;
     return __return_mapping_type{__orig_map};
   }
 };
@@ -292,6 +292,13 @@ template <class _NestedLayout>
 struct __transposed_layout<layout_transpose<_NestedLayout>>
 {
   using __layout_type = _NestedLayout;
+
+  template <class _OriginalExtents>
+  _CCCL_API static constexpr auto
+  __mapping(const typename layout_transpose<_NestedLayout>::template mapping<_OriginalExtents>& __orig_map)
+  {
+    return __orig_map.nested_mapping();
+  }
 };
 } // namespace __detail
 
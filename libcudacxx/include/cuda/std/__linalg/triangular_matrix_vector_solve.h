@@ -0,0 +1,153 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_TRIANGULAR_MATRIX_VECTOR_SOLVE_H
+#define _CUDA_STD___LINALG_TRIANGULAR_MATRIX_VECTOR_SOLVE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__linalg/blocked_loops.h>
+#include <cuda/std/__linalg/concepts.h>
+#include <cuda/std/__linalg/tags.h>
+#include <cuda/std/__type_traits/is_execution_policy.h>
+#include <cuda/std/__type_traits/is_same.h>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+//! @brief Solves __A * __x = __b for __x, where __A is the triangle _Triangle of the matrix. __x may alias __b.
+//!
+//! A row-major matrix is solved by substitution, which reduces the rows with independent partial sums. A column-major
+//! matrix is solved by eliminating the solved unknowns from the remaining right-hand sides column by column.
+template <class _Triangle, class _DiagonalStorage, class _InMat, class _InVec, class _OutVec>
+_CCCL_API constexpr void __triangular_matrix_vector_solve(const _InMat& __A, const _InVec& __b, const _OutVec& __x)
+{
+  using _MatIndex = typename _InMat::index_type;
+  using _BIndex   = typename _InVec::index_type;
+  using _XIndex   = typename _OutVec::index_type;
+  using _Value    = typename _OutVec::value_type;
+
+  constexpr bool __lower         = is_same_v<_Triangle, lower_triangle_t>;
+  constexpr bool __explicit_diag = is_same_v<_DiagonalStorage, explicit_diagonal_t>;
+
+  const size_t __size = ::cuda::std::linalg::__linalg_extent(__A, 0);
+  const auto __a      = [&](size_t __i, size_t __j) {
+    return __A(static_cast<_MatIndex>(__i), static_cast<_MatIndex>(__j));
+  };
+  if constexpr (__linalg_is_column_major<_InMat>)
+  {
+    for (size_t __i = 0; __i != __size; ++__i)
+    {
+      __x(static_cast<_XIndex>(__i)) = __b(static_cast<_BIndex>(__i));
+    }
+    for (size_t __n = 0; __n != __size; ++__n)
+    {
+      const size_t __j = __lower ? __n : __size - 1 - __n;
+      if constexpr (__explicit_diag)
+      {
+        __x(static_cast<_XIndex>(__j)) = __x(static_cast<_XIndex>(__j)) / __a(__j, __j);
+      }
+      const auto __xj = __x(static_cast<_XIndex>(__j));
+      for (size_t __i = __lower ? __j + 1 : 0; __i != (__lower ? __size : __j); ++__i)
+      {
+        __x(static_cast<_XIndex>(__i)) -= __a(__i, __j) * __xj;
+      }
+    }
+  }
+  else
+  {
+    for (size_t __n = 0; __n != __size; ++__n)
+    {
+      const size_t __i    = __lower ? __n : __size - 1 - __n;
+      const auto __solved = ::cuda::std::linalg::__linalg_sum(
+        __lower ? 0 : __i + 1, __lower ? __i : __size, _Value{}, [&](size_t __k) {
+          return __a(__i, __k) * __x(static_cast<_XIndex>(__k));
+        });
+      _Value __xi = __b(static_cast<_BIndex>(__i)) - __solved;
+      if constexpr (__explicit_diag)
+      {
+        __xi = __xi / __a(__i, __i);
+      }
+      __x(static_cast<_XIndex>(__i)) = __xi;
+    }
+  }
+}
+
+// [linalg.algs.blas2.trsv]
+
+//! @brief Solves __A * __x = __b for __x, where __A is the triangle __t of the matrix
+_CCCL_TEMPLATE(class _InMat, class _Triangle, class _DiagonalStorage, class _InVec, class _OutVec)
+_CCCL_REQUIRES(__in_matrix<_InMat> _CCCL_AND __triangle<_Triangle> _CCCL_AND __diagonal_storage<_DiagonalStorage>
+                 _CCCL_AND __in_vector<_InVec> _CCCL_AND __out_vector<_OutVec>)
+_CCCL_API constexpr void
+triangular_matrix_vector_solve(_InMat __A, _Triangle, _DiagonalStorage, _InVec __b, _OutVec __x)
+{
+  _CCCL_ASSERT(::cuda::std::linalg::__linalg_extent(__A, 0) == ::cuda::std::linalg::__linalg_extent(__A, 1)
+                 && ::cuda::std::linalg::__linalg_extent(__A, 0) == ::cuda::std::linalg::__linalg_extent(__b, 0)
+                 && ::cuda::std::linalg::__linalg_extent(__A, 0) == ::cuda::std::linalg::__linalg_extent(__x, 0),
+               "cuda::std::linalg::triangular_matrix_vector_solve: the extents do not match");
+  ::cuda::std::linalg::__triangular_matrix_vector_solve<_Triangle, _DiagonalStorage>(__A, __b, __x);
+}
+
+//! @brief Solves __A * __x = __b for __x in place, overwriting __b with __x
+_CCCL_TEMPLATE(class _InMat, class _Triangle, class _DiagonalStorage, class _InOutVec)
+_CCCL_REQUIRES(__in_matrix<_InMat> _CCCL_AND __triangle<_Triangle> _CCCL_AND __diagonal_storage<_DiagonalStorage>
+                 _CCCL_AND __inout_vector<_InOutVec>)
+_CCCL_API constexpr void triangular_matrix_vector_solve(_InMat __A, _Triangle, _DiagonalStorage, _InOutVec __b)
+{
+  _CCCL_ASSERT(::cuda::std::linalg::__linalg_extent(__A, 0) == ::cuda::std::linalg::__linalg_extent(__A, 1)
+                 && ::cuda::std::linalg::__linalg_extent(__A, 0) == ::cuda::std::linalg::__linalg_extent(__b, 0),
+               "cuda::std::linalg::triangular_matrix_vector_solve: the extents do not match");
+  ::cuda::std::linalg::__triangular_matrix_vector_solve<_Triangle, _DiagonalStorage>(__A, __b, __b);
+}
+
+#if _CCCL_HOSTED()
+
+// Every unknown depends on the previous ones, so the overloads with an execution policy solve serially.
+
+_CCCL_TEMPLATE(class _Policy, class _InMat, class _Triangle, class _DiagonalStorage, class _InVec, class _OutVec)
+_CCCL_REQUIRES(is_execution_policy_v<_Policy> _CCCL_AND __in_matrix<_InMat> _CCCL_AND __triangle<_Triangle> _CCCL_AND
+                 __diagonal_storage<_DiagonalStorage> _CCCL_AND __in_vector<_InVec> _CCCL_AND __out_vector<_OutVec>)
+_CCCL_HOST_API void triangular_matrix_vector_solve(
+  const _Policy&, _InMat __A, _Triangle __t, _DiagonalStorage __d, _InVec __b, _OutVec __x)
+{
+  ::cuda::std::linalg::triangular_matrix_vector_solve(__A, __t, __d, __b, __x);
+}
+
+_CCCL_TEMPLATE(class _Policy, class _InMat, class _Triangle, class _DiagonalStorage, class _InOutVec)
+_CCCL_REQUIRES(is_execution_policy_v<_Policy> _CCCL_AND __in_matrix<_InMat> _CCCL_AND __triangle<_Triangle> _CCCL_AND
+                 __diagonal_storage<_DiagonalStorage> _CCCL_AND __inout_vector<_InOutVec>)
+_CCCL_HOST_API void
+triangular_matrix_vector_solve(const _Policy&, _InMat __A, _Triangle __t, _DiagonalStorage __d, _InOutVec __b)
+{
+  ::cuda::std::linalg::triangular_matrix_vector_solve(__A, __t, __d, __b);
+}
+
+#endif // _CCCL_HOSTED()
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_TRIANGULAR_MATRIX_VECTOR_SOLVE_H
@@ -0,0 +1,219 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_VECTOR_TWO_NORM_H
+#define _CUDA_STD___LINALG_VECTOR_TWO_NORM_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__cmath/roots.h>
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__linalg/blocked_loops.h>
+#include <cuda/std/__linalg/concepts.h>
+#include <cuda/std/__type_traits/is_arithmetic.h>
+#include <cuda/std/__type_traits/is_execution_policy.h>
+#include <cuda/std/__type_traits/is_floating_point.h>
+#include <cuda/std/__utility/declval.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/complex>
+
+#if _CCCL_HOSTED()
+#  include <cuda/std/__linalg/parallel.h>
+#endif // _CCCL_HOSTED()
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+//! @brief Returns the square of the absolute value of __t, without computing the square root of complex numbers
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr auto __abs_squared(const _Tp& __t)
+{
+  if constexpr (is_arithmetic_v<_Tp>)
+  {
+    return __t * __t;
+  }
+  else
+  {
+    return ::cuda::std::norm(__t);
+  }
+}
+
+template <class _InVec>
+using __vector_two_norm_result_t = decltype(::cuda::std::linalg::__abs_squared(
+  ::cuda::std::declval<typename _InVec::value_type>()));
+
+//! @brief A sum of squares held as __scale_ * __scale_ * __ssq_, as in the nrm2 of the reference BLAS
+//!
+//! The largest absolute value seen so far is kept as the scale, and only the squares of the ratios of the other values
+//! to the scale are summed, so that neither huge nor tiny values overflow or underflow when they are squared.
+template <class _Scalar>
+struct __scaled_sum_of_squares
+{
+  _Scalar __scale_ = _Scalar{};
+  _Scalar __ssq_   = _Scalar{1};
+
+  [[nodiscard]] _CCCL_API static constexpr __scaled_sum_of_squares __from_value(_Scalar __value) noexcept
+  {
+    return {__value < _Scalar{} ? -__value : __value, _Scalar{1}};
+  }
+
+  [[nodiscard]] _CCCL_API friend constexpr __scaled_sum_of_squares
+  operator+(const __scaled_sum_of_squares& __lhs, const __scaled_sum_of_squares& __rhs) noexcept
+  {
+    // the larger scale is kept, which is the one that is NaN if any is
+    const bool __rhs_is_larger = __lhs.__scale_ < __rhs.__scale_ || __rhs.__scale_ != __rhs.__scale_;
+    const auto& __large        = __rhs_is_larger ? __rhs : __lhs;
+    const auto& __small        = __rhs_is_larger ? __lhs : __rhs;
+    if (__large.__scale_ == __small.__scale_)
+    {
+      // also keeps the sum of two infinite values infinite
+      return {__large.__scale_, __large.__ssq_ + __small.__ssq_};
+    }
+    const _Scalar __ratio = __small.__scale_ / __large.__scale_;
+    return {__large.__scale_, __large.__ssq_ + __small.__ssq_ * __ratio * __ratio};
+  }
+
+  _CCCL_API constexpr __scaled_sum_of_squares& operator+=(const __scaled_sum_of_squares& __rhs) noexcept
+  {
+    return *this = *this + __rhs;
+  }
+
+  [[nodiscard]] _CCCL_API constexpr _Scalar __sqrt() const
+  {
+    using ::cuda::std::sqrt;
+    return __scale_ * sqrt(__ssq_);
+  }
+};
+
+//! @brief Floating point norms are scaled, the others sum the squares directly
+template <class _Scalar>
+inline constexpr bool __vector_two_norm_is_scaled = is_floating_point_v<_Scalar>;
+
+template <class _Scalar, class _Tp>
+[[nodiscard]] _CCCL_API constexpr __scaled_sum_of_squares<_Scalar> __scaled_square(const _Tp& __t)
+{
+  if constexpr (is_arithmetic_v<_Tp>)
+  {
+    return __scaled_sum_of_squares<_Scalar>::__from_value(static_cast<_Scalar>(__t));
+  }
+  else
+  {
+    // the real and imaginary parts are scaled separately, as in the complex nrm2 of the reference BLAS
+    return __scaled_sum_of_squares<_Scalar>::__from_value(static_cast<_Scalar>(::cuda::std::real(__t)))
+         + __scaled_sum_of_squares<_Scalar>::__from_value(static_cast<_Scalar>(::cuda::std::imag(__t)));
+  }
+}
+
+//! @brief Returns the sum of the squares of the absolute values of the elements of __v in [__first, __last), as a
+//! __scaled_sum_of_squares if _Scalar is a floating point type
+template <class _Scalar, class _InVec>
+[[nodiscard]] _CCCL_API constexpr auto __sum_of_squares_range(const _InVec& __v, size_t __first, size_t __last)
+{
+  using _Index = typename _InVec::index_type;
+  if constexpr (__vector_two_norm_is_scaled<_Scalar>)
+  {
+    return ::cuda::std::linalg::__linalg_sum(__first, __last, __scaled_sum_of_squares<_Scalar>{}, [&](size_t __k) {
+      return ::cuda::std::linalg::__scaled_square<_Scalar>(__v(static_cast<_Index>(__k)));
+    });
+  }
+  else
+  {
+    return ::cuda::std::linalg::__linalg_sum(__first, __last, _Scalar{}, [&](size_t __k) {
+      return ::cuda::std::linalg::__abs_squared(__v(static_cast<_Index>(__k)));
+    });
+  }
+}
+
+//! @brief Returns the square root of the sum of the squares of __init and of the elements of __v, given their sum of
+//! squares
+template <class _Scalar, class _SumOfSquares>
+[[nodiscard]] _CCCL_API constexpr _Scalar __vector_two_norm_result(_Scalar __init, const _SumOfSquares& __sum)
+{
+  if constexpr (__vector_two_norm_is_scaled<_Scalar>)
+  {
+    return (__scaled_sum_of_squares<_Scalar>::__from_value(__init) + __sum).__sqrt();
+  }
+  else
+  {
+    using ::cuda::std::sqrt;
+    return sqrt(__init * __init + __sum);
+  }
+}
+
+// [linalg.algs.blas1.nrm2]
+
+//! @brief Returns the square root of the sum of the square of __init and of the squares of the absolute values of the
+//! elements of __v
+//!
+//! Floating point norms are scaled by their largest element, so that they only overflow if the result does.
+_CCCL_TEMPLATE(class _InVec, class _Scalar)
+_CCCL_REQUIRES(__in_vector<_InVec>)
+[[nodiscard]] _CCCL_API constexpr _Scalar vector_two_norm(_InVec __v, _Scalar __init)
+{
+  return ::cuda::std::linalg::__vector_two_norm_result(
+    ::cuda::std::move(__init),
+    ::cuda::std::linalg::__sum_of_squares_range<_Scalar>(__v, 0, ::cuda::std::linalg::__linalg_extent(__v, 0)));
+}
+
+_CCCL_TEMPLATE(class _InVec)
+_CCCL_REQUIRES(__in_vector<_InVec>)
+[[nodiscard]] _CCCL_API constexpr auto vector_two_norm(_InVec __v)
+{
+  return ::cuda::std::linalg::vector_two_norm(__v, __vector_two_norm_result_t<_InVec>{});
+}
+
+#if _CCCL_HOSTED()
+
+_CCCL_TEMPLATE(class _Policy, class _InVec, class _Scalar)
+_CCCL_REQUIRES(is_execution_policy_v<_Policy> _CCCL_AND __in_vector<_InVec>)
+[[nodiscard]] _CCCL_HOST_API _Scalar vector_two_norm(const _Policy& __policy, _InVec __v, _Scalar __init)
+{
+  const size_t __size = ::cuda::std::linalg::__linalg_extent(__v, 0);
+  using _SumOfSquares = decltype(::cuda::std::linalg::__sum_of_squares_range<_Scalar>(__v, 0, 0));
+  return ::cuda::std::linalg::__vector_two_norm_result(
+    ::cuda::std::move(__init),
+    ::cuda::std::linalg::__linalg_reduce_blocks(
+      __policy,
+      ::cuda::std::linalg::__linalg_num_blocks(__size, __linalg_vector_block),
+      _SumOfSquares{},
+      [&](size_t __block) {
+        const size_t __first = __block * __linalg_vector_block;
+        const size_t __last  = ::cuda::std::linalg::__linalg_min(__size, __first + __linalg_vector_block);
+        return ::cuda::std::linalg::__sum_of_squares_range<_Scalar>(__v, __first, __last);
+      }));
+}
+
+_CCCL_TEMPLATE(class _Policy, class _InVec)
+_CCCL_REQUIRES(is_execution_policy_v<_Policy> _CCCL_AND __in_vector<_InVec>)
+[[nodiscard]] _CCCL_HOST_API auto vector_two_norm(const _Policy& __policy, _InVec __v)
+{
+  return ::cuda::std::linalg::vector_two_norm(__policy, __v, __vector_two_norm_result_t<_InVec>{});
+}
+
+#endif // _CCCL_HOSTED()
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_VECTOR_TWO_NORM_H
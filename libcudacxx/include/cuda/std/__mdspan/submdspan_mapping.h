@@ -309,18 +309,26 @@ __submdspan_mapping_impl(const typename layout_stride::mapping<_Extents>& __mapp
   }
 }
 
+template <class _LayoutMapping>
+_CCCL_CONCEPT __is_standard_layout_mapping =
+  __mdspan_detail::__is_mapping_of<layout_left, _LayoutMapping>
+  || __mdspan_detail::__is_mapping_of<layout_right, _LayoutMapping>
+  || __mdspan_detail::__is_mapping_of<layout_stride, _LayoutMapping>;
+
 _CCCL_TEMPLATE(class _LayoutMapping, class... _Slices)
-_CCCL_REQUIRES(__matching_number_of_slices<typename _LayoutMapping::extents_type, _Slices...>)
+_CCCL_REQUIRES(__is_standard_layout_mapping<_LayoutMapping> _CCCL_AND
+                 __matching_number_of_slices<typename _LayoutMapping::extents_type, _Slices...>)
 [[nodiscard]] _CCCL_API constexpr auto submdspan_mapping(const _LayoutMapping& __mapping, _Slices... __slices)
 {
   return ::cuda::std::__submdspan_mapping_impl(__mapping, __slices...);
 }
 
 // [mdspan.sub.sub]
+// The other layout mappings provide submdspan_mapping as a hidden friend, which is found by argument-dependent lookup.
 template <class _LayoutMapping, class... _Slices>
 _CCCL_CONCEPT __can_submdspan_mapping =
   _CCCL_REQUIRES_EXPR((_LayoutMapping, variadic _Slices), const _LayoutMapping& __mapping, _Slices... __slices)(
-    (::cuda::std::submdspan_mapping(__mapping, __slices...)));
+    (submdspan_mapping(__mapping, __slices...)));
 
 _CCCL_TEMPLATE(class _Tp, class _Extents, class _Layout, class _Accessor, class... _Slices)
 _CCCL_REQUIRES(__matching_number_of_slices<_Extents, _Slices...> _CCCL_AND
@@ -328,7 +336,7 @@ _CCCL_REQUIRES(__matching_number_of_slices<_Extents, _Slices...> _CCCL_AND
 [[nodiscard]] _CCCL_API constexpr auto
 submdspan(const mdspan<_Tp, _Extents, _Layout, _Accessor>& __src, _Slices... __slices)
 {
-  auto __sub_map_result = ::cuda::std::submdspan_mapping(__src.mapping(), __slices...);
+  auto __sub_map_result = submdspan_mapping(__src.mapping(), __slices...);
   return mdspan(__src.accessor().offset(__src.data_handle(), __sub_map_result.offset),
                 __sub_map_result.mapping,
                 typename _Accessor::offset_policy(__src.accessor()));
@@ -34,6 +34,7 @@
 #  include <cuda/std/__iterator/next.h>
 #  include <cuda/std/__iterator/prev.h>
 #  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/unseq.h>
 #  include <cuda/std/__type_traits/always_false.h>
 #  include <cuda/std/__type_traits/is_execution_policy.h>
 #  include <cuda/std/__utility/move.h>
@@ -42,6 +43,18 @@
 #    include <cuda/std/__pstl/cuda/find_if.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
 
+#  if _CCCL_HAS_BACKEND_OMP()
+#    include <cuda/std/__pstl/omp/find_if.h>
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+#    include <cuda/std/__pstl/tbb/find_if.h>
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+#  if _CCCL_HAS_BACKEND_THREADS()
+#    include <cuda/std/__pstl/threads/find_if.h>
+#  endif // _CCCL_HAS_BACKEND_THREADS()
+
 #  include <cuda/std/__cccl/prologue.h>
 
 _CCCL_BEGIN_NAMESPACE_CUDA_STD
@@ -66,13 +79,26 @@ _CCCL_REQUIRES(__has_forward_traversal<_InputIterator> _CCCL_AND is_execution_po
       return __first;
     }
 
-    auto __zipped_ret = __dispatch(
+    const auto __zipped_last = ::cuda::zip_iterator{::cuda::std::prev(__last), __last};
+    auto __zipped_ret        = __dispatch(
       __policy,
       ::cuda::zip_iterator{__first, ::cuda::std::next(__first)},
-      ::cuda::zip_iterator{::cuda::std::prev(__last), __last},
+      __zipped_last,
       ::cuda::zip_function{::cuda::std::move(__pred)});
+    // The end of the zipped range starts at the last element, while a range without equal neighbors returns __last
+    if (__zipped_ret == __zipped_last)
+    {
+      return __last;
+    }
     return ::cuda::std::get<0>(__zipped_ret.__iterators());
   }
+  else if constexpr (::cuda::std::execution::__pstl_is_unsequenced<_Policy>)
+  {
+    _CCCL_NVTX_RANGE_SCOPE("cuda::std::adjacent_find");
+
+    return ::cuda::std::__pstl_unseq_adjacent_find(
+      ::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__pred));
+  }
   else
   {
     static_assert(__always_false_v<_Policy>,
@@ -40,6 +40,18 @@
 #    include <cuda/std/__pstl/cuda/copy_if.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
 
+#  if _CCCL_HAS_BACKEND_OMP()
+#    include <cuda/std/__pstl/omp/copy_if.h>
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+#    include <cuda/std/__pstl/tbb/copy_if.h>
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+#  if _CCCL_HAS_BACKEND_THREADS()
+#    include <cuda/std/__pstl/threads/copy_if.h>
+#  endif // _CCCL_HAS_BACKEND_THREADS()
+
 #  include <cuda/std/__cccl/prologue.h>
 
 _CCCL_BEGIN_NAMESPACE_CUDA_STD
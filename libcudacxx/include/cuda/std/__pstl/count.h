@@ -34,6 +34,7 @@
 #  include <cuda/std/__iterator/incrementable_traits.h>
 #  include <cuda/std/__iterator/iterator_traits.h>
 #  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/unseq.h>
 #  include <cuda/std/__type_traits/always_false.h>
 #  include <cuda/std/__type_traits/is_comparable.h>
 #  include <cuda/std/__type_traits/is_execution_policy.h>
@@ -44,6 +45,18 @@
 #    include <cuda/std/__pstl/cuda/reduce.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
 
+#  if _CCCL_HAS_BACKEND_OMP()
+#    include <cuda/std/__pstl/omp/reduce.h>
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+#    include <cuda/std/__pstl/tbb/reduce.h>
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+#  if _CCCL_HAS_BACKEND_THREADS()
+#    include <cuda/std/__pstl/threads/reduce.h>
+#  endif // _CCCL_HAS_BACKEND_THREADS()
+
 #  include <cuda/std/__cccl/prologue.h>
 
 _CCCL_BEGIN_NAMESPACE_CUDA_STD
@@ -76,6 +89,12 @@ count([[maybe_unused]] const _Policy& __policy, _InputIterator __first, _InputIt
       iter_difference_t<_InputIterator>{0},
       ::cuda::std::plus<iter_difference_t<_InputIterator>>{});
   }
+  else if constexpr (::cuda::std::execution::__pstl_is_unsequenced<_Policy>)
+  {
+    _CCCL_NVTX_RANGE_SCOPE("cuda::std::count");
+
+    return ::cuda::std::__pstl_unseq_count(::cuda::std::move(__first), ::cuda::std::move(__last), __value);
+  }
   else
   {
     static_assert(__always_false_v<_Policy>, "Parallel cuda::std::count requires at least one selected backend");
@@ -82,8 +82,47 @@ template <__pstl_algorithm _Algorithm, __execution_backend _Backend>
 inline constexpr bool __pstl_can_dispatch<__pstl_dispatch<_Algorithm, _Backend>> =
   !::cuda::std::is_base_of_v<__pstl_no_dispatch, __pstl_dispatch<_Algorithm, _Backend>>;
 
+//! @brief Whether @tparam _Policy is the unsequenced policy without a backend. It runs the algorithms on the calling
+//! thread, with the vector kernels of __pstl/unseq.h where they apply.
+template <class _Policy>
+inline constexpr bool __pstl_is_unsequenced =
+  _Policy::__get_backend() == __execution_backend::__none
+  && _Policy::__get_policy() == __execution_policy::__unsequenced;
+
 _CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
 
+//! @brief Selects the host backend for a parallel policy that does not request a backend
+//! The opt-in oneTBB backend is preferred over the OpenMP backend, which is preferred over the thread pool backend.
+//! Returns @c __none if no available host backend implements @tparam _Algorithm
+template <__pstl_algorithm _Algorithm>
+[[nodiscard]] _CCCL_HOST_API _CCCL_CONSTEVAL __execution_backend __pstl_select_host_backend() noexcept
+{
+#if _CCCL_HAS_BACKEND_TBB()
+  if constexpr (__pstl_can_dispatch<__pstl_dispatch<_Algorithm, __execution_backend::__tbb>>)
+  {
+    return __execution_backend::__tbb;
+  }
+  else
+#endif // _CCCL_HAS_BACKEND_TBB()
+#if _CCCL_HAS_BACKEND_OMP()
+  if constexpr (__pstl_can_dispatch<__pstl_dispatch<_Algorithm, __execution_backend::__omp>>)
+  {
+    return __execution_backend::__omp;
+  }
+  else
+#endif // _CCCL_HAS_BACKEND_OMP()
+#if _CCCL_HAS_BACKEND_THREADS()
+  if constexpr (__pstl_can_dispatch<__pstl_dispatch<_Algorithm, __execution_backend::__threads>>)
+  {
+    return __execution_backend::__threads;
+  }
+  else
+#endif // _CCCL_HAS_BACKEND_THREADS()
+  {
+    return __execution_backend::__none;
+  }
+}
+
 //! @brief Top layer dispatcher that returns a concrete dispatch if possible
 template <__pstl_algorithm _Algorithm, class _Policy>
 [[nodiscard]] _CCCL_HOST_API _CCCL_CONSTEVAL auto __pstl_select_dispatch() noexcept
@@ -96,6 +135,11 @@ template <__pstl_algorithm _Algorithm, class _Policy>
   {
     return __pstl_dispatch<_Algorithm, __backend>{};
   }
+  // The standard parallel policies do not request a backend, so they run on the host
+  else if constexpr (__backend == __execution_backend::__none && __is_parallel_policy(_Policy::__get_policy()))
+  {
+    return __pstl_dispatch<_Algorithm, __pstl_select_host_backend<_Algorithm>()>{};
+  }
   else
   {
     // No dispatch found, return invalid to signal serial execution
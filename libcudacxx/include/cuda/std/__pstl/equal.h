@@ -33,6 +33,7 @@
 #  include <cuda/std/__functional/operations.h>
 #  include <cuda/std/__iterator/concepts.h>
 #  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/unseq.h>
 #  include <cuda/std/__type_traits/always_false.h>
 #  include <cuda/std/__type_traits/is_comparable.h>
 #  include <cuda/std/__type_traits/is_execution_policy.h>
@@ -42,6 +43,18 @@
 #    include <cuda/std/__pstl/cuda/find_if.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
 
+#  if _CCCL_HAS_BACKEND_OMP()
+#    include <cuda/std/__pstl/omp/find_if.h>
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+#    include <cuda/std/__pstl/tbb/find_if.h>
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+#  if _CCCL_HAS_BACKEND_THREADS()
+#    include <cuda/std/__pstl/threads/find_if.h>
+#  endif // _CCCL_HAS_BACKEND_THREADS()
+
 #  include <cuda/std/__cccl/prologue.h>
 
 _CCCL_BEGIN_NAMESPACE_CUDA_STD
@@ -83,6 +96,13 @@ equal([[maybe_unused]] const _Policy& __policy,
       ::cuda::zip_function{::cuda::std::not_fn(::cuda::std::move(__pred))});
     return __result == __zip_last;
   }
+  else if constexpr (::cuda::std::execution::__pstl_is_unsequenced<_Policy>)
+  {
+    _CCCL_NVTX_RANGE_SCOPE("cuda::std::equal");
+
+    return ::cuda::std::__pstl_unseq_equal(
+      ::cuda::std::move(__first1), ::cuda::std::move(__last1), ::cuda::std::move(__first2), ::cuda::std::move(__pred));
+  }
   else
   {
     static_assert(__always_false_v<_Policy>, "Parallel cuda::std::equal requires at least one selected backend");
@@ -133,6 +153,17 @@ _CCCL_REQUIRES(__has_forward_traversal<_InputIter1> _CCCL_AND __has_forward_trav
       ::cuda::zip_function{::cuda::std::not_fn(::cuda::std::move(__pred))});
     return __result == __zip_last;
   }
+  else if constexpr (::cuda::std::execution::__pstl_is_unsequenced<_Policy>)
+  {
+    _CCCL_NVTX_RANGE_SCOPE("cuda::std::equal");
+
+    return ::cuda::std::__pstl_unseq_equal(
+      ::cuda::std::move(__first1),
+      ::cuda::std::move(__last1),
+      ::cuda::std::move(__first2),
+      ::cuda::std::move(__last2),
+      ::cuda::std::move(__pred));
+  }
   else
   {
     static_assert(__always_false_v<_Policy>, "Parallel cuda::std::equal requires at least one selected backend");
@@ -31,6 +31,7 @@
 #  include <cuda/std/__iterator/concepts.h>
 #  include <cuda/std/__iterator/iterator_traits.h>
 #  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/unseq.h>
 #  include <cuda/std/__type_traits/always_false.h>
 #  include <cuda/std/__type_traits/is_comparable.h>
 #  include <cuda/std/__type_traits/is_execution_policy.h>
@@ -41,6 +42,18 @@
 #    include <cuda/std/__pstl/cuda/find_if.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
 
+#  if _CCCL_HAS_BACKEND_OMP()
+#    include <cuda/std/__pstl/omp/find_if.h>
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+#    include <cuda/std/__pstl/tbb/find_if.h>
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+#  if _CCCL_HAS_BACKEND_THREADS()
+#    include <cuda/std/__pstl/threads/find_if.h>
+#  endif // _CCCL_HAS_BACKEND_THREADS()
+
 #  include <cuda/std/__cccl/prologue.h>
 
 _CCCL_BEGIN_NAMESPACE_CUDA_STD
@@ -69,6 +82,12 @@ find([[maybe_unused]] const _Policy& __policy, _Iter __first, _Iter __last, cons
     return __dispatch(
       __policy, ::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::equal_to_value<_Tp>{__val});
   }
+  else if constexpr (::cuda::std::execution::__pstl_is_unsequenced<_Policy>)
+  {
+    _CCCL_NVTX_RANGE_SCOPE("cuda::std::find");
+
+    return ::cuda::std::__pstl_unseq_find(::cuda::std::move(__first), ::cuda::std::move(__last), __val);
+  }
   else
   {
     static_assert(__always_false_v<_Policy>, "Parallel cuda::std::find requires at least one selected backend");
@@ -0,0 +1,67 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_TEMPORARY_BUFFER_H
+#define _CUDA_STD___PSTL_HOST_TEMPORARY_BUFFER_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_OMP() || _CCCL_HAS_BACKEND_TBB() || _CCCL_HAS_BACKEND_THREADS()
+
+#  include <cuda/std/__new/allocate.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+//! @brief Uninitialized host memory for the host backends, for @c __count objects of type @tparam _Tp
+//! The buffer only owns the memory, constructing and destroying the objects is up to the algorithm using it
+template <class _Tp>
+class __host_temporary_buffer
+{
+  _Tp* __ptr_;
+  size_t __count_;
+
+public:
+  _CCCL_HOST_API explicit __host_temporary_buffer(const size_t __count)
+      : __ptr_{static_cast<_Tp*>(::cuda::std::__cccl_allocate(__count * sizeof(_Tp), alignof(_Tp)))}
+      , __count_{__count}
+  {}
+
+  __host_temporary_buffer(const __host_temporary_buffer&)            = delete;
+  __host_temporary_buffer& operator=(const __host_temporary_buffer&) = delete;
+
+  _CCCL_HOST_API ~__host_temporary_buffer()
+  {
+    ::cuda::std::__cccl_deallocate(__ptr_, __count_ * sizeof(_Tp), alignof(_Tp));
+  }
+
+  [[nodiscard]] _CCCL_HOST_API _Tp* __get() const noexcept
+  {
+    return __ptr_;
+  }
+};
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_OMP() || _CCCL_HAS_BACKEND_TBB() || _CCCL_HAS_BACKEND_THREADS()
+
+#endif // _CUDA_STD___PSTL_HOST_TEMPORARY_BUFFER_H
@@ -30,6 +30,7 @@
 #  include <cuda/std/__iterator/concepts.h>
 #  include <cuda/std/__iterator/iterator_traits.h>
 #  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/unseq.h>
 #  include <cuda/std/__type_traits/always_false.h>
 #  include <cuda/std/__type_traits/is_execution_policy.h>
 #  include <cuda/std/__utility/move.h>
@@ -38,6 +39,18 @@
 #    include <cuda/std/__pstl/cuda/max_element.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
 
+#  if _CCCL_HAS_BACKEND_OMP()
+#    include <cuda/std/__pstl/omp/max_element.h>
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+#    include <cuda/std/__pstl/tbb/max_element.h>
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+#  if _CCCL_HAS_BACKEND_THREADS()
+#    include <cuda/std/__pstl/threads/max_element.h>
+#  endif // _CCCL_HAS_BACKEND_THREADS()
+
 #  include <cuda/std/__cccl/prologue.h>
 
 _CCCL_BEGIN_NAMESPACE_CUDA_STD
@@ -62,6 +75,13 @@ max_element([[maybe_unused]] const _Policy& __policy, _Iter __first, _Iter __las
 
     return __dispatch(__policy, ::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__pred));
   }
+  else if constexpr (::cuda::std::execution::__pstl_is_unsequenced<_Policy>)
+  {
+    _CCCL_NVTX_RANGE_SCOPE("cuda::std::max_element");
+
+    return ::cuda::std::__pstl_unseq_max_element(
+      ::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__pred));
+  }
   else
   {
     static_assert(__always_false_v<_Policy>, "Parallel cuda::std::max_element requires at least one selected backend");
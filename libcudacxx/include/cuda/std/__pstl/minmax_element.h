@@ -0,0 +1,116 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_MINMAX_ELEMENT_H
+#define _CUDA_STD___PSTL_MINMAX_ELEMENT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HOSTED()
+
+#  include <cuda/__nvtx/nvtx.h>
+#  include <cuda/std/__algorithm/minmax_element.h>
+#  include <cuda/std/__concepts/concept_macros.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/concepts.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__iterator/prev.h>
+#  include <cuda/std/__iterator/reverse_iterator.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/unseq.h>
+#  include <cuda/std/__type_traits/always_false.h>
+#  include <cuda/std/__type_traits/is_execution_policy.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/__utility/pair.h>
+
+#  if _CCCL_HAS_BACKEND_CUDA()
+#    include <cuda/std/__pstl/cuda/max_element.h>
+#    include <cuda/std/__pstl/cuda/min_element.h>
+#  endif // _CCCL_HAS_BACKEND_CUDA()
+
+#  if _CCCL_HAS_BACKEND_OMP()
+#    include <cuda/std/__pstl/omp/max_element.h>
+#    include <cuda/std/__pstl/omp/min_element.h>
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+#    include <cuda/std/__pstl/tbb/max_element.h>
+#    include <cuda/std/__pstl/tbb/min_element.h>
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+#  if _CCCL_HAS_BACKEND_THREADS()
+#    include <cuda/std/__pstl/threads/max_element.h>
+#    include <cuda/std/__pstl/threads/min_element.h>
+#  endif // _CCCL_HAS_BACKEND_THREADS()
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_TEMPLATE(class _Policy, class _Iter, class _BinaryPredicate = less<>)
+_CCCL_REQUIRES(__has_forward_traversal<_Iter> _CCCL_AND is_execution_policy_v<_Policy>)
+[[nodiscard]] _CCCL_HOST_API pair<_Iter, _Iter>
+minmax_element([[maybe_unused]] const _Policy& __policy, _Iter __first, _Iter __last, _BinaryPredicate __pred = {})
+{
+  [[maybe_unused]] auto __min_dispatch =
+    ::cuda::std::execution::__pstl_select_dispatch<::cuda::std::execution::__pstl_algorithm::__min_element, _Policy>();
+  [[maybe_unused]] auto __max_dispatch =
+    ::cuda::std::execution::__pstl_select_dispatch<::cuda::std::execution::__pstl_algorithm::__max_element, _Policy>();
+  if constexpr (::cuda::std::execution::__pstl_can_dispatch<decltype(__min_dispatch)>
+                && ::cuda::std::execution::__pstl_can_dispatch<decltype(__max_dispatch)>)
+  {
+    _CCCL_NVTX_RANGE_SCOPE("cuda::std::minmax_element");
+
+    if (__first == __last)
+    {
+      return pair<_Iter, _Iter>{__first, __first};
+    }
+
+    // minmax_element returns the last largest element, which is the first largest element of the reversed range
+    auto __min = __min_dispatch(__policy, __first, __last, __pred);
+    auto __max = __max_dispatch(
+      __policy, ::cuda::std::reverse_iterator<_Iter>{__last}, ::cuda::std::reverse_iterator<_Iter>{__first}, __pred);
+    return pair<_Iter, _Iter>{::cuda::std::move(__min), ::cuda::std::prev(__max.base())};
+  }
+  else if constexpr (::cuda::std::execution::__pstl_is_unsequenced<_Policy>)
+  {
+    _CCCL_NVTX_RANGE_SCOPE("cuda::std::minmax_element");
+
+    return ::cuda::std::__pstl_unseq_minmax_element(
+      ::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__pred));
+  }
+  else
+  {
+    static_assert(__always_false_v<_Policy>,
+                  "Parallel cuda::std::minmax_element requires at least one selected backend");
+    return ::cuda::std::minmax_element(
+      ::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__pred));
+  }
+}
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HOSTED()
+
+#endif // _CUDA_STD___PSTL_MINMAX_ELEMENT_H
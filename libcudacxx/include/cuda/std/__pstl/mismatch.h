@@ -33,6 +33,7 @@
 #  include <cuda/std/__functional/operations.h>
 #  include <cuda/std/__iterator/concepts.h>
 #  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/unseq.h>
 #  include <cuda/std/__type_traits/always_false.h>
 #  include <cuda/std/__type_traits/is_comparable.h>
 #  include <cuda/std/__type_traits/is_execution_policy.h>
@@ -44,6 +45,18 @@
 #    include <cuda/std/__pstl/cuda/find_if.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
 
+#  if _CCCL_HAS_BACKEND_OMP()
+#    include <cuda/std/__pstl/omp/find_if.h>
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+#    include <cuda/std/__pstl/tbb/find_if.h>
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+#  if _CCCL_HAS_BACKEND_THREADS()
+#    include <cuda/std/__pstl/threads/find_if.h>
+#  endif // _CCCL_HAS_BACKEND_THREADS()
+
 #  include <cuda/std/__cccl/prologue.h>
 
 _CCCL_BEGIN_NAMESPACE_CUDA_STD
@@ -86,6 +99,13 @@ _CCCL_REQUIRES(__has_forward_traversal<_InputIter1> _CCCL_AND __has_forward_trav
     return pair<_InputIter1, _InputIter2>{
       ::cuda::std::get<0>(__result.__iterators()), ::cuda::std::get<1>(__result.__iterators())};
   }
+  else if constexpr (::cuda::std::execution::__pstl_is_unsequenced<_Policy>)
+  {
+    _CCCL_NVTX_RANGE_SCOPE("cuda::std::mismatch");
+
+    return ::cuda::std::__pstl_unseq_mismatch(
+      ::cuda::std::move(__first1), ::cuda::std::move(__last1), ::cuda::std::move(__first2), ::cuda::std::move(__pred));
+  }
   else
   {
     static_assert(__always_false_v<_Policy>, "Parallel cuda::std::mismatch requires at least one selected backend");
@@ -129,6 +149,17 @@ _CCCL_REQUIRES(__has_forward_traversal<_InputIter1> _CCCL_AND __has_forward_trav
     return pair<_InputIter1, _InputIter2>{
       ::cuda::std::get<0>(__result.__iterators()), ::cuda::std::get<1>(__result.__iterators())};
   }
+  else if constexpr (::cuda::std::execution::__pstl_is_unsequenced<_Policy>)
+  {
+    _CCCL_NVTX_RANGE_SCOPE("cuda::std::mismatch");
+
+    return ::cuda::std::__pstl_unseq_mismatch(
+      ::cuda::std::move(__first1),
+      ::cuda::std::move(__last1),
+      ::cuda::std::move(__first2),
+      ::cuda::std::move(__last2),
+      ::cuda::std::move(__pred));
+  }
   else
   {
     static_assert(__always_false_v<_Policy>, "Parallel cuda::std::mismatch requires at least one selected backend");
@@ -0,0 +1,98 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_OMP_CHUNKS_H
+#define _CUDA_STD___PSTL_OMP_CHUNKS_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_OMP()
+
+#  include <cuda/__cmath/ceil_div.h>
+#  include <cuda/std/__algorithm/max.h>
+#  include <cuda/std/__algorithm/min.h>
+#  include <cuda/std/cstddef>
+
+#  include <omp.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+//! @brief Invokes `__fn(__i)` for every @c __i in `[0, __n)` on the threads of an OpenMP parallel region
+//! A single iteration runs on the calling thread without opening a parallel region
+template <class _Fn>
+_CCCL_HOST_API void __omp_parallel_for(const ptrdiff_t __n, _Fn&& __fn)
+{
+  _CCCL_PRAGMA(omp parallel for if (__n > 1))
+  for (ptrdiff_t __i = 0; __i < __n; ++__i)
+  {
+    __fn(__i);
+  }
+}
+
+//! @brief Splits a range into contiguous chunks, at most one per OpenMP thread
+//! Small ranges are split into fewer chunks, so that no thread is started for less than @c __min_chunk_size elements
+struct __omp_chunks
+{
+  static constexpr ptrdiff_t __min_chunk_size = 2048;
+
+  ptrdiff_t __count_;
+  ptrdiff_t __num_chunks_;
+
+  _CCCL_HOST_API explicit __omp_chunks(const ptrdiff_t __count, const ptrdiff_t __min_size = __min_chunk_size) noexcept
+      : __count_{__count}
+      , __num_chunks_{(::cuda::std::max) (ptrdiff_t{1},
+                                          (::cuda::std::min) (static_cast<ptrdiff_t>(::omp_get_max_threads()),
+                                                              ::cuda::ceil_div(__count, __min_size)))}
+  {}
+
+  [[nodiscard]] _CCCL_HOST_API ptrdiff_t __size() const noexcept
+  {
+    return __num_chunks_;
+  }
+
+  //! @brief Returns the index of the first element of @p __chunk, the first `__count_ % __num_chunks_` chunks get one
+  //! element more than the others
+  [[nodiscard]] _CCCL_HOST_API ptrdiff_t __begin(const ptrdiff_t __chunk) const noexcept
+  {
+    return (__count_ / __num_chunks_) * __chunk + (::cuda::std::min) (__chunk, __count_ % __num_chunks_);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API ptrdiff_t __end(const ptrdiff_t __chunk) const noexcept
+  {
+    return __begin(__chunk + 1);
+  }
+
+  //! @brief Invokes `__fn(__chunk, __begin, __end)` for every chunk in parallel
+  template <class _Fn>
+  _CCCL_HOST_API void __for_each(_Fn&& __fn) const
+  {
+    ::cuda::std::execution::__omp_parallel_for(__num_chunks_, [&](const ptrdiff_t __chunk) {
+      __fn(__chunk, __begin(__chunk), __end(__chunk));
+    });
+  }
+};
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_OMP()
+
+#endif // _CUDA_STD___PSTL_OMP_CHUNKS_H
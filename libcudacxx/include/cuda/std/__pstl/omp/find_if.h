@@ -0,0 +1,104 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_OMP_FIND_IF_H
+#define _CUDA_STD___PSTL_OMP_FIND_IF_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_OMP()
+
+#  include <cuda/std/__algorithm/find_if.h>
+#  include <cuda/std/__algorithm/min.h>
+#  include <cuda/std/__iterator/concepts.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/omp/chunks.h>
+#  include <cuda/std/__type_traits/always_false.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__find_if, __execution_backend::__omp>
+{
+  //! Every thread checks its chunk in blocks of @c __block_size elements and stops as soon as a match before its
+  //! current block has been found
+  static constexpr ptrdiff_t __block_size = 512;
+
+  template <class _Policy, class _Iter, class _UnaryOp>
+  [[nodiscard]] _CCCL_HOST_API _Iter
+  operator()([[maybe_unused]] const _Policy& __policy, _Iter __first, _Iter __last, _UnaryOp __pred) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_Iter>)
+    {
+      using _Diff = iter_difference_t<_Iter>;
+
+      const auto __count = static_cast<ptrdiff_t>(::cuda::std::distance(__first, __last));
+      ptrdiff_t __found  = __count;
+      __omp_chunks{__count}.__for_each([&](ptrdiff_t, const ptrdiff_t __begin, const ptrdiff_t __end) {
+        for (ptrdiff_t __block = __begin; __block < __end; __block += __block_size)
+        {
+          ptrdiff_t __current;
+          _CCCL_PRAGMA(omp atomic read)
+          __current = __found;
+          if (__current < __block)
+          {
+            return;
+          }
+
+          const ptrdiff_t __block_end = (::cuda::std::min) (__block + __block_size, __end);
+          for (ptrdiff_t __i = __block; __i != __block_end; ++__i)
+          {
+            if (__pred(__first[static_cast<_Diff>(__i)]))
+            {
+              _CCCL_PRAGMA(omp critical)
+              {
+                __found = (::cuda::std::min) (__found, __i);
+              }
+              return;
+            }
+          }
+        }
+      });
+      return __first + static_cast<_Diff>(__found);
+    }
+    else
+    {
+      static_assert(__always_false_v<_Policy>,
+                    "__pstl_dispatch: OpenMP backend of cuda::std::find_if requires at least random access iterators");
+      return ::cuda::std::find_if(::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__pred));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_OMP()
+
+#endif // _CUDA_STD___PSTL_OMP_FIND_IF_H
@@ -0,0 +1,80 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_OMP_FOR_EACH_N_H
+#define _CUDA_STD___PSTL_OMP_FOR_EACH_N_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_OMP()
+
+#  include <cuda/std/__algorithm/for_each_n.h>
+#  include <cuda/std/__iterator/concepts.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/omp/chunks.h>
+#  include <cuda/std/__type_traits/always_false.h>
+#  include <cuda/std/__utility/convert_to_integral.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__for_each_n, __execution_backend::__omp>
+{
+  _CCCL_TEMPLATE(class _Policy, class _Iter, class _Size, class _Fn)
+  _CCCL_REQUIRES(__has_forward_traversal<_Iter>)
+  [[nodiscard]] _CCCL_HOST_API _Iter
+  operator()([[maybe_unused]] const _Policy& __policy, _Iter __first, _Size __orig_n, _Fn __func) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_Iter>)
+    {
+      const auto __count = static_cast<ptrdiff_t>(::cuda::std::__convert_to_integral(__orig_n));
+      __omp_chunks{__count}.__for_each([&](ptrdiff_t, const ptrdiff_t __begin, const ptrdiff_t __end) {
+        auto __it = __first + static_cast<iter_difference_t<_Iter>>(__begin);
+        for (ptrdiff_t __i = __begin; __i != __end; ++__i, (void) ++__it)
+        {
+          __func(*__it);
+        }
+      });
+      return __first + static_cast<iter_difference_t<_Iter>>(__count);
+    }
+    else
+    {
+      static_assert(__always_false_v<_Policy>,
+                    "__pstl_dispatch: OpenMP backend of cuda::std::for_each_n requires at least random access "
+                    "iterators");
+      return ::cuda::std::for_each_n(::cuda::std::move(__first), __orig_n, ::cuda::std::move(__func));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_OMP()
+
+#endif // _CUDA_STD___PSTL_OMP_FOR_EACH_N_H
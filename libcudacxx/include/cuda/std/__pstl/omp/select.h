@@ -0,0 +1,89 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_OMP_SELECT_H
+#define _CUDA_STD___PSTL_OMP_SELECT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_OMP()
+
+#  include <cuda/std/__pstl/host_temporary_buffer.h>
+#  include <cuda/std/__pstl/omp/chunks.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Stable compaction of @c __count elements, returns the number of selected elements
+//! `__keep(__i)` decides whether element @c __i is selected and is evaluated exactly once per element, before any
+//! element is written. Then `__write(__i, __j)` writes the selected element @c __i to output position @c __j.
+template <class _Keep, class _Write>
+[[nodiscard]] _CCCL_HOST_API ptrdiff_t __omp_select(const ptrdiff_t __count, _Keep&& __keep, _Write&& __write)
+{
+  const __omp_chunks __chunks{__count};
+  const ptrdiff_t __num_chunks = __chunks.__size();
+
+  __host_temporary_buffer<bool> __flag_buffer{static_cast<size_t>(__count)};
+  __host_temporary_buffer<ptrdiff_t> __offset_buffer{static_cast<size_t>(__num_chunks + 1)};
+  bool* __flags        = __flag_buffer.__get();
+  ptrdiff_t* __offsets = __offset_buffer.__get();
+
+  __chunks.__for_each([&](const ptrdiff_t __chunk, const ptrdiff_t __begin, const ptrdiff_t __end) {
+    ptrdiff_t __selected = 0;
+    for (ptrdiff_t __i = __begin; __i != __end; ++__i)
+    {
+      __flags[__i] = static_cast<bool>(__keep(__i));
+      __selected += __flags[__i];
+    }
+    __offsets[__chunk + 1] = __selected;
+  });
+
+  __offsets[0] = 0;
+  for (ptrdiff_t __chunk = 0; __chunk != __num_chunks; ++__chunk)
+  {
+    __offsets[__chunk + 1] += __offsets[__chunk];
+  }
+
+  __chunks.__for_each([&](const ptrdiff_t __chunk, const ptrdiff_t __begin, const ptrdiff_t __end) {
+    ptrdiff_t __out = __offsets[__chunk];
+    for (ptrdiff_t __i = __begin; __i != __end; ++__i)
+    {
+      if (__flags[__i])
+      {
+        __write(__i, __out);
+        ++__out;
+      }
+    }
+  });
+
+  return __offsets[__num_chunks];
+}
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_OMP()
+
+#endif // _CUDA_STD___PSTL_OMP_SELECT_H
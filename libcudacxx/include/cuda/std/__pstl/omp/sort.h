@@ -0,0 +1,144 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_OMP_SORT_H
+#define _CUDA_STD___PSTL_OMP_SORT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_OMP()
+
+#  include <cuda/std/__algorithm/min.h>
+#  include <cuda/std/__algorithm/sort.h>
+#  include <cuda/std/__iterator/concepts.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__memory/construct_at.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host_temporary_buffer.h>
+#  include <cuda/std/__pstl/omp/chunks.h>
+#  include <cuda/std/__pstl/omp/merge.h>
+#  include <cuda/std/__type_traits/always_false.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__sort, __execution_backend::__omp>
+{
+  //! @brief Merges pairs of adjacent sorted runs of @p __src into @p __dst, a run without partner is moved as is.
+  //! Run @c __r spans the chunks `[__r * __width, (__r + 1) * __width)` of @p __chunks
+  template <class _Source, class _Dest, class _BinaryPredicate>
+  _CCCL_HOST_API static void __merge_runs(
+    const __omp_chunks& __chunks, const ptrdiff_t __width, _Source __src, _Dest __dst, _BinaryPredicate& __pred)
+  {
+    const ptrdiff_t __num_chunks = __chunks.__size();
+    for (ptrdiff_t __chunk = 0; __chunk < __num_chunks; __chunk += 2 * __width)
+    {
+      const ptrdiff_t __begin = __chunks.__begin(__chunk);
+      const ptrdiff_t __mid   = __chunks.__begin((::cuda::std::min) (__chunk + __width, __num_chunks));
+      const ptrdiff_t __end   = __chunks.__begin((::cuda::std::min) (__chunk + 2 * __width, __num_chunks));
+      ::cuda::std::execution::__omp_merge<true>(
+        __src + __begin, __mid - __begin, __src + __mid, __end - __mid, __dst + __begin, __pred);
+    }
+  }
+
+  _CCCL_TEMPLATE(class _Policy, class _InputIterator, class _BinaryPredicate)
+  _CCCL_REQUIRES(__has_forward_traversal<_InputIterator>)
+  _CCCL_HOST_API void operator()(
+    [[maybe_unused]] const _Policy& __policy,
+    _InputIterator __first,
+    _InputIterator __last,
+    _BinaryPredicate __pred) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>)
+    {
+      using _Diff      = iter_difference_t<_InputIterator>;
+      using _ValueType = iter_value_t<_InputIterator>;
+
+      // Every chunk is sorted on its own, then the sorted runs are merged pairwise until a single one is left
+      const __omp_chunks __chunks{static_cast<ptrdiff_t>(::cuda::std::distance(__first, __last))};
+      __chunks.__for_each([&](ptrdiff_t, const ptrdiff_t __begin, const ptrdiff_t __end) {
+        ::cuda::std::sort(__first + static_cast<_Diff>(__begin), __first + static_cast<_Diff>(__end), __pred);
+      });
+
+      const ptrdiff_t __num_chunks = __chunks.__size();
+      if (__num_chunks == 1)
+      {
+        return;
+      }
+
+      const ptrdiff_t __count = __chunks.__end(__num_chunks - 1);
+      __host_temporary_buffer<_ValueType> __buffer{static_cast<size_t>(__count)};
+      _ValueType* __tmp = __buffer.__get();
+
+      // The merge rounds alternate between the buffer and the input, which both hold live objects
+      __chunks.__for_each([&](ptrdiff_t, const ptrdiff_t __begin, const ptrdiff_t __end) {
+        for (ptrdiff_t __i = __begin; __i != __end; ++__i)
+        {
+          ::cuda::std::__construct_at(__tmp + __i, ::cuda::std::move(__first[static_cast<_Diff>(__i)]));
+        }
+      });
+
+      bool __in_buffer = true;
+      for (ptrdiff_t __width = 1; __width < __num_chunks; __width *= 2, __in_buffer = !__in_buffer)
+      {
+        if (__in_buffer)
+        {
+          __merge_runs(__chunks, __width, __tmp, __first, __pred);
+        }
+        else
+        {
+          __merge_runs(__chunks, __width, __first, __tmp, __pred);
+        }
+      }
+
+      __chunks.__for_each([&](ptrdiff_t, const ptrdiff_t __begin, const ptrdiff_t __end) {
+        if (__in_buffer)
+        {
+          for (ptrdiff_t __i = __begin; __i != __end; ++__i)
+          {
+            __first[static_cast<_Diff>(__i)] = ::cuda::std::move(__tmp[__i]);
+          }
+        }
+        ::cuda::std::__destroy(__tmp + __begin, __tmp + __end);
+      });
+    }
+    else
+    {
+      static_assert(__always_false_v<_Policy>,
+                    "__pstl_dispatch: OpenMP backend of cuda::std::sort requires at least random access iterators");
+      ::cuda::std::sort(::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__pred));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_OMP()
+
+#endif // _CUDA_STD___PSTL_OMP_SORT_H
@@ -0,0 +1,124 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_OMP_TRANSFORM_REDUCE_H
+#define _CUDA_STD___PSTL_OMP_TRANSFORM_REDUCE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_OMP()
+
+#  include <cuda/std/__functional/invoke.h>
+#  include <cuda/std/__iterator/concepts.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__iterator/next.h>
+#  include <cuda/std/__memory/construct_at.h>
+#  include <cuda/std/__numeric/transform_reduce.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host_temporary_buffer.h>
+#  include <cuda/std/__pstl/omp/chunks.h>
+#  include <cuda/std/__type_traits/always_false.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__transform_reduce, __execution_backend::__omp>
+{
+  template <class _InputIterator, class _Size, class _Tp, class _ReductionOp, class _TransformOp>
+  [[nodiscard]] _CCCL_HOST_API static _Tp __par_impl(
+    _InputIterator __first, _Size __count, _Tp __init, _ReductionOp __reduction_op, _TransformOp __transform_op)
+  {
+    using _AccumT = __accumulator_t<_ReductionOp, invoke_result_t<_TransformOp, iter_reference_t<_InputIterator>>, _Tp>;
+
+    // Every chunk is reduced on its own, starting from its first transformed element
+    const __omp_chunks __chunks{static_cast<ptrdiff_t>(__count)};
+    __host_temporary_buffer<_AccumT> __partials{static_cast<size_t>(__chunks.__size())};
+    _AccumT* __partial = __partials.__get();
+    __chunks.__for_each([&](const ptrdiff_t __chunk, const ptrdiff_t __begin, const ptrdiff_t __end) {
+      auto __it     = __first + static_cast<iter_difference_t<_InputIterator>>(__begin);
+      _AccumT __acc = static_cast<_AccumT>(__transform_op(*__it));
+      ++__it;
+      for (ptrdiff_t __i = __begin + 1; __i != __end; ++__i, (void) ++__it)
+      {
+        __acc = __reduction_op(::cuda::std::move(__acc), __transform_op(*__it));
+      }
+      ::cuda::std::__construct_at(__partial + __chunk, ::cuda::std::move(__acc));
+    });
+
+    for (ptrdiff_t __chunk = 0; __chunk != __chunks.__size(); ++__chunk)
+    {
+      __init = __reduction_op(::cuda::std::move(__init), ::cuda::std::move(__partial[__chunk]));
+    }
+    ::cuda::std::__destroy(__partial, __partial + __chunks.__size());
+    return __init;
+  }
+
+  _CCCL_TEMPLATE(class _Policy, class _InputIterator, class _Size, class _Tp, class _ReductionOp, class _TransformOp)
+  _CCCL_REQUIRES(__has_forward_traversal<_InputIterator>)
+  [[nodiscard]] _CCCL_HOST_API _Tp operator()(
+    [[maybe_unused]] const _Policy& __policy,
+    _InputIterator __first,
+    _Size __count,
+    _Tp __init,
+    _ReductionOp __reduction_op,
+    _TransformOp __transform_op) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>)
+    {
+      if (__count == 0)
+      {
+        return __init;
+      }
+      return __par_impl(
+        ::cuda::std::move(__first),
+        __count,
+        ::cuda::std::move(__init),
+        ::cuda::std::move(__reduction_op),
+        ::cuda::std::move(__transform_op));
+    }
+    else
+    {
+      static_assert(__always_false_v<_Policy>,
+                    "__pstl_dispatch: OpenMP backend of cuda::std::transform_reduce requires at least random access "
+                    "iterators");
+      auto __last = ::cuda::std::next(__first, __count);
+      return ::cuda::std::transform_reduce(
+        ::cuda::std::move(__first),
+        ::cuda::std::move(__last),
+        ::cuda::std::move(__init),
+        ::cuda::std::move(__reduction_op),
+        ::cuda::std::move(__transform_op));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_OMP()
+
+#endif // _CUDA_STD___PSTL_OMP_TRANSFORM_REDUCE_H
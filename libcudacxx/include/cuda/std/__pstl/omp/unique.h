@@ -0,0 +1,102 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_OMP_UNIQUE_H
+#define _CUDA_STD___PSTL_OMP_UNIQUE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_OMP()
+
+#  include <cuda/std/__algorithm/unique.h>
+#  include <cuda/std/__iterator/concepts.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__memory/construct_at.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host_temporary_buffer.h>
+#  include <cuda/std/__pstl/omp/chunks.h>
+#  include <cuda/std/__pstl/omp/select.h>
+#  include <cuda/std/__type_traits/always_false.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__unique, __execution_backend::__omp>
+{
+  _CCCL_TEMPLATE(class _Policy, class _InputIterator, class _BinaryPredicate)
+  _CCCL_REQUIRES(__has_forward_traversal<_InputIterator>)
+  [[nodiscard]] _CCCL_HOST_API _InputIterator operator()(
+    [[maybe_unused]] const _Policy& __policy,
+    _InputIterator __first,
+    _InputIterator __last,
+    _BinaryPredicate __pred) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>)
+    {
+      using _Diff      = iter_difference_t<_InputIterator>;
+      using _ValueType = iter_value_t<_InputIterator>;
+
+      // Compacting in place would overwrite elements that other threads still compare, so the kept elements are moved
+      // into a buffer first. All comparisons are done before the first element is moved.
+      const auto __count = static_cast<ptrdiff_t>(::cuda::std::distance(__first, __last));
+      __host_temporary_buffer<_ValueType> __buffer{static_cast<size_t>(__count)};
+      _ValueType* __kept = __buffer.__get();
+
+      const ptrdiff_t __selected = ::cuda::std::execution::__omp_select(
+        __count,
+        [&](const ptrdiff_t __i) {
+          return __i == 0 || !__pred(__first[static_cast<_Diff>(__i - 1)], __first[static_cast<_Diff>(__i)]);
+        },
+        [&](const ptrdiff_t __i, const ptrdiff_t __j) {
+          ::cuda::std::__construct_at(__kept + __j, ::cuda::std::move(__first[static_cast<_Diff>(__i)]));
+        });
+
+      __omp_chunks{__selected}.__for_each([&](ptrdiff_t, const ptrdiff_t __begin, const ptrdiff_t __end) {
+        for (ptrdiff_t __i = __begin; __i != __end; ++__i)
+        {
+          __first[static_cast<_Diff>(__i)] = ::cuda::std::move(__kept[__i]);
+        }
+        ::cuda::std::__destroy(__kept + __begin, __kept + __end);
+      });
+      return __first + static_cast<_Diff>(__selected);
+    }
+    else
+    {
+      static_assert(__always_false_v<_Policy>,
+                    "__pstl_dispatch: OpenMP backend of cuda::std::unique requires at least random access iterators");
+      return ::cuda::std::unique(::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__pred));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_OMP()
+
+#endif // _CUDA_STD___PSTL_OMP_UNIQUE_H
@@ -42,6 +42,10 @@
 #    include <cuda/std/__pstl/cuda/partition_copy.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
 
+#  if _CCCL_HAS_BACKEND_TBB()
+#    include <cuda/std/__pstl/tbb/partition_copy.h>
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
 #  include <cuda/std/__cccl/prologue.h>
 
 _CCCL_BEGIN_NAMESPACE_CUDA_STD
@@ -50,6 +50,21 @@
 #    include <cuda/std/__pstl/cuda/transform.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
 
+#  if _CCCL_HAS_BACKEND_OMP()
+#    include <cuda/std/__pstl/omp/for_each_n.h>
+#    include <cuda/std/__pstl/omp/transform.h>
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+#    include <cuda/std/__pstl/tbb/for_each_n.h>
+#    include <cuda/std/__pstl/tbb/transform.h>
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+#  if _CCCL_HAS_BACKEND_THREADS()
+#    include <cuda/std/__pstl/threads/for_each_n.h>
+#    include <cuda/std/__pstl/threads/transform.h>
+#  endif // _CCCL_HAS_BACKEND_THREADS()
+
 #  include <cuda/std/__cccl/prologue.h>
 
 _CCCL_BEGIN_NAMESPACE_CUDA_STD
@@ -61,7 +76,7 @@ struct __swap_ranges_iter_swap_fn
   _InputIterator2 __first2;
 
   template <class _DifferenceType>
-  _CCCL_DEVICE_API _CCCL_FORCEINLINE constexpr void operator()(const _DifferenceType __index) const
+  _CCCL_API _CCCL_FORCEINLINE constexpr void operator()(const _DifferenceType __index) const
   {
     ::cuda::std::__iter_swap_cpo{}(
       __first1 + __index, __first2 + static_cast<iter_difference_t<_InputIterator2>>(__index));
@@ -71,7 +86,7 @@ struct __swap_ranges_iter_swap_fn
 struct __swap_ranges_transform_fn
 {
   template <class _Tp, class _Up>
-  [[nodiscard]] _CCCL_DEVICE_API _CCCL_FORCEINLINE constexpr auto operator()(_Tp __lhs, _Up __rhs) const
+  [[nodiscard]] _CCCL_API _CCCL_FORCEINLINE constexpr auto operator()(_Tp __lhs, _Up __rhs) const
   {
     using ::cuda::std::swap;
     swap(__lhs, __rhs);
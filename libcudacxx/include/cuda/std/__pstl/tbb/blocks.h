@@ -0,0 +1,54 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_TBB_BLOCKS_H
+#define _CUDA_STD___PSTL_TBB_BLOCKS_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_TBB()
+
+#  include <cuda/std/cstddef>
+
+#  include <oneapi/tbb/blocked_range.h>
+#  include <oneapi/tbb/parallel_for.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+//! @brief The range type used by all algorithms of the oneTBB backend
+using __tbb_range = ::tbb::blocked_range<ptrdiff_t>;
+
+//! @brief Invokes `__fn(__begin, __end)` for disjoint blocks covering `[0, __count)` on the threads of the oneTBB arena
+//! The size of the blocks is chosen by the auto partitioner of oneTBB
+template <class _Fn>
+_CCCL_HOST_API void __tbb_for_each_block(const ptrdiff_t __count, _Fn&& __fn)
+{
+  ::tbb::parallel_for(__tbb_range{0, __count}, [&](const __tbb_range& __range) {
+    __fn(__range.begin(), __range.end());
+  });
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_TBB()
+
+#endif // _CUDA_STD___PSTL_TBB_BLOCKS_H
@@ -0,0 +1,101 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_TBB_FIND_IF_H
+#define _CUDA_STD___PSTL_TBB_FIND_IF_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_TBB()
+
+#  include <cuda/__atomic/atomic.h>
+#  include <cuda/std/__algorithm/find_if.h>
+#  include <cuda/std/__algorithm/min.h>
+#  include <cuda/std/__atomic/order.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/tbb/blocks.h>
+#  include <cuda/std/__type_traits/always_false.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <oneapi/tbb/parallel_for.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__find_if, __execution_backend::__tbb>
+{
+  //! Every task checks its range in blocks of @c __block_size elements and stops as soon as a match before its current
+  //! block has been found
+  static constexpr ptrdiff_t __block_size = 512;
+
+  template <class _Policy, class _Iter, class _UnaryOp>
+  [[nodiscard]] _CCCL_HOST_API _Iter
+  operator()([[maybe_unused]] const _Policy& __policy, _Iter __first, _Iter __last, _UnaryOp __pred) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_Iter>)
+    {
+      using _Diff = iter_difference_t<_Iter>;
+
+      const auto __count = static_cast<ptrdiff_t>(::cuda::std::distance(__first, __last));
+      ::cuda::atomic<ptrdiff_t> __found{__count};
+      ::tbb::parallel_for(__tbb_range{0, __count, __block_size}, [&](const __tbb_range& __range) {
+        for (ptrdiff_t __block = __range.begin(); __block < __range.end(); __block += __block_size)
+        {
+          if (__found.load(::cuda::std::memory_order_relaxed) < __block)
+          {
+            return;
+          }
+
+          const ptrdiff_t __block_end = (::cuda::std::min) (__block + __block_size, __range.end());
+          for (ptrdiff_t __i = __block; __i != __block_end; ++__i)
+          {
+            if (__pred(__first[static_cast<_Diff>(__i)]))
+            {
+              __found.fetch_min(__i, ::cuda::std::memory_order_relaxed);
+              return;
+            }
+          }
+        }
+      });
+      return __first + static_cast<_Diff>(__found.load(::cuda::std::memory_order_relaxed));
+    }
+    else
+    {
+      static_assert(__always_false_v<_Policy>,
+                    "__pstl_dispatch: oneTBB backend of cuda::std::find_if requires at least random access iterators");
+      return ::cuda::std::find_if(::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__pred));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_TBB()
+
+#endif // _CUDA_STD___PSTL_TBB_FIND_IF_H
@@ -0,0 +1,177 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_TBB_MERGE_H
+#define _CUDA_STD___PSTL_TBB_MERGE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_TBB()
+
+#  include <cuda/std/__algorithm/lower_bound.h>
+#  include <cuda/std/__algorithm/merge.h>
+#  include <cuda/std/__algorithm/upper_bound.h>
+#  include <cuda/std/__iterator/concepts.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__type_traits/always_false.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <oneapi/tbb/blocked_range.h>
+#  include <oneapi/tbb/parallel_for.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief A oneTBB range over two sorted ranges that are merged into `[__begin1_ + __begin2_, __end1_ + __end2_)` of
+//! the output. It is split by halving the larger of the two ranges and searching the matching split point in the other
+//! one, such that every element of the first part precedes every element of the second part in a stable merge.
+template <class _InputIterator1, class _InputIterator2, class _Compare>
+struct __tbb_merge_range
+{
+  static constexpr ptrdiff_t __grain_size = 2048;
+
+  _InputIterator1 __first1_;
+  _InputIterator2 __first2_;
+  _Compare* __comp_;
+  ptrdiff_t __begin1_;
+  ptrdiff_t __end1_;
+  ptrdiff_t __begin2_;
+  ptrdiff_t __end2_;
+
+  _CCCL_HOST_API __tbb_merge_range(
+    _InputIterator1 __first1,
+    const ptrdiff_t __count1,
+    _InputIterator2 __first2,
+    const ptrdiff_t __count2,
+    _Compare& __comp)
+      : __first1_{::cuda::std::move(__first1)}
+      , __first2_{::cuda::std::move(__first2)}
+      , __comp_{&__comp}
+      , __begin1_{0}
+      , __end1_{__count1}
+      , __begin2_{0}
+      , __end2_{__count2}
+  {}
+
+  //! @brief Takes the second part of @p __other, which keeps the first part
+  _CCCL_HOST_API __tbb_merge_range(__tbb_merge_range& __other, ::tbb::split)
+      : __tbb_merge_range{__other}
+  {
+    using _Diff1 = iter_difference_t<_InputIterator1>;
+    using _Diff2 = iter_difference_t<_InputIterator2>;
+
+    const auto __begin1 = __first1_ + static_cast<_Diff1>(__begin1_);
+    const auto __end1   = __first1_ + static_cast<_Diff1>(__end1_);
+    const auto __begin2 = __first2_ + static_cast<_Diff2>(__begin2_);
+    const auto __end2   = __first2_ + static_cast<_Diff2>(__end2_);
+    if (__end1_ - __begin1_ >= __end2_ - __begin2_)
+    {
+      // Elements of the second range that are equal to the pivot follow it in the output
+      const auto __mid1 = __begin1_ + (__end1_ - __begin1_) / 2;
+      const auto __mid2 = ::cuda::std::lower_bound(__begin2, __end2, __first1_[static_cast<_Diff1>(__mid1)], *__comp_);
+      __begin1_         = __mid1;
+      __begin2_         = static_cast<ptrdiff_t>(__mid2 - __first2_);
+    }
+    else
+    {
+      // Elements of the first range that are equal to the pivot precede it in the output
+      const auto __mid2 = __begin2_ + (__end2_ - __begin2_) / 2;
+      const auto __mid1 = ::cuda::std::upper_bound(__begin1, __end1, __first2_[static_cast<_Diff2>(__mid2)], *__comp_);
+      __begin1_         = static_cast<ptrdiff_t>(__mid1 - __first1_);
+      __begin2_         = __mid2;
+    }
+    __other.__end1_ = __begin1_;
+    __other.__end2_ = __begin2_;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API bool empty() const noexcept
+  {
+    return __begin1_ == __end1_ && __begin2_ == __end2_;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API bool is_divisible() const noexcept
+  {
+    return (__end1_ - __begin1_) + (__end2_ - __begin2_) > __grain_size;
+  }
+};
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__merge, __execution_backend::__tbb>
+{
+  _CCCL_TEMPLATE(class _Policy, class _InputIterator1, class _InputIterator2, class _OutputIterator, class _Compare)
+  _CCCL_REQUIRES(__has_forward_traversal<_OutputIterator>)
+  [[nodiscard]] _CCCL_HOST_API _OutputIterator operator()(
+    [[maybe_unused]] const _Policy& __policy,
+    _InputIterator1 __first1,
+    _InputIterator1 __last1,
+    _InputIterator2 __first2,
+    _InputIterator2 __last2,
+    _OutputIterator __result,
+    _Compare __comp) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator1>
+                  && ::cuda::std::__has_random_access_traversal<_InputIterator2>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator>)
+    {
+      using _Diff1   = iter_difference_t<_InputIterator1>;
+      using _Diff2   = iter_difference_t<_InputIterator2>;
+      using _OutDiff = iter_difference_t<_OutputIterator>;
+      using _Range   = __tbb_merge_range<_InputIterator1, _InputIterator2, _Compare>;
+
+      const auto __count1 = static_cast<ptrdiff_t>(::cuda::std::distance(__first1, __last1));
+      const auto __count2 = static_cast<ptrdiff_t>(::cuda::std::distance(__first2, __last2));
+      ::tbb::parallel_for(_Range{__first1, __count1, __first2, __count2, __comp}, [&](const _Range& __range) {
+        ::cuda::std::merge(__first1 + static_cast<_Diff1>(__range.__begin1_),
+                           __first1 + static_cast<_Diff1>(__range.__end1_),
+                           __first2 + static_cast<_Diff2>(__range.__begin2_),
+                           __first2 + static_cast<_Diff2>(__range.__end2_),
+                           __result + static_cast<_OutDiff>(__range.__begin1_ + __range.__begin2_),
+                           __comp);
+      });
+      return __result + static_cast<_OutDiff>(__count1 + __count2);
+    }
+    else
+    {
+      static_assert(__always_false_v<_Policy>,
+                    "__pstl_dispatch: oneTBB backend of cuda::std::merge requires at least random access iterators");
+      return ::cuda::std::merge(
+        ::cuda::std::move(__first1),
+        ::cuda::std::move(__last1),
+        ::cuda::std::move(__first2),
+        ::cuda::std::move(__last2),
+        ::cuda::std::move(__result),
+        ::cuda::std::move(__comp));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_TBB()
+
+#endif // _CUDA_STD___PSTL_TBB_MERGE_H
@@ -0,0 +1,124 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_TBB_REDUCE_H
+#define _CUDA_STD___PSTL_TBB_REDUCE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_TBB()
+
+#  include <cuda/std/__functional/invoke.h>
+#  include <cuda/std/__iterator/concepts.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__iterator/next.h>
+#  include <cuda/std/__numeric/reduce.h>
+#  include <cuda/std/__optional/optional.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/tbb/blocks.h>
+#  include <cuda/std/__type_traits/always_false.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <oneapi/tbb/parallel_reduce.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__reduce, __execution_backend::__tbb>
+{
+  template <class _Iter, class _Size, class _Tp, class _BinaryOp>
+  [[nodiscard]] _CCCL_HOST_API static _Tp __par_impl(_Iter __first, _Size __count, _Tp __init, _BinaryOp __func)
+  {
+    using _AccumT = __accumulator_t<_BinaryOp, iter_reference_t<_Iter>, _Tp>;
+    using _State  = optional<_AccumT>;
+
+    // Every range is reduced starting from its first element, so that no identity element is required
+    _State __sum = ::tbb::parallel_reduce(
+      __tbb_range{0, static_cast<ptrdiff_t>(__count)},
+      _State{},
+      [&](const __tbb_range& __range, _State __acc) {
+        auto __it     = __first + static_cast<iter_difference_t<_Iter>>(__range.begin());
+        ptrdiff_t __i = __range.begin();
+        if (!__acc)
+        {
+          __acc.emplace(*__it);
+          ++__it;
+          ++__i;
+        }
+        for (; __i != __range.end(); ++__i, (void) ++__it)
+        {
+          *__acc = __func(::cuda::std::move(*__acc), *__it);
+        }
+        return __acc;
+      },
+      [&](const _State& __left, const _State& __right) {
+        if (!__left || !__right)
+        {
+          return __left ? __left : __right;
+        }
+        return _State{__func(*__left, *__right)};
+      });
+    return __func(::cuda::std::move(__init), ::cuda::std::move(*__sum));
+  }
+
+  template <class _Policy, class _Iter, class _Size, class _Tp, class _BinaryOp>
+  [[nodiscard]] _CCCL_HOST_API _Tp
+  operator()([[maybe_unused]] const _Policy& __policy, _Iter __first, _Size __count, _Tp __init, _BinaryOp __func) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_Iter>)
+    {
+      if (__count == 0)
+      {
+        return __init;
+      }
+      return __par_impl(::cuda::std::move(__first), __count, ::cuda::std::move(__init), ::cuda::std::move(__func));
+    }
+    else
+    {
+      static_assert(__always_false_v<_Policy>,
+                    "__pstl_dispatch: oneTBB backend of cuda::std::reduce requires at least random access iterators");
+      return ::cuda::std::reduce(
+        __first, ::cuda::std::next(__first, __count), ::cuda::std::move(__init), ::cuda::std::move(__func));
+    }
+  }
+
+  template <class _Policy, class _Iter, class _Tp, class _BinaryOp>
+  [[nodiscard]] _CCCL_HOST_API _Tp
+  operator()([[maybe_unused]] const _Policy& __policy, _Iter __first, _Iter __last, _Tp __init, _BinaryOp __func) const
+  {
+    const auto __count = ::cuda::std::distance(__first, __last);
+    return (*this)(__policy, ::cuda::std::move(__first), __count, ::cuda::std::move(__init), ::cuda::std::move(__func));
+  }
+};
+
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_TBB()
+
+#endif // _CUDA_STD___PSTL_TBB_REDUCE_H
@@ -0,0 +1,95 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_TBB_ROTATE_H
+#define _CUDA_STD___PSTL_TBB_ROTATE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_TBB()
+
+#  include <cuda/std/__algorithm/iter_swap.h>
+#  include <cuda/std/__algorithm/rotate.h>
+#  include <cuda/std/__iterator/concepts.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/tbb/blocks.h>
+#  include <cuda/std/__type_traits/always_false.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__rotate, __execution_backend::__tbb>
+{
+  //! @brief Reverses `[__first, __first + __count)` in parallel
+  template <class _InputIterator>
+  _CCCL_HOST_API static void __reverse(_InputIterator __first, const ptrdiff_t __count)
+  {
+    using _Diff = iter_difference_t<_InputIterator>;
+    ::cuda::std::execution::__tbb_for_each_block(__count / 2, [&](const ptrdiff_t __begin, const ptrdiff_t __end) {
+      for (ptrdiff_t __i = __begin; __i != __end; ++__i)
+      {
+        ::cuda::std::iter_swap(__first + static_cast<_Diff>(__i), __first + static_cast<_Diff>(__count - 1 - __i));
+      }
+    });
+  }
+
+  _CCCL_TEMPLATE(class _Policy, class _InputIterator)
+  _CCCL_REQUIRES(__has_forward_traversal<_InputIterator>)
+  [[nodiscard]] _CCCL_HOST_API _InputIterator operator()(
+    [[maybe_unused]] const _Policy& __policy,
+    _InputIterator __first,
+    _InputIterator __middle,
+    _InputIterator __last) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>)
+    {
+      const auto __count  = static_cast<ptrdiff_t>(::cuda::std::distance(__first, __last));
+      const auto __offset = static_cast<ptrdiff_t>(::cuda::std::distance(__first, __middle));
+
+      // Reversing both parts and then the whole range rotates it in place
+      __reverse(__first, __offset);
+      __reverse(__middle, __count - __offset);
+      __reverse(__first, __count);
+      return __first + static_cast<iter_difference_t<_InputIterator>>(__count - __offset);
+    }
+    else
+    {
+      static_assert(__always_false_v<_Policy>,
+                    "__pstl_dispatch: oneTBB backend of cuda::std::rotate requires at least random access iterators");
+      return ::cuda::std::rotate(::cuda::std::move(__first), ::cuda::std::move(__middle), ::cuda::std::move(__last));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_TBB()
+
+#endif // _CUDA_STD___PSTL_TBB_ROTATE_H
@@ -0,0 +1,94 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_TBB_ROTATE_COPY_H
+#define _CUDA_STD___PSTL_TBB_ROTATE_COPY_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_TBB()
+
+#  include <cuda/std/__algorithm/rotate_copy.h>
+#  include <cuda/std/__iterator/concepts.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/tbb/blocks.h>
+#  include <cuda/std/__type_traits/always_false.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__rotate_copy, __execution_backend::__tbb>
+{
+  _CCCL_TEMPLATE(class _Policy, class _InputIterator, class _OutputIterator)
+  _CCCL_REQUIRES(__has_forward_traversal<_InputIterator> _CCCL_AND __has_forward_traversal<_OutputIterator>)
+  [[nodiscard]] _CCCL_HOST_API _OutputIterator operator()(
+    [[maybe_unused]] const _Policy& __policy,
+    _InputIterator __first,
+    _InputIterator __middle,
+    _InputIterator __last,
+    _OutputIterator __result) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator>)
+    {
+      using _InDiff  = iter_difference_t<_InputIterator>;
+      using _OutDiff = iter_difference_t<_OutputIterator>;
+
+      // `[__middle, __last)` is copied to the front of the output, followed by `[__first, __middle)`
+      const auto __count = static_cast<ptrdiff_t>(::cuda::std::distance(__first, __last));
+      const auto __tail  = static_cast<ptrdiff_t>(::cuda::std::distance(__middle, __last));
+      ::cuda::std::execution::__tbb_for_each_block(__count, [&](const ptrdiff_t __begin, const ptrdiff_t __end) {
+        for (ptrdiff_t __i = __begin; __i != __end; ++__i)
+        {
+          const ptrdiff_t __from               = __i < __tail ? __i + (__count - __tail) : __i - __tail;
+          __result[static_cast<_OutDiff>(__i)] = __first[static_cast<_InDiff>(__from)];
+        }
+      });
+      return __result + static_cast<_OutDiff>(__count);
+    }
+    else
+    {
+      static_assert(__always_false_v<_Policy>,
+                    "__pstl_dispatch: oneTBB backend of cuda::std::rotate_copy requires at least random access "
+                    "iterators");
+      return ::cuda::std::rotate_copy(
+        ::cuda::std::move(__first),
+        ::cuda::std::move(__middle),
+        ::cuda::std::move(__last),
+        ::cuda::std::move(__result));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_TBB()
+
+#endif // _CUDA_STD___PSTL_TBB_ROTATE_COPY_H
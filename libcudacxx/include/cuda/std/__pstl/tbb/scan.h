@@ -0,0 +1,117 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_TBB_SCAN_H
+#define _CUDA_STD___PSTL_TBB_SCAN_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_TBB()
+
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__optional/optional.h>
+#  include <cuda/std/__pstl/tbb/blocks.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <oneapi/tbb/parallel_scan.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Scan of @c __count elements with @c __op on top of `tbb::parallel_scan`, optionally starting with @c __init
+//! The state of the scan is the sum of everything before the current range. It is empty for ranges that are not
+//! preceded by anything, so that no identity element is required, and only the range starting at the first element is
+//! seeded with @c __init. Each element is read before its output is written, so the scan may run in place.
+template <bool _Exclusive, class _AccumT, class _InputIterator, class _OutputIterator, class _BinaryOp, class... _Init>
+[[nodiscard]] _CCCL_HOST_API _OutputIterator __tbb_scan(
+  _InputIterator __first, const ptrdiff_t __count, _OutputIterator __result, _BinaryOp& __op, _Init&&... __init)
+{
+  constexpr bool __has_init = sizeof...(_Init) != 0;
+  static_assert(__has_init || !_Exclusive, "__tbb_scan: an exclusive scan requires an initial value");
+
+  using _State = optional<_AccumT>;
+  ::tbb::parallel_scan(
+    __tbb_range{0, __count},
+    _State{},
+    [&](const __tbb_range& __range, _State __sum, const bool __final_pass) {
+      if constexpr (__has_init)
+      {
+        if (__range.begin() == 0)
+        {
+          __sum.emplace(__init...);
+        }
+      }
+
+      auto __in  = __first + static_cast<iter_difference_t<_InputIterator>>(__range.begin());
+      auto __out = __result + static_cast<iter_difference_t<_OutputIterator>>(__range.begin());
+      for (ptrdiff_t __i = __range.begin(); __i != __range.end(); ++__i, (void) ++__in, (void) ++__out)
+      {
+        if constexpr (_Exclusive)
+        {
+          // The final pass always starts from __init or the sum of the preceding ranges
+          if (__final_pass)
+          {
+            _AccumT __next = __op(*__sum, *__in);
+            *__out         = ::cuda::std::move(*__sum);
+            *__sum         = ::cuda::std::move(__next);
+            continue;
+          }
+        }
+
+        if (__sum)
+        {
+          *__sum = __op(::cuda::std::move(*__sum), *__in);
+        }
+        else
+        {
+          __sum.emplace(*__in);
+        }
+
+        if constexpr (!_Exclusive)
+        {
+          if (__final_pass)
+          {
+            *__out = *__sum;
+          }
+        }
+      }
+      return __sum;
+    },
+    [&](const _State& __left, const _State& __right) {
+      if (!__left || !__right)
+      {
+        return __left ? __left : __right;
+      }
+      return _State{__op(*__left, *__right)};
+    });
+  return __result + static_cast<iter_difference_t<_OutputIterator>>(__count);
+}
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_TBB()
+
+#endif // _CUDA_STD___PSTL_TBB_SCAN_H
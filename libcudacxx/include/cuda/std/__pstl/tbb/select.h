@@ -0,0 +1,99 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_TBB_SELECT_H
+#define _CUDA_STD___PSTL_TBB_SELECT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_TBB()
+
+#  include <cuda/std/__pstl/host_temporary_buffer.h>
+#  include <cuda/std/__pstl/tbb/blocks.h>
+#  include <cuda/std/cstddef>
+
+#  include <oneapi/tbb/parallel_scan.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Stable partition of @c __count elements, returns the number of selected elements
+//! `__keep(__i)` decides whether element @c __i is selected and is evaluated exactly once per element, before any
+//! element is written. Then `__write_true(__i, __j)` writes the selected element @c __i to position @c __j among the
+//! selected elements and `__write_false(__i, __j)` writes the rejected element @c __i to position @c __j among the
+//! rejected elements.
+template <class _Keep, class _WriteTrue, class _WriteFalse>
+[[nodiscard]] _CCCL_HOST_API ptrdiff_t
+__tbb_partition(const ptrdiff_t __count, _Keep&& __keep, _WriteTrue&& __write_true, _WriteFalse&& __write_false)
+{
+  __host_temporary_buffer<bool> __flag_buffer{static_cast<size_t>(__count)};
+  bool* __flags = __flag_buffer.__get();
+  ::cuda::std::execution::__tbb_for_each_block(__count, [&](const ptrdiff_t __begin, const ptrdiff_t __end) {
+    for (ptrdiff_t __i = __begin; __i != __end; ++__i)
+    {
+      __flags[__i] = static_cast<bool>(__keep(__i));
+    }
+  });
+
+  // The state of the scan is the number of selected elements before the current range
+  return ::tbb::parallel_scan(
+    __tbb_range{0, __count},
+    ptrdiff_t{0},
+    [&](const __tbb_range& __range, ptrdiff_t __selected, const bool __final_pass) {
+      for (ptrdiff_t __i = __range.begin(); __i != __range.end(); ++__i)
+      {
+        if (__flags[__i])
+        {
+          if (__final_pass)
+          {
+            __write_true(__i, __selected);
+          }
+          ++__selected;
+        }
+        else if (__final_pass)
+        {
+          __write_false(__i, __i - __selected);
+        }
+      }
+      return __selected;
+    },
+    [](const ptrdiff_t __left, const ptrdiff_t __right) {
+      return __left + __right;
+    });
+}
+
+//! @brief Stable compaction of @c __count elements, returns the number of selected elements
+//! Same as @c __tbb_partition, but the rejected elements are dropped
+template <class _Keep, class _Write>
+[[nodiscard]] _CCCL_HOST_API ptrdiff_t __tbb_select(const ptrdiff_t __count, _Keep&& __keep, _Write&& __write)
+{
+  return ::cuda::std::execution::__tbb_partition(__count, __keep, __write, [](ptrdiff_t, ptrdiff_t) {});
+}
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_TBB()
+
+#endif // _CUDA_STD___PSTL_TBB_SELECT_H
@@ -0,0 +1,84 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_TBB_SHIFT_H
+#define _CUDA_STD___PSTL_TBB_SHIFT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_TBB()
+
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__memory/construct_at.h>
+#  include <cuda/std/__pstl/host_temporary_buffer.h>
+#  include <cuda/std/__pstl/tbb/blocks.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Moves the @c __count elements starting at index @c __src of @p __first to index @c __dst in parallel
+//! Overlapping source and destination ranges are moved through a temporary buffer.
+template <class _Iter>
+_CCCL_HOST_API void __tbb_shift(_Iter __first, const ptrdiff_t __src, const ptrdiff_t __dst, const ptrdiff_t __count)
+{
+  using _Diff      = iter_difference_t<_Iter>;
+  using _ValueType = iter_value_t<_Iter>;
+
+  const ptrdiff_t __distance = __src < __dst ? __dst - __src : __src - __dst;
+  if (__distance >= __count)
+  {
+    ::cuda::std::execution::__tbb_for_each_block(__count, [&](const ptrdiff_t __begin, const ptrdiff_t __end) {
+      for (ptrdiff_t __i = __begin; __i != __end; ++__i)
+      {
+        __first[static_cast<_Diff>(__dst + __i)] = ::cuda::std::move(__first[static_cast<_Diff>(__src + __i)]);
+      }
+    });
+    return;
+  }
+
+  __host_temporary_buffer<_ValueType> __buffer{static_cast<size_t>(__count)};
+  _ValueType* __values = __buffer.__get();
+  ::cuda::std::execution::__tbb_for_each_block(__count, [&](const ptrdiff_t __begin, const ptrdiff_t __end) {
+    for (ptrdiff_t __i = __begin; __i != __end; ++__i)
+    {
+      ::cuda::std::__construct_at(__values + __i, ::cuda::std::move(__first[static_cast<_Diff>(__src + __i)]));
+    }
+  });
+  ::cuda::std::execution::__tbb_for_each_block(__count, [&](const ptrdiff_t __begin, const ptrdiff_t __end) {
+    for (ptrdiff_t __i = __begin; __i != __end; ++__i)
+    {
+      __first[static_cast<_Diff>(__dst + __i)] = ::cuda::std::move(__values[__i]);
+    }
+    ::cuda::std::__destroy(__values + __begin, __values + __end);
+  });
+}
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_TBB()
+
+#endif // _CUDA_STD___PSTL_TBB_SHIFT_H
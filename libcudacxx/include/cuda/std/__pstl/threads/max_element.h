@@ -0,0 +1,111 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_THREADS_MAX_ELEMENT_H
+#define _CUDA_STD___PSTL_THREADS_MAX_ELEMENT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_THREADS()
+
+#  include <cuda/std/__algorithm/max_element.h>
+#  include <cuda/std/__iterator/concepts.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__memory/construct_at.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host_temporary_buffer.h>
+#  include <cuda/std/__pstl/threads/chunks.h>
+#  include <cuda/std/__pstl/unseq.h>
+#  include <cuda/std/__type_traits/always_false.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__max_element, __execution_backend::__threads>
+{
+  template <class _Policy, class _InputIterator, class _BinaryPred>
+  [[nodiscard]] _CCCL_HOST_API _InputIterator operator()(
+    [[maybe_unused]] const _Policy& __policy, _InputIterator __first, _InputIterator __last, _BinaryPred __pred) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>)
+    {
+      using _Diff = iter_difference_t<_InputIterator>;
+      const __threads_config __config{__policy};
+
+      const auto __count = static_cast<ptrdiff_t>(::cuda::std::distance(__first, __last));
+      if (__count == 0)
+      {
+        return __first;
+      }
+
+      const __threads_chunks __chunks{__config, __count};
+      __host_temporary_buffer<_InputIterator> __buffer{static_cast<size_t>(__chunks.__size())};
+      _InputIterator* __candidates = __buffer.__get();
+      __chunks.__for_each([&](const ptrdiff_t __chunk, const ptrdiff_t __begin, const ptrdiff_t __end) {
+        const auto __chunk_first = __first + static_cast<_Diff>(__begin);
+        const auto __chunk_last  = __first + static_cast<_Diff>(__end);
+        if constexpr (__is_unsequenced_policy(_Policy::__get_policy()))
+        {
+          ::cuda::std::__construct_at(
+            __candidates + __chunk, ::cuda::std::__pstl_unseq_max_element(__chunk_first, __chunk_last, __pred));
+        }
+        else
+        {
+          ::cuda::std::__construct_at(
+            __candidates + __chunk, ::cuda::std::max_element(__chunk_first, __chunk_last, __pred));
+        }
+      });
+
+      // The candidates are visited in order and only replaced by a strictly better one, so the first occurrence wins
+      _InputIterator __result = __candidates[0];
+      for (ptrdiff_t __chunk = 1; __chunk < __chunks.__size(); ++__chunk)
+      {
+        if (__pred(*__result, *__candidates[__chunk]))
+        {
+          __result = __candidates[__chunk];
+        }
+      }
+      ::cuda::std::__destroy(__candidates, __candidates + __chunks.__size());
+      return __result;
+    }
+    else
+    {
+      static_assert(__always_false_v<_Policy>,
+                    "__pstl_dispatch: thread pool backend of cuda::std::max_element requires at least random access "
+                    "iterators");
+      return ::cuda::std::max_element(::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__pred));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_THREADS()
+
+#endif // _CUDA_STD___PSTL_THREADS_MAX_ELEMENT_H
@@ -0,0 +1,180 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_THREADS_MERGE_H
+#define _CUDA_STD___PSTL_THREADS_MERGE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_THREADS()
+
+#  include <cuda/std/__algorithm/max.h>
+#  include <cuda/std/__algorithm/merge.h>
+#  include <cuda/std/__algorithm/min.h>
+#  include <cuda/std/__iterator/concepts.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__iterator/move_iterator.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host_temporary_buffer.h>
+#  include <cuda/std/__pstl/threads/chunks.h>
+#  include <cuda/std/__type_traits/always_false.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Returns how many of the first @c __diag elements of the merged output are taken from the first range
+//! Equivalent elements are taken from the first range first, which keeps the merge stable.
+template <class _InputIterator1, class _InputIterator2, class _Compare>
+[[nodiscard]] _CCCL_HOST_API ptrdiff_t __threads_merge_path(
+  _InputIterator1 __first1,
+  const ptrdiff_t __count1,
+  _InputIterator2 __first2,
+  const ptrdiff_t __count2,
+  const ptrdiff_t __diag,
+  _Compare& __comp)
+{
+  ptrdiff_t __lo = (::cuda::std::max) (ptrdiff_t{0}, __diag - __count2);
+  ptrdiff_t __hi = (::cuda::std::min) (__diag, __count1);
+  while (__lo < __hi)
+  {
+    const ptrdiff_t __mid = __lo + (__hi - __lo) / 2;
+    if (!__comp(__first2[static_cast<iter_difference_t<_InputIterator2>>(__diag - __mid - 1)],
+                __first1[static_cast<iter_difference_t<_InputIterator1>>(__mid)]))
+    {
+      __lo = __mid + 1;
+    }
+    else
+    {
+      __hi = __mid;
+    }
+  }
+  return __lo;
+}
+
+//! @brief Merges two sorted ranges by splitting the output into chunks, every chunk is merged serially from the
+//! pieces of both inputs found by @c __threads_merge_path. With @c _Move the input elements are moved instead of
+//! copied.
+template <bool _Move, class _InputIterator1, class _InputIterator2, class _OutputIterator, class _Compare>
+_CCCL_HOST_API _OutputIterator __threads_merge(
+  const __threads_config& __config,
+  _InputIterator1 __first1,
+  const ptrdiff_t __count1,
+  _InputIterator2 __first2,
+  const ptrdiff_t __count2,
+  _OutputIterator __result,
+  _Compare& __comp)
+{
+  using _Diff1 = iter_difference_t<_InputIterator1>;
+  using _Diff2 = iter_difference_t<_InputIterator2>;
+
+  // All split points are searched before the first element is moved
+  const __threads_chunks __chunks{__config, __count1 + __count2};
+  __host_temporary_buffer<ptrdiff_t> __split_buffer{static_cast<size_t>(__chunks.__size() + 1)};
+  ptrdiff_t* __splits = __split_buffer.__get();
+  ::cuda::std::execution::__threads_parallel_for(__config, __chunks.__size() + 1, [&](const ptrdiff_t __chunk) {
+    __splits[__chunk] = ::cuda::std::execution::__threads_merge_path(
+      __first1, __count1, __first2, __count2, __chunks.__begin(__chunk), __comp);
+  });
+
+  __chunks.__for_each([&](const ptrdiff_t __chunk, const ptrdiff_t __begin, const ptrdiff_t __end) {
+    const ptrdiff_t __begin1 = __splits[__chunk];
+    const ptrdiff_t __end1   = __splits[__chunk + 1];
+    auto __piece1 = __first1 + static_cast<_Diff1>(__begin1);
+    auto __piece2 = __first2 + static_cast<_Diff2>(__begin - __begin1);
+    auto __last1  = __first1 + static_cast<_Diff1>(__end1);
+    auto __last2  = __first2 + static_cast<_Diff2>(__end - __end1);
+    auto __out    = __result + static_cast<iter_difference_t<_OutputIterator>>(__begin);
+    if constexpr (_Move)
+    {
+      ::cuda::std::merge(
+        ::cuda::std::make_move_iterator(__piece1),
+        ::cuda::std::make_move_iterator(__last1),
+        ::cuda::std::make_move_iterator(__piece2),
+        ::cuda::std::make_move_iterator(__last2),
+        __out,
+        __comp);
+    }
+    else
+    {
+      ::cuda::std::merge(__piece1, __last1, __piece2, __last2, __out, __comp);
+    }
+  });
+  return __result + static_cast<iter_difference_t<_OutputIterator>>(__count1 + __count2);
+}
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__merge, __execution_backend::__threads>
+{
+  _CCCL_TEMPLATE(class _Policy, class _InputIterator1, class _InputIterator2, class _OutputIterator, class _Compare)
+  _CCCL_REQUIRES(__has_forward_traversal<_OutputIterator>)
+  [[nodiscard]] _CCCL_HOST_API _OutputIterator operator()(
+    [[maybe_unused]] const _Policy& __policy,
+    _InputIterator1 __first1,
+    _InputIterator1 __last1,
+    _InputIterator2 __first2,
+    _InputIterator2 __last2,
+    _OutputIterator __result,
+    _Compare __comp) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator1>
+                  && ::cuda::std::__has_random_access_traversal<_InputIterator2>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator>)
+    {
+      const __threads_config __config{__policy};
+      const auto __count1 = static_cast<ptrdiff_t>(::cuda::std::distance(__first1, __last1));
+      const auto __count2 = static_cast<ptrdiff_t>(::cuda::std::distance(__first2, __last2));
+      return ::cuda::std::execution::__threads_merge<false>(
+        __config,
+        ::cuda::std::move(__first1),
+        __count1,
+        ::cuda::std::move(__first2),
+        __count2,
+        ::cuda::std::move(__result),
+        __comp);
+    }
+    else
+    {
+      static_assert(__always_false_v<_Policy>,
+                    "__pstl_dispatch: thread pool backend of cuda::std::merge requires at least random access "
+                    "iterators");
+      return ::cuda::std::merge(
+        ::cuda::std::move(__first1),
+        ::cuda::std::move(__last1),
+        ::cuda::std::move(__first2),
+        ::cuda::std::move(__last2),
+        ::cuda::std::move(__result),
+        ::cuda::std::move(__comp));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_THREADS()
+
+#endif // _CUDA_STD___PSTL_THREADS_MERGE_H
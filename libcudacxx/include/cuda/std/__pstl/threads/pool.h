@@ -0,0 +1,320 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_THREADS_POOL_H
+#define _CUDA_STD___PSTL_THREADS_POOL_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_THREADS()
+
+#  include <cuda/__execution/host_threads.h>
+#  include <cuda/__functional/call_or.h>
+#  include <cuda/std/__algorithm/max.h>
+#  include <cuda/std/__algorithm/min.h>
+#  include <cuda/std/__atomic/order.h>
+#  include <cuda/std/__memory/construct_at.h>
+#  include <cuda/std/__pstl/host_temporary_buffer.h>
+#  include <cuda/std/atomic>
+#  include <cuda/std/cstddef>
+#  include <cuda/std/cstdint>
+
+#  include <condition_variable>
+#  include <mutex>
+#  include <thread>
+#  include <vector>
+
+// Pinning the workers requires the thread affinity extensions of the Linux C libraries
+#  if defined(__linux__) && !_CCCL_OS(ANDROID)
+#    define _CCCL_PSTL_THREADS_PINNING() 1
+#    include <pthread.h>
+#    include <sched.h>
+#  else // ^^^ __linux__ ^^^ / vvv !__linux__ vvv
+#    define _CCCL_PSTL_THREADS_PINNING() 0
+#  endif // !__linux__
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+//! @brief The number of threads and the pinning an algorithm of the thread pool backend runs with
+//! Both are queried from the execution policy, see @c cuda::execution::num_threads and @c cuda::execution::pin_threads
+struct __threads_config
+{
+  ptrdiff_t __num_threads_;
+  bool __pin_;
+
+  template <class _Policy>
+  _CCCL_HOST_API explicit __threads_config(const _Policy& __policy) noexcept
+      : __num_threads_{static_cast<ptrdiff_t>(
+          ::cuda::__call_or(::cuda::execution::__get_num_threads, ::cuda::std::size_t{0}, __policy))}
+      , __pin_{static_cast<bool>(::cuda::__call_or(::cuda::execution::__get_thread_pinning, false, __policy))}
+  {
+    if (__num_threads_ <= 0)
+    {
+      __num_threads_ = (::cuda::std::max) (ptrdiff_t{1}, static_cast<ptrdiff_t>(::std::thread::hardware_concurrency()));
+    }
+  }
+};
+
+//! @brief The chunks of a job owned by one participating thread, which other threads steal from once they ran out
+//! of their own. Every chunk is claimed with a single `fetch_add`, so owner and thieves never run the same chunk.
+struct alignas(64) __threads_steal_range
+{
+  ::cuda::std::atomic<ptrdiff_t> __next_;
+  ptrdiff_t __end_;
+
+  _CCCL_HOST_API __threads_steal_range(const ptrdiff_t __begin, const ptrdiff_t __end) noexcept
+      : __next_{__begin}
+      , __end_{__end}
+  {}
+};
+
+//! @brief A parallel loop over @c __num_chunks_ chunks, shared by the calling thread and the participating workers
+struct __threads_job
+{
+  void (*__run_chunk_)(void*, ptrdiff_t);
+  void* __body_;
+  __threads_steal_range* __ranges_;
+  ptrdiff_t __num_participants_;
+
+  //! @brief Runs the chunks of @p __participant, then steals the remaining chunks of the other participants
+  //! Exceptions escaping the loop body terminate the program, like for the other backends
+  _CCCL_HOST_API void __participate(const ptrdiff_t __participant) const noexcept
+  {
+    for (ptrdiff_t __victim = 0; __victim != __num_participants_; ++__victim)
+    {
+      __threads_steal_range& __range = __ranges_[(__participant + __victim) % __num_participants_];
+      for (ptrdiff_t __chunk = __range.__next_.fetch_add(1, ::cuda::std::memory_order_relaxed);
+           __chunk < __range.__end_;
+           __chunk = __range.__next_.fetch_add(1, ::cuda::std::memory_order_relaxed))
+      {
+        __run_chunk_(__body_, __chunk);
+      }
+    }
+  }
+};
+
+//! @brief Process wide pool of worker threads, started lazily on the first parallel algorithm that needs them
+//! The pool runs a single job at a time. Nested calls from within a job and calls from other threads while a job is
+//! running are executed serially on the calling thread, so that they can never wait on each other.
+class __threads_pool
+{
+  ::std::mutex __submit_mutex_;
+  ::std::mutex __mutex_;
+  ::std::condition_variable __wake_;
+  ::std::condition_variable __done_;
+  ::std::vector<::std::thread> __workers_;
+  const __threads_job* __job_   = nullptr;
+  uint64_t __generation_        = 0;
+  ptrdiff_t __num_participants_ = 0;
+  ptrdiff_t __pending_          = 0;
+  bool __stop_                  = false;
+#  if _CCCL_PSTL_THREADS_PINNING()
+  ::std::size_t __num_pinned_ = 0;
+  ::cpu_set_t __process_cpus_{};
+  ::std::vector<int> __cpus_;
+#  endif // _CCCL_PSTL_THREADS_PINNING()
+
+  [[nodiscard]] _CCCL_HOST_API static bool& __is_worker() noexcept
+  {
+    static thread_local bool __flag = false;
+    return __flag;
+  }
+
+  template <class _Body>
+  _CCCL_HOST_API static void __run_chunk(void* __body, const ptrdiff_t __chunk)
+  {
+    (*static_cast<_Body*>(__body))(__chunk);
+  }
+
+  template <class _Body>
+  _CCCL_HOST_API static void __run_serially(const ptrdiff_t __num_chunks, _Body& __body) noexcept
+  {
+    for (ptrdiff_t __chunk = 0; __chunk != __num_chunks; ++__chunk)
+    {
+      __body(__chunk);
+    }
+  }
+
+  //! @brief Every worker sleeps until the next job is published and takes part in it as @p __participant if the job
+  //! has that many participants
+  _CCCL_HOST_API void __worker_loop(const ptrdiff_t __participant, uint64_t __seen)
+  {
+    __is_worker() = true;
+    ::std::unique_lock<::std::mutex> __lock{__mutex_};
+    while (true)
+    {
+      __wake_.wait(__lock, [&] {
+        return __stop_ || __generation_ != __seen;
+      });
+      if (__stop_)
+      {
+        return;
+      }
+      __seen = __generation_;
+      if (__participant >= __num_participants_)
+      {
+        continue;
+      }
+
+      const __threads_job* __job = __job_;
+      __lock.unlock();
+      __job->__participate(__participant);
+      __lock.lock();
+      if (--__pending_ == 0)
+      {
+        __done_.notify_one();
+      }
+    }
+  }
+
+  //! @brief Pins the workers that are not pinned yet to consecutive CPUs of the process, or unpins all of them.
+  //! The first CPU is left to the calling thread. Pinning is a hint, so failures are ignored. Requires @c __mutex_
+  _CCCL_HOST_API void __update_pinning([[maybe_unused]] const bool __pin) noexcept
+  {
+#  if _CCCL_PSTL_THREADS_PINNING()
+    if (__pin && !__cpus_.empty())
+    {
+      for (; __num_pinned_ < __workers_.size(); ++__num_pinned_)
+      {
+        ::cpu_set_t __cpu_set;
+        CPU_ZERO(&__cpu_set);
+        CPU_SET(__cpus_[(__num_pinned_ + 1) % __cpus_.size()], &__cpu_set);
+        ::pthread_setaffinity_np(__workers_[__num_pinned_].native_handle(), sizeof(::cpu_set_t), &__cpu_set);
+      }
+    }
+    else if (!__pin)
+    {
+      for (; __num_pinned_ > 0; --__num_pinned_)
+      {
+        ::pthread_setaffinity_np(
+          __workers_[__num_pinned_ - 1].native_handle(), sizeof(::cpu_set_t), &__process_cpus_);
+      }
+    }
+#  endif // _CCCL_PSTL_THREADS_PINNING()
+  }
+
+public:
+  _CCCL_HOST_API __threads_pool()
+  {
+#  if _CCCL_PSTL_THREADS_PINNING()
+    if (::sched_getaffinity(0, sizeof(::cpu_set_t), &__process_cpus_) == 0)
+    {
+      for (int __index = 0; __index != CPU_SETSIZE; ++__index)
+      {
+        if (CPU_ISSET(__index, &__process_cpus_))
+        {
+          __cpus_.push_back(__index);
+        }
+      }
+    }
+#  endif // _CCCL_PSTL_THREADS_PINNING()
+  }
+
+  __threads_pool(const __threads_pool&)            = delete;
+  __threads_pool& operator=(const __threads_pool&) = delete;
+
+  _CCCL_HOST_API ~__threads_pool()
+  {
+    {
+      ::std::lock_guard<::std::mutex> __lock{__mutex_};
+      __stop_ = true;
+    }
+    __wake_.notify_all();
+    for (::std::thread& __worker : __workers_)
+    {
+      __worker.join();
+    }
+  }
+
+  //! @brief Invokes `__body(__chunk)` for every @c __chunk in `[0, __num_chunks)` on the calling thread and up to
+  //! `__config.__num_threads_ - 1` workers. Every participant starts with its own contiguous range of chunks.
+  template <class _Body>
+  _CCCL_HOST_API void __run(const __threads_config& __config, const ptrdiff_t __num_chunks, _Body& __body)
+  {
+    const ptrdiff_t __num_participants = (::cuda::std::min) (__config.__num_threads_, __num_chunks);
+    if (__num_participants <= 1 || __is_worker())
+    {
+      __run_serially(__num_chunks, __body);
+      return;
+    }
+
+    ::std::unique_lock<::std::mutex> __submit_lock{__submit_mutex_, ::std::try_to_lock};
+    if (!__submit_lock.owns_lock())
+    {
+      __run_serially(__num_chunks, __body);
+      return;
+    }
+
+    __host_temporary_buffer<__threads_steal_range> __buffer{static_cast<::std::size_t>(__num_participants)};
+    __threads_steal_range* __ranges = __buffer.__get();
+    for (ptrdiff_t __participant = 0; __participant != __num_participants; ++__participant)
+    {
+      ::cuda::std::__construct_at(__ranges + __participant,
+                                  __num_chunks * __participant / __num_participants,
+                                  __num_chunks * (__participant + 1) / __num_participants);
+    }
+    const __threads_job __job{&__run_chunk<_Body>, &__body, __ranges, __num_participants};
+
+    {
+      ::std::lock_guard<::std::mutex> __lock{__mutex_};
+      while (static_cast<ptrdiff_t>(__workers_.size()) < __num_participants - 1)
+      {
+        const auto __participant = static_cast<ptrdiff_t>(__workers_.size()) + 1;
+        __workers_.emplace_back(&__threads_pool::__worker_loop, this, __participant, __generation_);
+      }
+      __update_pinning(__config.__pin_);
+
+      __job_              = &__job;
+      __num_participants_ = __num_participants;
+      __pending_          = __num_participants - 1;
+      ++__generation_;
+    }
+    __wake_.notify_all();
+
+    __job.__participate(0);
+
+    ::std::unique_lock<::std::mutex> __lock{__mutex_};
+    __done_.wait(__lock, [&] {
+      return __pending_ == 0;
+    });
+    __job_ = nullptr;
+  }
+};
+
+[[nodiscard]] _CCCL_HOST_API inline __threads_pool& __threads_get_pool()
+{
+  static __threads_pool __pool;
+  return __pool;
+}
+
+//! @brief Invokes `__fn(__i)` for every @c __i in `[0, __n)` on the thread pool
+template <class _Fn>
+_CCCL_HOST_API void __threads_parallel_for(const __threads_config& __config, const ptrdiff_t __n, _Fn&& __fn)
+{
+  ::cuda::std::execution::__threads_get_pool().__run(__config, __n, __fn);
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_THREADS()
+
+#endif // _CUDA_STD___PSTL_THREADS_POOL_H
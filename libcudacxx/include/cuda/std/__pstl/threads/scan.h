@@ -0,0 +1,134 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_THREADS_SCAN_H
+#define _CUDA_STD___PSTL_THREADS_SCAN_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_THREADS()
+
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__memory/construct_at.h>
+#  include <cuda/std/__pstl/host_temporary_buffer.h>
+#  include <cuda/std/__pstl/threads/chunks.h>
+#  include <cuda/std/__utility/forward.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Reduce-then-scan of @c __count elements with @c __op, optionally starting with a single @c __init
+//! Every chunk but the last is reduced on its own, the chunk sums are scanned serially and then every chunk is scanned
+//! starting from the sum of everything before it. Each element is read before its output is written, so the scan may
+//! run in place.
+template <bool _Exclusive, class _AccumT, class _InputIterator, class _OutputIterator, class _BinaryOp, class... _Init>
+[[nodiscard]] _CCCL_HOST_API _OutputIterator __threads_scan(
+  const __threads_config& __config,
+  _InputIterator __first,
+  const ptrdiff_t __count,
+  _OutputIterator __result,
+  _BinaryOp& __op,
+  _Init&&... __init)
+{
+  constexpr bool __has_init = sizeof...(_Init) != 0;
+  static_assert(__has_init || !_Exclusive, "__threads_scan: an exclusive scan requires an initial value");
+
+  if (__count == 0)
+  {
+    return __result;
+  }
+
+  const __threads_chunks __chunks{__config, __count};
+  const ptrdiff_t __num_chunks = __chunks.__size();
+
+  // __sums[__c] is the sum of everything before chunk __c, there is none before the first chunk without __init
+  __host_temporary_buffer<_AccumT> __buffer{static_cast<size_t>(__num_chunks)};
+  _AccumT* __sums = __buffer.__get();
+  if constexpr (__has_init)
+  {
+    ::cuda::std::__construct_at(__sums, ::cuda::std::forward<_Init>(__init)...);
+  }
+
+  __chunks.__for_each([&](const ptrdiff_t __chunk, const ptrdiff_t __begin, const ptrdiff_t __end) {
+    if (__chunk + 1 == __num_chunks)
+    {
+      return;
+    }
+    auto __it     = __first + static_cast<iter_difference_t<_InputIterator>>(__begin);
+    _AccumT __acc = static_cast<_AccumT>(*__it);
+    ++__it;
+    for (ptrdiff_t __i = __begin + 1; __i != __end; ++__i, (void) ++__it)
+    {
+      __acc = __op(::cuda::std::move(__acc), *__it);
+    }
+    ::cuda::std::__construct_at(__sums + __chunk + 1, ::cuda::std::move(__acc));
+  });
+
+  for (ptrdiff_t __chunk = (__has_init ? 1 : 2); __chunk < __num_chunks; ++__chunk)
+  {
+    __sums[__chunk] = __op(__sums[__chunk - 1], ::cuda::std::move(__sums[__chunk]));
+  }
+
+  __chunks.__for_each([&](const ptrdiff_t __chunk, const ptrdiff_t __begin, const ptrdiff_t __end) {
+    auto __in  = __first + static_cast<iter_difference_t<_InputIterator>>(__begin);
+    auto __out = __result + static_cast<iter_difference_t<_OutputIterator>>(__begin);
+    ptrdiff_t __i = __begin;
+    if constexpr (_Exclusive)
+    {
+      _AccumT __acc = __sums[__chunk];
+      for (; __i != __end; ++__i, (void) ++__in, (void) ++__out)
+      {
+        _AccumT __next = __op(__acc, *__in);
+        *__out         = ::cuda::std::move(__acc);
+        __acc          = ::cuda::std::move(__next);
+      }
+    }
+    else
+    {
+      _AccumT __acc = (__has_init || __chunk != 0) ? __sums[__chunk] : static_cast<_AccumT>(*__in);
+      if (!__has_init && __chunk == 0)
+      {
+        *__out = __acc;
+        ++__i, (void) ++__in, (void) ++__out;
+      }
+      for (; __i != __end; ++__i, (void) ++__in, (void) ++__out)
+      {
+        __acc  = __op(::cuda::std::move(__acc), *__in);
+        *__out = __acc;
+      }
+    }
+  });
+
+  ::cuda::std::__destroy(__sums + (__has_init ? 0 : 1), __sums + __num_chunks);
+  return __result + static_cast<iter_difference_t<_OutputIterator>>(__count);
+}
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_THREADS()
+
+#endif // _CUDA_STD___PSTL_THREADS_SCAN_H
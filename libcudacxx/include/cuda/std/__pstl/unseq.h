@@ -0,0 +1,599 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_UNSEQ_H
+#define _CUDA_STD___PSTL_UNSEQ_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HOSTED()
+
+#  include <cuda/__functional/equal_to_value.h>
+#  include <cuda/std/__algorithm/adjacent_find.h>
+#  include <cuda/std/__algorithm/count.h>
+#  include <cuda/std/__algorithm/equal.h>
+#  include <cuda/std/__algorithm/find.h>
+#  include <cuda/std/__algorithm/find_if.h>
+#  include <cuda/std/__algorithm/max_element.h>
+#  include <cuda/std/__algorithm/min.h>
+#  include <cuda/std/__algorithm/min_element.h>
+#  include <cuda/std/__algorithm/minmax_element.h>
+#  include <cuda/std/__algorithm/mismatch.h>
+#  include <cuda/std/__bit/countr.h>
+#  include <cuda/std/__functional/operations.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__limits/numeric_limits.h>
+#  include <cuda/std/__memory/pointer_traits.h>
+#  include <cuda/std/__type_traits/conditional.h>
+#  include <cuda/std/__type_traits/is_floating_point.h>
+#  include <cuda/std/__type_traits/is_integral.h>
+#  include <cuda/std/__type_traits/is_same.h>
+#  include <cuda/std/__type_traits/is_signed.h>
+#  include <cuda/std/__type_traits/make_signed.h>
+#  include <cuda/std/__type_traits/make_unsigned.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/__utility/pair.h>
+#  include <cuda/std/cstddef>
+#  include <cuda/std/cstdint>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+// Host kernels of the non-modifying algorithms for the unsequenced execution policies.
+//
+// They apply to contiguous ranges of integers, float and double compared with equal_to or less, and process a block
+// of 16 or 32 bytes per step with the vector extensions of GCC and Clang. Comparing two blocks yields a lane of ones
+// for each lane where the comparison holds, whose bytes are gathered into a bit mask. count adds these lanes up, and
+// min_element, max_element and minmax_element keep the best value and the number of the block it came from in every
+// lane, so that both only look at the lanes at the end of a segment. Any other range, and any host compiler without
+// vector registers, runs the serial algorithm.
+
+//! @brief Whether the unsequenced kernels handle the elements of type @tparam _Tp.
+template <class _Tp>
+inline constexpr bool __pstl_unseq_vectorizable_type =
+  ((is_integral_v<_Tp> && !is_same_v<_Tp, bool>) || is_same_v<_Tp, float> || is_same_v<_Tp, double>)
+  && (sizeof(_Tp) == 1 || sizeof(_Tp) == 2 || sizeof(_Tp) == 4 || sizeof(_Tp) == 8);
+
+//! @brief Whether the unsequenced kernels handle the range [__first, __last) of @tparam _Iter.
+template <class _Iter>
+inline constexpr bool __pstl_unseq_vectorizable =
+  _CCCL_HAS_SIMD_HOST_VECTOR() && __has_contiguous_traversal<_Iter>
+  && __pstl_unseq_vectorizable_type<iter_value_t<_Iter>>;
+
+template <class _Pred, class _Tp>
+inline constexpr bool __pstl_unseq_is_equal_to = is_same_v<_Pred, equal_to<>> || is_same_v<_Pred, equal_to<_Tp>>;
+
+template <class _Pred, class _Tp>
+inline constexpr bool __pstl_unseq_is_less = is_same_v<_Pred, less<>> || is_same_v<_Pred, less<_Tp>>;
+
+#  if _CCCL_HAS_SIMD_HOST_VECTOR()
+
+inline constexpr size_t __pstl_unseq_block_bytes = _CCCL_SIMD_HOST_VECTOR_BYTES >= 32 ? 32 : 16;
+
+//! @brief The integer or floating-point type with the bits and the order of @tparam _Tp, e.g. int for wchar_t.
+template <class _Tp, bool = is_floating_point_v<_Tp>>
+struct __pstl_unseq_lane
+{
+  using type = _Tp;
+};
+
+template <class _Tp>
+struct __pstl_unseq_lane<_Tp, false>
+{
+  using type = conditional_t<is_signed_v<_Tp>, make_signed_t<_Tp>, make_unsigned_t<_Tp>>;
+};
+
+template <class _Lane>
+struct __pstl_unseq_block
+{
+  typedef _Lane __type __attribute__((__vector_size__(__pstl_unseq_block_bytes)));
+};
+
+template <class _Tp>
+using __pstl_unseq_block_t = typename __pstl_unseq_block<typename __pstl_unseq_lane<_Tp>::type>::__type;
+
+//! @brief The signed integers with the size of @tparam _Tp, which hold the block numbers of min_element.
+template <class _Tp>
+using __pstl_unseq_index_t =
+  conditional_t<sizeof(_Tp) == 1,
+                int8_t,
+                conditional_t<sizeof(_Tp) == 2, int16_t, conditional_t<sizeof(_Tp) == 4, int32_t, int64_t>>>;
+
+template <class _Tp>
+inline constexpr ptrdiff_t __pstl_unseq_lanes = static_cast<ptrdiff_t>(__pstl_unseq_block_bytes / sizeof(_Tp));
+
+template <class _Tp>
+[[nodiscard]] _CCCL_HOST_API inline __pstl_unseq_block_t<_Tp> __pstl_unseq_load(const _Tp* __p) noexcept
+{
+  __pstl_unseq_block_t<_Tp> __block;
+  __builtin_memcpy(&__block, __p, __pstl_unseq_block_bytes);
+  return __block;
+}
+
+//! @brief Returns a bit for each byte of the result of a comparison, i.e. sizeof(_Tp) bits for each lane.
+template <class _Mask>
+[[nodiscard]] _CCCL_HOST_API inline uint32_t __pstl_unseq_movemask(const _Mask& __mask) noexcept
+{
+  typedef char __bytes __attribute__((__vector_size__(__pstl_unseq_block_bytes)));
+#    if _CCCL_SIMD_HOST_VECTOR_BYTES >= 32
+  return static_cast<uint32_t>(__builtin_ia32_pmovmskb256((__bytes) __mask));
+#    else // ^^^ _CCCL_SIMD_HOST_VECTOR_BYTES >= 32 ^^^ / vvv _CCCL_SIMD_HOST_VECTOR_BYTES < 32 vvv
+  return static_cast<uint32_t>(__builtin_ia32_pmovmskb128((__bytes) __mask));
+#    endif // ^^^ _CCCL_SIMD_HOST_VECTOR_BYTES < 32 ^^^
+}
+
+template <class _Tp>
+[[nodiscard]] _CCCL_HOST_API inline ptrdiff_t __pstl_unseq_mask_first(uint32_t __mask) noexcept
+{
+  return static_cast<ptrdiff_t>(::cuda::std::countr_zero(__mask) / sizeof(_Tp));
+}
+
+//! @brief Returns the offset of the first element equal to __value in [__first, __first + __n), or __n.
+template <class _Tp>
+[[nodiscard]] _CCCL_HOST_API ptrdiff_t
+__pstl_unseq_find_kernel(const _Tp* __first, ptrdiff_t __n, _Tp __value) noexcept
+{
+  using _Lane                 = typename __pstl_unseq_lane<_Tp>::type;
+  constexpr ptrdiff_t __lanes = __pstl_unseq_lanes<_Tp>;
+  const _Lane __lane_value    = static_cast<_Lane>(__value);
+  ptrdiff_t __i               = 0;
+  for (; __i + __lanes <= __n; __i += __lanes)
+  {
+    const uint32_t __mask =
+      ::cuda::std::__pstl_unseq_movemask(::cuda::std::__pstl_unseq_load(__first + __i) == __lane_value);
+    if (__mask != 0)
+    {
+      return __i + ::cuda::std::__pstl_unseq_mask_first<_Tp>(__mask);
+    }
+  }
+  for (; __i != __n; ++__i)
+  {
+    if (__first[__i] == __value)
+    {
+      return __i;
+    }
+  }
+  return __n;
+}
+
+//! @brief Returns the number of elements equal to __value in [__first, __first + __n).
+//! Every lane counts its matches, which are added up every numeric_limits<_Index>::max() blocks and at the end.
+template <class _Tp>
+[[nodiscard]] _CCCL_HOST_API ptrdiff_t
+__pstl_unseq_count_kernel(const _Tp* __first, ptrdiff_t __n, _Tp __value) noexcept
+{
+  using _Lane                  = typename __pstl_unseq_lane<_Tp>::type;
+  using _Index                 = __pstl_unseq_index_t<_Tp>;
+  using _IndexBlock            = typename __pstl_unseq_block<_Index>::__type;
+  constexpr ptrdiff_t __lanes  = __pstl_unseq_lanes<_Tp>;
+  constexpr ptrdiff_t __blocks = static_cast<ptrdiff_t>(numeric_limits<_Index>::max());
+  const _Lane __lane_value     = static_cast<_Lane>(__value);
+
+  ptrdiff_t __count = 0;
+  ptrdiff_t __i     = 0;
+  while (__i + __lanes <= __n)
+  {
+    const ptrdiff_t __segment_end = __i + (::cuda::std::min) ((__n - __i) / __lanes, __blocks) * __lanes;
+    _IndexBlock __counts          = _IndexBlock{};
+    for (; __i != __segment_end; __i += __lanes)
+    {
+      // The lanes of a comparison are -1 where it holds
+      __counts -= (_IndexBlock) (::cuda::std::__pstl_unseq_load(__first + __i) == __lane_value);
+    }
+    for (ptrdiff_t __lane = 0; __lane < __lanes; ++__lane)
+    {
+      __count += static_cast<ptrdiff_t>(__counts[__lane]);
+    }
+  }
+  for (; __i != __n; ++__i)
+  {
+    __count += __first[__i] == __value;
+  }
+  return __count;
+}
+
+//! @brief Returns the offset of the first position where [__first1, __first1 + __n) and __first2 differ, or __n.
+template <class _Tp>
+[[nodiscard]] _CCCL_HOST_API ptrdiff_t
+__pstl_unseq_mismatch_kernel(const _Tp* __first1, const _Tp* __first2, ptrdiff_t __n) noexcept
+{
+  constexpr ptrdiff_t __lanes = __pstl_unseq_lanes<_Tp>;
+  ptrdiff_t __i               = 0;
+  for (; __i + __lanes <= __n; __i += __lanes)
+  {
+    const uint32_t __mask = ::cuda::std::__pstl_unseq_movemask(
+      ::cuda::std::__pstl_unseq_load(__first1 + __i) != ::cuda::std::__pstl_unseq_load(__first2 + __i));
+    if (__mask != 0)
+    {
+      return __i + ::cuda::std::__pstl_unseq_mask_first<_Tp>(__mask);
+    }
+  }
+  for (; __i != __n; ++__i)
+  {
+    if (!(__first1[__i] == __first2[__i]))
+    {
+      return __i;
+    }
+  }
+  return __n;
+}
+
+//! @brief Returns the offset of the first element of [__first, __first + __n) equal to its successor, or __n.
+template <class _Tp>
+[[nodiscard]] _CCCL_HOST_API ptrdiff_t __pstl_unseq_adjacent_find_kernel(const _Tp* __first, ptrdiff_t __n) noexcept
+{
+  constexpr ptrdiff_t __lanes = __pstl_unseq_lanes<_Tp>;
+  ptrdiff_t __i               = 0;
+  for (; __i + __lanes < __n; __i += __lanes)
+  {
+    const uint32_t __mask = ::cuda::std::__pstl_unseq_movemask(
+      ::cuda::std::__pstl_unseq_load(__first + __i) == ::cuda::std::__pstl_unseq_load(__first + __i + 1));
+    if (__mask != 0)
+    {
+      return __i + ::cuda::std::__pstl_unseq_mask_first<_Tp>(__mask);
+    }
+  }
+  for (; __i + 1 < __n; ++__i)
+  {
+    if (__first[__i] == __first[__i + 1])
+    {
+      return __i;
+    }
+  }
+  return __n;
+}
+
+//! @brief Whether the element __value at __pos replaces the element __best at __best_pos as the smallest element, which
+//! is the first one of the smallest elements, or as the largest element, the first or the last one of them.
+template <bool _Largest, bool _Last, class _Tp>
+[[nodiscard]] _CCCL_HOST_API constexpr bool
+__pstl_unseq_is_better(_Tp __value, ptrdiff_t __pos, _Tp __best, ptrdiff_t __best_pos) noexcept
+{
+  const bool __better = _Largest ? __best < __value : __value < __best;
+  const bool __tie    = !(__value < __best) && !(__best < __value);
+  return __better || (__tie && (_Last ? __best_pos < __pos : __pos < __best_pos));
+}
+
+//! @brief Returns the offsets of the first smallest element of [__first, __first + __n) if @tparam _Min, and of the first
+//! or, if @tparam _LastMax, the last largest element if @tparam _Max, for 0 < __n. Every lane keeps its best values and
+//! the numbers of the blocks they came from, which are combined every numeric_limits<_Index>::max() blocks and at the
+//! end.
+template <bool _Min, bool _Max, bool _LastMax, class _Tp>
+[[nodiscard]] _CCCL_HOST_API pair<ptrdiff_t, ptrdiff_t>
+__pstl_unseq_minmax_kernel(const _Tp* __first, ptrdiff_t __n) noexcept
+{
+  using _Block                 = __pstl_unseq_block_t<_Tp>;
+  using _Index                 = __pstl_unseq_index_t<_Tp>;
+  using _IndexBlock            = typename __pstl_unseq_block<_Index>::__type;
+  constexpr ptrdiff_t __lanes  = __pstl_unseq_lanes<_Tp>;
+  constexpr ptrdiff_t __blocks = static_cast<ptrdiff_t>(numeric_limits<_Index>::max());
+
+  ptrdiff_t __min = 0;
+  ptrdiff_t __max = 0;
+  ptrdiff_t __i   = 0;
+  while (__i + __lanes <= __n)
+  {
+    const ptrdiff_t __segment = (::cuda::std::min) ((__n - __i) / __lanes, __blocks);
+    _Block __lo               = ::cuda::std::__pstl_unseq_load(__first + __i);
+    _Block __hi               = __lo;
+    _IndexBlock __lo_block    = _IndexBlock{};
+    _IndexBlock __hi_block    = _IndexBlock{};
+    _IndexBlock __block       = _IndexBlock{};
+    for (ptrdiff_t __b = 1; __b < __segment; ++__b)
+    {
+      const _Block __values = ::cuda::std::__pstl_unseq_load(__first + __i + __b * __lanes);
+      __block += 1;
+      if constexpr (_Min)
+      {
+        const auto __better = (_IndexBlock) (__values < __lo);
+        __lo                = __better ? __values : __lo;
+        __lo_block          = __better ? __block : __lo_block;
+      }
+      if constexpr (_Max)
+      {
+        const auto __better = _LastMax ? (_IndexBlock) (__hi <= __values) : (_IndexBlock) (__hi < __values);
+        __hi                = __better ? __values : __hi;
+        __hi_block          = __better ? __block : __hi_block;
+      }
+    }
+    for (ptrdiff_t __lane = 0; __lane < __lanes; ++__lane)
+    {
+      if constexpr (_Min)
+      {
+        const ptrdiff_t __pos = __i + static_cast<ptrdiff_t>(__lo_block[__lane]) * __lanes + __lane;
+        if (::cuda::std::__pstl_unseq_is_better<false, false>(__first[__pos], __pos, __first[__min], __min))
+        {
+          __min = __pos;
+        }
+      }
+      if constexpr (_Max)
+      {
+        const ptrdiff_t __pos = __i + static_cast<ptrdiff_t>(__hi_block[__lane]) * __lanes + __lane;
+        if (::cuda::std::__pstl_unseq_is_better<true, _LastMax>(__first[__pos], __pos, __first[__max], __max))
+        {
+          __max = __pos;
+        }
+      }
+    }
+    __i += __segment * __lanes;
+  }
+  for (; __i != __n; ++__i)
+  {
+    if (_Min && ::cuda::std::__pstl_unseq_is_better<false, false>(__first[__i], __i, __first[__min], __min))
+    {
+      __min = __i;
+    }
+    if (_Max && ::cuda::std::__pstl_unseq_is_better<true, _LastMax>(__first[__i], __i, __first[__max], __max))
+    {
+      __max = __i;
+    }
+  }
+  return pair<ptrdiff_t, ptrdiff_t>{__min, __max};
+}
+
+#  endif // _CCCL_HAS_SIMD_HOST_VECTOR()
+
+//! @brief find for the unsequenced policies
+template <class _Iter, class _Tp>
+[[nodiscard]] _CCCL_HOST_API _Iter __pstl_unseq_find(_Iter __first, _Iter __last, const _Tp& __value)
+{
+#  if _CCCL_HAS_SIMD_HOST_VECTOR()
+  if constexpr (__pstl_unseq_vectorizable<_Iter> && is_same_v<_Tp, iter_value_t<_Iter>>)
+  {
+    return __first
+         + ::cuda::std::__pstl_unseq_find_kernel(::cuda::std::__to_address(__first), __last - __first, __value);
+  }
+  else
+#  endif // _CCCL_HAS_SIMD_HOST_VECTOR()
+  {
+    return ::cuda::std::find(::cuda::std::move(__first), ::cuda::std::move(__last), __value);
+  }
+}
+
+//! @brief find_if for the unsequenced policies, which vectorizes the searches for a value with equal_to_value
+template <class _Iter, class _UnaryPred>
+[[nodiscard]] _CCCL_HOST_API _Iter __pstl_unseq_find_if(_Iter __first, _Iter __last, _UnaryPred __pred)
+{
+  if constexpr (is_same_v<_UnaryPred, ::cuda::equal_to_value<iter_value_t<_Iter>>>)
+  {
+    return ::cuda::std::__pstl_unseq_find(::cuda::std::move(__first), ::cuda::std::move(__last), __pred.__value_);
+  }
+  else
+  {
+    return ::cuda::std::find_if(::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__pred));
+  }
+}
+
+//! @brief count for the unsequenced policies
+template <class _Iter, class _Tp>
+[[nodiscard]] _CCCL_HOST_API iter_difference_t<_Iter>
+__pstl_unseq_count(_Iter __first, _Iter __last, const _Tp& __value)
+{
+#  if _CCCL_HAS_SIMD_HOST_VECTOR()
+  if constexpr (__pstl_unseq_vectorizable<_Iter> && is_same_v<_Tp, iter_value_t<_Iter>>)
+  {
+    return static_cast<iter_difference_t<_Iter>>(
+      ::cuda::std::__pstl_unseq_count_kernel(::cuda::std::__to_address(__first), __last - __first, __value));
+  }
+  else
+#  endif // _CCCL_HAS_SIMD_HOST_VECTOR()
+  {
+    return ::cuda::std::count(::cuda::std::move(__first), ::cuda::std::move(__last), __value);
+  }
+}
+
+//! @brief mismatch for the unsequenced policies
+template <class _Iter1, class _Iter2, class _BinaryPred>
+[[nodiscard]] _CCCL_HOST_API pair<_Iter1, _Iter2>
+__pstl_unseq_mismatch(_Iter1 __first1, _Iter1 __last1, _Iter2 __first2, _BinaryPred __pred)
+{
+#  if _CCCL_HAS_SIMD_HOST_VECTOR()
+  if constexpr (__pstl_unseq_vectorizable<_Iter1> && __pstl_unseq_vectorizable<_Iter2>
+                && is_same_v<iter_value_t<_Iter1>, iter_value_t<_Iter2>>
+                && __pstl_unseq_is_equal_to<_BinaryPred, iter_value_t<_Iter1>>)
+  {
+    const auto __pos = ::cuda::std::__pstl_unseq_mismatch_kernel(
+      ::cuda::std::__to_address(__first1), ::cuda::std::__to_address(__first2), __last1 - __first1);
+    return pair<_Iter1, _Iter2>{__first1 + __pos, __first2 + __pos};
+  }
+  else
+#  endif // _CCCL_HAS_SIMD_HOST_VECTOR()
+  {
+    return ::cuda::std::mismatch(
+      ::cuda::std::move(__first1), ::cuda::std::move(__last1), ::cuda::std::move(__first2), ::cuda::std::move(__pred));
+  }
+}
+
+//! @brief mismatch for the unsequenced policies, over two ranges
+template <class _Iter1, class _Iter2, class _BinaryPred>
+[[nodiscard]] _CCCL_HOST_API pair<_Iter1, _Iter2>
+__pstl_unseq_mismatch(_Iter1 __first1, _Iter1 __last1, _Iter2 __first2, _Iter2 __last2, _BinaryPred __pred)
+{
+#  if _CCCL_HAS_SIMD_HOST_VECTOR()
+  if constexpr (__pstl_unseq_vectorizable<_Iter1> && __pstl_unseq_vectorizable<_Iter2>
+                && is_same_v<iter_value_t<_Iter1>, iter_value_t<_Iter2>>
+                && __pstl_unseq_is_equal_to<_BinaryPred, iter_value_t<_Iter1>>)
+  {
+    const ptrdiff_t __n = (::cuda::std::min) (static_cast<ptrdiff_t>(__last1 - __first1),
+                                               static_cast<ptrdiff_t>(__last2 - __first2));
+    const auto __pos    = ::cuda::std::__pstl_unseq_mismatch_kernel(
+      ::cuda::std::__to_address(__first1), ::cuda::std::__to_address(__first2), __n);
+    return pair<_Iter1, _Iter2>{__first1 + __pos, __first2 + __pos};
+  }
+  else
+#  endif // _CCCL_HAS_SIMD_HOST_VECTOR()
+  {
+    return ::cuda::std::mismatch(
+      ::cuda::std::move(__first1),
+      ::cuda::std::move(__last1),
+      ::cuda::std::move(__first2),
+      ::cuda::std::move(__last2),
+      ::cuda::std::move(__pred));
+  }
+}
+
+//! @brief equal for the unsequenced policies
+template <class _Iter1, class _Iter2, class _BinaryPred>
+[[nodiscard]] _CCCL_HOST_API bool
+__pstl_unseq_equal(_Iter1 __first1, _Iter1 __last1, _Iter2 __first2, _BinaryPred __pred)
+{
+#  if _CCCL_HAS_SIMD_HOST_VECTOR()
+  if constexpr (__pstl_unseq_vectorizable<_Iter1> && __pstl_unseq_vectorizable<_Iter2>
+                && is_same_v<iter_value_t<_Iter1>, iter_value_t<_Iter2>>
+                && __pstl_unseq_is_equal_to<_BinaryPred, iter_value_t<_Iter1>>)
+  {
+    const ptrdiff_t __n = __last1 - __first1;
+    return ::cuda::std::__pstl_unseq_mismatch_kernel(
+             ::cuda::std::__to_address(__first1), ::cuda::std::__to_address(__first2), __n)
+        == __n;
+  }
+  else
+#  endif // _CCCL_HAS_SIMD_HOST_VECTOR()
+  {
+    return ::cuda::std::equal(
+      ::cuda::std::move(__first1), ::cuda::std::move(__last1), ::cuda::std::move(__first2), ::cuda::std::move(__pred));
+  }
+}
+
+//! @brief equal for the unsequenced policies, over two ranges
+template <class _Iter1, class _Iter2, class _BinaryPred>
+[[nodiscard]] _CCCL_HOST_API bool
+__pstl_unseq_equal(_Iter1 __first1, _Iter1 __last1, _Iter2 __first2, _Iter2 __last2, _BinaryPred __pred)
+{
+#  if _CCCL_HAS_SIMD_HOST_VECTOR()
+  if constexpr (__pstl_unseq_vectorizable<_Iter1> && __pstl_unseq_vectorizable<_Iter2>
+                && is_same_v<iter_value_t<_Iter1>, iter_value_t<_Iter2>>
+                && __pstl_unseq_is_equal_to<_BinaryPred, iter_value_t<_Iter1>>)
+  {
+    const ptrdiff_t __n = __last1 - __first1;
+    return __n == static_cast<ptrdiff_t>(__last2 - __first2)
+        && ::cuda::std::__pstl_unseq_mismatch_kernel(
+             ::cuda::std::__to_address(__first1), ::cuda::std::__to_address(__first2), __n)
+             == __n;
+  }
+  else
+#  endif // _CCCL_HAS_SIMD_HOST_VECTOR()
+  {
+    return ::cuda::std::equal(
+      ::cuda::std::move(__first1),
+      ::cuda::std::move(__last1),
+      ::cuda::std::move(__first2),
+      ::cuda::std::move(__last2),
+      ::cuda::std::move(__pred));
+  }
+}
+
+//! @brief adjacent_find for the unsequenced policies
+template <class _Iter, class _BinaryPred>
+[[nodiscard]] _CCCL_HOST_API _Iter __pstl_unseq_adjacent_find(_Iter __first, _Iter __last, _BinaryPred __pred)
+{
+#  if _CCCL_HAS_SIMD_HOST_VECTOR()
+  if constexpr (__pstl_unseq_vectorizable<_Iter> && __pstl_unseq_is_equal_to<_BinaryPred, iter_value_t<_Iter>>)
+  {
+    return __first
+         + ::cuda::std::__pstl_unseq_adjacent_find_kernel(::cuda::std::__to_address(__first), __last - __first);
+  }
+  else
+#  endif // _CCCL_HAS_SIMD_HOST_VECTOR()
+  {
+    return ::cuda::std::adjacent_find(::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__pred));
+  }
+}
+
+//! @brief min_element for the unsequenced policies
+template <class _Iter, class _BinaryPred>
+[[nodiscard]] _CCCL_HOST_API _Iter __pstl_unseq_min_element(_Iter __first, _Iter __last, _BinaryPred __pred)
+{
+#  if _CCCL_HAS_SIMD_HOST_VECTOR()
+  if constexpr (__pstl_unseq_vectorizable<_Iter> && __pstl_unseq_is_less<_BinaryPred, iter_value_t<_Iter>>)
+  {
+    if (__first == __last)
+    {
+      return __first;
+    }
+    return __first
+         + ::cuda::std::__pstl_unseq_minmax_kernel<true, false, false>(
+             ::cuda::std::__to_address(__first), __last - __first)
+             .first;
+  }
+  else
+#  endif // _CCCL_HAS_SIMD_HOST_VECTOR()
+  {
+    return ::cuda::std::min_element(::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__pred));
+  }
+}
+
+//! @brief max_element for the unsequenced policies
+template <class _Iter, class _BinaryPred>
+[[nodiscard]] _CCCL_HOST_API _Iter __pstl_unseq_max_element(_Iter __first, _Iter __last, _BinaryPred __pred)
+{
+#  if _CCCL_HAS_SIMD_HOST_VECTOR()
+  if constexpr (__pstl_unseq_vectorizable<_Iter> && __pstl_unseq_is_less<_BinaryPred, iter_value_t<_Iter>>)
+  {
+    if (__first == __last)
+    {
+      return __first;
+    }
+    return __first
+         + ::cuda::std::__pstl_unseq_minmax_kernel<false, true, false>(
+             ::cuda::std::__to_address(__first), __last - __first)
+             .second;
+  }
+  else
+#  endif // _CCCL_HAS_SIMD_HOST_VECTOR()
+  {
+    return ::cuda::std::max_element(::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__pred));
+  }
+}
+
+//! @brief minmax_element for the unsequenced policies, which returns the first smallest and the last largest element
+template <class _Iter, class _BinaryPred>
+[[nodiscard]] _CCCL_HOST_API pair<_Iter, _Iter>
+__pstl_unseq_minmax_element(_Iter __first, _Iter __last, _BinaryPred __pred)
+{
+#  if _CCCL_HAS_SIMD_HOST_VECTOR()
+  if constexpr (__pstl_unseq_vectorizable<_Iter> && __pstl_unseq_is_less<_BinaryPred, iter_value_t<_Iter>>)
+  {
+    if (__first == __last)
+    {
+      return pair<_Iter, _Iter>{__first, __first};
+    }
+    const auto __result =
+      ::cuda::std::__pstl_unseq_minmax_kernel<true, true, true>(::cuda::std::__to_address(__first), __last - __first);
+    return pair<_Iter, _Iter>{__first + __result.first, __first + __result.second};
+  }
+  else
+#  endif // _CCCL_HAS_SIMD_HOST_VECTOR()
+  {
+    return ::cuda::std::minmax_element(
+      ::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__pred));
+  }
+}
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HOSTED()
+
+#endif // _CUDA_STD___PSTL_UNSEQ_H
@@ -27,6 +27,7 @@
 #include <cuda/std/__random/generate_canonical.h>
 #include <cuda/std/__random/is_valid.h>
 #include <cuda/std/__random/uniform_real_distribution.h>
+#include <cuda/std/__random/ziggurat.h>
 
 #include <cuda/std/__cccl/prologue.h>
 
@@ -96,9 +97,16 @@ public:
   [[nodiscard]] _CCCL_API result_type operator()(_URng& __g, const param_type& __p)
   {
     static_assert(__cccl_random_is_valid_urng<_URng>, "URng must meet the UniformRandomBitGenerator requirements");
-    return -::cuda::std::log(
-             result_type{1} - ::cuda::std::generate_canonical<result_type, numeric_limits<result_type>::digits>(__g))
-         / __p.lambda();
+    if constexpr (__cccl_random_use_ziggurat<result_type>)
+    {
+      return ::cuda::std::__ziggurat_exponential<result_type>(__g) / __p.lambda();
+    }
+    else
+    {
+      return -::cuda::std::log(
+               result_type{1} - ::cuda::std::generate_canonical<result_type, numeric_limits<result_type>::digits>(__g))
+           / __p.lambda();
+    }
   }
 
   // property functions
@@ -29,11 +29,43 @@
 #include <cuda/std/__random/exponential_distribution.h>
 #include <cuda/std/__random/is_valid.h>
 #include <cuda/std/__random/uniform_real_distribution.h>
+#include <cuda/std/__random/ziggurat.h>
 
 #include <cuda/std/__cccl/prologue.h>
 
 _CCCL_BEGIN_NAMESPACE_CUDA_STD
 
+//! @brief Returns a sample of the gamma distribution with shape __a > 1 and scale 1, by the method of Marsaglia and
+//! Tsang, "A Simple Method for Generating Gamma Variables", 2000. It transforms a normal sample from the ziggurat, and
+//! accepts about 98% of them with the polynomial squeeze, without evaluating a logarithm.
+template <class _RealType, class _URng>
+[[nodiscard]] _CCCL_API _RealType __gamma_marsaglia_tsang(_URng& __g, _RealType __a)
+{
+  const _RealType __d = __a - _RealType{1} / _RealType{3};
+  const _RealType __c = _RealType{1} / ::cuda::std::sqrt(_RealType{9} * __d);
+  while (true)
+  {
+    const _RealType __x = ::cuda::std::__ziggurat_normal<_RealType>(__g);
+    _RealType __v       = _RealType{1} + __c * __x;
+    if (__v <= _RealType{0})
+    {
+      continue;
+    }
+    __v                  = __v * __v * __v;
+    const _RealType __x2 = __x * __x;
+    const _RealType __u =
+      _RealType{1} - ::cuda::std::generate_canonical<_RealType, numeric_limits<_RealType>::digits>(__g);
+    if (__u < _RealType{1} - _RealType{0.0331} * __x2 * __x2)
+    {
+      return __d * __v;
+    }
+    if (::cuda::std::log(__u) < _RealType{0.5} * __x2 + __d * (_RealType{1} - __v + ::cuda::std::log(__v)))
+    {
+      return __d * __v;
+    }
+  }
+}
+
 template <class _RealType = double>
 class gamma_distribution
 {
@@ -112,27 +144,34 @@ public:
     }
     else if (__a > result_type{1})
     {
-      const result_type __b = __a - result_type{1};
-      const result_type __c = result_type{3} * __a - result_type{0.75};
-      while (true)
+      if constexpr (__cccl_random_use_ziggurat<result_type>)
       {
-        const result_type __u = __gen(__g);
-        const result_type __v = __gen(__g);
-        const result_type __w = __u * (result_type{1} - __u);
-        if (__w != result_type{0})
+        __x = ::cuda::std::__gamma_marsaglia_tsang<result_type>(__g, __a);
+      }
+      else
+      {
+        const result_type __b = __a - result_type{1};
+        const result_type __c = result_type{3} * __a - result_type{0.75};
+        while (true)
         {
-          const result_type __y = ::cuda::std::sqrt(__c / __w) * (__u - result_type{0.5});
-          __x                   = __b + __y;
-          if (__x >= result_type{0})
+          const result_type __u = __gen(__g);
+          const result_type __v = __gen(__g);
+          const result_type __w = __u * (result_type{1} - __u);
+          if (__w != result_type{0})
           {
-            const result_type __z = result_type{64} * __w * __w * __w * __v * __v;
-            if (__z <= result_type{1} - result_type{2} * __y * __y / __x)
-            {
-              break;
-            }
-            if (::cuda::std::log(__z) <= result_type{2} * (__b * ::cuda::std::log(__x / __b) - __y))
+            const result_type __y = ::cuda::std::sqrt(__c / __w) * (__u - result_type{0.5});
+            __x                   = __b + __y;
+            if (__x >= result_type{0})
             {
-              break;
+              const result_type __z = result_type{64} * __w * __w * __w * __v * __v;
+              if (__z <= result_type{1} - result_type{2} * __y * __y / __x)
+              {
+                break;
+              }
+              if (::cuda::std::log(__z) <= result_type{2} * (__b * ::cuda::std::log(__x / __b) - __y))
+              {
+                break;
+              }
             }
           }
         }
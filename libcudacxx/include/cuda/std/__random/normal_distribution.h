@@ -27,6 +27,7 @@
 #include <cuda/std/__limits/numeric_limits.h>
 #include <cuda/std/__random/is_valid.h>
 #include <cuda/std/__random/uniform_real_distribution.h>
+#include <cuda/std/__random/ziggurat.h>
 
 #include <cuda/std/__cccl/prologue.h>
 
@@ -112,8 +113,13 @@ public:
       __v_hot_ = false;
       __up     = __v_;
     }
+    else if constexpr (__cccl_random_use_ziggurat<result_type>)
+    {
+      __up = ::cuda::std::__ziggurat_normal<result_type>(__g);
+    }
     else
     {
+      // Marsaglia polar method, which generates two samples
       uniform_real_distribution<result_type> __uni(-1, 1);
       result_type __u = __uni(__g);
       result_type __v = __uni(__g);
@@ -0,0 +1,439 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___RANDOM_ZIGGURAT_H
+#define _CUDA_STD___RANDOM_ZIGGURAT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__cmath/exponential_functions.h>
+#include <cuda/std/__cmath/logarithms.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__limits/numeric_limits.h>
+#include <cuda/std/__random/generate_canonical.h>
+#include <cuda/std/__random/uniform_int_distribution.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+// The ziggurat method of Marsaglia and Tsang, "The Ziggurat Method for Generating Random Variables", 2000, with 256
+// layers of equal area under the density. A sample picks a layer and a point in its rectangle with a single 64-bit
+// random word, and is accepted without evaluating the density when the point lies in the part of the rectangle that is
+// below the layer above it, which happens for about 99% of the samples.
+//
+// The tables hold the right edges x[i] of the layers, decreasing from x[1], the start of the tail, to x[256] = 0, and
+// the value of the density at these edges. The bottom layer, which also covers the tail, has the pseudo-width
+// x[0] = v / f(x[1]), where v is the area of a layer.
+
+//! @brief Whether the distributions generate their samples with the ziggurat method, which computes in the precision of
+//! the tables.
+template <class _RealType>
+inline constexpr bool __cccl_random_use_ziggurat = is_same_v<_RealType, float> || is_same_v<_RealType, double>;
+
+//! The right edges of the layers of the ziggurat of the normal density f(x) = exp(-x * x / 2).
+template <class _RealType>
+_CCCL_GLOBAL_CONSTANT _RealType __ziggurat_normal_x[257] = {
+  3.9107579595249167, 3.6541528853610092, 3.4492782985614316, 3.320244733839826,
+  3.2245750520478023, 3.1478892895180013, 3.083526132002144, 3.027837791769594,
+  2.9786032798818436, 2.934366867208888, 2.8941210536134125, 2.857138730873225,
+  2.8228773968264433, 2.790921174001928, 2.760944005279987, 2.7326853590440123,
+  2.7059336561230634, 2.680514643285746, 2.656283037576744, 2.6331163936315836,
+  2.6109105184888244, 2.5895759867082875, 2.5690354526818444, 2.5492215503247837,
+  2.5300752321598545, 2.5115444416266945, 2.4935830412710467, 2.476149939670523,
+  2.459208374334705, 2.442725318200364, 2.4266709849371466, 2.4110184139011195,
+  2.3957431197819274, 2.3808227951720857, 2.366237056717291, 2.3519672273791445,
+  2.3379961487965284, 2.3243080188711325, 2.310888250601372, 2.2977233489028634,
+  2.284800802724492, 2.2721089902283818, 2.2596370951737876, 2.247375032947389,
+  2.235313384929921, 2.22344334009251, 2.2117566428841604, 2.200245546611276,
+  2.1889027716263603, 2.1777214677402923, 2.1666951803543077, 2.1558178198767366,
+  2.145083634047888, 2.134487182846016, 2.1240233156895227, 2.1136871506866526,
+  2.1034740557148766, 2.0933796311387916, 2.083399693998304, 2.0735302635187427,
+  2.063767547811732, 2.054107931650652, 2.0445479652175313, 2.035084353729619,
+  2.025713947863854, 2.016433734906204, 2.0072408305605287, 1.9981324713584196,
+  1.989106007617438, 1.9801588969004766, 1.9712886979336592, 1.962493064944363,
+  1.9537697423846467, 1.9451165600086784, 1.9365314282756947, 1.9280123340526658,
+  1.9195573365931882, 1.9111645637712535, 1.9028322085504297, 1.8945585256707052,
+  1.8863418285367834, 1.8781804862929965, 1.8700729210712674, 1.8620176053996749,
+  1.8540130597602025, 1.846057850285186, 1.8381505865828072, 1.8302899196827576,
+  1.8224745400938864, 1.8147031759662833, 1.8069745913508215, 1.7992875845497207,
+  1.791640986552163, 1.784033659549442, 1.7764644955245235, 1.768932414911269,
+  1.7614363653189107, 1.753975320317672, 1.7465482782817228, 1.739154261285912,
+  1.7317923140529636, 1.7244615029480455, 1.7171609150178238, 1.7098896570713025,
+  1.7026468547999238, 1.6954316519345622, 1.6882432094371962, 1.6810807047251746,
+  1.6739433309261256, 1.6668302961616661, 1.6597408228581831, 1.6526741470830566,
+  1.645629517904783, 1.6386061967755485, 1.6316034569348743, 1.6246205828330356,
+  1.6176568695730162, 1.6107116223698308, 1.6037841560260953, 1.5968737944227889,
+  1.5899798700241916, 1.58310172339603, 1.5762387027359073, 1.5693901634151246,
+  1.5625554675310458, 1.5557339834691772, 1.5489250854741743, 1.542128153229003,
+  1.5353425714415152, 1.5285677294377134, 1.5218030207609992, 1.5150478427767158,
+  1.5083015962813129, 1.501563685115465, 1.494833515780495, 1.488110497057449,
+  1.4813940396281888, 1.4746835556978568, 1.4679784586180809, 1.4612781625102769,
+  1.4545820818884116, 1.4478896312805773, 1.4412002248487252, 1.4345132760058934,
+  1.427828197030257, 1.4211443986753103, 1.4144612897754725, 1.4077782768464002,
+  1.4010947636792523, 1.3944101509281424, 1.3877238356899773, 1.3810352110758566,
+  1.3743436657731674, 1.3676485835974772, 1.3609493430332842, 1.354245316762636,
+  1.3475358711805883, 1.340820365896405, 1.334098153219361, 1.327368577627927,
+  1.3206309752210572, 1.3138846731502214, 1.307128989030732, 1.3003632303308381,
+  1.2935866937369487, 1.2867986644932445, 1.279998415713819, 1.2731852076653574,
+  1.2663582870182304, 1.2595168860637151, 1.2526602218948981, 1.245787495548628,
+  1.2388978911056883, 1.2319905747461368, 1.2250646937565315, 1.2181193754854824,
+  1.2111537262437, 1.2041668301443824, 1.1971577478794424, 1.1901255154266928,
+  1.1830691426826876, 1.1759876120154529, 1.1688798767308342, 1.1617448594456123,
+  1.1545814503599288, 1.1473885054208501, 1.1401648443681522, 1.132909248652535,
+  1.1256204592155346, 1.1182971741193461, 1.110938046013577, 1.103541679424641,
+  1.0961066278520228, 1.0886313906539813, 1.0811144097034053, 1.0735540657924376,
+  1.0659486747621238, 1.0582964833306765, 1.0505956645909313, 1.0428443131441505,
+  1.0350404398334425, 1.0271819660356476, 1.019266717465486, 1.0112924174399973,
+  1.0032566795446747, 0.9951569996350926, 0.9869907470990642, 0.9787551552942263,
+  0.9704473110642261, 0.9620641432230422, 0.9536024098810878, 0.9450586844681672,
+  0.9364293402865769, 0.9277105334020018, 0.9188981836495924, 0.9099879534967203,
+  0.9009752244612236, 0.8918550707329435, 0.8826222295851675, 0.8732710680888626,
+  0.8637955455533108, 0.8541891710081658, 0.8444449549091559, 0.8345553540863843,
+  0.8245122087522943, 0.8143066701352175, 0.8039291169899736, 0.7933690588406257,
+  0.7826150233072355, 0.7716544242245705, 0.7604734064301106, 0.749056662017818,
+  0.7373872114342983, 0.7254461409100025, 0.7132122851909788, 0.7006618411068181,
+  0.6877678927957916, 0.674499822837297, 0.660822574244423, 0.6466957148949973,
+  0.6320722363860648, 0.6168969900077552, 0.6011046177559964, 0.5846167661063835,
+  0.5673382570538232, 0.5491517023271699, 0.5299097206615632, 0.5094233296020972,
+  0.48744396613924196, 0.4636343367908887, 0.4375184022078789, 0.4083891346119995,
+  0.3751213328783903, 0.33573751921443695, 0.28617459179208804, 0.2152418959849064,
+  0.0,
+};
+
+//! The normal density at the right edges of the layers.
+template <class _RealType>
+_CCCL_GLOBAL_CONSTANT _RealType __ziggurat_normal_f[257] = {
+  0.0004774677646093862, 0.0012602859304985956, 0.0026090727461021593, 0.0040379725933630236,
+  0.005522403299250986, 0.007050875471373216, 0.00861658276939872, 0.010214971439701459,
+  0.011842757857907879, 0.013497450601739867, 0.01517708830793531, 0.016880083152543142,
+  0.018605121275724622, 0.020351096230044483, 0.02211706270730882, 0.023902203305795823,
+  0.025705804008548817, 0.027527235669603013, 0.029365939758133255, 0.03122141719192019,
+  0.03309321945857846, 0.03498094146171602, 0.03688421568856722, 0.038802707404526064,
+  0.0407361106559409, 0.042684144916474424, 0.044646552251294463, 0.04662309490193038,
+  0.04861355321586854, 0.05061772386094778, 0.05263541827679219, 0.05466646132488892,
+  0.0567106901062029, 0.05876795292093374, 0.06083810834953988, 0.06292102443775814,
+  0.0650165779712429, 0.0671246538277885, 0.06924514439700676, 0.0713779490588904,
+  0.07352297371398132, 0.07568013035892711, 0.07784933670209605, 0.08003051581466307,
+  0.0822235958132029, 0.08442850957035347, 0.08664519445055807, 0.08887359206827589,
+  0.09111364806637376, 0.09336531191269101, 0.095628536713009, 0.09790327903886246,
+  0.10018949876881002, 0.10248715894193525, 0.10479622562248707, 0.1071166677746838,
+  0.1094484571468118, 0.11179156816383809, 0.11414597782783849, 0.11651166562561087,
+  0.11888861344291006, 0.1212768054847903, 0.12367622820159657, 0.1260868702201859,
+  0.12850872227999957, 0.13094177717364436, 0.13338602969166916, 0.13584147657125376,
+  0.13830811644855073, 0.1407859498144447, 0.14327497897351346, 0.14577520800599403,
+  0.14828664273257455, 0.15080929068184568, 0.15334316106026286, 0.1558882647244792,
+  0.15844461415592428, 0.161012223437511, 0.16359110823236558, 0.1661812857644819,
+  0.1687827748012113, 0.17139559563750575, 0.17401977008183855, 0.17665532144373478,
+  0.1793022745228475, 0.18196065559952238, 0.1846304924267991, 0.18731181422380005,
+  0.1900046516704648, 0.19270903690358893, 0.1954250035141341, 0.19815258654577494,
+  0.20089182249465645, 0.20364274931033471, 0.20640540639788052, 0.20917983462112485,
+  0.21196607630703004, 0.21476417525117344, 0.21757417672433102, 0.22039612748015178,
+  0.22323007576391726, 0.22607607132237997, 0.22893416541467998, 0.23180441082433836,
+  0.23468686187232965, 0.23758157443123773, 0.2404886059405001, 0.2434080154227499,
+  0.24633986350126344, 0.24928421241852802, 0.2522411260559417, 0.2552106699546614,
+  0.2581929113376186, 0.26118791913272055, 0.26419576399726047, 0.2672165183435608,
+  0.27025025636587496, 0.2732970540685766, 0.2763569892956678, 0.27943014176163744,
+  0.2825165930837071, 0.2856164268155012, 0.2887297284821823, 0.2918565856170946,
+  0.29499708779996126, 0.298151326696685, 0.3013193961008025, 0.3045013919766494,
+  0.30769741250429145, 0.3109075581262859, 0.3141319315963365, 0.3173706380299129,
+  0.3206237849569047, 0.3238914823763904, 0.32717384281360057, 0.33047098137916275,
+  0.33378301583071757, 0.3371100666370053, 0.34045225704452103, 0.34380971314684994,
+  0.34718256395679287, 0.35057094148140533, 0.35397498080007594, 0.3573948201457797,
+  0.3608306009896472, 0.3642824681290031, 0.36775056977903164, 0.37123505766823856,
+  0.3747360871378902, 0.3782538172456183, 0.3817884108733928, 0.3853400348400765,
+  0.388908860018788, 0.39249506145931484, 0.3960988185158316, 0.3997203149801965,
+  0.4033597392211138, 0.40701728432947265, 0.41069314827018755, 0.4143875340408904,
+  0.4181006498378475, 0.4218327092294953, 0.4255839313380213, 0.4293545410294408,
+  0.43314476911265165, 0.4369548525479849, 0.44078503466580327, 0.4446355653957386,
+  0.4485067015072023, 0.4523987068618478, 0.45631185267871566, 0.4602464178128421,
+  0.4642026890481735, 0.4681809614056928, 0.4721815384677294, 0.47620473271950514,
+  0.480250865909046, 0.48432026942668244, 0.4884132847054572, 0.49253026364386776,
+  0.49667156905248894, 0.5008375751261479, 0.5050286679434673, 0.509245245995747,
+  0.513487720747326, 0.5177565172297554, 0.5220520746723208, 0.5263748471716834,
+  0.530725304403661, 0.5351039323804565, 0.5395112342569509, 0.543947731190025,
+  0.5484139632552646, 0.5529104904258311, 0.5574378936187647, 0.5619967758145232,
+  0.5665877632561631, 0.5712115067352519, 0.5758686829723524, 0.5805599961007896,
+  0.5852861792633699, 0.5900479963328245, 0.594846243767986, 0.5996817526191239,
+  0.6045553906974664, 0.6094680649257721, 0.6144207238889126, 0.619414360605833,
+  0.6244500155470252, 0.6295287799248354, 0.6346517992876223, 0.6398202774530553,
+  0.645035480820821, 0.6502987431108154, 0.6556114705796959, 0.6609751477766618,
+  0.6663913439087488, 0.6718617198970807, 0.677388036218772, 0.6829721616449933,
+  0.6886160830046703, 0.6943219161261152, 0.7000919181365101, 0.7059285013327526,
+  0.7118342488782468, 0.7178119326307203, 0.7238645334686284, 0.7299952645614745,
+  0.7362075981268609, 0.7425052963401493, 0.748892447219155, 0.7553735065070942,
+  0.7619533468367934, 0.7686373157984843, 0.7754313049811852, 0.7823418326548004,
+  0.7893761435660225, 0.7965423304229569, 0.8038494831709622, 0.811307874312654,
+  0.8189291916037001, 0.8267268339462192, 0.8347162929868812, 0.8429156531122018,
+  0.8513462584586755, 0.860033621196329, 0.8690086880368544, 0.8783096558089146,
+  0.8879846607558305, 0.8980959218983404, 0.9087264400521277, 0.9199915050393436,
+  0.9320600759592268, 0.9451989534422957, 0.9598790918001021, 0.977101701267666,
+  1.0,
+};
+
+//! The right edges of the layers of the ziggurat of the exponential density f(x) = exp(-x).
+template <class _RealType>
+_CCCL_GLOBAL_CONSTANT _RealType __ziggurat_exponential_x[257] = {
+  8.697117470131051, 7.69711747013105, 6.941033629377213, 6.47837849383257,
+  6.144164665772473, 5.8821443157954, 5.666410167454034, 5.4828906275260625,
+  5.323090505754398, 5.1814872813015, 5.054288489981304, 4.9387770859012505,
+  4.832939741025112, 4.735242996601741, 4.644491885420085, 4.559737061707351,
+  4.480211746528422, 4.405287693473573, 4.334443680317273, 4.267242480277366,
+  4.203313713735184, 4.1423408656640515, 4.084051310408298, 4.028208544647937,
+  3.974606066673789, 3.9230625001354897, 3.873417670399509, 3.8255294185223367,
+  3.779270992411668, 3.7345288940397974, 3.691201090237419, 3.6491955157608538,
+  3.6084288131289095, 3.568825265648337, 3.5303158891293434, 3.4928376547740596,
+  3.45633282113276, 3.42074835725112, 3.386035442460301, 3.3521490309001094,
+  3.319047470970748, 3.2866921715990687, 3.25504730857045, 3.224079565286264,
+  3.1937579032122403, 3.164053358025973, 3.1349388580844404, 3.1063890623398245,
+  3.0783802152540902, 3.050890016615455, 3.0238975044556766, 2.9973829495161306,
+  2.9713277599210897, 2.9457143948950457, 2.920526286512741, 2.895747768600142,
+  2.8713640120155364, 2.847360965635189, 2.8237253024500353, 2.800444370250738,
+  2.7775061464397566, 2.7548991965623446, 2.7326126361947, 2.7106360958679288,
+  2.6889596887418037, 2.6675739807732666, 2.646469963151809, 2.6256390267977885,
+  2.6050729387408356, 2.5847638202141408, 2.5647041263169053, 2.54488662711187,
+  2.525304390037828, 2.505950763528594, 2.4868193617402095, 2.467904050297365,
+  2.4491989329782498, 2.4306983392644197, 2.4123968126888706, 2.394289099921458,
+  2.3763701405361406, 2.3586350574093373, 2.3410791477030344, 2.3236978743901964,
+  2.30648685828358, 2.2894418705322694, 2.272558825553155, 2.255833774367219,
+  2.239262898312909, 2.222842503111037, 2.206569013257664, 2.19043896672322,
+  2.1744490099377747, 2.158595893043886, 2.142876465399842, 2.1272876713173683,
+  2.111826546019042, 2.096490211801715, 2.081275874393225, 2.0661808194905755,
+  2.051202409468585, 2.0363380802487696, 2.021585338318926, 2.0069417578945186,
+  1.9924049782135766, 1.9779727009573604, 1.9636426877895483, 1.949412758007185,
+  1.9352807862970514, 1.921244700591528, 1.9073024800183875, 1.8934521529393082,
+  1.8796917950722112, 1.866019527692828, 1.8524335159111756, 1.83893196701888,
+  1.8255131289035198, 1.8121752885263906, 1.7989167704602909, 1.785735935484126,
+  1.7726311792313056, 1.7596009308890748, 1.7466436519460744, 1.7337578349855716,
+  1.7209420025219353, 1.7081947058780578, 1.695514524101538, 1.682900062917554,
+  1.6703499537164521, 1.6578628525741728, 1.6454374393037237, 1.6330724165359913,
+  1.620766508828258, 1.6085184617988584, 1.5963270412864834, 1.584191032532689,
+  1.5721092393862297, 1.560080483527888, 1.5481036037145135, 1.536177455041032,
+  1.5243009082192263, 1.512472848872117, 1.5006921768428167, 1.488957805516746,
+  1.4772686611561339, 1.4656236822457454, 1.4540218188487934, 1.4424620319720125,
+  1.4309432929388797, 1.4194645827699832, 1.4080248915695357, 1.3966232179170421,
+  1.3852585682631222, 1.3739299563284908, 1.362636402505087, 1.3513769332583354,
+  1.340150580529505, 1.328956381137117, 1.3177933761763252, 1.3066606104151746,
+  1.2955571316866015, 1.284481990275013, 1.2734342382962416, 1.2624129290696158,
+  1.251417116480853, 1.240445854334407, 1.2294981956938498, 1.218573192208791,
+  1.2076698934267622, 1.196787346088404, 1.185924593404203, 1.1750806743109123,
+  1.1642546227056796, 1.1534454666557754, 1.1426522275816735, 1.1318739194110792,
+  1.121109547701331, 1.110358108727412, 1.0996185885325982, 1.088889961938548,
+  1.0781711915113732, 1.0674612264799688, 1.0567590016025523, 1.046063435977045,
+  1.0353734317905294, 1.0246878730026183, 1.0140056239570978, 1.003325527915698,
+  0.9926464055072772, 0.9819670530850639, 0.9712862409839048, 0.960602711668668,
+  0.9499151777640774, 0.9392223199552638, 0.928522784747212, 0.9178151820700458,
+  0.9070980827156918, 0.8963700155898915, 0.8856294647617531, 0.8748748662910267,
+  0.864104604811006, 0.8533170098423749, 0.84251035181037, 0.8316828377342746,
+  0.8208326065544134, 0.80995772405742, 0.7990561773554887, 0.7881258688694941,
+  0.7771646097591313, 0.7661701127354362, 0.7551399841819838, 0.7440717155005095,
+  0.732962673584367, 0.7218100903087578, 0.7106110509096565, 0.6993624811032334,
+  0.6880611327737494, 0.6767035680295241, 0.6652861413926794, 0.6538049798476665,
+  0.6422559604245379, 0.630634684933492, 0.6189364513948777, 0.6071562216203017,
+  0.5952885842915044, 0.5833277127487712, 0.5712673165325899, 0.5591005855115422,
+  0.5468201251633121, 0.534417881237167, 0.5218850515921366, 0.509211982443656,
+  0.4963880455186726, 0.4834014916534633, 0.47023927508217045, 0.4568868409314218,
+  0.4433278660735541, 0.4295439402254126, 0.41551416960035825, 0.4012146788962796,
+  0.3866179779411214, 0.3716921453299192, 0.3563997602583957, 0.3406964810648512,
+  0.32452911701691145, 0.30783295467493427, 0.2905279554912326, 0.27251318547846703,
+  0.25365836338591446, 0.23379048305967726, 0.21267151063096923, 0.18995868962243467,
+  0.16512762256419042, 0.13730498094001628, 0.10483850756582322, 0.0638521638150076,
+  0.0,
+};
+
+//! The exponential density at the right edges of the layers.
+template <class _RealType>
+_CCCL_GLOBAL_CONSTANT _RealType __ziggurat_exponential_f[257] = {
+  0.00016706669230796367, 0.0004541343538414966, 0.0009672692823271743, 0.0015362997803015726,
+  0.002145967743718907, 0.0027887987935740757, 0.003460264777836904, 0.004157295120833797,
+  0.004877655983542396, 0.005619642207205489, 0.006381905937319183, 0.007163353183634991,
+  0.007963077438017043, 0.008780314985808977, 0.009614413642502212, 0.01046481018102998,
+  0.0113310135978346, 0.012212592426255378, 0.013109164931254991, 0.014020391403181943,
+  0.014945968011691148, 0.015885621839973156, 0.01683910682603994, 0.017806200410911355,
+  0.018786700744696024, 0.01978042433800974, 0.020787204072578114, 0.02180688750428358,
+  0.02283933540638524, 0.023884420511558174, 0.024942026419731787, 0.02601204664513422,
+  0.027094383780955803, 0.028188948763978646, 0.02929566022463741, 0.03041444391046662,
+  0.03154523217289362, 0.032687963508959555, 0.03384258215087436, 0.03500903769739743,
+  0.03618728478193144, 0.03737728277295938, 0.03857899550307487, 0.03979239102337414,
+  0.04101744138041484, 0.042254122413316254, 0.0435024135688882, 0.04476229773294329,
+  0.046033761076175184, 0.04731679291318156, 0.048611385573379504, 0.04991753428270638,
+  0.05123523705512628, 0.052564494593071685, 0.05390531019604608, 0.05525768967669703,
+  0.05662164128374287, 0.05799717563120066, 0.05938430563342028, 0.06078304644547966,
+  0.062193415408541036, 0.06361543199980738, 0.0650491177867538, 0.06649449638533982,
+  0.06795159342193664, 0.06942043649872878, 0.07090105516237184, 0.07239348087570875,
+  0.07389774699236475, 0.07541388873405841, 0.07694194317048052, 0.07848194920160644,
+  0.0800339475423199, 0.08159798070923742, 0.0831740930096324, 0.08476233053236815,
+  0.08636274114075693, 0.08797537446727023, 0.08960028191003289, 0.0912375166310402,
+  0.09288713355604357, 0.09454918937605587, 0.09622374255043283, 0.09791085331149221,
+  0.09961058367063713, 0.10132299742595363, 0.1030481601712577, 0.10478613930657016,
+  0.10653700405000163, 0.10830082545103376, 0.11007767640518536, 0.11186763167005628,
+  0.11367076788274429, 0.1154871635786335, 0.11731689921155553, 0.11916005717532764,
+  0.12101672182667479, 0.12288697950954511, 0.12477091858083093, 0.12666862943751067,
+  0.1285802045452282, 0.13050573846833077, 0.1324453279013875, 0.1343990717022136,
+  0.13636707092642883, 0.13834942886358018, 0.1403462510748624, 0.14235764543247215,
+  0.14438372216063472, 0.1464245938783449, 0.14848037564386674, 0.15055118500103984,
+  0.1526371420274428, 0.15473836938446803, 0.15685499236936515, 0.15898713896931413,
+  0.16113493991759195, 0.16329852875190173, 0.16547804187493592, 0.16767361861725008,
+  0.16988540130252755, 0.17211353531531998, 0.1743581691713534, 0.17661945459049483,
+  0.17889754657247828, 0.18119260347549626, 0.18350478709776744, 0.18583426276219708,
+  0.18818119940425426, 0.19054576966319536, 0.1929281499767713, 0.1953285206795632,
+  0.19774706610509882, 0.2001839746919112, 0.20263943909370896, 0.20511365629383765,
+  0.20760682772422198, 0.21011915938898823, 0.21265086199297822, 0.21520215107537863,
+  0.21777324714870047, 0.22036437584335944, 0.2229757680581201, 0.22560766011668396,
+  0.22826029393071662, 0.23093391716962736, 0.2336287834374333, 0.23634515245705956,
+  0.2390832902624491, 0.24184346939887713, 0.24462596913189202, 0.24743107566532754,
+  0.2502590823688622, 0.25311029001562935, 0.25598500703041527, 0.25888354974901606,
+  0.2618062426893628, 0.26475341883506204, 0.26772541993204463, 0.27072259679905986,
+  0.2737453096528028, 0.2767939284485172, 0.27986883323697276, 0.28297041453878063,
+  0.2860990737370767, 0.2892552234896776, 0.2924392881618924, 0.295651704281261,
+  0.2988929210155815, 0.3021634006756933, 0.30546361924459003, 0.30879406693455996,
+  0.3121552487741794, 0.3155476852271287, 0.318971912844957, 0.322428484956089,
+  0.325917972393556, 0.32944096426413616, 0.33299806876180876, 0.3365899140286774,
+  0.34021714906677986, 0.34388044470450224, 0.3475804946216368, 0.35131801643748317,
+  0.3550937528667873, 0.35890847294874956, 0.3627629733548175, 0.3666580797815139,
+  0.3705946484351457, 0.3745735676159019, 0.3785957594095805, 0.3826621814960095,
+  0.3867738290841374, 0.3909317369847968, 0.3951369818332898, 0.39939068447523074,
+  0.40369401253052994, 0.40804818315203206, 0.41245446599716085, 0.41691418643300254,
+  0.42142872899761624, 0.425999541143034, 0.4306281372884585, 0.43531610321563624,
+  0.4400651008423535, 0.4448768734145481, 0.4497532511627546, 0.4546961574746151,
+  0.4597076156421373, 0.4647897562504258, 0.4699448252839596, 0.475175193037377,
+  0.4804833639304538, 0.4858719873418845, 0.49134386959403215, 0.49690198724154916,
+  0.5025495018413473, 0.5082897764106424, 0.5141263938147481, 0.5200631773682332,
+  0.5261042139836193, 0.5322538802630428, 0.5385168720028614, 0.5448982376724392,
+  0.5514034165406408, 0.558038282262587, 0.5648091929123997, 0.5717230486648253,
+  0.5787873586028445, 0.5860103184772675, 0.5934009016917329, 0.6009689663652317,
+  0.6087253820796215, 0.616682180915207, 0.6248527387036653, 0.6332519942143654,
+  0.6418967164272653, 0.6508058334145702, 0.6600008410789989, 0.669506316731924,
+  0.6793505722647646, 0.6895664961170771, 0.7001926550827873, 0.711274760805075,
+  0.722867659593571, 0.7350380924314225, 0.747868621985194, 0.7614633888498951,
+  0.7759568520401143, 0.7915276369724943, 0.8084216515230069, 0.8269932966430488,
+  0.8477855006239878, 0.8717043323812015, 0.9004699299257437, 0.9381436808621708,
+  1.0,
+};
+
+//! @brief Returns 64 uniformly distributed random bits, with a single call to generators of 64-bit words.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _URng>
+[[nodiscard]] _CCCL_API constexpr uint64_t __ziggurat_bits(_URng& __g)
+{
+  constexpr uint64_t __range = static_cast<uint64_t>((_URng::max) () - (_URng::min) ());
+  if constexpr (__range == ~uint64_t{0})
+  {
+    return static_cast<uint64_t>(__g() - (_URng::min) ());
+  }
+  else if constexpr (__range == uint64_t{0xFFFFFFFF})
+  {
+    const uint64_t __high = static_cast<uint64_t>(__g() - (_URng::min) ());
+    return (__high << 32) | static_cast<uint64_t>(__g() - (_URng::min) ());
+  }
+  else
+  {
+    return __independent_bits_engine<_URng, uint64_t>{__g, 64}();
+  }
+}
+
+//! @brief Returns a uniformly distributed value in [0, 1) from the high bits of __bits, which are independent of its 9
+//! low bits.
+template <class _RealType>
+[[nodiscard]] _CCCL_API constexpr _RealType __ziggurat_uniform(uint64_t __bits) noexcept
+{
+  constexpr int __digits     = numeric_limits<_RealType>::digits;
+  constexpr _RealType __scale = _RealType{1} / static_cast<_RealType>(uint64_t{1} << __digits);
+  return static_cast<_RealType>(__bits >> (64 - __digits)) * __scale;
+}
+
+//! @brief Returns a sample of the standard normal distribution.
+template <class _RealType, class _URng>
+[[nodiscard]] _CCCL_API constexpr _RealType __ziggurat_normal(_URng& __g)
+{
+  const _RealType* __x = __ziggurat_normal_x<_RealType>;
+  const _RealType* __f = __ziggurat_normal_f<_RealType>;
+  while (true)
+  {
+    const uint64_t __bits   = ::cuda::std::__ziggurat_bits(__g);
+    const size_t __layer    = static_cast<size_t>(__bits & 0xFF);
+    // The sign is random, so it is applied without a branch
+    const _RealType __sign  = _RealType{1} - _RealType{2} * static_cast<_RealType>((__bits >> 8) & 1);
+    const _RealType __value = ::cuda::std::__ziggurat_uniform<_RealType>(__bits) * __x[__layer];
+    if (__value < __x[__layer + 1])
+    {
+      return __sign * __value;
+    }
+    if (__layer == 0)
+    {
+      // The tail beyond __x[1], sampled by the method of Marsaglia, "Generating a variable from the tail of the normal
+      // distribution", 1964.
+      _RealType __tail{};
+      _RealType __y{};
+      do
+      {
+        __tail = -::cuda::std::log(
+                   _RealType{1} - ::cuda::std::generate_canonical<_RealType, numeric_limits<_RealType>::digits>(__g))
+               / __x[1];
+        __y = -::cuda::std::log(
+          _RealType{1} - ::cuda::std::generate_canonical<_RealType, numeric_limits<_RealType>::digits>(__g));
+      } while (__y + __y < __tail * __tail);
+      return __sign * (__x[1] + __tail);
+    }
+    // The wedge between the layer above and the density
+    const _RealType __u = ::cuda::std::generate_canonical<_RealType, numeric_limits<_RealType>::digits>(__g);
+    if (__f[__layer] + __u * (__f[__layer + 1] - __f[__layer])
+        < ::cuda::std::exp(-__value * __value / _RealType{2}))
+    {
+      return __sign * __value;
+    }
+  }
+}
+
+//! @brief Returns a sample of the exponential distribution with rate 1.
+template <class _RealType, class _URng>
+[[nodiscard]] _CCCL_API constexpr _RealType __ziggurat_exponential(_URng& __g)
+{
+  const _RealType* __x = __ziggurat_exponential_x<_RealType>;
+  const _RealType* __f = __ziggurat_exponential_f<_RealType>;
+  // The tail beyond __x[1] is the exponential distribution shifted by __x[1]
+  _RealType __offset{};
+  while (true)
+  {
+    const uint64_t __bits   = ::cuda::std::__ziggurat_bits(__g);
+    const size_t __layer    = static_cast<size_t>(__bits & 0xFF);
+    const _RealType __value = ::cuda::std::__ziggurat_uniform<_RealType>(__bits) * __x[__layer];
+    if (__value < __x[__layer + 1])
+    {
+      return __offset + __value;
+    }
+    if (__layer == 0)
+    {
+      __offset += __x[1];
+      continue;
+    }
+    const _RealType __u = ::cuda::std::generate_canonical<_RealType, numeric_limits<_RealType>::digits>(__g);
+    if (__f[__layer] + __u * (__f[__layer + 1] - __f[__layer]) < ::cuda::std::exp(-__value))
+    {
+      return __offset + __value;
+    }
+  }
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___RANDOM_ZIGGURAT_H
@@ -40,10 +40,24 @@ struct __fixed_size; // internal ABI tag
 template <__simd_size_type _Np>
 using fixed_size = __fixed_size<_Np>; // implementation-defined ABI
 
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+// On the host, native holds as many elements as fit in the widest vector register enabled for the translation unit,
+// and compatible as many as fit in the 16 byte registers that every x86-64 processor has
+template <typename _Tp>
+using native = fixed_size<(sizeof(_Tp) < _CCCL_SIMD_HOST_VECTOR_BYTES) ? _CCCL_SIMD_HOST_VECTOR_BYTES / sizeof(_Tp)
+                                                                       : 1>; // implementation-defined ABI
+
+template <typename _Tp>
+using compatible = fixed_size<(sizeof(_Tp) < 16) ? 16 / sizeof(_Tp) : 1>; // implementation-defined ABI
+#else // ^^^ _CCCL_HAS_SIMD_HOST_VECTOR() ^^^ / vvv !_CCCL_HAS_SIMD_HOST_VECTOR() vvv
 // TODO(fbusato): this could be optimized by using max access size / sizeof(T)
 template <typename>
 using native = fixed_size<1>; // implementation-defined ABI
 
+template <typename>
+using compatible = fixed_size<1>; // implementation-defined ABI
+#endif // !_CCCL_HAS_SIMD_HOST_VECTOR()
+
 template <typename, __simd_size_type _Np>
 using __deduce_abi_t = fixed_size<_Np>; // exposition-only
 
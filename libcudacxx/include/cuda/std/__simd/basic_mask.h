@@ -74,6 +74,8 @@ class basic_mask<_Bytes, _Abi, enable_if_t<__is_vectorizable_byte_size_v<_Bytes>
   template <typename, typename, typename>
   friend class basic_vec;
 
+  friend struct __simd_access;
+
   using _Impl    = __mask_operations<_Bytes, _Abi>;
   using _Storage = typename _Impl::_MaskStorage;
 
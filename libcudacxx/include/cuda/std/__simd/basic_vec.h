@@ -35,6 +35,7 @@
 #include <cuda/std/__simd/flag.h>
 #include <cuda/std/__simd/iterator.h>
 #include <cuda/std/__simd/specializations/fixed_size_float_vec.h>
+#include <cuda/std/__simd/specializations/fixed_size_host_vec.h>
 #include <cuda/std/__simd/specializations/fixed_size_integral_vec.h>
 #include <cuda/std/__simd/specializations/fixed_size_vec.h>
 #include <cuda/std/__simd/type_traits.h>
@@ -100,6 +101,8 @@ private:
   template <size_t, typename, typename>
   friend class basic_mask;
 
+  friend struct __simd_access;
+
   template <typename _Result, typename _Up, typename... _Flags>
   _CCCL_HOST_DEVICE_API friend constexpr _Result
   __partial_load_from_ptr(const _Up*, __simd_size_type, const typename _Result::mask_type&, flags<_Flags...>) noexcept;
@@ -741,6 +744,22 @@ public:
   }
 };
 
+// Gives the operations that are implemented outside of basic_vec and basic_mask access to their storage
+struct __simd_access
+{
+  template <typename _Vp>
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr const auto& __storage(const _Vp& __v) noexcept
+  {
+    return __v.__s_;
+  }
+
+  template <typename _Vp, typename _Storage>
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _Vp __from_storage(const _Storage& __s) noexcept
+  {
+    return _Vp{__s, _Vp::__storage_tag};
+  }
+};
+
 // [simd.ctor] deduction guide from contiguous sized range
 // Deduces vec<range_value_t<R>, static_cast<simd-size-type>(::cuda::std::ranges::size(r))>
 //    * it is not possible to use the alias "vec" for the deduction guide
@@ -24,6 +24,7 @@
 #include <cuda/__type_traits/is_floating_point.h>
 #include <cuda/std/__concepts/concept_macros.h>
 #include <cuda/std/__simd/basic_vec.h>
+#include <cuda/std/__simd/math/host_vector_math.h>
 #include <cuda/std/__simd/type_traits.h> // rebind_t
 #include <cuda/std/__type_traits/is_convertible.h>
 #include <cuda/std/__type_traits/is_default_constructible.h>
@@ -100,6 +101,25 @@ _CCCL_CONCEPT __is_simd_math_floating_point_v = _CCCL_REQUIRES_EXPR(
     return _Result{__simd_##_NAME##_generator<_Result, _Vp>{__x}};                      \
   }
 
+// common macro to implement unary function, with the lane parallel implementation of __simd_host_vector_math for host
+// vectors
+#define _CCCL_SIMD_MATH_UNARY_VECTORIZED_FUNCTION(_NAME, _CONSTEXPR)                    \
+  _CCCL_SIMD_MATH_UNARY_GENERATOR(_NAME);                                               \
+                                                                                        \
+  _CCCL_TEMPLATE(typename _Vp, typename _Result = __deduced_vec_t<_Vp>)                 \
+  _CCCL_REQUIRES(__is_simd_math_floating_point_v<_Vp>)                                  \
+  [[nodiscard]] _CCCL_HOST_DEVICE_API _CONSTEXPR _Result _NAME(const _Vp& __x) noexcept \
+  {                                                                                     \
+    if constexpr (__has_simd_host_vector_math_v<_Result>)                               \
+    {                                                                                   \
+      return __simd_host_vector_math<_Result>::__##_NAME(_Result{__x});                 \
+    }                                                                                   \
+    else                                                                                \
+    {                                                                                   \
+      return _Result{__simd_##_NAME##_generator<_Result, _Vp>{__x}};                    \
+    }                                                                                   \
+  }
+
 // common macro to implement (unary) rebind function
 #define _CCCL_SIMD_MATH_UNARY_REBIND_FUNCTION(_NAME, _Tp, _CONSTEXPR)                \
   _CCCL_TEMPLATE(typename _Vp)                                                       \
@@ -251,6 +271,27 @@ inline constexpr bool __is_simd_math_v =
     return __result_t{__simd_##_GENERATOR##_generator<__result_t, __result_t, __result_t>{__x_vec, __y_vec}}; \
   }
 
+// common macro to implement a binary function, with the lane parallel implementation of __simd_host_vector_math for
+// host vectors
+#define _CCCL_SIMD_MATH_BINARY_VECTORIZED_FUNCTION(_NAME, _GENERATOR, _CONSTEXPR)                      \
+  _CCCL_TEMPLATE(typename _Vp0, typename _Vp1)                                                         \
+  _CCCL_REQUIRES(__is_simd_math_v<__simd_math_result_t<_Vp0, _Vp1>, _Vp0, _Vp1>)                       \
+  [[nodiscard]] _CCCL_HOST_DEVICE_API _CONSTEXPR auto _NAME(const _Vp0& __x, const _Vp1& __y) noexcept \
+  {                                                                                                    \
+    using __result_t = __simd_math_result_t<_Vp0, _Vp1>;                                               \
+    const __result_t __x_vec{__x};                                                                     \
+    const __result_t __y_vec{__y};                                                                     \
+    if constexpr (__has_simd_host_vector_math_v<__result_t>)                                           \
+    {                                                                                                  \
+      return __simd_host_vector_math<__result_t>::__##_NAME(__x_vec, __y_vec);                         \
+    }                                                                                                  \
+    else                                                                                               \
+    {                                                                                                  \
+      using __generator_t = __simd_##_GENERATOR##_generator<__result_t, __result_t, __result_t>;       \
+      return __result_t{__generator_t{__x_vec, __y_vec}};                                              \
+    }                                                                                                  \
+  }
+
 //----------------------------------------------------------------------------------------------------------------------
 // ternary macros
 
@@ -33,16 +33,16 @@
 
 _CCCL_BEGIN_NAMESPACE_CUDA_STD_SIMD
 
-_CCCL_SIMD_MATH_UNARY_FUNCTION(exp, )
+_CCCL_SIMD_MATH_UNARY_VECTORIZED_FUNCTION(exp, )
 _CCCL_SIMD_MATH_UNARY_FUNCTION(exp2, )
 _CCCL_SIMD_MATH_UNARY_FUNCTION(expm1, )
-_CCCL_SIMD_MATH_UNARY_FUNCTION(log, )
+_CCCL_SIMD_MATH_UNARY_VECTORIZED_FUNCTION(log, )
 _CCCL_SIMD_MATH_UNARY_FUNCTION(log10, )
 _CCCL_SIMD_MATH_UNARY_FUNCTION(log1p, )
 _CCCL_SIMD_MATH_UNARY_FUNCTION(log2, )
 _CCCL_SIMD_MATH_UNARY_FUNCTION(cbrt, )
-_CCCL_SIMD_MATH_UNARY_FUNCTION(sqrt, )
-_CCCL_SIMD_MATH_UNARY_FUNCTION(erf, )
+_CCCL_SIMD_MATH_UNARY_VECTORIZED_FUNCTION(sqrt, )
+_CCCL_SIMD_MATH_UNARY_VECTORIZED_FUNCTION(erf, )
 _CCCL_SIMD_MATH_UNARY_FUNCTION(erfc, )
 _CCCL_SIMD_MATH_UNARY_FUNCTION(lgamma, )
 _CCCL_SIMD_MATH_UNARY_FUNCTION(tgamma, )
@@ -51,7 +51,7 @@ _CCCL_SIMD_MATH_BINARY_GENERATOR(pow, pow);
 _CCCL_SIMD_MATH_BINARY_GENERATOR(hypot, hypot_two_args);
 _CCCL_SIMD_MATH_TERNARY_GENERATOR(hypot, hypot_three_args);
 
-_CCCL_SIMD_MATH_BINARY_FUNCTION(pow, pow, )
+_CCCL_SIMD_MATH_BINARY_VECTORIZED_FUNCTION(pow, pow, )
 _CCCL_SIMD_MATH_BINARY_FUNCTION(hypot, hypot_two_args, )
 _CCCL_SIMD_MATH_TERNARY_FUNCTION(hypot, hypot_three_args, )
 
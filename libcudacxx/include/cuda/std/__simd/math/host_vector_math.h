@@ -0,0 +1,937 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___SIMD_MATH_HOST_VECTOR_MATH_H
+#define _CUDA_STD___SIMD_MATH_HOST_VECTOR_MATH_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__cmath/error_functions.h>
+#include <cuda/std/__cmath/exponential_functions.h>
+#include <cuda/std/__cmath/hyperbolic_functions.h>
+#include <cuda/std/__cmath/logarithms.h>
+#include <cuda/std/__cmath/trigonometric_functions.h>
+#include <cuda/std/__limits/numeric_limits.h>
+#include <cuda/std/__simd/basic_vec.h>
+#include <cuda/std/__simd/specializations/fixed_size_host_vec.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/__type_traits/remove_cv.h>
+#include <cuda/std/__type_traits/remove_cvref.h>
+#include <cuda/std/__utility/declval.h>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_SIMD
+
+// Whether the math functions of the vector type _Vp have lane parallel implementations in __simd_host_vector_math
+template <typename _Vp>
+inline constexpr bool __has_simd_host_vector_math_v = false;
+
+template <typename _Vp>
+struct __simd_host_vector_math;
+
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+
+// Lane parallel implementations of exp, log, sqrt, sin, cos, tanh, erf and pow for float and double vectors in host
+// vector registers. They follow the scalar implementations of fdlibm, musl and Cephes: the argument is reduced with
+// integer operations on the bits of the lanes, the branches of the scalar implementation are computed for all lanes,
+// and the right one is selected per lane. Lanes whose argument is outside of the range of the reduction, such as the
+// sine of a huge number or a power of a negative number, are computed by the scalar function.
+//
+// The float versions of sin, cos, tanh and pow are evaluated in double and rounded once to float. The errors of
+// the results that are normal numbers, measured against a reference in higher precision, are at most
+//
+//   function | float   | double
+//   ---------+---------+--------
+//   exp      | 1 ulp   | 1 ulp
+//   log      | 1 ulp   | 1 ulp
+//   sqrt     | 0.5 ulp | 0.5 ulp
+//   sin, cos | 1 ulp   | 1 ulp
+//   tanh     | 1 ulp   | 2 ulp
+//   erf      | 1 ulp   | 1 ulp
+//   pow      | 1 ulp   | 1 ulp
+//
+// The functions assume rounding to nearest and do not set errno or the floating point exceptions.
+
+template <typename _Vec>
+using __host_vector_element_t = remove_cvref_t<decltype(::cuda::std::declval<_Vec>()[0])>;
+
+// The vector of signed integers of the width of the lanes, which is the type of the comparisons of two _Vec
+template <typename _Vec>
+using __host_vector_int_t = decltype(::cuda::std::declval<_Vec>() < ::cuda::std::declval<_Vec>());
+
+template <typename _Tp>
+struct __host_vector_math_constants;
+
+template <>
+struct __host_vector_math_constants<float>
+{
+  static constexpr int __mantissa_bits = 23;
+  static constexpr int __exponent_bias = 127;
+
+  // exp, from musl
+  static constexpr float __exp_overflow  = 88.72283172607421875f;
+  static constexpr float __exp_underflow = -103.97208404541015625f;
+  static constexpr float __inv_ln2       = 1.4426950216e+00f;
+  static constexpr float __ln2_hi        = 6.9314575195e-01f;
+  static constexpr float __ln2_lo        = 1.4286067653e-06f;
+
+  // log, from musl
+  static constexpr int __log_subnormal_shift = 25;
+  static constexpr int __one_bits            = 0x3f800000;
+  static constexpr int __sqrt_half_bits      = 0x3f3504f3;
+  static constexpr float __log_ln2_hi        = 6.9313812256e-01f;
+  static constexpr float __log_ln2_lo        = 9.0580006145e-06f;
+};
+
+template <>
+struct __host_vector_math_constants<double>
+{
+  static constexpr int __mantissa_bits = 52;
+  static constexpr int __exponent_bias = 1023;
+
+  // exp, from fdlibm
+  static constexpr double __exp_overflow  = 7.09782712893383973096e+02;
+  static constexpr double __exp_underflow = -7.45133219101941108420e+02;
+  static constexpr double __inv_ln2       = 1.44269504088896338700e+00;
+  static constexpr double __ln2_hi        = 6.93147180369123816490e-01;
+  static constexpr double __ln2_lo        = 1.90821492927058770002e-10;
+
+  // log, from fdlibm, where only the high 32 bits of the bits of sqrt(1/2) take part in the reduction
+  static constexpr int __log_subnormal_shift     = 54;
+  static constexpr long long __one_bits          = 0x3ff0000000000000;
+  static constexpr long long __sqrt_half_bits    = 0x3fe6a09e00000000;
+  static constexpr double __log_ln2_hi           = 6.93147180369123816490e-01;
+  static constexpr double __log_ln2_lo           = 1.90821492927058770002e-10;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+// helpers
+
+template <typename _Vec>
+[[nodiscard]] _CCCL_HOST_API bool __host_vector_any_of(const _Vec __mask) noexcept
+{
+  constexpr size_t __num_words = sizeof(_Vec) / sizeof(unsigned long long);
+  unsigned long long __words[__num_words];
+  __builtin_memcpy(__words, &__mask, sizeof(_Vec));
+  unsigned long long __any = 0;
+  for (size_t __i = 0; __i < __num_words; ++__i)
+  {
+    __any |= __words[__i];
+  }
+  return __any != 0;
+}
+
+// Rounds to the nearest integer, ties to even, for |x| < 2^(mantissa bits - 1)
+template <typename _Vec>
+[[nodiscard]] _CCCL_HOST_API _Vec __host_vector_round(const _Vec __x) noexcept
+{
+  using _Tp               = __host_vector_element_t<_Vec>;
+  constexpr _Tp __shifter = _Tp(1.5) * _Tp(1ull << __host_vector_math_constants<_Tp>::__mantissa_bits);
+  return (__x + __shifter) - __shifter;
+}
+
+// 2^k for the integers k in [1 - bias, bias]
+template <typename _Vec>
+[[nodiscard]] _CCCL_HOST_API _Vec __host_vector_exp2i(const __host_vector_int_t<_Vec> __k) noexcept
+{
+  using _Cp = __host_vector_math_constants<__host_vector_element_t<_Vec>>;
+  return (_Vec) ((__k + _Cp::__exponent_bias) << _Cp::__mantissa_bits);
+}
+
+// x * 2^k for the integers k in [2 * (1 - bias), 2 * bias], in two steps that stay in the range of 2^k
+template <typename _Vec>
+[[nodiscard]] _CCCL_HOST_API _Vec __host_vector_scale(const _Vec __x, const __host_vector_int_t<_Vec> __k) noexcept
+{
+  const __host_vector_int_t<_Vec> __k1 = __k >> 1;
+  return __x * ::cuda::std::simd::__host_vector_exp2i<_Vec>(__k1)
+       * ::cuda::std::simd::__host_vector_exp2i<_Vec>(__k - __k1);
+}
+
+template <typename _Vec>
+[[nodiscard]] _CCCL_HOST_API __host_vector_int_t<_Vec> __host_vector_sign_mask() noexcept
+{
+  using _IVec = __host_vector_int_t<_Vec>;
+  return _IVec{} + numeric_limits<__host_vector_element_t<_IVec>>::min();
+}
+
+template <typename _Vec>
+[[nodiscard]] _CCCL_HOST_API _Vec __host_vector_abs(const _Vec __x) noexcept
+{
+  using _IVec = __host_vector_int_t<_Vec>;
+  return (_Vec) ((_IVec) __x & ~::cuda::std::simd::__host_vector_sign_mask<_Vec>());
+}
+
+// The magnitudes of the lanes of x with the signs of the lanes of s
+template <typename _Vec>
+[[nodiscard]] _CCCL_HOST_API _Vec __host_vector_copysign(const _Vec __x, const _Vec __s) noexcept
+{
+  using _IVec        = __host_vector_int_t<_Vec>;
+  const _IVec __sign = ::cuda::std::simd::__host_vector_sign_mask<_Vec>();
+  return (_Vec) (((_IVec) __x & ~__sign) | ((_IVec) __s & __sign));
+}
+
+// The lanes of the half h of the float vector x, converted to a double vector of the width of x
+template <typename _Vec>
+[[nodiscard]] _CCCL_HOST_API __host_vector_t<double, sizeof(_Vec)>
+__host_vector_double_half(const _Vec __x, const int __h) noexcept
+{
+  __host_vector_t<float, sizeof(_Vec) / 2> __half;
+  __builtin_memcpy(&__half, reinterpret_cast<const char*>(&__x) + __h * sizeof(__half), sizeof(__half));
+  return __builtin_convertvector(__half, __host_vector_t<double, sizeof(_Vec)>);
+}
+
+// Evaluates the function fn of double vectors for the float vectors x... in two halves, so that the double vectors
+// have the width of a float vector, and rounds the results once to float
+template <typename _Vec, typename _Fn, typename... _Vecs>
+[[nodiscard]] _CCCL_HOST_API _Vec __host_vector_in_double(_Fn __fn, const _Vec __x, const _Vecs... __xs) noexcept
+{
+  using _Half = __host_vector_t<float, sizeof(_Vec) / 2>;
+  _Half __halves[2];
+  for (int __h = 0; __h < 2; ++__h)
+  {
+    __halves[__h] = __builtin_convertvector(
+      __fn(::cuda::std::simd::__host_vector_double_half(__x, __h),
+           ::cuda::std::simd::__host_vector_double_half(__xs, __h)...),
+      _Half);
+  }
+  _Vec __r;
+  __builtin_memcpy(&__r, __halves, sizeof(_Vec));
+  return __r;
+}
+
+// Recomputes the lanes of r where the mask is set with the scalar function fn of the lanes of the arguments
+template <typename _Vec, typename _Fn, typename... _Args>
+[[nodiscard]] _CCCL_HOST_API _Vec __host_vector_fallback(
+  _Vec __r, const __host_vector_int_t<_Vec> __mask, _Fn __fn, const _Args... __args) noexcept
+{
+  if (::cuda::std::simd::__host_vector_any_of(__mask))
+  {
+    constexpr size_t __lanes = sizeof(_Vec) / sizeof(__host_vector_element_t<_Vec>);
+    for (size_t __i = 0; __i < __lanes; ++__i)
+    {
+      if (__mask[__i])
+      {
+        __r[__i] = __fn(__args[__i]...);
+      }
+    }
+  }
+  return __r;
+}
+
+// The product a * b of double vectors as p + e, exactly, with the algorithm of Dekker. The factors are split by
+// clearing the low 27 bits of their mantissas, so that every partial product is exact even if it is contracted into
+// a fused multiply add
+template <typename _Vec>
+_CCCL_HOST_API void __host_vector_two_product(const _Vec __a, const _Vec __b, _Vec& __p, _Vec& __e) noexcept
+{
+  using _IVec                  = __host_vector_int_t<_Vec>;
+  constexpr long long __hi_bits = static_cast<long long>(0xfffffffff8000000ull);
+  const _Vec __a_hi            = (_Vec) ((_IVec) __a & __hi_bits);
+  const _Vec __a_lo            = __a - __a_hi;
+  const _Vec __b_hi            = (_Vec) ((_IVec) __b & __hi_bits);
+  const _Vec __b_lo            = __b - __b_hi;
+  __p                          = __a * __b;
+  __e = (((__a_hi * __b_hi - __p) + __a_hi * __b_lo) + __a_lo * __b_hi) + __a_lo * __b_lo;
+}
+
+// The sum a + b as s + e, exactly
+template <typename _Vec>
+_CCCL_HOST_API void __host_vector_two_sum(const _Vec __a, const _Vec __b, _Vec& __s, _Vec& __e) noexcept
+{
+  __s                = __a + __b;
+  const _Vec __b_sum = __s - __a;
+  __e                = (__a - (__s - __b_sum)) + (__b - __b_sum);
+}
+
+// c0 + c1 x + c2 x^2 + ..., with the scheme of Horner
+template <typename _Vec, typename... _Coefficients>
+[[nodiscard]] _CCCL_HOST_API _Vec __host_vector_polynomial(
+  const _Vec __x, const __host_vector_element_t<_Vec> __c0, const _Coefficients... __cs) noexcept
+{
+  if constexpr (sizeof...(_Coefficients) == 0)
+  {
+    return _Vec{} + __c0;
+  }
+  else
+  {
+    return __c0 + __x * ::cuda::std::simd::__host_vector_polynomial(__x, __cs...);
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// sqrt
+
+template <typename _Vec>
+[[nodiscard]] _CCCL_HOST_API _Vec __host_vector_sqrt(const _Vec __x) noexcept
+{
+#  if _CCCL_HAS_BUILTIN(__builtin_elementwise_sqrt)
+  return __builtin_elementwise_sqrt(__x);
+#  else // ^^^ has __builtin_elementwise_sqrt ^^^ / vvv no __builtin_elementwise_sqrt vvv
+  constexpr bool __is_float = is_same_v<__host_vector_element_t<_Vec>, float>;
+  if constexpr (sizeof(_Vec) == 16)
+  {
+    if constexpr (__is_float)
+    {
+      return __builtin_ia32_sqrtps(__x);
+    }
+    else
+    {
+      return __builtin_ia32_sqrtpd(__x);
+    }
+  }
+#    if _CCCL_SIMD_HOST_VECTOR_BYTES >= 32
+  else if constexpr (sizeof(_Vec) == 32)
+  {
+    if constexpr (__is_float)
+    {
+      return __builtin_ia32_sqrtps256(__x);
+    }
+    else
+    {
+      return __builtin_ia32_sqrtpd256(__x);
+    }
+  }
+#    endif // _CCCL_SIMD_HOST_VECTOR_BYTES >= 32
+  else
+  {
+    // The square roots of the halves, where the masked 512 bit builtins have no portable spelling
+    using _Half = __host_vector_t<__host_vector_element_t<_Vec>, sizeof(_Vec) / 2>;
+    _Half __halves[2];
+    __builtin_memcpy(__halves, &__x, sizeof(_Vec));
+    __halves[0] = ::cuda::std::simd::__host_vector_sqrt(__halves[0]);
+    __halves[1] = ::cuda::std::simd::__host_vector_sqrt(__halves[1]);
+    _Vec __r;
+    __builtin_memcpy(&__r, __halves, sizeof(_Vec));
+    return __r;
+  }
+#  endif // no __builtin_elementwise_sqrt
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// exp
+
+// e^(hi - lo) for the reduced argument hi - lo in [-ln(2) / 2, ln(2) / 2], with the rational approximation of fdlibm
+template <typename _Vec>
+[[nodiscard]] _CCCL_HOST_API _Vec __host_vector_exp_reduced(const _Vec __hi, const _Vec __lo) noexcept
+{
+  using _Tp      = __host_vector_element_t<_Vec>;
+  const _Vec __r = __hi - __lo;
+  const _Vec __z = __r * __r;
+  _Vec __c;
+  if constexpr (is_same_v<_Tp, float>)
+  {
+    __c = __r - __z * ::cuda::std::simd::__host_vector_polynomial(__z, 1.6666625440e-1f, -2.7667332906e-3f);
+  }
+  else
+  {
+    __c = __r
+        - __z
+            * ::cuda::std::simd::__host_vector_polynomial(
+              __z,
+              1.66666666666666019037e-01,
+              -2.77777777770155933842e-03,
+              6.61375632143793436117e-05,
+              -1.65339022054652515390e-06,
+              4.13813679705723846039e-08);
+  }
+  return _Tp(1) - ((__lo - (__r * __c) / (_Tp(2) - __c)) - __hi);
+}
+
+// e^(hi + lo) for hi in the range of the exponential, where lo is much smaller than hi
+template <typename _Vec>
+[[nodiscard]] _CCCL_HOST_API _Vec __host_vector_exp_extended(const _Vec __hi, const _Vec __lo) noexcept
+{
+  using _Tp   = __host_vector_element_t<_Vec>;
+  using _IVec = __host_vector_int_t<_Vec>;
+  using _Cp   = __host_vector_math_constants<_Tp>;
+  // The lanes out of range are computed as e^0, so that no subnormal intermediate slows them down, and replaced below
+  const _Vec __overflow  = _Vec{} + _Cp::__exp_overflow;
+  const _Vec __underflow = _Vec{} + _Cp::__exp_underflow;
+  const _Vec __xc        = ((__hi > __overflow) | (__hi < __underflow)) ? _Vec{} : __hi;
+  const _Vec __k         = ::cuda::std::simd::__host_vector_round(__xc * _Cp::__inv_ln2);
+  const _Vec __y =
+    ::cuda::std::simd::__host_vector_exp_reduced(__xc - __k * _Cp::__ln2_hi, __k * _Cp::__ln2_lo - __lo);
+  _Vec __r = ::cuda::std::simd::__host_vector_scale(__y, __builtin_convertvector(__k, _IVec));
+  __r      = (__hi > __overflow) ? _Vec{} + numeric_limits<_Tp>::infinity() : __r;
+  return (__hi < __underflow) ? _Vec{} : __r;
+}
+
+template <typename _Vec>
+[[nodiscard]] _CCCL_HOST_API _Vec __host_vector_exp(const _Vec __x) noexcept
+{
+  return ::cuda::std::simd::__host_vector_exp_extended(__x, _Vec{});
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// log
+
+// Reduces positive finite x to 2^k * m with m in [sqrt(1/2), sqrt(2))
+template <typename _Vec>
+_CCCL_HOST_API void
+__host_vector_log_reduce(const _Vec __x, _Vec& __m, __host_vector_int_t<_Vec>& __k) noexcept
+{
+  using _Tp   = __host_vector_element_t<_Vec>;
+  using _IVec = __host_vector_int_t<_Vec>;
+  using _Cp   = __host_vector_math_constants<_Tp>;
+  // Scale the subnormal lanes to normal numbers
+  using _Ip               = remove_cv_t<decltype(_Cp::__one_bits)>;
+  const _IVec __subnormal = __x < numeric_limits<_Tp>::min();
+  const _Vec __xs         = __subnormal ? __x * _Tp(_Ip{1} << _Cp::__log_subnormal_shift) : __x;
+  _IVec __ix              = (_IVec) __xs + (_Cp::__one_bits - _Cp::__sqrt_half_bits);
+  __k  = (__subnormal & -_Cp::__log_subnormal_shift) + (__ix >> _Cp::__mantissa_bits) - _Cp::__exponent_bias;
+  __ix = (__ix & ((_Ip{1} << _Cp::__mantissa_bits) - 1)) + _Cp::__sqrt_half_bits;
+  __m  = (_Vec) __ix;
+}
+
+template <typename _Vec>
+[[nodiscard]] _CCCL_HOST_API _Vec __host_vector_log(const _Vec __x) noexcept
+{
+  using _Tp   = __host_vector_element_t<_Vec>;
+  using _IVec = __host_vector_int_t<_Vec>;
+  using _Cp   = __host_vector_math_constants<_Tp>;
+  _Vec __m;
+  _IVec __k;
+  ::cuda::std::simd::__host_vector_log_reduce(__x, __m, __k);
+  // log(1 + f) = f - f^2 / 2 + s * (f^2 / 2 + R(s^2)) with s = f / (2 + f), from fdlibm
+  const _Vec __f    = __m - _Tp(1);
+  const _Vec __hfsq = _Tp(0.5) * __f * __f;
+  const _Vec __s    = __f / (_Tp(2) + __f);
+  const _Vec __z    = __s * __s;
+  const _Vec __w    = __z * __z;
+  _Vec __rs;
+  if constexpr (is_same_v<_Tp, float>)
+  {
+    __rs = __z * ::cuda::std::simd::__host_vector_polynomial(__w, 0.66666662693f, 0.28498786688f)
+         + __w * ::cuda::std::simd::__host_vector_polynomial(__w, 0.40000972152f, 0.24279078841f);
+  }
+  else
+  {
+    const _Vec __t1 = ::cuda::std::simd::__host_vector_polynomial(
+      __w, 6.666666666666735130e-01, 2.857142874366239149e-01, 1.818357216161805012e-01, 1.479819860511658591e-01);
+    const _Vec __t2 = ::cuda::std::simd::__host_vector_polynomial(
+      __w, 3.999999999940941908e-01, 2.222219843214978396e-01, 1.531383769920937332e-01);
+    __rs = __z * __t1 + __w * __t2;
+  }
+  const _Vec __dk = __builtin_convertvector(__k, _Vec);
+  _Vec __r        = __s * (__hfsq + __rs) + __dk * _Cp::__log_ln2_lo - __hfsq + __f + __dk * _Cp::__log_ln2_hi;
+  // log(inf) = inf, log(NaN) = NaN, log(0) = -inf and log(x) = NaN for x < 0
+  __r = (__x < numeric_limits<_Tp>::infinity()) ? __r : __x;
+  __r = (__x == _Tp(0)) ? _Vec{} - numeric_limits<_Tp>::infinity() : __r;
+  return (__x < _Tp(0)) ? _Vec{} + numeric_limits<_Tp>::quiet_NaN() : __r;
+}
+
+// log(x) as hi + lo with a relative error below 2^-67 for positive finite double x, for pow
+template <typename _Vec>
+_CCCL_HOST_API void __host_vector_log_extended(const _Vec __x, _Vec& __hi, _Vec& __lo) noexcept
+{
+  using _IVec = __host_vector_int_t<_Vec>;
+  using _Cp   = __host_vector_math_constants<double>;
+  _Vec __m;
+  _IVec __k;
+  ::cuda::std::simd::__host_vector_log_reduce(__x, __m, __k);
+  // s = (m - 1) / (m + 1) as s_hi + s_lo, where m - 1 is exact
+  const _Vec __num = __m - 1.0;
+  _Vec __den;
+  _Vec __den_lo;
+  ::cuda::std::simd::__host_vector_two_sum(__m, _Vec{} + 1.0, __den, __den_lo);
+  const _Vec __s_hi = __num / __den;
+  _Vec __p;
+  _Vec __p_lo;
+  ::cuda::std::simd::__host_vector_two_product(__s_hi, __den, __p, __p_lo);
+  const _Vec __s_lo = (((__num - __p) - __p_lo) - __s_hi * __den_lo) / __den;
+  // log(m) = 2 atanh(s) = 2 s + s^3 t with t = 2 / 3 + 2 z / 5 + 2 z^2 / 7 + ... and z = s^2 < 0.0295. The tail s^3 t
+  // reaches a hundredth of log(m), so it is carried with its leading terms as double-double, too.
+  _Vec __z;
+  _Vec __z_lo;
+  ::cuda::std::simd::__host_vector_two_product(__s_hi, __s_hi, __z, __z_lo);
+  __z_lo += 2.0 * __s_hi * __s_lo;
+  const _Vec __q = __z * __z
+                 * ::cuda::std::simd::__host_vector_polynomial(
+                   __z,
+                   2.0 / 7,
+                   2.0 / 9,
+                   2.0 / 11,
+                   2.0 / 13,
+                   2.0 / 15,
+                   2.0 / 17,
+                   2.0 / 19,
+                   2.0 / 21,
+                   2.0 / 23,
+                   2.0 / 25,
+                   2.0 / 27,
+                   2.0 / 29);
+  // t as double-double, where the low parts of 2 / 5 and 2 / 3 are the errors of rounding them to double
+  _Vec __c;
+  _Vec __c_lo;
+  ::cuda::std::simd::__host_vector_two_product(_Vec{} + 0.4, __z, __c, __c_lo);
+  __c_lo += 0.4 * __z_lo - 2.2204460492503132e-17 * __z;
+  _Vec __u;
+  _Vec __u_lo;
+  ::cuda::std::simd::__host_vector_two_sum(__c, __q, __u, __u_lo);
+  _Vec __t;
+  _Vec __t_lo;
+  ::cuda::std::simd::__host_vector_two_sum(_Vec{} + 2.0 / 3, __u, __t, __t_lo);
+  __t_lo += (__u_lo + __c_lo) + 3.700743415417188e-17;
+  // s^3 t
+  _Vec __sz;
+  _Vec __sz_lo;
+  ::cuda::std::simd::__host_vector_two_product(__s_hi, __z, __sz, __sz_lo);
+  __sz_lo += __s_hi * __z_lo + __s_lo * __z;
+  _Vec __tail;
+  _Vec __tail_lo;
+  ::cuda::std::simd::__host_vector_two_product(__sz, __t, __tail, __tail_lo);
+  __tail_lo += __sz * __t_lo + __sz_lo * __t;
+  // k ln(2) + 2 s + s^3 t, where k * ln2_hi is exact
+  const _Vec __dk = __builtin_convertvector(__k, _Vec);
+  _Vec __sum;
+  _Vec __sum_lo;
+  ::cuda::std::simd::__host_vector_two_sum(__dk * _Cp::__ln2_hi, 2.0 * __s_hi, __sum, __sum_lo);
+  _Vec __sum_tail_lo;
+  ::cuda::std::simd::__host_vector_two_sum(__sum, __tail, __sum, __sum_tail_lo);
+  const _Vec __rest = (__sum_lo + __sum_tail_lo) + ((__dk * _Cp::__ln2_lo + 2.0 * __s_lo) + __tail_lo);
+  __hi              = __sum + __rest;
+  __lo              = __rest - (__hi - __sum);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// pow
+
+template <typename _Vec>
+[[nodiscard]] _CCCL_HOST_API _Vec __host_vector_pow(const _Vec __x, const _Vec __y) noexcept
+{
+  using _Tp   = __host_vector_element_t<_Vec>;
+  using _IVec = __host_vector_int_t<_Vec>;
+  _Vec __r;
+  if constexpr (is_same_v<_Tp, float>)
+  {
+    // y log(x) in double is accurate enough for the float result
+    __r = ::cuda::std::simd::__host_vector_in_double(
+      [](const auto __xd, const auto __yd) {
+        return ::cuda::std::simd::__host_vector_exp(__yd * ::cuda::std::simd::__host_vector_log(__xd));
+      },
+      __x,
+      __y);
+  }
+  else
+  {
+    // e^(y log(x)) with y log(x) as hi + lo
+    _Vec __log_hi;
+    _Vec __log_lo;
+    ::cuda::std::simd::__host_vector_log_extended(__x, __log_hi, __log_lo);
+    _Vec __hi;
+    _Vec __lo;
+    ::cuda::std::simd::__host_vector_two_product(__y, __log_hi, __hi, __lo);
+    __r = ::cuda::std::simd::__host_vector_exp_extended(__hi, __lo + __y * __log_lo);
+  }
+  // Negative, zero, infinite and NaN bases and infinite and NaN exponents
+  const _IVec __special = ~((__x > _Tp(0)) & (__x < numeric_limits<_Tp>::infinity())
+                            & (::cuda::std::simd::__host_vector_abs(__y) < numeric_limits<_Tp>::infinity()));
+  return ::cuda::std::simd::__host_vector_fallback(
+    __r,
+    __special,
+    [](const _Tp __a, const _Tp __b) {
+      return ::cuda::std::pow(__a, __b);
+    },
+    __x,
+    __y);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// sin and cos
+
+// sin(x + y) for |x + y| <= pi / 4, with the polynomial of fdlibm
+template <typename _Vec>
+[[nodiscard]] _CCCL_HOST_API _Vec __host_vector_sin_kernel(const _Vec __x, const _Vec __y) noexcept
+{
+  const _Vec __z = __x * __x;
+  const _Vec __w = __z * __z;
+  const _Vec __r =
+    ::cuda::std::simd::__host_vector_polynomial(
+      __z, 8.33333333332248946124e-03, -1.98412698298579493134e-04, 2.75573137070700676789e-06)
+    + __z * __w
+        * ::cuda::std::simd::__host_vector_polynomial(__z, -2.50507602534068634195e-08, 1.58969099521155010221e-10);
+  const _Vec __v = __z * __x;
+  return __x - ((__z * (0.5 * __y - __v * __r) - __y) - __v * -1.66666666666666324348e-01);
+}
+
+// cos(x + y) for |x + y| <= pi / 4, with the polynomial of fdlibm
+template <typename _Vec>
+[[nodiscard]] _CCCL_HOST_API _Vec __host_vector_cos_kernel(const _Vec __x, const _Vec __y) noexcept
+{
+  const _Vec __z = __x * __x;
+  const _Vec __w = __z * __z;
+  const _Vec __r =
+    __z
+      * ::cuda::std::simd::__host_vector_polynomial(
+        __z, 4.16666666666666019037e-02, -1.38888888888741095749e-03, 2.48015872894767294178e-05)
+    + __w * __w
+        * ::cuda::std::simd::__host_vector_polynomial(
+          __z, -2.75573143513906633035e-07, 2.08757232129817482790e-09, -1.13596475577881948265e-11);
+  const _Vec __hz = 0.5 * __z;
+  const _Vec __v  = 1.0 - __hz;
+  return __v + (((1.0 - __v) - __hz) + (__z * __r - __x * __y));
+}
+
+// sin(x) and cos(x) for |x| <= pi / 4 in the double precision polynomials of musl for float
+template <typename _Vec>
+[[nodiscard]] _CCCL_HOST_API _Vec __host_vector_sin_kernel_float(const _Vec __x) noexcept
+{
+  const _Vec __z = __x * __x;
+  const _Vec __w = __z * __z;
+  const _Vec __r = -0.000198393348360966317347 + __z * 0.0000027183114939898219064;
+  const _Vec __s = __z * __x;
+  return (__x + __s * (-0.166666666416265235595 + __z * 0.0083333293858894631756)) + __s * __w * __r;
+}
+
+template <typename _Vec>
+[[nodiscard]] _CCCL_HOST_API _Vec __host_vector_cos_kernel_float(const _Vec __x) noexcept
+{
+  const _Vec __z = __x * __x;
+  const _Vec __w = __z * __z;
+  const _Vec __r = -0.00138867637746099294692 + __z * 0.0000243904487962774090654;
+  return ((1.0 + __z * -0.499999997251031003120) + __w * 0.0416666233237390631894) + (__w * __z) * __r;
+}
+
+// x - n pi / 2 as y0 + y1 for |x| < 2^20 pi / 2 and the nearest integer n to x / (pi / 2), with the medium case of
+// fdlibm. The second and the third round are only taken by the lanes where the previous one cancels more than 16 and
+// 49 bits.
+template <typename _Vec>
+_CCCL_HOST_API void __host_vector_rem_pio2(const _Vec __x, const _Vec __n, _Vec& __y0, _Vec& __y1) noexcept
+{
+  using _IVec          = __host_vector_int_t<_Vec>;
+  const _IVec __ex     = ((_IVec) __x >> 52) & 0x7ff;
+  _Vec __r             = __x - __n * 1.57079632673412561417e+00;
+  _Vec __w             = __n * 6.07710050650619224932e-11;
+  _Vec __t             = __r;
+  _Vec __w_next        = __n * 6.07710050630396597660e-11;
+  _Vec __r_next        = __t - __w_next;
+  __w_next             = __n * 2.02226624879595063154e-21 - ((__t - __r_next) - __w_next);
+  const _IVec __second = (__ex - (((_IVec) (__r - __w) >> 52) & 0x7ff)) > 16;
+  __r                  = __second ? __r_next : __r;
+  __w                  = __second ? __w_next : __w;
+  __t                  = __r;
+  __w_next             = __n * 2.02226624871116645580e-21;
+  __r_next             = __t - __w_next;
+  __w_next             = __n * 8.47842766036889956997e-32 - ((__t - __r_next) - __w_next);
+  const _IVec __third  = __second & ((__ex - (((_IVec) (__r - __w) >> 52) & 0x7ff)) > 49);
+  __r                  = __third ? __r_next : __r;
+  __w                  = __third ? __w_next : __w;
+  __y0                 = __r - __w;
+  __y1                 = (__r - __y0) - __w;
+}
+
+// sin(x) or cos(x) of a double vector, as selected by _IsCos, from the reduction of x to [-pi / 4, pi / 4] and the
+// quadrant, with the kernels of musl for float if _FloatKernels is set. The reductions are exact for |x| up to
+// 2^20 pi / 2 for double, and up to 2^28 pi / 2 for the arguments converted from float.
+template <bool _IsCos, bool _FloatKernels, typename _Vec>
+[[nodiscard]] _CCCL_HOST_API _Vec __host_vector_sin_cos_reduced(const _Vec __x) noexcept
+{
+  using _IVec     = __host_vector_int_t<_Vec>;
+  const _Vec __fn = ::cuda::std::simd::__host_vector_round(__x * 6.36619772367581382433e-01);
+  const _IVec __n = __builtin_convertvector(__fn, _IVec);
+  _Vec __sin;
+  _Vec __cos;
+  if constexpr (_FloatKernels)
+  {
+    const _Vec __y = (__x - __fn * 1.57079631090164184570e+00) - __fn * 1.58932547735281966916e-08;
+    __sin          = ::cuda::std::simd::__host_vector_sin_kernel_float(__y);
+    __cos          = ::cuda::std::simd::__host_vector_cos_kernel_float(__y);
+  }
+  else
+  {
+    _Vec __y0;
+    _Vec __y1;
+    ::cuda::std::simd::__host_vector_rem_pio2(__x, __fn, __y0, __y1);
+    __sin = ::cuda::std::simd::__host_vector_sin_kernel(__y0, __y1);
+    __cos = ::cuda::std::simd::__host_vector_cos_kernel(__y0, __y1);
+  }
+  // sin is sin, cos, -sin, -cos and cos is cos, -sin, -cos, sin in the quadrants n mod 4
+  const _IVec __q = __n + (_IsCos ? 1 : 0);
+  const _Vec __r  = ((__q & 1) != 0) ? __cos : __sin;
+  return ((__q & 2) != 0) ? -__r : __r;
+}
+
+template <bool _IsCos, typename _Vec>
+[[nodiscard]] _CCCL_HOST_API _Vec __host_vector_sin_cos(const _Vec __x) noexcept
+{
+  using _Tp = __host_vector_element_t<_Vec>;
+  _Vec __r;
+  if constexpr (is_same_v<_Tp, float>)
+  {
+    __r = ::cuda::std::simd::__host_vector_in_double(
+      [](const auto __xd) {
+        return ::cuda::std::simd::__host_vector_sin_cos_reduced<_IsCos, true>(__xd);
+      },
+      __x);
+  }
+  else
+  {
+    __r = ::cuda::std::simd::__host_vector_sin_cos_reduced<_IsCos, false>(__x);
+  }
+  if constexpr (!_IsCos)
+  {
+    __r = (__x == _Tp(0)) ? __x : __r;
+  }
+  constexpr _Tp __limit = is_same_v<_Tp, float> ? _Tp(268435456.0) : _Tp(1647099.0);
+  return ::cuda::std::simd::__host_vector_fallback(
+    __r,
+    ~(::cuda::std::simd::__host_vector_abs(__x) < __limit),
+    [](const _Tp __a) {
+      return _IsCos ? ::cuda::std::cos(__a) : ::cuda::std::sin(__a);
+    },
+    __x);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// tanh
+
+template <typename _Vec>
+[[nodiscard]] _CCCL_HOST_API _Vec __host_vector_tanh(const _Vec __x) noexcept
+{
+  if constexpr (is_same_v<__host_vector_element_t<_Vec>, float>)
+  {
+    return ::cuda::std::simd::__host_vector_in_double(
+      [](const auto __xd) {
+        return ::cuda::std::simd::__host_vector_tanh(__xd);
+      },
+      __x);
+  }
+  else
+  {
+    const _Vec __ax = ::cuda::std::simd::__host_vector_abs(__x);
+    // x + x^3 P(x^2) / Q(x^2) for |x| < 0.625, from Cephes
+    const _Vec __z     = __x * __x;
+    const _Vec __p =
+      ::cuda::std::simd::__host_vector_polynomial(
+        __z, -1.61468768441708447952e3, -9.92877231001918586564e1, -9.64399179425052238628e-1);
+    const _Vec __q = ::cuda::std::simd::__host_vector_polynomial(
+      __z, 4.84406305325125486048e3, 2.23548839060100448583e3, 1.12811678491632931402e2, 1.0);
+    const _Vec __small = __x + __x * __z * __p / __q;
+    // 1 - 2 / (e^(2 |x|) + 1) otherwise, which is 1 when the exponential overflows
+    const _Vec __large = ::cuda::std::simd::__host_vector_copysign(
+      1.0 - 2.0 / (::cuda::std::simd::__host_vector_exp(2.0 * __ax) + 1.0), __x);
+    const _Vec __r = (__ax < 0.625) ? __small : __large;
+    return (__x == 0.0) ? __x : __r;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// erf
+
+// The rational approximations of fdlibm on [0, 0.84375), [0.84375, 1.25), [1.25, 1 / 0.35) and [1 / 0.35, 6), which
+// are evaluated only if a lane is in their interval. Float vectors use the coefficients rounded to float, as musl does
+template <typename _Vec>
+[[nodiscard]] _CCCL_HOST_API _Vec __host_vector_erf(const _Vec __x) noexcept
+{
+  using _Tp       = __host_vector_element_t<_Vec>;
+  using _IVec     = __host_vector_int_t<_Vec>;
+  const _Vec __ax = ::cuda::std::simd::__host_vector_abs(__x);
+  const _Vec __r  = ::cuda::std::simd::__host_vector_copysign(_Vec{} + _Tp(1), __x);
+  _Vec __erf      = (__x != __x) ? __x : __r;
+
+  const _IVec __is_tail = (__ax >= _Tp(1.25)) & (__ax < _Tp(6));
+  if (::cuda::std::simd::__host_vector_any_of(__is_tail))
+  {
+    // The lanes out of the tail are evaluated at 2, where the exponentials stay normal
+    const _Vec __at    = __is_tail ? __ax : _Vec{} + _Tp(2);
+    const _Vec __t     = _Tp(1) / (__at * __at);
+    const _IVec __near = __at < _Tp(1.0 / 0.35);
+    _Vec __rs          = _Vec{};
+    _Vec __ss          = _Vec{} + _Tp(1);
+    if (::cuda::std::simd::__host_vector_any_of(__is_tail & __near))
+    {
+      __rs = ::cuda::std::simd::__host_vector_polynomial(
+        __t,
+        -9.86494403484714822705e-03,
+        -6.93858572707181764372e-01,
+        -1.05586262253232909814e+01,
+        -6.23753324503260060396e+01,
+        -1.62396669462573470355e+02,
+        -1.84605092906711035994e+02,
+        -8.12874355063065934246e+01,
+        -9.81432934416914548592e+00);
+      __ss = ::cuda::std::simd::__host_vector_polynomial(
+        __t,
+        1.0,
+        1.96512716674392571292e+01,
+        1.37657754143519042600e+02,
+        4.34565877475229228821e+02,
+        6.45387271733267880336e+02,
+        4.29008140027567833386e+02,
+        1.08635005541779435134e+02,
+        6.57024977031928170135e+00,
+        -6.04244152148580987438e-02);
+    }
+    if (::cuda::std::simd::__host_vector_any_of(__is_tail & ~__near))
+    {
+      const _Vec __rb = ::cuda::std::simd::__host_vector_polynomial(
+        __t,
+        -9.86494292470009928597e-03,
+        -7.99283237680523006574e-01,
+        -1.77579549177547519889e+01,
+        -1.60636384855821916062e+02,
+        -6.37566443368389627722e+02,
+        -1.02509513161107724954e+03,
+        -4.83519191608651397019e+02);
+      const _Vec __sb = ::cuda::std::simd::__host_vector_polynomial(
+        __t,
+        1.0,
+        3.03380607434824582924e+01,
+        3.25792512996573918826e+02,
+        1.53672958608443695994e+03,
+        3.19985821950859553908e+03,
+        2.55305040643316442583e+03,
+        4.74528541206955367215e+02,
+        -2.24409524465858183362e+01);
+      __rs = __near ? __rs : __rb;
+      __ss = __near ? __ss : __sb;
+    }
+    // erfc(|x|) = e^(-z^2 - 0.5625) e^((z - |x|)(z + |x|) + R / S) / |x|, where z is |x| with the low half of the
+    // mantissa cleared, so that -z^2 - 0.5625 is exact
+    constexpr auto __z_bits =
+      static_cast<__host_vector_element_t<_IVec>>(is_same_v<_Tp, float> ? 0xffff0000u : 0xffffffff00000000ull);
+    const _Vec __z    = (_Vec) ((_IVec) __at & __z_bits);
+    const _Vec __erfc = ::cuda::std::simd::__host_vector_exp(-__z * __z - _Tp(0.5625))
+                      * ::cuda::std::simd::__host_vector_exp((__z - __at) * (__z + __at) + __rs / __ss) / __at;
+    __erf = __is_tail ? ::cuda::std::simd::__host_vector_copysign(_Tp(1) - __erfc, __x) : __erf;
+  }
+
+  const _IVec __is_one = (__ax >= _Tp(0.84375)) & (__ax < _Tp(1.25));
+  if (::cuda::std::simd::__host_vector_any_of(__is_one))
+  {
+    const _Vec __s  = __ax - _Tp(1);
+    const _Vec __pa = ::cuda::std::simd::__host_vector_polynomial(
+      __s,
+      -2.36211856075265944077e-03,
+      4.14856118683748331666e-01,
+      -3.72207876035701323847e-01,
+      3.18346619901161753674e-01,
+      -1.10894694282396677476e-01,
+      3.54783043256182359371e-02,
+      -2.16637559486879084300e-03);
+    const _Vec __qa = ::cuda::std::simd::__host_vector_polynomial(
+      __s,
+      1.0,
+      1.06420880400844228286e-01,
+      5.40397917702171048937e-01,
+      7.18286544141962662868e-02,
+      1.26171219808761642112e-01,
+      1.36370839120290507362e-02,
+      1.19844998467991074170e-02);
+    __erf = __is_one
+            ? ::cuda::std::simd::__host_vector_copysign(_Tp(8.45062911510467529297e-01) + __pa / __qa, __x)
+            : __erf;
+  }
+
+  const _IVec __is_small = __ax < _Tp(0.84375);
+  if (::cuda::std::simd::__host_vector_any_of(__is_small))
+  {
+    const _Vec __z  = __x * __x;
+    const _Vec __pp = ::cuda::std::simd::__host_vector_polynomial(
+      __z,
+      1.28379167095512558561e-01,
+      -3.25042107247001499370e-01,
+      -2.84817495755985104766e-02,
+      -5.77027029648944159157e-03,
+      -2.37630166566501626084e-05);
+    const _Vec __qq = ::cuda::std::simd::__host_vector_polynomial(
+      __z,
+      1.0,
+      3.97917223959155352819e-01,
+      6.50222499887672944485e-02,
+      5.08130628187576562776e-03,
+      1.32494738004321644526e-04,
+      -3.96022827877536812320e-06);
+    __erf = __is_small ? __x + __x * (__pp / __qq) : __erf;
+  }
+  return __erf;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// basic_vec interface
+
+template <typename _Tp, typename _Abi>
+inline constexpr bool __has_simd_host_vector_math_v<basic_vec<_Tp, _Abi>> =
+  (is_same_v<_Tp, float> || is_same_v<_Tp, double>) && __is_simd_host_vector_v<_Tp, _Abi>;
+
+template <typename _Tp, typename _Abi>
+struct __simd_host_vector_math<basic_vec<_Tp, _Abi>>
+{
+  using _Vp        = basic_vec<_Tp, _Abi>;
+  using _Impl      = __simd_operations<_Tp, _Abi>;
+  using __vector_t = typename _Impl::__vector_t;
+
+  [[nodiscard]] _CCCL_HOST_API static __vector_t __to_vector(const _Vp& __v) noexcept
+  {
+    return _Impl::__to_vector(__simd_access::__storage(__v));
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static _Vp __from_vector(const __vector_t __v) noexcept
+  {
+    return __simd_access::__from_storage<_Vp>(_Impl::__from_vector(__v));
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static _Vp __exp(const _Vp& __x) noexcept
+  {
+    return __from_vector(::cuda::std::simd::__host_vector_exp(__to_vector(__x)));
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static _Vp __log(const _Vp& __x) noexcept
+  {
+    return __from_vector(::cuda::std::simd::__host_vector_log(__to_vector(__x)));
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static _Vp __sqrt(const _Vp& __x) noexcept
+  {
+    return __from_vector(::cuda::std::simd::__host_vector_sqrt(__to_vector(__x)));
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static _Vp __sin(const _Vp& __x) noexcept
+  {
+    return __from_vector(::cuda::std::simd::__host_vector_sin_cos<false>(__to_vector(__x)));
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static _Vp __cos(const _Vp& __x) noexcept
+  {
+    return __from_vector(::cuda::std::simd::__host_vector_sin_cos<true>(__to_vector(__x)));
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static _Vp __tanh(const _Vp& __x) noexcept
+  {
+    return __from_vector(::cuda::std::simd::__host_vector_tanh(__to_vector(__x)));
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static _Vp __erf(const _Vp& __x) noexcept
+  {
+    return __from_vector(::cuda::std::simd::__host_vector_erf(__to_vector(__x)));
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static _Vp __pow(const _Vp& __x, const _Vp& __y) noexcept
+  {
+    return __from_vector(::cuda::std::simd::__host_vector_pow(__to_vector(__x), __to_vector(__y)));
+  }
+};
+
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
+
+_CCCL_END_NAMESPACE_CUDA_STD_SIMD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___SIMD_MATH_HOST_VECTOR_MATH_H
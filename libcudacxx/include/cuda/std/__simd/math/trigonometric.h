@@ -34,8 +34,8 @@ _CCCL_BEGIN_NAMESPACE_CUDA_STD_SIMD
 _CCCL_SIMD_MATH_UNARY_FUNCTION(acos, )
 _CCCL_SIMD_MATH_UNARY_FUNCTION(asin, )
 _CCCL_SIMD_MATH_UNARY_FUNCTION(atan, )
-_CCCL_SIMD_MATH_UNARY_FUNCTION(cos, )
-_CCCL_SIMD_MATH_UNARY_FUNCTION(sin, )
+_CCCL_SIMD_MATH_UNARY_VECTORIZED_FUNCTION(cos, )
+_CCCL_SIMD_MATH_UNARY_VECTORIZED_FUNCTION(sin, )
 _CCCL_SIMD_MATH_UNARY_FUNCTION(tan, )
 
 _CCCL_SIMD_MATH_UNARY_FUNCTION(acosh, )
@@ -43,7 +43,7 @@ _CCCL_SIMD_MATH_UNARY_FUNCTION(asinh, )
 _CCCL_SIMD_MATH_UNARY_FUNCTION(atanh, )
 _CCCL_SIMD_MATH_UNARY_FUNCTION(cosh, )
 _CCCL_SIMD_MATH_UNARY_FUNCTION(sinh, )
-_CCCL_SIMD_MATH_UNARY_FUNCTION(tanh, )
+_CCCL_SIMD_MATH_UNARY_VECTORIZED_FUNCTION(tanh, )
 
 _CCCL_SIMD_MATH_BINARY_GENERATOR(atan2, atan2);
 
@@ -34,6 +34,7 @@
 #include <cuda/std/__type_traits/remove_cvref.h>
 #include <cuda/std/__type_traits/type_identity.h>
 #include <cuda/std/__type_traits/void_t.h>
+#include <cuda/std/__utility/integer_sequence.h>
 
 #include <cuda/std/__cccl/prologue.h>
 
@@ -113,6 +114,30 @@ struct __permute_generator
   }
 };
 
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+// Vectors in host vector registers permute with a single shuffle, where the index one past the last element selects a
+// zero for zero_element and uninit_element.
+template <typename _IdxMap, __simd_size_type _Idx, __simd_size_type _Size>
+[[nodiscard]] _CCCL_HOST_API _CCCL_CONSTEVAL __simd_size_type __permute_shuffle_index() noexcept
+{
+  constexpr __simd_size_type __src = ::cuda::std::simd::__permute_gen_fn<remove_cvref_t<_IdxMap>, _Idx, _Size>();
+  static_assert(__src == zero_element || __src == uninit_element || (__src >= 0 && __src < _Size),
+                "cuda::std::simd::permute: idxmap(i) must return zero_element, uninit_element, or a value in [0, "
+                "V::size())");
+  return (__src < 0) ? _Size : __src;
+}
+
+template <typename _IdxMap, typename _Vp, __simd_size_type... _Is>
+[[nodiscard]] _CCCL_HOST_API _Vp
+__permute_host_vector(const _Vp& __v, integer_sequence<__simd_size_type, _Is...>) noexcept
+{
+  using _Impl = __simd_operations<typename _Vp::value_type, typename _Vp::abi_type>;
+  return __simd_access::__from_storage<_Vp>(
+    _Impl::template __shuffle<::cuda::std::simd::__permute_shuffle_index<_IdxMap, _Is, _Vp::__size>()...>(
+      __simd_access::__storage(__v)));
+}
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
+
 //----------------------------------------------------------------------------------------------------------------------
 // [simd.permute.static]
 
@@ -121,6 +146,19 @@ _CCCL_TEMPLATE(typename _Tp, typename _Abi, typename _IdxMap)
 _CCCL_REQUIRES(__idxmap_result_is_integral_v<_IdxMap>)
 [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr basic_vec<_Tp, _Abi> permute(const basic_vec<_Tp, _Abi>& __v, _IdxMap&&)
 {
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+  if constexpr (__is_simd_host_vector_v<_Tp, _Abi>)
+  {
+    if constexpr (__simd_operations<_Tp, _Abi>::__has_shuffle)
+    {
+      _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+      {
+        return ::cuda::std::simd::__permute_host_vector<_IdxMap>(
+          __v, make_integer_sequence<__simd_size_type, basic_vec<_Tp, _Abi>::__size>{});
+      }
+    }
+  }
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
   return basic_vec<_Tp, _Abi>{__permute_generator<_IdxMap, basic_vec<_Tp, _Abi>>{__v}};
 }
 
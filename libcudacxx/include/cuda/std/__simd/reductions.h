@@ -84,6 +84,105 @@ template <typename _Tp, typename _BinaryOp>
   }
 }
 
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+// Vectors in host vector registers reduce the halves of the register with vector instructions for the operations that
+// are known to be associative and commutative, which reduce allows.
+
+struct __host_vector_plus
+{
+  template <typename _Up>
+  [[nodiscard]] _CCCL_HOST_API _Up operator()(const _Up __a, const _Up __b) const noexcept
+  {
+    return __a + __b;
+  }
+};
+
+struct __host_vector_multiplies
+{
+  template <typename _Up>
+  [[nodiscard]] _CCCL_HOST_API _Up operator()(const _Up __a, const _Up __b) const noexcept
+  {
+    return __a * __b;
+  }
+};
+
+struct __host_vector_bit_and
+{
+  template <typename _Up>
+  [[nodiscard]] _CCCL_HOST_API _Up operator()(const _Up __a, const _Up __b) const noexcept
+  {
+    return __a & __b;
+  }
+};
+
+struct __host_vector_bit_or
+{
+  template <typename _Up>
+  [[nodiscard]] _CCCL_HOST_API _Up operator()(const _Up __a, const _Up __b) const noexcept
+  {
+    return __a | __b;
+  }
+};
+
+struct __host_vector_bit_xor
+{
+  template <typename _Up>
+  [[nodiscard]] _CCCL_HOST_API _Up operator()(const _Up __a, const _Up __b) const noexcept
+  {
+    return __a ^ __b;
+  }
+};
+
+struct __host_vector_min
+{
+  template <typename _Up>
+  [[nodiscard]] _CCCL_HOST_API _Up operator()(const _Up __a, const _Up __b) const noexcept
+  {
+    return __b < __a ? __b : __a;
+  }
+};
+
+struct __host_vector_max
+{
+  template <typename _Up>
+  [[nodiscard]] _CCCL_HOST_API _Up operator()(const _Up __a, const _Up __b) const noexcept
+  {
+    return __a < __b ? __b : __a;
+  }
+};
+
+template <typename _BinaryOp>
+[[nodiscard]] _CCCL_HOST_API constexpr auto __host_vector_reduce_op() noexcept
+{
+  if constexpr (__is_plus_op_v<_BinaryOp>)
+  {
+    return __host_vector_plus{};
+  }
+  else if constexpr (__is_multiplies_op_v<_BinaryOp>)
+  {
+    return __host_vector_multiplies{};
+  }
+  else if constexpr (__is_bit_and_op_v<_BinaryOp>)
+  {
+    return __host_vector_bit_and{};
+  }
+  else if constexpr (__is_bit_or_op_v<_BinaryOp>)
+  {
+    return __host_vector_bit_or{};
+  }
+  else
+  {
+    return __host_vector_bit_xor{};
+  }
+}
+
+template <typename _Tp, typename _Abi, typename _ReduceOp>
+[[nodiscard]] _CCCL_HOST_API _Tp __host_vector_reduce(const basic_vec<_Tp, _Abi>& __x, _ReduceOp __op) noexcept
+{
+  return __simd_operations<_Tp, _Abi>::__reduce(__simd_access::__storage(__x), __op);
+}
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
+
 // [simd.reductions], reduce
 
 _CCCL_TEMPLATE(typename _Tp, typename _Abi, typename _BinaryOperation = plus<>)
@@ -92,6 +191,16 @@ _CCCL_REQUIRES(__reduction_binary_operation<_BinaryOperation, _Tp>)
 reduce(const basic_vec<_Tp, _Abi>& __x,
        _BinaryOperation __binary_op = {}) noexcept(__is_nothrow_reduction_binary_operation_v<_BinaryOperation, _Tp>)
 {
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+  if constexpr (__is_simd_host_vector_v<_Tp, _Abi> && __is_reduce_default_supported_operation_v<_BinaryOperation>)
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      return ::cuda::std::simd::__host_vector_reduce(
+        __x, ::cuda::std::simd::__host_vector_reduce_op<_BinaryOperation>());
+    }
+  }
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
   vec<_Tp, 1> __result{__x[0]};
   _CCCL_PRAGMA_UNROLL_FULL()
   for (__simd_size_type __i = 1; __i < __x.__size; ++__i)
@@ -113,6 +222,20 @@ reduce(const basic_vec<_Tp, _Abi>& __x,
        const type_identity_t<_Tp> __identity_element) //
   noexcept(__is_nothrow_reduction_binary_operation_v<_BinaryOperation, _Tp>)
 {
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+  if constexpr (__is_simd_host_vector_v<_Tp, _Abi> && __is_reduce_default_supported_operation_v<_BinaryOperation>)
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      // The given identity element need not be the identity of the operation, so it takes part exactly once
+      const _Tp __reduced = ::cuda::std::simd::__host_vector_reduce(
+        __simd_select_impl(
+          __mask, __x, basic_vec<_Tp, _Abi>{::cuda::std::simd::__default_identity_element<_Tp, _BinaryOperation>()}),
+        ::cuda::std::simd::__host_vector_reduce_op<_BinaryOperation>());
+      return __binary_op(vec<_Tp, 1>{__identity_element}, vec<_Tp, 1>{__reduced})[0];
+    }
+  }
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
   vec<_Tp, 1> __result{__identity_element};
   _CCCL_PRAGMA_UNROLL_FULL()
   for (__simd_size_type __i = 0; __i < __x.__size; ++__i)
@@ -143,6 +266,15 @@ _CCCL_TEMPLATE(typename _Tp, typename _Abi)
 _CCCL_REQUIRES(totally_ordered<_Tp>)
 [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr _Tp reduce_min(const basic_vec<_Tp, _Abi>& __x) noexcept
 {
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+  if constexpr (__is_simd_host_vector_v<_Tp, _Abi>)
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      return ::cuda::std::simd::__host_vector_reduce(__x, __host_vector_min{});
+    }
+  }
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
   auto __result = __x[0];
   _CCCL_PRAGMA_UNROLL_FULL()
   for (__simd_size_type __i = 1; __i < __x.__size; ++__i)
@@ -161,6 +293,16 @@ _CCCL_REQUIRES(totally_ordered<_Tp>)
 [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr _Tp
 reduce_min(const basic_vec<_Tp, _Abi>& __x, const typename basic_vec<_Tp, _Abi>::mask_type& __mask) noexcept
 {
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+  if constexpr (__is_simd_host_vector_v<_Tp, _Abi>)
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      return ::cuda::std::simd::__host_vector_reduce(
+        __simd_select_impl(__mask, __x, basic_vec<_Tp, _Abi>{numeric_limits<_Tp>::max()}), __host_vector_min{});
+    }
+  }
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
   auto __result = numeric_limits<_Tp>::max();
   _CCCL_PRAGMA_UNROLL_FULL()
   for (__simd_size_type __i = 0; __i < __x.__size; ++__i)
@@ -183,6 +325,15 @@ _CCCL_TEMPLATE(typename _Tp, typename _Abi)
 _CCCL_REQUIRES(totally_ordered<_Tp>)
 [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr _Tp reduce_max(const basic_vec<_Tp, _Abi>& __x) noexcept
 {
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+  if constexpr (__is_simd_host_vector_v<_Tp, _Abi>)
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      return ::cuda::std::simd::__host_vector_reduce(__x, __host_vector_max{});
+    }
+  }
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
   auto __result = __x[0];
   _CCCL_PRAGMA_UNROLL_FULL()
   for (__simd_size_type __i = 1; __i < __x.__size; ++__i)
@@ -201,6 +352,16 @@ _CCCL_REQUIRES(totally_ordered<_Tp>)
 [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr _Tp
 reduce_max(const basic_vec<_Tp, _Abi>& __x, const typename basic_vec<_Tp, _Abi>::mask_type& __mask) noexcept
 {
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+  if constexpr (__is_simd_host_vector_v<_Tp, _Abi>)
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      return ::cuda::std::simd::__host_vector_reduce(
+        __simd_select_impl(__mask, __x, basic_vec<_Tp, _Abi>{numeric_limits<_Tp>::lowest()}), __host_vector_max{});
+    }
+  }
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
   auto __result = numeric_limits<_Tp>::lowest();
   _CCCL_PRAGMA_UNROLL_FULL()
   for (__simd_size_type __i = 0; __i < __x.__size; ++__i)
@@ -222,6 +383,12 @@ reduce_max(const basic_vec<_Tp, _Abi>& __x, const typename basic_vec<_Tp, _Abi>:
 template <size_t _Bytes, typename _Abi>
 [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr bool all_of(const basic_mask<_Bytes, _Abi>& __k) noexcept
 {
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+  _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+  {
+    return __mask_operations<_Bytes, _Abi>::__count(__simd_access::__storage(__k)) == __k.__size;
+  }
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
   _CCCL_PRAGMA_UNROLL_FULL()
   for (__simd_size_type __i = 0; __i < __k.__size; ++__i)
   {
@@ -236,6 +403,12 @@ template <size_t _Bytes, typename _Abi>
 template <size_t _Bytes, typename _Abi>
 [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr bool any_of(const basic_mask<_Bytes, _Abi>& __k) noexcept
 {
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+  _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+  {
+    return __mask_operations<_Bytes, _Abi>::__any_of(__simd_access::__storage(__k));
+  }
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
   _CCCL_PRAGMA_UNROLL_FULL()
   for (__simd_size_type __i = 0; __i < __k.__size; ++__i)
   {
@@ -256,6 +429,12 @@ template <size_t _Bytes, typename _Abi>
 template <size_t _Bytes, typename _Abi>
 [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr __simd_size_type reduce_count(const basic_mask<_Bytes, _Abi>& __k) noexcept
 {
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+  _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+  {
+    return __mask_operations<_Bytes, _Abi>::__count(__simd_access::__storage(__k));
+  }
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
   __simd_size_type __count = 0;
   _CCCL_PRAGMA_UNROLL_FULL()
   for (__simd_size_type __i = 0; __i < __k.__size; ++__i)
@@ -270,6 +449,12 @@ template <size_t _Bytes, typename _Abi>
 reduce_min_index(const basic_mask<_Bytes, _Abi>& __k) noexcept
 {
   _CCCL_ASSERT(::cuda::std::simd::any_of(__k), "No bits are set");
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+  _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+  {
+    return __mask_operations<_Bytes, _Abi>::__min_index(__simd_access::__storage(__k));
+  }
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
   _CCCL_PRAGMA_UNROLL_FULL()
   for (__simd_size_type __i = 0; __i < __k.__size; ++__i)
   {
@@ -286,6 +471,12 @@ template <size_t _Bytes, typename _Abi>
 reduce_max_index(const basic_mask<_Bytes, _Abi>& __k) noexcept
 {
   _CCCL_ASSERT(::cuda::std::simd::any_of(__k), "No bits are set");
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+  _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+  {
+    return __mask_operations<_Bytes, _Abi>::__max_index(__simd_access::__storage(__k));
+  }
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
   _CCCL_PRAGMA_UNROLL_FULL()
   for (__simd_size_type __i = __k.__size - 1; __i >= 0; --__i)
   {
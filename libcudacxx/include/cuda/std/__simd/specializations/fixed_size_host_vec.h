@@ -0,0 +1,296 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___SIMD_SPECIALIZATIONS_FIXED_SIZE_HOST_VEC_H
+#define _CUDA_STD___SIMD_SPECIALIZATIONS_FIXED_SIZE_HOST_VEC_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__fwd/simd.h>
+#include <cuda/std/__simd/specializations/fixed_size_vec.h>
+#include <cuda/std/__type_traits/is_integral.h>
+#include <cuda/std/__type_traits/is_same.h>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_SIMD
+
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+
+// Vectors of standard integers or floating point numbers that fill a vector register of the host, up to the widest
+// one enabled for the translation unit
+template <typename _Tp, __simd_size_type _Np>
+inline constexpr bool __is_fixed_size_host_vector_v =
+  ((is_integral_v<_Tp> && !is_same_v<_Tp, bool> && sizeof(_Tp) <= 8) || is_same_v<_Tp, float>
+   || is_same_v<_Tp, double>)
+  && (_Np * sizeof(_Tp) == 16 || _Np * sizeof(_Tp) == 32 || _Np * sizeof(_Tp) == 64)
+  && _Np * sizeof(_Tp) <= _CCCL_SIMD_HOST_VECTOR_BYTES;
+
+//! @brief A vector of @c _Bytes bytes with elements of type @c _Tp, in the vector extensions of GCC and Clang
+template <typename _Tp, size_t _Bytes>
+struct __host_vector
+{
+  typedef _Tp __type __attribute__((__vector_size__(_Bytes)));
+};
+
+template <typename _Tp, size_t _Bytes>
+using __host_vector_t = typename __host_vector<_Tp, _Bytes>::__type;
+
+#  define _CCCL_SIMD_HOST_VECTOR_BINARY(_NAME, _OP)                                                    \
+    [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _SimdStorage _NAME(                           \
+      const _SimdStorage& __lhs, const _SimdStorage& __rhs) noexcept                                   \
+    {                                                                                                  \
+      _CCCL_IF_NOT_CONSTEVAL_DEFAULT                                                                   \
+      {                                                                                                \
+        return __from_vector(__to_vector(__lhs) _OP __to_vector(__rhs));                               \
+      }                                                                                                \
+      return __base::_NAME(__lhs, __rhs);                                                              \
+    }
+
+#  define _CCCL_SIMD_HOST_VECTOR_COMPARE(_NAME, _OP)                                                   \
+    [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _MaskStorage _NAME(                           \
+      const _SimdStorage& __lhs, const _SimdStorage& __rhs) noexcept                                   \
+    {                                                                                                  \
+      _CCCL_IF_NOT_CONSTEVAL_DEFAULT                                                                   \
+      {                                                                                                \
+        return __from_mask_vector(__to_vector(__lhs) _OP __to_vector(__rhs));                          \
+      }                                                                                                \
+      return __base::_NAME(__lhs, __rhs);                                                              \
+    }
+
+// Simd operations for fixed_size ABI with vectors that fill a vector register of the host. The storage stays the array
+// of elements of the other fixed_size vectors, with the same size and alignment on host and device, and is converted
+// to the vector type only inside an operation. The compiler keeps it in a register across these conversions.
+template <typename _Tp, __simd_size_type _Np>
+struct __simd_operations<_Tp, __fixed_size<_Np>, __simd_operations_kind::__fixed_size_host_vector>
+    : __fixed_size_operations<_Tp, _Np>
+{
+  using __base       = __fixed_size_operations<_Tp, _Np>;
+  using _SimdStorage = __simd_storage<_Tp, __fixed_size<_Np>>;
+  using _MaskStorage = __mask_storage<sizeof(_Tp), __fixed_size<_Np>>;
+
+  static constexpr size_t __bytes = _Np * sizeof(_Tp);
+
+  using __vector_t = __host_vector_t<_Tp, __bytes>;
+  // Comparisons of vectors give a vector of signed integers of the width of the elements, with all bits set where true
+  using __mask_vector_t = __host_vector_t<__integer_from<sizeof(_Tp)>, __bytes>;
+  using __bool_vector_t = __host_vector_t<signed char, _Np>;
+
+  [[nodiscard]] _CCCL_HOST_API static __vector_t __to_vector(const _SimdStorage& __s) noexcept
+  {
+    __vector_t __v;
+    __builtin_memcpy(&__v, __s.__data, __bytes);
+    return __v;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static _SimdStorage __from_vector(const __vector_t __v) noexcept
+  {
+    _SimdStorage __result;
+    __builtin_memcpy(__result.__data, &__v, __bytes);
+    return __result;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static _MaskStorage __from_mask_vector(const __mask_vector_t __m) noexcept
+  {
+    // -1 and 0 become the bytes 1 and 0 of a bool
+    const __bool_vector_t __bools = -__builtin_convertvector(__m, __bool_vector_t);
+    _MaskStorage __result;
+    __builtin_memcpy(__result.__data, &__bools, _Np);
+    return __result;
+  }
+
+  // Unary operations
+
+  _CCCL_HOST_DEVICE_API static constexpr void __increment(_SimdStorage& __s) noexcept
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      __s = __from_vector(__to_vector(__s) + _Tp(1));
+      return;
+    }
+    __base::__increment(__s);
+  }
+
+  _CCCL_HOST_DEVICE_API static constexpr void __decrement(_SimdStorage& __s) noexcept
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      __s = __from_vector(__to_vector(__s) - _Tp(1));
+      return;
+    }
+    __base::__decrement(__s);
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _MaskStorage __negate(const _SimdStorage& __s) noexcept
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      return __from_mask_vector(__to_vector(__s) == _Tp(0));
+    }
+    return __base::__negate(__s);
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _SimdStorage __bitwise_not(const _SimdStorage& __s) noexcept
+  {
+    if constexpr (is_integral_v<_Tp>)
+    {
+      _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+      {
+        return __from_vector(~__to_vector(__s));
+      }
+    }
+    return __base::__bitwise_not(__s);
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _SimdStorage __unary_minus(const _SimdStorage& __s) noexcept
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      return __from_vector(-__to_vector(__s));
+    }
+    return __base::__unary_minus(__s);
+  }
+
+  // Binary arithmetic operations
+
+  _CCCL_SIMD_HOST_VECTOR_BINARY(__plus, +)
+  _CCCL_SIMD_HOST_VECTOR_BINARY(__minus, -)
+  _CCCL_SIMD_HOST_VECTOR_BINARY(__multiplies, *)
+
+  // There is no vector instruction for integer division, the element loop is as fast
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _SimdStorage
+  __divides(const _SimdStorage& __lhs, const _SimdStorage& __rhs) noexcept
+  {
+    if constexpr (!is_integral_v<_Tp>)
+    {
+      _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+      {
+        return __from_vector(__to_vector(__lhs) / __to_vector(__rhs));
+      }
+    }
+    return __base::__divides(__lhs, __rhs);
+  }
+
+  // Comparison operations
+
+  _CCCL_SIMD_HOST_VECTOR_COMPARE(__equal_to, ==)
+  _CCCL_SIMD_HOST_VECTOR_COMPARE(__not_equal_to, !=)
+  _CCCL_SIMD_HOST_VECTOR_COMPARE(__less, <)
+  _CCCL_SIMD_HOST_VECTOR_COMPARE(__less_equal, <=)
+  _CCCL_SIMD_HOST_VECTOR_COMPARE(__greater, >)
+  _CCCL_SIMD_HOST_VECTOR_COMPARE(__greater_equal, >=)
+
+  // Bitwise and shift operations, which only exist for integral element types. Shifts of elements narrower than int
+  // keep the element loop, as the scalar operands are promoted to int and may be shifted by more than their width.
+
+#  define _CCCL_SIMD_HOST_VECTOR_INTEGRAL_BINARY(_NAME, _OP, _MIN_SIZE)                                \
+    [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _SimdStorage _NAME(                           \
+      const _SimdStorage& __lhs, const _SimdStorage& __rhs) noexcept                                   \
+    {                                                                                                  \
+      if constexpr (is_integral_v<_Tp> && sizeof(_Tp) >= _MIN_SIZE)                                    \
+      {                                                                                                \
+        _CCCL_IF_NOT_CONSTEVAL_DEFAULT                                                                 \
+        {                                                                                              \
+          return __from_vector(__to_vector(__lhs) _OP __to_vector(__rhs));                             \
+        }                                                                                              \
+      }                                                                                                \
+      return __base::_NAME(__lhs, __rhs);                                                              \
+    }
+
+  _CCCL_SIMD_HOST_VECTOR_INTEGRAL_BINARY(__bitwise_and, &, 1)
+  _CCCL_SIMD_HOST_VECTOR_INTEGRAL_BINARY(__bitwise_or, |, 1)
+  _CCCL_SIMD_HOST_VECTOR_INTEGRAL_BINARY(__bitwise_xor, ^, 1)
+  _CCCL_SIMD_HOST_VECTOR_INTEGRAL_BINARY(__shift_left, <<, sizeof(int))
+  _CCCL_SIMD_HOST_VECTOR_INTEGRAL_BINARY(__shift_right, >>, sizeof(int))
+
+#  undef _CCCL_SIMD_HOST_VECTOR_INTEGRAL_BINARY
+
+  // Reductions
+
+  //! @brief Reduces the @c _Bytes bytes at @p __data with @p __op, which combines either two vectors or two elements,
+  //! by combining the halves of the vector until it fits in 16 bytes, and then the elements one by one
+  template <size_t _Bytes, typename _BinaryOp>
+  [[nodiscard]] _CCCL_HOST_API static _Tp __reduce_bytes(const _Tp* __data, _BinaryOp __op) noexcept
+  {
+    constexpr size_t __count = _Bytes / sizeof(_Tp);
+    if constexpr (_Bytes > 16)
+    {
+      using __half_t = __host_vector_t<_Tp, _Bytes / 2>;
+      __half_t __lo;
+      __half_t __hi;
+      __builtin_memcpy(&__lo, __data, _Bytes / 2);
+      __builtin_memcpy(&__hi, __data + __count / 2, _Bytes / 2);
+      const __half_t __combined = __op(__lo, __hi);
+      _Tp __half[__count / 2];
+      __builtin_memcpy(__half, &__combined, _Bytes / 2);
+      return __reduce_bytes<_Bytes / 2>(__half, __op);
+    }
+    else
+    {
+      _Tp __result = __data[0];
+      for (size_t __i = 1; __i < __count; ++__i)
+      {
+        __result = __op(__result, __data[__i]);
+      }
+      return __result;
+    }
+  }
+
+  //! @brief Reduces @p __s with @p __op, which must accept both vectors and elements. The order in which the elements
+  //! are combined is unspecified, as for @c reduce.
+  template <typename _BinaryOp>
+  [[nodiscard]] _CCCL_HOST_API static _Tp __reduce(const _SimdStorage& __s, _BinaryOp __op) noexcept
+  {
+    return __reduce_bytes<__bytes>(__s.__data, __op);
+  }
+
+  // Permutations
+
+#  if _CCCL_HAS_BUILTIN(__builtin_shufflevector)
+  static constexpr bool __has_shuffle = true;
+
+  //! @brief Permutes @p __s by the indices @c _Is, where @c _Np selects a zero
+  template <__simd_size_type... _Is>
+  [[nodiscard]] _CCCL_HOST_API static _SimdStorage __shuffle(const _SimdStorage& __s) noexcept
+  {
+    return __from_vector(__builtin_shufflevector(__to_vector(__s), __vector_t{}, _Is...));
+  }
+#  else // ^^^ _CCCL_HAS_BUILTIN(__builtin_shufflevector) ^^^ / vvv !_CCCL_HAS_BUILTIN(__builtin_shufflevector) vvv
+  static constexpr bool __has_shuffle = false;
+#  endif // !_CCCL_HAS_BUILTIN(__builtin_shufflevector)
+};
+
+#  undef _CCCL_SIMD_HOST_VECTOR_COMPARE
+#  undef _CCCL_SIMD_HOST_VECTOR_BINARY
+
+#else // ^^^ _CCCL_HAS_SIMD_HOST_VECTOR() ^^^ / vvv !_CCCL_HAS_SIMD_HOST_VECTOR() vvv
+
+template <typename _Tp, __simd_size_type _Np>
+inline constexpr bool __is_fixed_size_host_vector_v = false;
+
+#endif // !_CCCL_HAS_SIMD_HOST_VECTOR()
+
+template <typename _Tp, typename _Abi>
+inline constexpr bool __is_simd_host_vector_v =
+  __simd_operations_kind_v<_Tp, _Abi> == __simd_operations_kind::__fixed_size_host_vector;
+
+_CCCL_END_NAMESPACE_CUDA_STD_SIMD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___SIMD_SPECIALIZATIONS_FIXED_SIZE_HOST_VEC_H
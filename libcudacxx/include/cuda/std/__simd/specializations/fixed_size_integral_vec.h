@@ -26,6 +26,7 @@
 // TODO(fbusato): extend to other GPU archs in the future
 
 #include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/__simd/specializations/fixed_size_host_vec.h>
 #include <cuda/std/__simd/specializations/fixed_size_vec.h>
 #include <cuda/std/__simd/specializations/simd_intrinsics_array.h>
 #include <cuda/std/__type_traits/is_integral.h>
@@ -46,7 +47,10 @@ inline constexpr auto __simd_operations_small_integral = __simd_operations_kind:
 
 template <typename _Tp, __simd_size_type _Np>
 inline constexpr __simd_operations_kind __simd_operations_kind_v<_Tp, __fixed_size<_Np>> =
-  __is_fixed_size_small_integral_v<_Tp, _Np> ? __simd_operations_small_integral : __simd_operations_kind::__default;
+  __is_fixed_size_host_vector_v<_Tp, _Np> ? __simd_operations_kind::__fixed_size_host_vector
+  : __is_fixed_size_small_integral_v<_Tp, _Np>
+    ? __simd_operations_small_integral
+    : __simd_operations_kind::__default;
 
 #define _CCCL_SIMD_FIXED_SIZE_INTEGRAL_BINARY_BITWISE(_NAME, _OP)                           \
   [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr __simd_storage_t _NAME(              \
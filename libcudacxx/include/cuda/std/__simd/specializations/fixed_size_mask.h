@@ -21,12 +21,17 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/__cmath/ceil_div.h>
 #include <cuda/__utility/in_range.h>
+#include <cuda/std/__bit/countl.h>
+#include <cuda/std/__bit/countr.h>
+#include <cuda/std/__bit/popcount.h>
 #include <cuda/std/__cstddef/types.h>
 #include <cuda/std/__fwd/simd.h>
 #include <cuda/std/__simd/specializations/fixed_size_storage.h>
 #include <cuda/std/__type_traits/integral_constant.h>
 #include <cuda/std/__utility/integer_sequence.h>
+#include <cuda/std/cstdint>
 
 #include <cuda/std/__cccl/prologue.h>
 
@@ -163,6 +168,74 @@ struct __mask_operations<_Bytes, __fixed_size<_Np>>
     }
     return __result;
   }
+
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+  // Mask reductions on the host, which scan the bools eight at a time. A bool is a byte that holds 0 or 1, so that
+  // a word is zero exactly when its bools are false, its population count is the number of true bools, and on the
+  // little endian host the trailing and leading zeros locate the first and last true bool.
+
+  static constexpr size_t __num_words = ::cuda::ceil_div(static_cast<size_t>(_Np), sizeof(uint64_t));
+
+  struct __words_t
+  {
+    uint64_t __data[__num_words];
+  };
+
+  [[nodiscard]] _CCCL_HOST_API static __words_t __to_words(const _MaskStorage& __s) noexcept
+  {
+    __words_t __words{};
+    __builtin_memcpy(__words.__data, __s.__data, _Np);
+    return __words;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static bool __any_of(const _MaskStorage& __s) noexcept
+  {
+    const __words_t __words = __to_words(__s);
+    uint64_t __any          = 0;
+    for (size_t __i = 0; __i < __num_words; ++__i)
+    {
+      __any |= __words.__data[__i];
+    }
+    return __any != 0;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static __simd_size_type __count(const _MaskStorage& __s) noexcept
+  {
+    const __words_t __words = __to_words(__s);
+    int __count             = 0;
+    for (size_t __i = 0; __i < __num_words; ++__i)
+    {
+      __count += ::cuda::std::popcount(__words.__data[__i]);
+    }
+    return __count;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static __simd_size_type __min_index(const _MaskStorage& __s) noexcept
+  {
+    const __words_t __words = __to_words(__s);
+    for (size_t __i = 0; __i < __num_words; ++__i)
+    {
+      if (__words.__data[__i] != 0)
+      {
+        return static_cast<__simd_size_type>(__i * 8 + ::cuda::std::countr_zero(__words.__data[__i]) / 8);
+      }
+    }
+    return __simd_size_type{-1};
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static __simd_size_type __max_index(const _MaskStorage& __s) noexcept
+  {
+    const __words_t __words = __to_words(__s);
+    for (size_t __i = __num_words; __i-- > 0;)
+    {
+      if (__words.__data[__i] != 0)
+      {
+        return static_cast<__simd_size_type>(__i * 8 + (63 - ::cuda::std::countl_zero(__words.__data[__i])) / 8);
+      }
+    }
+    return __simd_size_type{-1};
+  }
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
 };
 
 _CCCL_END_NAMESPACE_CUDA_STD_SIMD
@@ -0,0 +1,295 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___STRING_BYTE_SEARCH_H
+#define _CUDA_STD___STRING_BYTE_SEARCH_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__bit/byteswap.h>
+#include <cuda/std/__bit/countl.h>
+#include <cuda/std/__bit/countr.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__fwd/char_traits.h>
+#include <cuda/std/__string/constexpr_c_functions.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+// Host searches in strings of bytes, used by basic_string_view for char and char8_t with the standard char_traits.
+//
+// The haystack is scanned a block at a time: 16 or 32 bytes in a vector register on x86-64 hosts, or a 64-bit word
+// elsewhere. Comparing a block with a byte yields a mask with a set bit for each equal byte, every bit for the vector
+// registers and every eighth bit for the words, in the order of the bytes. A substring is only compared with the bytes
+// at the positions where both its first and its last byte match, and a set of bytes is looked up in a bitmap.
+
+//! @brief Whether the searches of basic_string_view<_CharT, _Traits> may compare bytes on the host.
+template <class _CharT, class _Traits>
+inline constexpr bool __cccl_str_is_byte_string = sizeof(_CharT) == 1 && is_same_v<_Traits, char_traits<_CharT>>;
+
+#if !_CCCL_COMPILER(NVRTC)
+
+#  if _CCCL_HAS_SIMD_HOST_VECTOR()
+#    if _CCCL_SIMD_HOST_VECTOR_BYTES >= 32
+inline constexpr size_t __cccl_byte_block_size = 32;
+#    else // ^^^ _CCCL_SIMD_HOST_VECTOR_BYTES >= 32 ^^^ / vvv _CCCL_SIMD_HOST_VECTOR_BYTES < 32 vvv
+inline constexpr size_t __cccl_byte_block_size = 16;
+#    endif // ^^^ _CCCL_SIMD_HOST_VECTOR_BYTES < 32 ^^^
+inline constexpr int __cccl_byte_mask_stride = 1;
+
+typedef char __cccl_byte_block_t __attribute__((__vector_size__(__cccl_byte_block_size)));
+
+[[nodiscard]] _CCCL_HOST_API inline uint64_t __cccl_byte_match(const unsigned char* __p, unsigned char __c) noexcept
+{
+  __cccl_byte_block_t __block;
+  __builtin_memcpy(&__block, __p, __cccl_byte_block_size);
+  const auto __eq = (__cccl_byte_block_t) (__block == static_cast<char>(__c));
+#    if _CCCL_SIMD_HOST_VECTOR_BYTES >= 32
+  return static_cast<uint32_t>(__builtin_ia32_pmovmskb256(__eq));
+#    else // ^^^ _CCCL_SIMD_HOST_VECTOR_BYTES >= 32 ^^^ / vvv _CCCL_SIMD_HOST_VECTOR_BYTES < 32 vvv
+  return static_cast<uint32_t>(__builtin_ia32_pmovmskb128(__eq));
+#    endif // ^^^ _CCCL_SIMD_HOST_VECTOR_BYTES < 32 ^^^
+}
+#  else // ^^^ _CCCL_HAS_SIMD_HOST_VECTOR() ^^^ / vvv !_CCCL_HAS_SIMD_HOST_VECTOR() vvv
+inline constexpr size_t __cccl_byte_block_size = sizeof(uint64_t);
+inline constexpr int __cccl_byte_mask_stride   = 8;
+
+[[nodiscard]] _CCCL_HOST_API inline uint64_t __cccl_byte_match(const unsigned char* __p, unsigned char __c) noexcept
+{
+  constexpr uint64_t __low7 = 0x7F7F7F7F7F7F7F7FULL;
+  uint64_t __word;
+  ::memcpy(&__word, __p, sizeof(__word));
+#    if _CCCL_ENDIAN_NATIVE() == _CCCL_ENDIAN_BIG()
+  __word = ::cuda::std::byteswap(__word);
+#    endif // _CCCL_ENDIAN_NATIVE() == _CCCL_ENDIAN_BIG()
+  // The high bit of each byte that is zero after the xor, without the carries of the usual zero byte test
+  const uint64_t __x = __word ^ (0x0101010101010101ULL * __c);
+  return ~(((__x & __low7) + __low7) | __x | __low7);
+}
+#  endif // ^^^ !_CCCL_HAS_SIMD_HOST_VECTOR() ^^^
+
+//! @brief Returns the offset of the first byte of a mask from __cccl_byte_match.
+[[nodiscard]] _CCCL_HOST_API inline size_t __cccl_byte_mask_first(uint64_t __mask) noexcept
+{
+  return static_cast<size_t>(::cuda::std::countr_zero(__mask) / __cccl_byte_mask_stride);
+}
+
+//! @brief Returns the offset of the last byte of a mask from __cccl_byte_match.
+[[nodiscard]] _CCCL_HOST_API inline size_t __cccl_byte_mask_last(uint64_t __mask) noexcept
+{
+  return static_cast<size_t>((63 - ::cuda::std::countl_zero(__mask)) / __cccl_byte_mask_stride);
+}
+
+//! @brief Returns the last occurrence of __c in [__first, __first + __n), or nullptr.
+[[nodiscard]] _CCCL_HOST_API inline const unsigned char*
+__cccl_byte_rfind(const unsigned char* __first, size_t __n, unsigned char __c) noexcept
+{
+  while (__n >= __cccl_byte_block_size)
+  {
+    __n -= __cccl_byte_block_size;
+    const uint64_t __mask = ::cuda::std::__cccl_byte_match(__first + __n, __c);
+    if (__mask != 0)
+    {
+      return __first + __n + ::cuda::std::__cccl_byte_mask_last(__mask);
+    }
+  }
+  while (__n != 0)
+  {
+    if (__first[--__n] == __c)
+    {
+      return __first + __n;
+    }
+  }
+  return nullptr;
+}
+
+//! @brief Returns the first occurrence of [__s, __s + __n) in [__first, __first + __len), or nullptr, for 2 <= __n.
+[[nodiscard]] _CCCL_HOST_API inline const unsigned char*
+__cccl_byte_search(const unsigned char* __first, size_t __len, const unsigned char* __s, size_t __n) noexcept
+{
+  if (__len < __n)
+  {
+    return nullptr;
+  }
+  const size_t __starts       = __len - __n + 1;
+  const unsigned char __front = __s[0];
+  const unsigned char __back  = __s[__n - 1];
+  size_t __i                  = 0;
+  for (; __i + __cccl_byte_block_size <= __starts; __i += __cccl_byte_block_size)
+  {
+    uint64_t __mask = ::cuda::std::__cccl_byte_match(__first + __i, __front)
+                    & ::cuda::std::__cccl_byte_match(__first + __i + __n - 1, __back);
+    while (__mask != 0)
+    {
+      const unsigned char* __candidate = __first + __i + ::cuda::std::__cccl_byte_mask_first(__mask);
+      if (::memcmp(__candidate + 1, __s + 1, __n - 2) == 0)
+      {
+        return __candidate;
+      }
+      __mask &= __mask - 1;
+    }
+  }
+  for (; __i < __starts; ++__i)
+  {
+    if (__first[__i] == __front && __first[__i + __n - 1] == __back
+        && ::memcmp(__first + __i + 1, __s + 1, __n - 2) == 0)
+    {
+      return __first + __i;
+    }
+  }
+  return nullptr;
+}
+
+//! @brief Returns the last occurrence of [__s, __s + __n) in [__first, __first + __len), or nullptr, for 2 <= __n.
+[[nodiscard]] _CCCL_HOST_API inline const unsigned char*
+__cccl_byte_rsearch(const unsigned char* __first, size_t __len, const unsigned char* __s, size_t __n) noexcept
+{
+  if (__len < __n)
+  {
+    return nullptr;
+  }
+  size_t __starts             = __len - __n + 1;
+  const unsigned char __front = __s[0];
+  const unsigned char __back  = __s[__n - 1];
+  while (__starts >= __cccl_byte_block_size)
+  {
+    __starts -= __cccl_byte_block_size;
+    uint64_t __mask = ::cuda::std::__cccl_byte_match(__first + __starts, __front)
+                    & ::cuda::std::__cccl_byte_match(__first + __starts + __n - 1, __back);
+    while (__mask != 0)
+    {
+      const size_t __offset            = ::cuda::std::__cccl_byte_mask_last(__mask);
+      const unsigned char* __candidate = __first + __starts + __offset;
+      if (::memcmp(__candidate + 1, __s + 1, __n - 2) == 0)
+      {
+        return __candidate;
+      }
+      __mask &= ~(uint64_t{1} << (__offset * __cccl_byte_mask_stride + __cccl_byte_mask_stride - 1));
+    }
+  }
+  while (__starts != 0)
+  {
+    --__starts;
+    if (__first[__starts] == __front && __first[__starts + __n - 1] == __back
+        && ::memcmp(__first + __starts + 1, __s + 1, __n - 2) == 0)
+    {
+      return __first + __starts;
+    }
+  }
+  return nullptr;
+}
+
+//! @brief The set of the bytes of a string, as a bitmap.
+struct __cccl_byte_set
+{
+  uint64_t __bits_[4];
+
+  _CCCL_HOST_API explicit __cccl_byte_set(const unsigned char* __s, size_t __n) noexcept
+      : __bits_{}
+  {
+    for (size_t __i = 0; __i < __n; ++__i)
+    {
+      __bits_[__s[__i] >> 6] |= uint64_t{1} << (__s[__i] & 63);
+    }
+  }
+
+  [[nodiscard]] _CCCL_HOST_API bool __contains(unsigned char __c) const noexcept
+  {
+    return (__bits_[__c >> 6] >> (__c & 63)) & 1;
+  }
+};
+
+//! @brief The sets of at most this many bytes are searched by comparing the blocks with each of them.
+inline constexpr size_t __cccl_byte_small_set_size = 4;
+
+//! @brief Returns the first byte of [__first, __first + __len) that is in (or not in, when _Negate) the set of the
+//! bytes of [__s, __s + __n), or nullptr.
+template <bool _Negate>
+[[nodiscard]] _CCCL_HOST_API const unsigned char*
+__cccl_byte_find_first_of(const unsigned char* __first, size_t __len, const unsigned char* __s, size_t __n) noexcept
+{
+  size_t __i = 0;
+  if (!_Negate && __n <= __cccl_byte_small_set_size)
+  {
+    for (; __i + __cccl_byte_block_size <= __len; __i += __cccl_byte_block_size)
+    {
+      uint64_t __mask = 0;
+      for (size_t __j = 0; __j < __n; ++__j)
+      {
+        __mask |= ::cuda::std::__cccl_byte_match(__first + __i, __s[__j]);
+      }
+      if (__mask != 0)
+      {
+        return __first + __i + ::cuda::std::__cccl_byte_mask_first(__mask);
+      }
+    }
+  }
+  const __cccl_byte_set __set{__s, __n};
+  for (; __i < __len; ++__i)
+  {
+    if (__set.__contains(__first[__i]) != _Negate)
+    {
+      return __first + __i;
+    }
+  }
+  return nullptr;
+}
+
+//! @brief Returns the last byte of [__first, __first + __len) that is in (or not in, when _Negate) the set of the
+//! bytes of [__s, __s + __n), or nullptr.
+template <bool _Negate>
+[[nodiscard]] _CCCL_HOST_API const unsigned char*
+__cccl_byte_find_last_of(const unsigned char* __first, size_t __len, const unsigned char* __s, size_t __n) noexcept
+{
+  if (!_Negate && __n <= __cccl_byte_small_set_size)
+  {
+    while (__len >= __cccl_byte_block_size)
+    {
+      __len -= __cccl_byte_block_size;
+      uint64_t __mask = 0;
+      for (size_t __j = 0; __j < __n; ++__j)
+      {
+        __mask |= ::cuda::std::__cccl_byte_match(__first + __len, __s[__j]);
+      }
+      if (__mask != 0)
+      {
+        return __first + __len + ::cuda::std::__cccl_byte_mask_last(__mask);
+      }
+    }
+  }
+  const __cccl_byte_set __set{__s, __n};
+  while (__len != 0)
+  {
+    if (__set.__contains(__first[--__len]) != _Negate)
+    {
+      return __first + __len;
+    }
+  }
+  return nullptr;
+}
+
+#endif // !_CCCL_COMPILER(NVRTC)
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___STRING_BYTE_SEARCH_H
@@ -26,12 +26,28 @@
 #include <cuda/std/__algorithm/min.h>
 #include <cuda/std/__cstddef/types.h>
 #include <cuda/std/__iterator/iterator_traits.h>
+#include <cuda/std/__string/byte_search.h>
 #include <cuda/std/__string/char_traits.h>
 
 #include <cuda/std/__cccl/prologue.h>
 
 _CCCL_BEGIN_NAMESPACE_CUDA_STD
 
+#if !_CCCL_COMPILER(NVRTC)
+// The searches in strings of bytes on the host, from __first to the end of the string, see byte_search.h
+template <class _CharT>
+[[nodiscard]] _CCCL_HOST_API const unsigned char* __cccl_str_bytes(const _CharT* __p) noexcept
+{
+  return reinterpret_cast<const unsigned char*>(__p);
+}
+
+template <class _CharT, class _SizeT, _SizeT __npos>
+[[nodiscard]] _CCCL_HOST_API _SizeT __cccl_str_byte_result(const _CharT* __p, const unsigned char* __r) noexcept
+{
+  return __r == nullptr ? __npos : static_cast<_SizeT>(__r - ::cuda::std::__cccl_str_bytes(__p));
+}
+#endif // !_CCCL_COMPILER(NVRTC)
+
 template <class _CharT, class _SizeT, class _Traits, _SizeT __npos>
 _CCCL_API constexpr _SizeT __cccl_str_find(const _CharT* __p, _SizeT __sz, _CharT __c, _SizeT __pos) noexcept
 {
@@ -116,6 +132,26 @@ __cccl_str_find(const _CharT* __p, _SizeT __sz, const _CharT* __s, _SizeT __pos,
     return __pos;
   }
 
+#if !_CCCL_COMPILER(NVRTC)
+  if constexpr (__cccl_str_is_byte_string<_CharT, _Traits>)
+  {
+    if (__n > 1)
+    {
+      _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+      {
+        NV_IF_TARGET(NV_IS_HOST,
+                     (return ::cuda::std::__cccl_str_byte_result<_CharT, _SizeT, __npos>(
+                               __p,
+                               ::cuda::std::__cccl_byte_search(
+                                 ::cuda::std::__cccl_str_bytes(__p + __pos),
+                                 __sz - __pos,
+                                 ::cuda::std::__cccl_str_bytes(__s),
+                                 __n));))
+      }
+    }
+  }
+#endif // !_CCCL_COMPILER(NVRTC)
+
   const _CharT* __r = ::cuda::std::__cccl_search_substring<_CharT, _Traits>(__p + __pos, __p + __sz, __s, __s + __n);
 
   if (__r == __p + __sz)
@@ -140,6 +176,19 @@ _CCCL_API constexpr _SizeT __cccl_str_rfind(const _CharT* __p, _SizeT __sz, _Cha
   {
     __pos = __sz;
   }
+#if !_CCCL_COMPILER(NVRTC)
+  if constexpr (__cccl_str_is_byte_string<_CharT, _Traits>)
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST,
+                   (return ::cuda::std::__cccl_str_byte_result<_CharT, _SizeT, __npos>(
+                             __p,
+                             ::cuda::std::__cccl_byte_rfind(
+                               ::cuda::std::__cccl_str_bytes(__p), __pos, static_cast<unsigned char>(__c)));))
+    }
+  }
+#endif // !_CCCL_COMPILER(NVRTC)
   _SizeT __result = __npos;
   for (const _CharT* __ps = __p + __pos; __ps != __p;)
   {
@@ -165,6 +214,22 @@ __cccl_str_rfind(const _CharT* __p, _SizeT __sz, const _CharT* __s, _SizeT __pos
   {
     __pos = __sz;
   }
+#if !_CCCL_COMPILER(NVRTC)
+  if constexpr (__cccl_str_is_byte_string<_CharT, _Traits>)
+  {
+    if (__n > 1)
+    {
+      _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+      {
+        NV_IF_TARGET(NV_IS_HOST,
+                     (return ::cuda::std::__cccl_str_byte_result<_CharT, _SizeT, __npos>(
+                               __p,
+                               ::cuda::std::__cccl_byte_rsearch(
+                                 ::cuda::std::__cccl_str_bytes(__p), __pos, ::cuda::std::__cccl_str_bytes(__s), __n));))
+      }
+    }
+  }
+#endif // !_CCCL_COMPILER(NVRTC)
   const _CharT* __r = ::cuda::std::__find_end(
     __p, __p + __pos, __s, __s + __n, _Traits::eq, random_access_iterator_tag(), random_access_iterator_tag());
   if (__n > 0 && __r == __p + __pos)
@@ -182,6 +247,22 @@ __cccl_str_find_first_of(const _CharT* __p, _SizeT __sz, const _CharT* __s, _Siz
   {
     return __npos;
   }
+#if !_CCCL_COMPILER(NVRTC)
+  if constexpr (__cccl_str_is_byte_string<_CharT, _Traits>)
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST,
+                   (return ::cuda::std::__cccl_str_byte_result<_CharT, _SizeT, __npos>(
+                             __p,
+                             ::cuda::std::__cccl_byte_find_first_of<false>(
+                               ::cuda::std::__cccl_str_bytes(__p + __pos),
+                               __sz - __pos,
+                               ::cuda::std::__cccl_str_bytes(__s),
+                               __n));))
+    }
+  }
+#endif // !_CCCL_COMPILER(NVRTC)
   const _CharT* __r = ::cuda::std::__find_first_of_ce(__p + __pos, __p + __sz, __s, __s + __n, _Traits::eq);
   if (__r == __p + __sz)
   {
@@ -206,6 +287,19 @@ __cccl_str_find_last_of(const _CharT* __p, _SizeT __sz, const _CharT* __s, _Size
   {
     __pos = __sz;
   }
+#if !_CCCL_COMPILER(NVRTC)
+  if constexpr (__cccl_str_is_byte_string<_CharT, _Traits>)
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST,
+                   (return ::cuda::std::__cccl_str_byte_result<_CharT, _SizeT, __npos>(
+                             __p,
+                             ::cuda::std::__cccl_byte_find_last_of<false>(
+                               ::cuda::std::__cccl_str_bytes(__p), __pos, ::cuda::std::__cccl_str_bytes(__s), __n));))
+    }
+  }
+#endif // !_CCCL_COMPILER(NVRTC)
   _SizeT __result = __npos;
   for (const _CharT* __ps = __p + __pos; __ps != __p;)
   {
@@ -226,6 +320,22 @@ __cccl_str_find_first_not_of(const _CharT* __p, _SizeT __sz, const _CharT* __s,
   {
     return __npos;
   }
+#if !_CCCL_COMPILER(NVRTC)
+  if constexpr (__cccl_str_is_byte_string<_CharT, _Traits>)
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST,
+                   (return ::cuda::std::__cccl_str_byte_result<_CharT, _SizeT, __npos>(
+                             __p,
+                             ::cuda::std::__cccl_byte_find_first_of<true>(
+                               ::cuda::std::__cccl_str_bytes(__p + __pos),
+                               __sz - __pos,
+                               ::cuda::std::__cccl_str_bytes(__s),
+                               __n));))
+    }
+  }
+#endif // !_CCCL_COMPILER(NVRTC)
   const _CharT* __pe = __p + __sz;
   _SizeT __result    = __npos;
   for (const _CharT* __ps = __p + __pos; __ps != __pe; ++__ps)
@@ -271,6 +381,19 @@ __cccl_str_find_last_not_of(const _CharT* __p, _SizeT __sz, const _CharT* __s, _
   {
     __pos = __sz;
   }
+#if !_CCCL_COMPILER(NVRTC)
+  if constexpr (__cccl_str_is_byte_string<_CharT, _Traits>)
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST,
+                   (return ::cuda::std::__cccl_str_byte_result<_CharT, _SizeT, __npos>(
+                             __p,
+                             ::cuda::std::__cccl_byte_find_last_of<true>(
+                               ::cuda::std::__cccl_str_bytes(__p), __pos, ::cuda::std::__cccl_str_bytes(__s), __n));))
+    }
+  }
+#endif // !_CCCL_COMPILER(NVRTC)
 
   _SizeT __result = __npos;
   for (const _CharT* __ps = __p + __pos; __ps != __p;)
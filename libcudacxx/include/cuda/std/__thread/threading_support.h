@@ -20,8 +20,12 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/std/__algorithm/clamp.h>
+#include <cuda/std/__atomic/functions/host.h>
+#include <cuda/std/__atomic/order.h>
 #include <cuda/std/__chrono/duration.h>
 #include <cuda/std/__chrono/high_resolution_clock.h>
+#include <cuda/std/__type_traits/remove_cvref.h>
 
 #if defined(_CCCL_HAS_THREAD_API_EXTERNAL)
 #  include <cuda/std/__thread/threading_support_external.h>
@@ -42,6 +46,7 @@
 _CCCL_BEGIN_NAMESPACE_CUDA_STD
 
 #define _LIBCUDACXX_POLLING_COUNT 16
+#define _LIBCUDACXX_YIELDING_COUNT 4
 
 #if _CCCL_HOST_ARCH(ARM64) && _CCCL_OS(LINUX)
 #  define __LIBCUDACXX_ASM_THREAD_YIELD (asm volatile("yield" :: :);)
@@ -56,27 +61,123 @@ _CCCL_HOST_DEVICE_API inline void __cccl_thread_yield_processor()
   NV_IF_TARGET(NV_IS_HOST, __LIBCUDACXX_ASM_THREAD_YIELD)
 }
 
-template <class _Fn>
+//! @brief The fixed backoff policy, which spins a given number of polls before parking.
+//!
+//! A backoff policy decides how __cccl_thread_spin_with_backoff and __cccl_thread_poll_with_backoff wait for a
+//! condition. They first spin, polling the condition with a processor yield in between, then poll a few times with a
+//! yield of the thread to the scheduler in between, and then park, giving the processor to other threads for growing
+//! periods. __spin_limit() returns the number of polls to spin, and __record() is told how many polls a spinning phase
+//! took and whether the condition was met before the limit.
+struct __cccl_fixed_backoff
+{
+  int __spins_ = _LIBCUDACXX_POLLING_COUNT;
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API int __spin_limit() const noexcept
+  {
+    return __spins_;
+  }
+
+  _CCCL_HOST_DEVICE_API void __record(int, bool) const noexcept {}
+};
+
+inline constexpr int __cccl_backoff_min_spins = 4;
+inline constexpr int __cccl_backoff_max_spins = 256;
+
+//! @brief The spin budget that __cccl_adaptive_backoff learned for the wait site @c _Site on the host
+template <class _Site>
+inline int __cccl_adaptive_spin_budget = _LIBCUDACXX_POLLING_COUNT;
+
+//! @brief The adaptive backoff policy, which learns the number of polls to spin per wait site on the host.
+//!
+//! A wait that is met while spinning moves the budget of its site towards twice the polls it took, any other wait
+//! shrinks it by an eighth. Sites with short waits keep spinning, which is cheaper than a round trip through the
+//! scheduler, while sites with longer waits yield right away instead of burning the processor, e.g. when there are
+//! more threads than processors and the thread that is waited for is not running. Concurrent updates of a budget may
+//! get lost, which only delays the learning. Device threads use the default budget of the fixed policy.
+//!
+//! @tparam _Site A type that identifies the wait site, e.g. the type of the polled condition
+template <class _Site>
+struct __cccl_adaptive_backoff
+{
+  [[nodiscard]] _CCCL_HOST_DEVICE_API int __spin_limit() const noexcept
+  {
+    NV_IF_ELSE_TARGET(
+      NV_IS_HOST,
+      (return ::cuda::std::__atomic_load_host(&__cccl_adaptive_spin_budget<_Site>, memory_order_relaxed);),
+      (return _LIBCUDACXX_POLLING_COUNT;))
+  }
+
+  _CCCL_HOST_DEVICE_API void __record([[maybe_unused]] int __spins, [[maybe_unused]] bool __met) const noexcept
+  {
+    NV_IF_TARGET(
+      NV_IS_HOST,
+      (int* const __budget = &__cccl_adaptive_spin_budget<_Site>;
+       const int __old     = ::cuda::std::__atomic_load_host(__budget, memory_order_relaxed);
+       const int __delta   = __met ? 2 * __spins - __old : -__old;
+       // Rounding away from zero lets the smallest budgets move at all
+       const int __step = (__delta > 0 ? __delta + 7 : __delta - 7) / 8;
+       const int __new  = (::cuda::std::clamp) (__old + __step, __cccl_backoff_min_spins, __cccl_backoff_max_spins);
+       if (__new != __old) { ::cuda::std::__atomic_store_host(__budget, __new, memory_order_relaxed); }))
+  }
+};
+
+//! @brief Polls @p __f, spinning for at most the spin limit of @p __policy and then yielding the thread a few times,
+//! and returns whether @p __f was met
+template <class _Fn, class _Policy>
+_CCCL_HOST_DEVICE_API inline bool __cccl_thread_spin_with_backoff(_Fn&& __f, _Policy __policy)
+{
+  const int __limit = __policy.__spin_limit();
+  for (int __spins = 0;; ++__spins)
+  {
+    if (__f())
+    {
+      // A condition that is met right away tells nothing about the length of the waits of a site
+      if (__spins != 0)
+      {
+        __policy.__record(__spins, true);
+      }
+      return true;
+    }
+    if (__spins >= __limit)
+    {
+      __policy.__record(__spins, false);
+      break;
+    }
+    ::cuda::std::__cccl_thread_yield_processor();
+  }
+  // Another thread on this processor may be the one that is waited for, which costs little when there is none
+  for (int __yields = 0; __yields < _LIBCUDACXX_YIELDING_COUNT; ++__yields)
+  {
+    ::cuda::std::__cccl_thread_yield();
+    if (__f())
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+//! @brief Polls @p __f until it is met or @p __max elapsed, spinning and yielding first as decided by @p __policy and
+//! then parking with sleeps that grow with the time spent waiting. A @p __max of zero waits without a time limit. By
+//! default every condition type is a wait site of its own that learns its spin budget.
+template <class _Fn, class _Policy = __cccl_adaptive_backoff<remove_cvref_t<_Fn>>>
 _CCCL_HOST_DEVICE_API inline bool __cccl_thread_poll_with_backoff(
-  _Fn&& __f, ::cuda::std::chrono::nanoseconds __max = ::cuda::std::chrono::nanoseconds::zero())
+  _Fn&& __f,
+  ::cuda::std::chrono::nanoseconds __max = ::cuda::std::chrono::nanoseconds::zero(),
+  _Policy __policy                       = _Policy{})
 {
   ::cuda::std::chrono::high_resolution_clock::time_point const __start =
     ::cuda::std::chrono::high_resolution_clock::now();
-  for (int __count = 0;;)
+  if (::cuda::std::__cccl_thread_spin_with_backoff(__f, __policy))
+  {
+    return true;
+  }
+  while (true)
   {
     if (__f())
     {
       return true;
     }
-    if (__count < _LIBCUDACXX_POLLING_COUNT)
-    {
-      if (__count > (_LIBCUDACXX_POLLING_COUNT >> 1))
-      {
-        ::cuda::std::__cccl_thread_yield_processor();
-      }
-      __count += 1;
-      continue;
-    }
     ::cuda::std::chrono::high_resolution_clock::duration const __elapsed =
       ::cuda::std::chrono::high_resolution_clock::now() - __start;
     if (__max != ::cuda::std::chrono::nanoseconds::zero() && __max < __elapsed)
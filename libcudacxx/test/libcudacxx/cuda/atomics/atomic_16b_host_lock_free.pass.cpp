@@ -0,0 +1,169 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: nvrtc
+
+// <cuda/std/atomic>
+
+// 16 byte atomics on the host, which are lock free with CCCL_ENABLE_HOST_ATOMICS_DWCAS and locked otherwise, are
+// linearizable under contention, and loads do not write to them
+
+#include <cuda/std/atomic>
+#include <cuda/std/cassert>
+#include <cuda/std/cstdint>
+
+#include "test_macros.h"
+
+#ifndef __CUDA_ARCH__
+#  include <thread>
+#  include <vector>
+
+struct node
+{
+  node* next;
+};
+
+// A pointer with a counter that changes on every update, so that a pop cannot succeed on a head that was popped and
+// pushed again in between
+struct alignas(16) tagged_ptr
+{
+  node* ptr;
+  cuda::std::uintptr_t tag;
+};
+
+struct wide
+{
+  cuda::std::uint64_t words[3];
+};
+
+static_assert(sizeof(tagged_ptr) == 16 || sizeof(void*) != 8);
+#  if _CCCL_HOST_ATOMICS_DWCAS()
+static_assert(cuda::std::atomic<tagged_ptr>::is_always_lock_free);
+#  endif // _CCCL_HOST_ATOMICS_DWCAS()
+static_assert(!cuda::std::atomic<wide>::is_always_lock_free);
+
+constexpr int num_threads    = 8;
+constexpr int num_iterations = 20000;
+
+template <class Fn>
+void run_threads(Fn fn)
+{
+  std::vector<std::thread> threads;
+  for (int i = 0; i < num_threads; ++i)
+  {
+    threads.emplace_back(fn);
+  }
+  for (std::thread& thread : threads)
+  {
+    thread.join();
+  }
+}
+
+void test_tagged_stack()
+{
+  cuda::std::atomic<tagged_ptr> head{tagged_ptr{nullptr, 0}};
+  assert(head.is_lock_free() == cuda::std::atomic<tagged_ptr>::is_always_lock_free);
+
+  std::vector<node> nodes(num_threads);
+  for (node& n : nodes)
+  {
+    tagged_ptr old = head.load();
+    n.next         = old.ptr;
+    head.store(tagged_ptr{&n, old.tag + 1});
+  }
+
+  run_threads([&] {
+    for (int i = 0; i < num_iterations; ++i)
+    {
+      // There are as many nodes as threads, so that a pop always finds one
+      tagged_ptr old = head.load();
+      while (!head.compare_exchange_weak(old, tagged_ptr{old.ptr->next, old.tag + 1}))
+      {
+      }
+      node* n = old.ptr;
+
+      old = head.load();
+      do
+      {
+        n->next = old.ptr;
+      } while (!head.compare_exchange_strong(old, tagged_ptr{n, old.tag + 1}));
+    }
+  });
+
+  const tagged_ptr final_head = head.load();
+  assert(final_head.tag == static_cast<cuda::std::uintptr_t>(num_threads + 2 * num_threads * num_iterations));
+  int count = 0;
+  for (node* n = final_head.ptr; n != nullptr; n = n->next)
+  {
+    ++count;
+  }
+  assert(count == num_threads);
+}
+
+#  if _CCCL_HAS_INT128()
+void test_int128()
+{
+  cuda::std::atomic<__uint128_t> counter{0};
+  const __uint128_t step = (__uint128_t{1} << 64) + 1;
+  run_threads([&] {
+    for (int i = 0; i < num_iterations; ++i)
+    {
+      counter.fetch_add(step);
+      counter.fetch_sub(1);
+    }
+  });
+  assert(counter.load() == (__uint128_t{num_threads * num_iterations} << 64));
+  assert(counter.exchange(3) == (__uint128_t{num_threads * num_iterations} << 64));
+  assert(counter.fetch_or(4) == 3);
+  assert(counter.fetch_and(6) == 7);
+  assert(counter.fetch_xor(6) == 6);
+  assert(counter.load() == 0);
+}
+#  endif // _CCCL_HAS_INT128()
+
+// Constant initialized without a mutable lock, so that the lock free atomic may be placed in read-only memory
+const cuda::std::atomic<tagged_ptr> read_only_head{tagged_ptr{nullptr, 42}};
+
+void test_read_only()
+{
+  const tagged_ptr value = read_only_head.load();
+  assert(value.ptr == nullptr);
+  assert(value.tag == 42);
+}
+
+void test_locked()
+{
+  cuda::std::atomic<wide> value{wide{{0, 0, 0}}};
+  run_threads([&] {
+    for (int i = 0; i < num_iterations; ++i)
+    {
+      wide old = value.load();
+      while (!value.compare_exchange_weak(old, wide{{old.words[0] + 1, old.words[1] + 2, old.words[2] + 3}}))
+      {
+      }
+    }
+  });
+  const wide result = value.load();
+  assert(result.words[0] == num_threads * num_iterations);
+  assert(result.words[1] == 2 * num_threads * num_iterations);
+  assert(result.words[2] == 3 * num_threads * num_iterations);
+}
+#endif // !__CUDA_ARCH__
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, (test_tagged_stack(); test_read_only(); test_locked();))
+#if _CCCL_HAS_INT128()
+  NV_IF_TARGET(NV_IS_HOST, (test_int128();))
+#endif // _CCCL_HAS_INT128()
+
+  return 0;
+}
@@ -0,0 +1,114 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: nvrtc
+
+// <cuda/atomic>
+
+#include <cuda/atomic>
+#include <cuda/std/cassert>
+#include <cuda/std/cstdint>
+#include <cuda/std/span>
+
+#include "test_macros.h"
+
+#ifndef __CUDA_ARCH__
+#  include <thread>
+#  include <vector>
+
+constexpr int num_threads    = 8;
+constexpr int num_iterations = 10000;
+
+void test_flush()
+{
+  int bins[5] = {};
+  {
+    cuda::privatizing_accumulator<int> acc(cuda::std::span<int>(bins), 4);
+    assert(acc.size() == 5);
+    acc.add(1, 2);
+    acc[3].fetch_add(5);
+    acc[3] += 1;
+    assert(acc.pending() == 3);
+    for (int bin : bins)
+    {
+      assert(bin == 0);
+    }
+
+    // The fourth addition reaches the threshold
+    acc[0]++;
+    assert(acc.pending() == 0);
+    assert(bins[0] == 1 && bins[1] == 2 && bins[2] == 0 && bins[3] == 6 && bins[4] == 0);
+
+    ++acc[4];
+    acc.flush();
+    assert(acc.pending() == 0);
+    assert(bins[4] == 1);
+
+    acc.add(2, 7);
+  }
+  // Destruction flushes
+  assert(bins[0] == 1 && bins[1] == 2 && bins[2] == 7 && bins[3] == 6 && bins[4] == 1);
+}
+
+template <class T, cuda::thread_scope Scope>
+void test_histogram(cuda::std::size_t flush_threshold)
+{
+  constexpr int num_bins = 17;
+  std::vector<T> bins(num_bins);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_threads; ++t)
+  {
+    threads.emplace_back([&, t] {
+      cuda::privatizing_accumulator<T, Scope> acc(cuda::std::span<T>(bins.data(), bins.size()), flush_threshold);
+      for (int i = 0; i < num_iterations; ++i)
+      {
+        // Most samples go to the first bin
+        const int bin = (i % 4 == 0) ? (i * 7 + t) % num_bins : 0;
+        acc[bin].fetch_add(T(1));
+      }
+    });
+  }
+  for (std::thread& thread : threads)
+  {
+    thread.join();
+  }
+
+  std::vector<T> expected(num_bins);
+  for (int t = 0; t < num_threads; ++t)
+  {
+    for (int i = 0; i < num_iterations; ++i)
+    {
+      expected[(i % 4 == 0) ? (i * 7 + t) % num_bins : 0] += T(1);
+    }
+  }
+  for (int bin = 0; bin < num_bins; ++bin)
+  {
+    assert(bins[bin] == expected[bin]);
+  }
+}
+
+void test()
+{
+  test_flush();
+  test_histogram<int, cuda::thread_scope_system>(cuda::std::numeric_limits<cuda::std::size_t>::max());
+  test_histogram<unsigned long long, cuda::thread_scope_device>(100);
+  test_histogram<cuda::std::uint16_t, cuda::thread_scope_system>(1000);
+  test_histogram<float, cuda::thread_scope_system>(1);
+  test_histogram<double, cuda::thread_scope_block>(64);
+}
+#endif // !__CUDA_ARCH__
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, (test();))
+
+  return 0;
+}
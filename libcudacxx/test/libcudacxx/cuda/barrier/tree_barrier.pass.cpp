@@ -0,0 +1,100 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: nvrtc
+
+// <cuda/barrier>
+
+#include <cuda/barrier>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+
+#ifndef __CUDA_ARCH__
+#  include <thread>
+#  include <vector>
+
+static_assert(cuda::tree_barrier<>::max() > 0);
+
+template <class Fn>
+void run_threads(int num_threads, Fn fn)
+{
+  std::vector<std::thread> threads;
+  for (int i = 0; i < num_threads; ++i)
+  {
+    threads.emplace_back(fn, i);
+  }
+  for (std::thread& thread : threads)
+  {
+    thread.join();
+  }
+}
+
+void test_phases(int num_threads)
+{
+  constexpr int num_phases = 300;
+  int completions          = 0;
+  std::vector<int> counters(num_threads);
+  auto completion = [&]() noexcept {
+    for (int counter : counters)
+    {
+      assert(counter == completions + 1);
+    }
+    ++completions;
+  };
+  cuda::tree_barrier<decltype(completion)> barrier(num_threads, completion);
+  run_threads(num_threads, [&](int i) {
+    for (int phase = 0; phase != num_phases; ++phase)
+    {
+      ++counters[i];
+      barrier.arrive_and_wait();
+      assert(completions == phase + 1);
+    }
+  });
+  assert(completions == num_phases);
+}
+
+void test_arrive_and_drop()
+{
+  cuda::tree_barrier<> barrier(4);
+  run_threads(4, [&](int i) {
+    if (i == 0)
+    {
+      barrier.arrive_and_drop();
+      return;
+    }
+    for (int phase = 0; phase != 100; ++phase)
+    {
+      barrier.arrive_and_wait();
+    }
+  });
+}
+
+void test_arrive_update()
+{
+  cuda::tree_barrier<> barrier(6);
+  run_threads(2, [&](int) {
+    for (int phase = 0; phase != 100; ++phase)
+    {
+      barrier.wait(barrier.arrive(3));
+    }
+  });
+}
+#endif // !__CUDA_ARCH__
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST,
+               (for (int num_threads : {1, 2, 3, 7, 16, 33}) { test_phases(num_threads); } test_arrive_and_drop();
+                test_arrive_update();))
+
+  return 0;
+}
@@ -0,0 +1,149 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/charconv>
+#include <cuda/std/cassert>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/cstring>
+#include <cuda/std/limits>
+#include <cuda/std/span>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+constexpr cuda::std::size_t num_values = 8;
+constexpr cuda::std::size_t buff_size  = 1100; // 8 values of 128 bits in base 2
+
+// The values of the batch, which are converted one by one with cuda::std::to_chars for reference
+template <class T>
+TEST_FUNC constexpr void fill_values(T (&values)[num_values])
+{
+  values[0] = T{0};
+  values[1] = T{7};
+  values[2] = T{10};
+  values[3] = T{99};
+  values[4] = cuda::std::numeric_limits<T>::max();
+  values[5] = cuda::std::numeric_limits<T>::min();
+  values[6] = static_cast<T>(cuda::std::numeric_limits<T>::max() / 3);
+  values[7] = static_cast<T>(cuda::std::numeric_limits<T>::min() / 3);
+}
+
+template <class T, class Offset>
+TEST_FUNC constexpr void test_batch(int base)
+{
+  T values[num_values]{};
+  fill_values(values);
+
+  char ref[buff_size]{};
+  cuda::std::size_t ref_offsets[num_values + 1]{};
+  char* ref_it = ref;
+  for (cuda::std::size_t i = 0; i < num_values; ++i)
+  {
+    const auto result = cuda::std::to_chars(ref_it, ref + buff_size, values[i], base);
+    assert(result.ec == cuda::std::errc{});
+    ref_it             = result.ptr;
+    ref_offsets[i + 1] = static_cast<cuda::std::size_t>(ref_it - ref);
+  }
+  const auto ref_size = ref_offsets[num_values];
+
+  // 1. The whole batch fits, with a buffer larger than needed, and exactly
+  for (const auto size : {buff_size, ref_size})
+  {
+    char buff[buff_size]{};
+    Offset offsets[num_values + 1]{};
+    const auto result = cuda::to_chars_batch(
+      buff, buff + size, cuda::std::span<const T>{values}, cuda::std::span<Offset>{offsets}, base);
+    assert(result.ec == cuda::std::errc{});
+    assert(result.ptr == buff + ref_size);
+    assert(cuda::std::strncmp(buff, ref, ref_size) == 0);
+    for (cuda::std::size_t i = 0; i <= num_values; ++i)
+    {
+      assert(static_cast<cuda::std::size_t>(offsets[i]) == ref_offsets[i]);
+    }
+  }
+
+  // 2. The batch does not fit, the values before the first one that does not fit are written with their offsets
+  {
+    const auto size = ref_offsets[5] - 1;
+    char buff[buff_size]{};
+    Offset offsets[num_values + 1]{};
+    const auto result = cuda::to_chars_batch(
+      buff, buff + size, cuda::std::span<const T>{values}, cuda::std::span<Offset>{offsets}, base);
+    assert(result.ec == cuda::std::errc::value_too_large);
+    assert(result.ptr == buff + size);
+    assert(cuda::std::strncmp(buff, ref, ref_offsets[4]) == 0);
+    for (cuda::std::size_t i = 0; i <= 4; ++i)
+    {
+      assert(static_cast<cuda::std::size_t>(offsets[i]) == ref_offsets[i]);
+    }
+  }
+
+  // 3. An empty batch only writes the first offset
+  {
+    char buff[1]{};
+    Offset offsets[1]{Offset{1}};
+    const auto result =
+      cuda::to_chars_batch(buff, buff, cuda::std::span<const T>{values, 0}, cuda::std::span<Offset>{offsets}, base);
+    assert(result.ec == cuda::std::errc{});
+    assert(result.ptr == buff);
+    assert(offsets[0] == Offset{0});
+  }
+}
+
+template <class T>
+TEST_FUNC constexpr void test_type()
+{
+  static_assert(cuda::std::is_same_v<cuda::std::to_chars_result,
+                                     decltype(cuda::to_chars_batch(
+                                       cuda::std::declval<char*>(),
+                                       cuda::std::declval<char*>(),
+                                       cuda::std::declval<cuda::std::span<const T>>(),
+                                       cuda::std::declval<cuda::std::span<cuda::std::size_t>>()))>);
+  static_assert(noexcept(cuda::to_chars_batch(
+    cuda::std::declval<char*>(),
+    cuda::std::declval<char*>(),
+    cuda::std::declval<cuda::std::span<T>>(),
+    cuda::std::declval<cuda::std::span<cuda::std::int32_t>>(),
+    int{})));
+
+  for (int base : {10, 2, 16, 7, 36})
+  {
+    test_batch<T, cuda::std::size_t>(base);
+    test_batch<T, cuda::std::int32_t>(base);
+  }
+}
+
+TEST_FUNC constexpr bool test()
+{
+  test_type<signed char>();
+  test_type<unsigned char>();
+  test_type<short>();
+  test_type<unsigned short>();
+  test_type<int>();
+  test_type<unsigned int>();
+  test_type<long>();
+  test_type<unsigned long>();
+  test_type<long long>();
+  test_type<unsigned long long>();
+#if _CCCL_HAS_INT128()
+  test_type<__int128_t>();
+  test_type<__uint128_t>();
+#endif // _CCCL_HAS_INT128()
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test());
+  return 0;
+}
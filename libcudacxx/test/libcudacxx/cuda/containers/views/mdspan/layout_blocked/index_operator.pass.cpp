@@ -0,0 +1,119 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <cuda/mdspan>
+
+// template<class... Indices>
+//   constexpr index_type operator()(Indices... i) const noexcept;
+//
+// For layout_blocked<T...>, the tiles are stored in row-major order and the elements of a tile in row-major order:
+//   index = sum over r of (i[r] / T[r]) * tile_stride[r] + (i[r] % T[r]) * (T[r+1] * ... * T[rank-1])
+
+#include <cuda/mdspan>
+#include <cuda/std/cassert>
+#include <cuda/std/cstddef>
+
+#include "test_macros.h"
+
+// Row-major model over the grid of padded tiles
+template <size_t... Tiles, class E>
+TEST_FUNC constexpr typename E::index_type expected_index(E e, const typename E::index_type (&idx)[E::rank() + 1])
+{
+  constexpr size_t tiles[] = {Tiles..., 1};
+  size_t tile_index        = 0;
+  size_t element_index     = 0;
+  for (size_t r = 0; r != E::rank(); ++r)
+  {
+    const size_t tile_count = (static_cast<size_t>(e.extent(r)) + tiles[r] - 1) / tiles[r];
+    tile_index              = tile_index * tile_count + static_cast<size_t>(idx[r]) / tiles[r];
+    element_index           = element_index * tiles[r] + static_cast<size_t>(idx[r]) % tiles[r];
+  }
+  size_t tile_size = 1;
+  for (size_t r = 0; r != E::rank(); ++r)
+  {
+    tile_size *= tiles[r];
+  }
+  return static_cast<typename E::index_type>(tile_index * tile_size + element_index);
+}
+
+template <size_t... Tiles, class E>
+TEST_FUNC constexpr void test_index_operator_2d(E e)
+{
+  using M = typename cuda::layout_blocked<Tiles...>::template mapping<E>;
+  using I = typename E::index_type;
+  const M m(e);
+  for (I i = 0; i != e.extent(0); ++i)
+  {
+    for (I j = 0; j != e.extent(1); ++j)
+    {
+      static_assert(noexcept(m(i, j)));
+      const I idx[] = {i, j, 0};
+      assert(m(i, j) == expected_index<Tiles...>(e, idx));
+      assert(m(i, j) < m.required_span_size());
+    }
+  }
+}
+
+template <size_t... Tiles, class E>
+TEST_FUNC constexpr void test_index_operator_3d(E e)
+{
+  using M = typename cuda::layout_blocked<Tiles...>::template mapping<E>;
+  using I = typename E::index_type;
+  const M m(e);
+  for (I i = 0; i != e.extent(0); ++i)
+  {
+    for (I j = 0; j != e.extent(1); ++j)
+    {
+      for (I k = 0; k != e.extent(2); ++k)
+      {
+        const I idx[] = {i, j, k, 0};
+        assert(m(i, j, k) == expected_index<Tiles...>(e, idx));
+        assert(m(i, j, k) < m.required_span_size());
+      }
+    }
+  }
+}
+
+TEST_FUNC constexpr bool test()
+{
+  constexpr size_t D = cuda::std::dynamic_extent;
+
+  // Rank-0 and rank-1, a rank-1 blocked layout is layout_right
+  {
+    const cuda::layout_blocked<>::mapping<cuda::std::extents<int>> m{};
+    assert(m() == 0);
+    const cuda::layout_blocked<4>::mapping<cuda::std::extents<int, D>> m1(cuda::std::extents<int, D>(10));
+    for (int i = 0; i != 10; ++i)
+    {
+      assert(m1(i) == i);
+    }
+  }
+
+  // Extents that are multiples of the tile extents
+  test_index_operator_2d<2, 2>(cuda::std::extents<int, 4, 4>());
+  test_index_operator_2d<2, 4>(cuda::std::extents<unsigned, D, D>(4, 8));
+  test_index_operator_2d<4, 2>(cuda::std::extents<size_t, D, 6>(8));
+
+  // Padded tiles at the end of the dimensions
+  test_index_operator_2d<4, 4>(cuda::std::extents<int, D, D>(7, 9));
+  test_index_operator_2d<3, 5>(cuda::std::extents<short, D, D>(10, 11));
+  test_index_operator_2d<8, 8>(cuda::std::extents<unsigned char, D, D>(3, 5));
+
+  test_index_operator_3d<2, 2, 2>(cuda::std::extents<int, 4, 4, 4>());
+  test_index_operator_3d<2, 3, 4>(cuda::std::extents<size_t, D, D, D>(5, 7, 6));
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test());
+  return 0;
+}
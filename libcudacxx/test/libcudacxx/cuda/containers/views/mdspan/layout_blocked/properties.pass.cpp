@@ -0,0 +1,98 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <cuda/mdspan>
+
+// Test properties of layout_blocked<T...>::mapping:
+//
+//     static constexpr bool is_always_unique() noexcept { return true; }
+//     static constexpr bool is_always_exhaustive() noexcept { return false; }
+//     static constexpr bool is_always_strided() noexcept { return false; }
+//
+//     constexpr bool is_exhaustive() const noexcept;  // true if no tile is padded
+//     constexpr index_type required_span_size() const noexcept;
+//
+// and the construction, conversion and comparison of the mappings
+
+#include <cuda/mdspan>
+#include <cuda/std/cassert>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+template <class M>
+TEST_FUNC constexpr void
+test_properties(const typename M::extents_type& e, typename M::index_type expected_size, bool expected_exhaustive)
+{
+  const M m(e);
+  static_assert(M::is_always_unique());
+  static_assert(!M::is_always_exhaustive());
+  static_assert(!M::is_always_strided());
+  static_assert(noexcept(m.required_span_size()));
+  static_assert(noexcept(m.is_exhaustive()));
+  assert(m.extents() == e);
+  assert(m.is_unique());
+  assert(!m.is_strided());
+  assert(m.required_span_size() == expected_size);
+  assert(m.is_exhaustive() == expected_exhaustive);
+}
+
+TEST_FUNC constexpr bool test()
+{
+  constexpr size_t D = cuda::std::dynamic_extent;
+  using E            = cuda::std::extents<int, D, D>;
+  using M            = cuda::layout_blocked<2, 4>::mapping<E>;
+
+  static_assert(cuda::std::is_same_v<M::layout_type, cuda::layout_blocked<2, 4>>);
+  static_assert(cuda::std::is_trivially_copyable_v<M>);
+  static_assert(M::tile_extent(0) == 2 && M::tile_extent(1) == 4);
+
+  test_properties<M>(E(4, 8), 32, true);
+  // 3 x 5 is padded to 4 x 8, the span ends after the last element (2, 4) at 1 * 16 + 1 * 8
+  test_properties<M>(E(3, 5), 25, false);
+  test_properties<M>(E(1, 1), 1, true);
+  test_properties<M>(E(0, 5), 0, true);
+  test_properties<M>(E(5, 0), 0, true);
+  test_properties<cuda::layout_blocked<>::mapping<cuda::std::extents<int>>>(cuda::std::extents<int>(), 1, true);
+
+  // The tile strides of a 6 x 9 array of 2 x 4 tiles, in a grid of 3 x 3 tiles
+  {
+    const M m(E(6, 9));
+    assert(m.tile_strides()[0] == 24);
+    assert(m.tile_strides()[1] == 8);
+    assert(m.origins()[0] == 0 && m.origins()[1] == 0);
+    // The last element (5, 8) is at 2 * 24 + 1 * 4 + 2 * 8 + 0 * 1
+    assert(m.required_span_size() == 69);
+  }
+
+  // Default construction, copy, conversion and comparison
+  {
+    const cuda::layout_blocked<2, 4>::mapping<cuda::std::extents<int, 4, 8>> s{};
+    assert(s.required_span_size() == 32);
+    const M d = s;
+    assert(d == s);
+    assert(d.extents().extent(0) == 4);
+    const cuda::layout_blocked<2, 4>::mapping<cuda::std::extents<int, 4, 8>> back(d);
+    assert(back == d);
+    static_assert(cuda::std::is_convertible_v<cuda::layout_blocked<2, 4>::mapping<cuda::std::extents<int, 4, 8>>, M>);
+    static_assert(!cuda::std::is_convertible_v<M, cuda::layout_blocked<2, 4>::mapping<cuda::std::extents<int, 4, 8>>>);
+    assert(M(E(3, 5)) != M(E(4, 8)));
+    assert(M(E(4, 8)) != M(E(4, 8), {8, 2}, {0, 0}));
+    assert(M(E(4, 8)) != M(E(4, 8), {16, 8}, {1, 0}));
+  }
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test());
+  return 0;
+}
@@ -0,0 +1,69 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <cuda/mdspan>
+
+// cuda::std::linalg::transposed of the mdspans with the layout_blocked and layout_morton layouts, which are wrapped
+// in layout_transpose
+
+#include <cuda/mdspan>
+#include <cuda/std/cassert>
+#include <cuda/std/cstddef>
+#include <cuda/std/linalg>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+template <class Layout>
+TEST_FUNC constexpr void test_transposed()
+{
+  constexpr size_t D = cuda::std::dynamic_extent;
+  using E            = cuda::std::extents<int, D, D>;
+
+  int data[16 * 16]{};
+  const cuda::std::mdspan<int, E, Layout> md(data, typename Layout::template mapping<E>(E(5, 11)));
+  const auto transposed_md = cuda::std::linalg::transposed(md);
+  static_assert(
+    cuda::std::is_same_v<typename decltype(transposed_md)::layout_type, cuda::std::linalg::layout_transpose<Layout>>);
+
+  assert(transposed_md.extent(0) == 11);
+  assert(transposed_md.extent(1) == 5);
+  assert(transposed_md.mapping().required_span_size() == md.mapping().required_span_size());
+  assert(transposed_md.is_unique() == md.is_unique());
+  assert(transposed_md.is_exhaustive() == md.is_exhaustive());
+  assert(transposed_md.is_strided() == md.is_strided());
+  for (int i = 0; i != 11; ++i)
+  {
+    for (int j = 0; j != 5; ++j)
+    {
+      assert(&transposed_md(i, j) == &md(j, i));
+    }
+  }
+
+  // Transposing twice returns the original layout
+  const auto twice = cuda::std::linalg::transposed(transposed_md);
+  static_assert(cuda::std::is_same_v<typename decltype(twice)::layout_type, Layout>);
+  assert(twice.mapping() == md.mapping());
+}
+
+TEST_FUNC constexpr bool test()
+{
+  test_transposed<cuda::layout_blocked<4, 4>>();
+  test_transposed<cuda::layout_blocked<2, 8>>();
+  test_transposed<cuda::layout_morton>();
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test());
+  return 0;
+}
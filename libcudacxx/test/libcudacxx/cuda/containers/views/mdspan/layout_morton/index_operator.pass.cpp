@@ -0,0 +1,128 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <cuda/mdspan>
+
+// template<class... Indices>
+//   constexpr index_type operator()(Indices... i) const noexcept;
+//
+// For layout_morton, the square tiles of extent 2^m are stored in row-major order, and the elements of a tile in
+// Morton order, which interleaves the low m bits of the indices with the first index in the most significant bit.
+
+#include <cuda/mdspan>
+#include <cuda/std/cassert>
+#include <cuda/std/cstddef>
+
+#include "test_macros.h"
+
+// Interleaves the bits of the indices one at a time, and stores the tiles in row-major order
+template <class E>
+TEST_FUNC constexpr size_t expected_index(E e, size_t tile, const size_t (&idx)[E::rank()])
+{
+  size_t tile_index = 0;
+  size_t morton     = 0;
+  size_t bit        = 1;
+  for (size_t r = 0; r != E::rank(); ++r)
+  {
+    tile_index = tile_index * ((static_cast<size_t>(e.extent(r)) + tile - 1) / tile) + idx[r] / tile;
+  }
+  for (size_t b = 1; b < tile; b <<= 1)
+  {
+    for (size_t r = E::rank(); r-- > 0;)
+    {
+      if (idx[r] % tile & b)
+      {
+        morton |= bit;
+      }
+      bit <<= 1;
+    }
+  }
+  size_t tile_size = 1;
+  for (size_t r = 0; r != E::rank(); ++r)
+  {
+    tile_size *= tile;
+  }
+  return tile_index * tile_size + morton;
+}
+
+template <class E>
+TEST_FUNC constexpr void test_index_operator_2d(E e, size_t tile)
+{
+  using M = cuda::layout_morton::mapping<E>;
+  using I = typename E::index_type;
+  const M m(e, static_cast<I>(tile));
+  assert(static_cast<size_t>(m.tile_extent()) == tile);
+  for (I i = 0; i != e.extent(0); ++i)
+  {
+    for (I j = 0; j != e.extent(1); ++j)
+    {
+      static_assert(noexcept(m(i, j)));
+      const size_t idx[] = {static_cast<size_t>(i), static_cast<size_t>(j)};
+      assert(static_cast<size_t>(m(i, j)) == expected_index(e, tile, idx));
+      assert(m(i, j) < m.required_span_size());
+    }
+  }
+}
+
+template <class E>
+TEST_FUNC constexpr void test_index_operator_3d(E e, size_t tile)
+{
+  using M = cuda::layout_morton::mapping<E>;
+  using I = typename E::index_type;
+  const M m(e, static_cast<I>(tile));
+  assert(static_cast<size_t>(m.tile_extent()) == tile);
+  for (I i = 0; i != e.extent(0); ++i)
+  {
+    for (I j = 0; j != e.extent(1); ++j)
+    {
+      for (I k = 0; k != e.extent(2); ++k)
+      {
+        const size_t idx[] = {static_cast<size_t>(i), static_cast<size_t>(j), static_cast<size_t>(k)};
+        assert(static_cast<size_t>(m(i, j, k)) == expected_index(e, tile, idx));
+        assert(m(i, j, k) < m.required_span_size());
+      }
+    }
+  }
+}
+
+TEST_FUNC constexpr bool test()
+{
+  constexpr size_t D = cuda::std::dynamic_extent;
+
+  // The Z-order of a 4 x 4 array
+  {
+    const cuda::layout_morton::mapping<cuda::std::extents<int, 4, 4>> m{};
+    assert(m(0, 0) == 0 && m(0, 1) == 1 && m(1, 0) == 2 && m(1, 1) == 3);
+    assert(m(0, 2) == 4 && m(0, 3) == 5 && m(1, 2) == 6 && m(1, 3) == 7);
+    assert(m(2, 0) == 8 && m(3, 3) == 15);
+  }
+
+  // Square arrays of a power of two extent are a single tile
+  test_index_operator_2d(cuda::std::extents<int, 16, 16>(), 16);
+  test_index_operator_2d(cuda::std::extents<unsigned, D, D>(8, 8), 8);
+
+  // The other arrays are split in tiles, the last of which are padded
+  test_index_operator_2d(cuda::std::extents<int, D, D>(4, 16), 4);
+  test_index_operator_2d(cuda::std::extents<size_t, D, D>(13, 6), 4);
+  test_index_operator_2d(cuda::std::extents<short, D, D>(1, 7), 1);
+  test_index_operator_2d(cuda::std::extents<unsigned char, D, D>(11, 12), 8);
+
+  test_index_operator_3d(cuda::std::extents<int, 4, 4, 4>(), 4);
+  test_index_operator_3d(cuda::std::extents<size_t, D, D, D>(5, 9, 6), 4);
+  test_index_operator_3d(cuda::std::extents<unsigned, D, D, D>(3, 8, 2), 2);
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test());
+  return 0;
+}
@@ -0,0 +1,114 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <cuda/mdspan>
+
+// Test properties of layout_morton::mapping:
+//
+//     static constexpr bool is_always_unique() noexcept { return true; }
+//     static constexpr bool is_always_exhaustive() noexcept { return false; }
+//     static constexpr bool is_always_strided() noexcept { return false; }
+//
+//     constexpr bool is_exhaustive() const noexcept;  // true if no tile is padded
+//     constexpr index_type required_span_size() const noexcept;
+//
+// and the construction, conversion and comparison of the mappings
+
+#include <cuda/mdspan>
+#include <cuda/std/cassert>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+template <class M>
+TEST_FUNC constexpr void test_properties(const M& m, typename M::index_type expected_size, bool expected_exhaustive)
+{
+  static_assert(M::is_always_unique());
+  static_assert(!M::is_always_exhaustive());
+  static_assert(!M::is_always_strided());
+  static_assert(noexcept(m.required_span_size()));
+  static_assert(noexcept(m.is_exhaustive()));
+  assert(m.is_unique());
+  assert(!m.is_strided());
+  assert(m.required_span_size() == expected_size);
+  assert(m.is_exhaustive() == expected_exhaustive);
+}
+
+TEST_FUNC constexpr bool test()
+{
+  constexpr size_t D = cuda::std::dynamic_extent;
+  using E            = cuda::std::extents<int, D, D>;
+  using M            = cuda::layout_morton::mapping<E>;
+
+  static_assert(cuda::std::is_same_v<M::layout_type, cuda::layout_morton>);
+  static_assert(cuda::std::is_trivially_copyable_v<M>);
+
+  test_properties(M(E(8, 8)), 64, true);
+  test_properties(M(E(4, 12)), 48, true);
+  // 6 x 5 is split in 4 x 4 tiles, the span ends after the last element (5, 4) at 1 * 32 + 1 * 16 + 2
+  test_properties(M(E(6, 5), 4), 51, false);
+  test_properties(M(E(0, 5)), 0, true);
+  test_properties(cuda::layout_morton::mapping<cuda::std::dims<3, int>>(cuda::std::dims<3, int>(2, 4, 2)), 16, true);
+
+  // The default tile extent is the largest power of two up to 32 that pads every dimension by at most an eighth of its
+  // extent, so the extents just above a power of two are not padded to the next one
+  {
+    assert(M(E(8, 8)).tile_extent() == 8);
+    assert(M(E(6, 5)).tile_extent() == 1);
+    assert(M(E(13, 6)).tile_extent() == 2);
+    assert(M(E(64, 128)).tile_extent() == 32);
+    assert(M(E(513, 513)).tile_extent() == 32);
+    assert(M(E(513, 513)).required_span_size() == 294913);
+    assert(M(E(600, 600)).required_span_size() == 369472);
+
+    using E3 = cuda::std::dims<3, int>;
+    using M3 = cuda::layout_morton::mapping<E3>;
+    assert(M3(E3(3, 8, 2)).tile_extent() == 1);
+    assert(M3(E3(513, 513, 513)).tile_extent() == 32);
+    assert(M3(E3(513, 513, 513)).required_span_size() == 160956417);
+    assert(M3(E3(600, 600, 600)).required_span_size() == 224752128);
+  }
+
+  // The tile extent and the tile strides
+  {
+    const M m(E(6, 5), 4);
+    assert(m.tile_extent() == 4);
+    assert(m.tile_strides()[0] == 32 && m.tile_strides()[1] == 16);
+    assert(m.origins()[0] == 0 && m.origins()[1] == 0);
+
+    // A smaller tile extent can be chosen
+    const M small(E(6, 5), 2);
+    assert(small.tile_extent() == 2);
+    assert(small.tile_strides()[0] == 12 && small.tile_strides()[1] == 4);
+    assert(small(2, 3) == 12 + 4 + 1);
+  }
+
+  // Default construction, copy, conversion and comparison
+  {
+    const cuda::layout_morton::mapping<cuda::std::extents<int, 4, 8>> s{};
+    assert(s.required_span_size() == 32);
+    const M d = s;
+    assert(d == s);
+    const cuda::layout_morton::mapping<cuda::std::extents<int, 4, 8>> back(d);
+    assert(back == d);
+    static_assert(cuda::std::is_convertible_v<cuda::layout_morton::mapping<cuda::std::extents<int, 4, 8>>, M>);
+    static_assert(!cuda::std::is_convertible_v<M, cuda::layout_morton::mapping<cuda::std::extents<int, 4, 8>>>);
+    assert(M(E(4, 8)) != M(E(4, 8), 2));
+    assert(M(E(4, 8)) != M(E(8, 4)));
+  }
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test());
+  return 0;
+}
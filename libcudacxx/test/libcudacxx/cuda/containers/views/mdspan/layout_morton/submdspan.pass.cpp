@@ -0,0 +1,124 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <cuda/mdspan>
+
+// template<class... SliceSpecifiers>
+//   friend constexpr auto submdspan_mapping(const mapping& src, SliceSpecifiers... slices);
+//
+// The slices that select contiguous ranges of indices return a window of the array, which is still a
+// layout_morton mapping. The other slices are not supported.
+
+#include <cuda/mdspan>
+#include <cuda/std/cassert>
+#include <cuda/std/cstddef>
+#include <cuda/std/type_traits>
+#include <cuda/std/utility>
+
+#include "test_macros.h"
+
+template <class Sub, class Parent>
+TEST_FUNC constexpr void check_window(const Sub& sub, const Parent& parent, int first0, int first1)
+{
+  for (int i = 0; i != sub.extent(0); ++i)
+  {
+    for (int j = 0; j != sub.extent(1); ++j)
+    {
+      assert(&sub(i, j) == &parent(first0 + i, first1 + j));
+    }
+  }
+}
+
+template <class M, class S0, class S1, class = void>
+struct has_submdspan_mapping : cuda::std::false_type
+{};
+
+template <class M, class S0, class S1>
+struct has_submdspan_mapping<
+  M,
+  S0,
+  S1,
+  cuda::std::void_t<decltype(submdspan_mapping(
+    cuda::std::declval<const M&>(), cuda::std::declval<S0>(), cuda::std::declval<S1>()))>>
+    : cuda::std::true_type
+{};
+
+TEST_FUNC constexpr bool test()
+{
+  constexpr size_t D = cuda::std::dynamic_extent;
+  using E            = cuda::std::extents<int, D, D>;
+  using L            = cuda::layout_morton;
+
+  int data[12 * 10]{};
+  const cuda::std::mdspan<int, E, L> md(data, L::mapping<E>(E(9, 7)));
+  for (int i = 0; i != md.mapping().required_span_size(); ++i)
+  {
+    data[i] = i;
+  }
+
+  // full_extent_t keeps the mapping
+  {
+    const auto sub = cuda::std::submdspan(md, cuda::std::full_extent, cuda::std::full_extent);
+    static_assert(cuda::std::is_same_v<decltype(sub), const cuda::std::mdspan<int, E, L>>);
+    assert(sub.mapping() == md.mapping());
+    assert(sub.data_handle() == md.data_handle());
+  }
+
+  // Index pairs and unit stride strided_slice start inside a tile
+  {
+    const auto sub = cuda::std::submdspan(md, cuda::std::pair{3, 8}, cuda::std::full_extent);
+    static_assert(cuda::std::is_same_v<typename decltype(sub)::layout_type, L>);
+    assert(sub.extent(0) == 5 && sub.extent(1) == 7);
+    assert(sub.mapping().origins()[0] == 3 && sub.mapping().origins()[1] == 0);
+    assert(sub.data_handle() == md.data_handle());
+    check_window(sub, md, 3, 0);
+  }
+  {
+    const auto sub = cuda::std::submdspan(
+      md,
+      cuda::std::strided_slice{1, 6, cuda::std::integral_constant<int, 1>{}},
+      cuda::std::strided_slice{3, 4, cuda::std::integral_constant<int, 1>{}});
+    assert(sub.extent(0) == 6 && sub.extent(1) == 4);
+    check_window(sub, md, 1, 3);
+
+    // Windows of windows accumulate their origins
+    const auto sub_sub = cuda::std::submdspan(sub, cuda::std::pair{2, 5}, cuda::std::pair{1, 3});
+    assert(sub_sub.mapping().origins()[0] == 3 && sub_sub.mapping().origins()[1] == 4);
+    check_window(sub_sub, md, 3, 4);
+  }
+
+  // Static extents
+  {
+    using SE = cuda::std::extents<int, 8, 4>;
+    const cuda::std::mdspan<int, SE, L> smd(data);
+    const auto sub = cuda::std::submdspan(
+      smd,
+      cuda::std::pair{cuda::std::integral_constant<int, 2>{}, cuda::std::integral_constant<int, 6>{}},
+      cuda::std::full_extent);
+    static_assert(decltype(sub)::static_extent(0) == 4 && decltype(sub)::static_extent(1) == 4);
+    check_window(sub, smd, 2, 0);
+  }
+
+  // The rank-reducing slices and the strided slices are not supported
+  {
+    using M = L::mapping<E>;
+    static_assert(has_submdspan_mapping<M, cuda::std::full_extent_t, cuda::std::pair<int, int>>::value);
+    static_assert(!has_submdspan_mapping<M, int, cuda::std::full_extent_t>::value);
+    static_assert(!has_submdspan_mapping<M, cuda::std::full_extent_t, cuda::std::strided_slice<int, int, int>>::value);
+  }
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test());
+  return 0;
+}
@@ -0,0 +1,160 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <cuda/std/format>
+
+// cuda::std::__fmt_compiled_format, the steps of a format string compiled by the validation of basic_format_string.
+// Without consteval the format strings are not compiled and are no larger than their string view.
+
+#include <cuda/std/__format_>
+#include <cuda/std/cassert>
+#include <cuda/std/cstddef>
+#include <cuda/std/string_view>
+#include <cuda/std/utility>
+
+#include "test_macros.h"
+
+struct point
+{
+  int x;
+  int y;
+};
+
+template <>
+struct cuda::std::formatter<point, char>
+{
+  TEST_FUNC constexpr auto parse(cuda::std::format_parse_context& ctx)
+  {
+    auto it = ctx.begin();
+    if (it != ctx.end() && *it == 'y')
+    {
+      only_y = true;
+      ++it;
+    }
+    return it;
+  }
+
+  TEST_FUNC auto format(point p, cuda::std::format_context& ctx) const
+  {
+    cuda::std::formatter<int, char> int_formatter;
+    if (!only_y)
+    {
+      ctx.advance_to(int_formatter.format(p.x, ctx));
+      *ctx.out()++ = ',';
+    }
+    return int_formatter.format(p.y, ctx);
+  }
+
+  bool only_y = false;
+};
+
+using op_kind = cuda::std::__fmt_compiled_op_kind;
+
+// The arguments are trivially copyable values, which are passed as rvalues to match the type of the format string
+template <class... Args>
+TEST_FUNC void check(cuda::std::string_view expected, cuda::std::format_string<Args...> fmt, Args... args)
+{
+  char buff[128]{};
+  char* const end = cuda::std::format_to(buff, fmt, cuda::std::move(args)...);
+  assert(cuda::std::string_view(buff, end - buff) == expected);
+  assert(cuda::std::formatted_size(fmt, cuda::std::move(args)...) == expected.size());
+
+  const auto result = cuda::std::format_to_n(buff, 4, fmt, cuda::std::move(args)...);
+  assert(result.size == static_cast<cuda::std::ptrdiff_t>(expected.size()));
+  assert(cuda::std::string_view(buff, result.out - buff) == expected.substr(0, 4));
+}
+
+#if !defined(_CCCL_NO_CONSTEVAL)
+TEST_FUNC void test_compiled()
+{
+  // 1. Literals, the escaped braces are copied without the second brace
+  {
+    constexpr cuda::std::format_string<> fmt{"a{{b}}c"};
+    static_assert(fmt.__get_compiled().__valid_);
+    static_assert(fmt.__get_compiled().__size_ == 3);
+    static_assert(fmt.__get_compiled().__ops_[0].__kind_ == op_kind::__literal);
+    static_assert(fmt.__get_compiled().__ops_[0].__begin_ == 0 && fmt.__get_compiled().__ops_[0].__size_ == 2);
+    static_assert(fmt.__get_compiled().__ops_[1].__begin_ == 3 && fmt.__get_compiled().__ops_[1].__size_ == 2);
+    static_assert(fmt.__get_compiled().__ops_[2].__begin_ == 6 && fmt.__get_compiled().__ops_[2].__size_ == 1);
+    check("a{b}c", fmt);
+  }
+
+  // 2. Fields with automatic and manual indexing, with and without format specification
+  {
+    constexpr cuda::std::format_string<int, const char*> fmt{"[{:>5}] {}"};
+    static_assert(fmt.__get_compiled().__valid_);
+    static_assert(fmt.__get_compiled().__size_ == 4);
+    static_assert(fmt.__get_compiled().__ops_[1].__kind_ == op_kind::__field_spec);
+    static_assert(fmt.__get_compiled().__ops_[1].__arg_id_ == 0);
+    static_assert(fmt.__get_compiled().__ops_[3].__kind_ == op_kind::__field);
+    static_assert(fmt.__get_compiled().__ops_[3].__arg_id_ == 1);
+    check("[   42] message", fmt, 42, static_cast<const char*>("message"));
+  }
+  {
+    constexpr cuda::std::format_string<int, char> fmt{"{1}{0:#x}"};
+    static_assert(fmt.__get_compiled().__valid_);
+    static_assert(fmt.__get_compiled().__size_ == 2);
+    check("z0x2a", fmt, 42, 'z');
+  }
+
+  // 3. A user-defined formatter without format specification parses its empty specification when formatting
+  {
+    constexpr cuda::std::format_string<point> fmt{"p={}!"};
+    static_assert(fmt.__get_compiled().__valid_);
+    check("p=1,2!", fmt, point{1, 2});
+  }
+}
+
+TEST_FUNC void test_not_compiled()
+{
+  // 1. More steps than the capacity, when an argument is formatted several times
+  {
+    constexpr cuda::std::format_string<int> fmt{"{0} {0} {0} {0}"};
+    static_assert(!fmt.__get_compiled().__valid_);
+    check("1 1 1 1", fmt, 1);
+  }
+
+  // 2. A user-defined formatter with format specification
+  {
+    constexpr cuda::std::format_string<point> fmt{"p={:y}"};
+    static_assert(!fmt.__get_compiled().__valid_);
+    check("p=2", fmt, point{1, 2});
+  }
+
+  // 3. The runtime format strings
+  {
+    const cuda::std::format_string<int> fmt{cuda::std::dynamic_format("{}")};
+    assert(!fmt.__get_compiled().__valid_);
+    check("7", fmt, 7);
+  }
+}
+#else // ^^^ !_CCCL_NO_CONSTEVAL ^^^ / vvv _CCCL_NO_CONSTEVAL vvv
+TEST_FUNC void test_not_compiled()
+{
+  static_assert(sizeof(cuda::std::format_string<>) == sizeof(cuda::std::string_view));
+  static_assert(sizeof(cuda::std::format_string<int, const char*, point>) == sizeof(cuda::std::string_view));
+
+  check("a{b}c", "a{{b}}c");
+  check("[   42] message", "[{:>5}] {}", 42, static_cast<const char*>("message"));
+  check("1 1 1 1", "{0} {0} {0} {0}", 1);
+  check("p=1,2!", "p={}!", point{1, 2});
+  check("p=2", "p={:y}", point{1, 2});
+  check("7", cuda::std::dynamic_format("{}"), 7);
+}
+#endif // ^^^ _CCCL_NO_CONSTEVAL ^^^
+
+int main(int, char**)
+{
+#if !defined(_CCCL_NO_CONSTEVAL)
+  test_compiled();
+#endif // !_CCCL_NO_CONSTEVAL
+  test_not_compiled();
+  return 0;
+}
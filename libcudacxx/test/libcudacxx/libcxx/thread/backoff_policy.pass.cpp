@@ -0,0 +1,148 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: nvrtc
+
+// <cuda/std/atomic>
+
+// The backoff policies of __cccl_thread_poll_with_backoff: a user supplied policy decides the polls to spin and sees
+// the outcome, and the adaptive policy learns the spin budget of a wait site from it
+
+#include <cuda/std/atomic>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+
+#ifndef __CUDA_ARCH__
+struct counting_policy
+{
+  int limit;
+  int* spins;
+  bool* met;
+
+  int __spin_limit() const noexcept
+  {
+    return limit;
+  }
+
+  void __record(int s, bool m) const noexcept
+  {
+    *spins = s;
+    *met   = m;
+  }
+};
+
+void test_custom_policy()
+{
+  int spins = -1;
+  bool met  = false;
+  int polls = 0;
+
+  // Met while spinning
+  assert(cuda::std::__cccl_thread_poll_with_backoff(
+    [&] {
+      return ++polls == 5;
+    },
+    cuda::std::chrono::nanoseconds::zero(),
+    counting_policy{8, &spins, &met}));
+  assert(polls == 5 && spins == 4 && met);
+
+  // Met after parking
+  polls = 0;
+  assert(cuda::std::__cccl_thread_poll_with_backoff(
+    [&] {
+      return ++polls == 20;
+    },
+    cuda::std::chrono::nanoseconds::zero(),
+    counting_policy{8, &spins, &met}));
+  assert(polls == 20 && spins == 8 && !met);
+
+  // Never met
+  polls = 0;
+  assert(!cuda::std::__cccl_thread_poll_with_backoff(
+    [&] {
+      return ++polls < 0;
+    },
+    cuda::std::chrono::microseconds(100),
+    counting_policy{2, &spins, &met}));
+  assert(polls > 2 && spins == 2 && !met);
+}
+
+template <int>
+struct site
+{};
+
+void test_adaptive_policy()
+{
+  using shrinking = cuda::std::__cccl_adaptive_backoff<site<0>>;
+  using growing   = cuda::std::__cccl_adaptive_backoff<site<1>>;
+
+  // Waits that are not met while spinning shrink the budget to the minimum, whether they are met while yielding
+  for (int i = 0; i != 100; ++i)
+  {
+    int polls        = 0;
+    const int needed = shrinking{}.__spin_limit() + 1 + i % 2;
+    assert(cuda::std::__cccl_thread_spin_with_backoff(
+      [&] {
+        return polls++ == needed;
+      },
+      shrinking{}));
+  }
+  assert(shrinking{}.__spin_limit() == cuda::std::__cccl_backoff_min_spins);
+  // or not at all
+  for (int i = 0; i != 100; ++i)
+  {
+    assert(!cuda::std::__cccl_thread_spin_with_backoff(
+      [] {
+        return false;
+      },
+      shrinking{}));
+  }
+  assert(shrinking{}.__spin_limit() == cuda::std::__cccl_backoff_min_spins);
+
+  // Waits that are met at the end of the budget grow it up to the maximum, starting from the minimum
+  growing{}.__record(0, false);
+  for (int i = 0; i != 100; ++i)
+  {
+    growing{}.__record(cuda::std::__cccl_backoff_min_spins, false);
+  }
+  assert(growing{}.__spin_limit() == cuda::std::__cccl_backoff_min_spins);
+  for (int i = 0; i != 1000; ++i)
+  {
+    int polls        = 0;
+    const int needed = growing{}.__spin_limit();
+    assert(cuda::std::__cccl_thread_spin_with_backoff(
+      [&] {
+        return polls++ == needed;
+      },
+      growing{}));
+  }
+  assert(growing{}.__spin_limit() == cuda::std::__cccl_backoff_max_spins);
+
+  // Conditions that are met right away do not change the budget of their site
+  for (int i = 0; i != 100; ++i)
+  {
+    assert(cuda::std::__cccl_thread_spin_with_backoff(
+      [] {
+        return true;
+      },
+      growing{}));
+  }
+  assert(growing{}.__spin_limit() == cuda::std::__cccl_backoff_max_spins);
+}
+#endif // !__CUDA_ARCH__
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, (test_custom_policy(); test_adaptive_policy();))
+
+  return 0;
+}
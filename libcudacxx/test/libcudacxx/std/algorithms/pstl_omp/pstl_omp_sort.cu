@@ -0,0 +1,108 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// The standard parallel policies run on the OpenMP backend for host ranges
+
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+#include <cuda/std/functional>
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <testing.cuh>
+
+#include "test_macros.h"
+#include "test_pstl.h"
+
+static_assert(_CCCL_HAS_BACKEND_OMP(), "These tests require the OpenMP backend");
+
+C2H_TEST("OpenMP backend of sort and merge", "[parallel algorithm]")
+{
+  const int size = GENERATE(0, 1, 1000, 100000);
+  c2h::device_vector<int> d_data(size, thrust::no_init);
+  c2h::gen(C2H_SEED(1), d_data, 0, 1000);
+  c2h::host_vector<int> h_data = d_data;
+  const std::vector<int> data(h_data.begin(), h_data.end());
+  const auto policy = cuda::std::execution::par;
+
+  SECTION("sort")
+  {
+    std::vector<int> result   = data;
+    std::vector<int> expected = data;
+    cuda::std::sort(policy, result.begin(), result.end());
+    std::sort(expected.begin(), expected.end());
+    CHECK(result == expected);
+
+    cuda::std::sort(policy, result.begin(), result.end(), cuda::std::greater<>{});
+    std::sort(expected.begin(), expected.end(), std::greater<>{});
+    CHECK(result == expected);
+  }
+
+  SECTION("sort of non-trivial elements")
+  {
+    // strings are moved between the input and a temporary buffer, so lost elements would show up as empty strings
+    std::vector<std::string> result(size);
+    for (int i = 0; i < size; ++i)
+    {
+      result[i] = std::to_string(data[i]);
+    }
+    std::vector<std::string> expected = result;
+    cuda::std::sort(policy, result.begin(), result.end());
+    std::sort(expected.begin(), expected.end());
+    CHECK(result == expected);
+  }
+
+  SECTION("merge")
+  {
+    std::vector<int> lhs(data.begin(), data.begin() + size / 3);
+    std::vector<int> rhs(data.begin() + size / 3, data.end());
+    std::sort(lhs.begin(), lhs.end());
+    std::sort(rhs.begin(), rhs.end());
+
+    std::vector<int> result(size);
+    std::vector<int> expected(size);
+    auto end = cuda::std::merge(policy, lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), result.begin());
+    CHECK(end == result.end());
+    std::merge(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), expected.begin());
+    CHECK(result == expected);
+  }
+
+  SECTION("merge is stable")
+  {
+    // equivalent elements of the first range precede the ones of the second range
+    std::vector<std::pair<int, int>> lhs(size / 2);
+    std::vector<std::pair<int, int>> rhs(size - size / 2);
+    for (int i = 0; i < size; ++i)
+    {
+      if (i < size / 2)
+      {
+        lhs[i] = {data[i] % 10, i};
+      }
+      else
+      {
+        rhs[i - size / 2] = {data[i] % 10, i};
+      }
+    }
+    const auto by_key = [](const std::pair<int, int>& x, const std::pair<int, int>& y) {
+      return x.first < y.first;
+    };
+    std::stable_sort(lhs.begin(), lhs.end(), by_key);
+    std::stable_sort(rhs.begin(), rhs.end(), by_key);
+
+    std::vector<std::pair<int, int>> result(size);
+    std::vector<std::pair<int, int>> expected(size);
+    cuda::std::merge(policy, lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), result.begin(), by_key);
+    std::merge(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), expected.begin(), by_key);
+    CHECK(result == expected);
+  }
+}
@@ -0,0 +1,93 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// cuda::execution::tbb_par runs the parallel algorithms on the oneTBB backend for host ranges
+
+#include <cuda/execution>
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+#include <cuda/std/functional>
+#include <cuda/std/numeric>
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <testing.cuh>
+
+#include "test_macros.h"
+#include "test_pstl.h"
+
+static_assert(_CCCL_HAS_BACKEND_TBB(), "These tests require the oneTBB backend");
+
+C2H_TEST("oneTBB backend of permuting algorithms", "[parallel algorithm]")
+{
+  const int size = GENERATE(3, 1000, 100000);
+  c2h::device_vector<int> d_data(size, thrust::no_init);
+  c2h::gen(C2H_SEED(1), d_data, 0, 1000);
+  c2h::host_vector<int> h_data = d_data;
+  const std::vector<int> data(h_data.begin(), h_data.end());
+  const auto policy = cuda::execution::tbb_par;
+
+  // non-trivial elements, so that moved-from elements would be noticed
+  std::vector<std::string> input(size);
+  for (int i = 0; i < size; ++i)
+  {
+    input[i] = std::to_string(data[i]);
+  }
+
+  SECTION("adjacent_difference")
+  {
+    std::vector<int> result(size);
+    std::vector<int> expected(size);
+    auto end = cuda::std::adjacent_difference(policy, data.begin(), data.end(), result.begin(), cuda::std::minus<>{});
+    CHECK(end == result.end());
+    std::adjacent_difference(data.begin(), data.end(), expected.begin());
+    CHECK(result == expected);
+  }
+
+  SECTION("rotate and rotate_copy")
+  {
+    // shifts by less and by more than half of the input
+    for (const int middle : {1, size / 3, size / 2, size - 1})
+    {
+      std::vector<std::string> result   = input;
+      std::vector<std::string> expected = input;
+      auto end          = cuda::std::rotate(policy, result.begin(), result.begin() + middle, result.end());
+      auto expected_end = std::rotate(expected.begin(), expected.begin() + middle, expected.end());
+      CHECK(end - result.begin() == expected_end - expected.begin());
+      CHECK(result == expected);
+
+      std::vector<int> copy(size);
+      std::vector<int> expected_copy(size);
+      cuda::std::rotate_copy(policy, data.begin(), data.begin() + middle, data.end(), copy.begin());
+      std::rotate_copy(data.begin(), data.begin() + middle, data.end(), expected_copy.begin());
+      CHECK(copy == expected_copy);
+    }
+  }
+
+  SECTION("shift_left and shift_right")
+  {
+    // overlapping source and destination ranges are moved through a temporary buffer
+    for (const int count : {1, size / 3, size / 2, size - 1})
+    {
+      std::vector<std::string> result = input;
+      auto end                        = cuda::std::shift_left(policy, result.begin(), result.end(), count);
+      CHECK(end - result.begin() == size - count);
+      CHECK(std::equal(result.begin(), end, input.begin() + count));
+
+      result     = input;
+      auto begin = cuda::std::shift_right(policy, result.begin(), result.end(), count);
+      CHECK(begin - result.begin() == count);
+      CHECK(std::equal(begin, result.end(), input.begin()));
+    }
+  }
+}
@@ -0,0 +1,138 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// cuda::execution::tbb_par runs the parallel algorithms on the oneTBB backend for host ranges
+
+#include <cuda/execution>
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+#include <cuda/std/functional>
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <testing.cuh>
+
+#include "test_macros.h"
+#include "test_pstl.h"
+
+static_assert(_CCCL_HAS_BACKEND_TBB(), "These tests require the oneTBB backend");
+
+C2H_TEST("oneTBB backend of compacting algorithms", "[parallel algorithm]")
+{
+  const int size = GENERATE(0, 1, 1000, 100000);
+  c2h::device_vector<int> d_data(size, thrust::no_init);
+  c2h::gen(C2H_SEED(1), d_data, 0, 3);
+  c2h::host_vector<int> h_data = d_data;
+  const std::vector<int> data(h_data.begin(), h_data.end());
+  const auto policy = cuda::execution::tbb_par;
+
+  SECTION("copy_if and remove_copy")
+  {
+    std::vector<int> result(size);
+    std::vector<int> expected(size);
+    const auto is_odd = [](const int value) {
+      return value % 2 == 1;
+    };
+    auto end          = cuda::std::copy_if(policy, data.begin(), data.end(), result.begin(), is_odd);
+    auto expected_end = std::copy_if(data.begin(), data.end(), expected.begin(), is_odd);
+    CHECK(end - result.begin() == expected_end - expected.begin());
+    CHECK(std::equal(expected.begin(), expected_end, result.begin()));
+
+    end          = cuda::std::remove_copy(policy, data.begin(), data.end(), result.begin(), 0);
+    expected_end = std::remove_copy(data.begin(), data.end(), expected.begin(), 0);
+    CHECK(end - result.begin() == expected_end - expected.begin());
+    CHECK(std::equal(expected.begin(), expected_end, result.begin()));
+  }
+
+  SECTION("unique_copy")
+  {
+    std::vector<int> result(size);
+    std::vector<int> expected(size);
+    auto end          = cuda::std::unique_copy(policy, data.begin(), data.end(), result.begin());
+    auto expected_end = std::unique_copy(data.begin(), data.end(), expected.begin());
+    CHECK(end - result.begin() == expected_end - expected.begin());
+    CHECK(std::equal(expected.begin(), expected_end, result.begin()));
+  }
+
+  SECTION("unique")
+  {
+    // non-trivial elements, so that moved-from elements would be noticed
+    std::vector<std::string> result(size);
+    for (int i = 0; i < size; ++i)
+    {
+      result[i] = std::to_string(data[i]);
+    }
+    std::vector<std::string> expected = result;
+    auto end                          = cuda::std::unique(policy, result.begin(), result.end());
+    auto expected_end                 = std::unique(expected.begin(), expected.end());
+    CHECK(end - result.begin() == expected_end - expected.begin());
+    CHECK(std::equal(expected.begin(), expected_end, result.begin()));
+  }
+
+  SECTION("remove_if")
+  {
+    std::vector<int> result   = data;
+    std::vector<int> expected = data;
+    const auto is_odd         = [](const int value) {
+      return value % 2 == 1;
+    };
+    auto end          = cuda::std::remove_if(policy, result.begin(), result.end(), is_odd);
+    auto expected_end = std::remove_if(expected.begin(), expected.end(), is_odd);
+    CHECK(end - result.begin() == expected_end - expected.begin());
+    CHECK(std::equal(expected.begin(), expected_end, result.begin()));
+  }
+
+  SECTION("partition and stable_partition")
+  {
+    const auto is_zero = [](const std::string& value) {
+      return value == "0";
+    };
+    std::vector<std::string> input(size);
+    for (int i = 0; i < size; ++i)
+    {
+      input[i] = std::to_string(data[i]);
+    }
+
+    std::vector<std::string> result   = input;
+    std::vector<std::string> expected = input;
+    auto mid          = cuda::std::stable_partition(policy, result.begin(), result.end(), is_zero);
+    auto expected_mid = std::stable_partition(expected.begin(), expected.end(), is_zero);
+    CHECK(mid - result.begin() == expected_mid - expected.begin());
+    CHECK(result == expected);
+
+    result = input;
+    mid    = cuda::std::partition(policy, result.begin(), result.end(), is_zero);
+    CHECK(mid - result.begin() == expected_mid - expected.begin());
+    CHECK(std::all_of(result.begin(), mid, is_zero));
+    CHECK(std::none_of(mid, result.end(), is_zero));
+  }
+
+  SECTION("partition_copy")
+  {
+    const auto is_odd = [](const int value) {
+      return value % 2 == 1;
+    };
+    std::vector<int> result_true(size);
+    std::vector<int> result_false(size);
+    std::vector<int> expected_true(size);
+    std::vector<int> expected_false(size);
+    auto ends =
+      cuda::std::partition_copy(policy, data.begin(), data.end(), result_true.begin(), result_false.begin(), is_odd);
+    auto expected_ends =
+      std::partition_copy(data.begin(), data.end(), expected_true.begin(), expected_false.begin(), is_odd);
+    CHECK(ends.first - result_true.begin() == expected_ends.first - expected_true.begin());
+    CHECK(ends.second - result_false.begin() == expected_ends.second - expected_false.begin());
+    CHECK(result_true == expected_true);
+    CHECK(result_false == expected_false);
+  }
+}
@@ -0,0 +1,119 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// cuda::execution::threads_par runs the parallel algorithms on the thread pool backend for host ranges
+
+#include <cuda/execution>
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+#include <cuda/std/functional>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include <testing.cuh>
+
+#include "test_macros.h"
+#include "test_pstl.h"
+
+static_assert(_CCCL_HAS_BACKEND_THREADS(), "These tests require the thread pool backend");
+
+C2H_TEST("Thread pool backend of element-wise algorithms", "[parallel algorithm]")
+{
+  const int size = GENERATE(0, 1, 1000, 100000);
+  c2h::device_vector<int> d_data(size, thrust::no_init);
+  c2h::gen(C2H_SEED(1), d_data, 0, 1000);
+  c2h::host_vector<int> h_data = d_data;
+  const std::vector<int> data(h_data.begin(), h_data.end());
+  // more threads than the machine might have, so that the work is always shared
+  const auto policy = cuda::execution::threads_par.with(cuda::execution::num_threads(4));
+
+  SECTION("for_each")
+  {
+    std::vector<int> result = data;
+    cuda::std::for_each(policy, result.begin(), result.end(), [](int& value) {
+      value += 1;
+    });
+    std::vector<int> expected = data;
+    std::for_each(expected.begin(), expected.end(), [](int& value) {
+      value += 1;
+    });
+    CHECK(result == expected);
+  }
+
+  SECTION("transform")
+  {
+    std::vector<int> result(size);
+    auto end = cuda::std::transform(policy, data.begin(), data.end(), result.begin(), cuda::std::negate<>{});
+    CHECK(end == result.end());
+    std::vector<int> expected(size);
+    std::transform(data.begin(), data.end(), expected.begin(), std::negate<>{});
+    CHECK(result == expected);
+
+    end = cuda::std::transform(policy, data.begin(), data.end(), data.begin(), result.begin(), cuda::std::plus<>{});
+    CHECK(end == result.end());
+    std::transform(data.begin(), data.end(), data.begin(), expected.begin(), std::plus<>{});
+    CHECK(result == expected);
+  }
+
+  SECTION("fill, generate and copy")
+  {
+    std::vector<int> result(size);
+    cuda::std::fill(policy, result.begin(), result.end(), 42);
+    CHECK(std::count(result.begin(), result.end(), 42) == size);
+
+    cuda::std::generate(cuda::std::execution::par_unseq, result.begin(), result.end(), [] {
+      return 7;
+    });
+    CHECK(std::count(result.begin(), result.end(), 7) == size);
+
+    auto end = cuda::std::copy(policy, data.begin(), data.end(), result.begin());
+    CHECK(end == result.end());
+    CHECK(result == data);
+  }
+
+  SECTION("replace, reverse and swap_ranges")
+  {
+    std::vector<int> result   = data;
+    std::vector<int> expected = data;
+    cuda::std::replace(policy, result.begin(), result.end(), 5, -5);
+    std::replace(expected.begin(), expected.end(), 5, -5);
+    CHECK(result == expected);
+
+    cuda::std::reverse(policy, result.begin(), result.end());
+    std::reverse(expected.begin(), expected.end());
+    CHECK(result == expected);
+
+    std::vector<int> other = data;
+    cuda::std::swap_ranges(policy, result.begin(), result.end(), other.begin());
+    CHECK(result == data);
+    CHECK(other == expected);
+  }
+
+  SECTION("find, min_element and max_element")
+  {
+    for (const int value : {-1, 0, 500, 1000})
+    {
+      CHECK(cuda::std::find(policy, data.begin(), data.end(), value) == std::find(data.begin(), data.end(), value));
+    }
+    CHECK(cuda::std::min_element(policy, data.begin(), data.end()) == std::min_element(data.begin(), data.end()));
+    CHECK(cuda::std::max_element(policy, data.begin(), data.end()) == std::max_element(data.begin(), data.end()));
+    CHECK(cuda::std::is_sorted(policy, data.begin(), data.end()) == std::is_sorted(data.begin(), data.end()));
+    CHECK(cuda::std::is_heap(policy, data.begin(), data.end()) == std::is_heap(data.begin(), data.end()));
+    CHECK(cuda::std::count(policy, data.begin(), data.end(), 5) == std::count(data.begin(), data.end(), 5));
+    CHECK(cuda::std::adjacent_find(policy, data.begin(), data.end()) == std::adjacent_find(data.begin(), data.end()));
+
+    // a range without equal neighbors returns last
+    std::vector<int> distinct(size);
+    std::iota(distinct.begin(), distinct.end(), 0);
+    CHECK(cuda::std::adjacent_find(policy, distinct.begin(), distinct.end()) == distinct.end());
+  }
+}
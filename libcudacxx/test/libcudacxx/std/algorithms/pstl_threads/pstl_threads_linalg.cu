@@ -0,0 +1,124 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// The cuda::std::linalg algorithms with cuda::execution::threads_par split the vectors and the rows of the matrices
+// in blocks run by the thread pool backend
+
+#include <cuda/execution>
+#include <cuda/std/cmath>
+#include <cuda/std/execution>
+#include <cuda/std/linalg>
+#include <cuda/std/mdspan>
+
+#include <vector>
+
+#include <testing.cuh>
+
+#include "test_macros.h"
+
+static_assert(_CCCL_HAS_BACKEND_THREADS(), "These tests require the thread pool backend");
+
+C2H_TEST("Thread pool backend of the linalg algorithms", "[parallel algorithm]")
+{
+  // the extents span several blocks of the parallel algorithms, and the tails of the blocks
+  const int rows    = GENERATE(1, 70, 300);
+  const int columns = 261;
+  const int size    = 40000;
+  // more threads than the machine might have, so that the work is always shared
+  const auto policy = cuda::execution::threads_par.with(cuda::execution::num_threads(4));
+
+  // the elements are small integers, so that the results are exact for any order of the additions
+  std::vector<double> a(rows * columns);
+  std::vector<double> b(columns * rows);
+  std::vector<double> v(size);
+  std::vector<double> w(size);
+  for (int i = 0; i < rows * columns; ++i)
+  {
+    a[i] = i % 13 - 6;
+    b[i] = i % 11 - 5;
+  }
+  for (int i = 0; i < size; ++i)
+  {
+    v[i] = i % 5;
+    w[i] = i % 3 - 1;
+  }
+  cuda::std::mdspan<double, cuda::std::dims<2>> A(a.data(), rows, columns);
+  cuda::std::mdspan<double, cuda::std::dims<2>, cuda::std::layout_left> B(b.data(), columns, rows);
+  cuda::std::mdspan<double, cuda::std::dims<1>> V(v.data(), size);
+  cuda::std::mdspan<double, cuda::std::dims<1>> W(w.data(), size);
+
+  SECTION("dot and vector_two_norm")
+  {
+    CHECK(cuda::std::linalg::dot(policy, V, W) == cuda::std::linalg::dot(V, W));
+    CHECK(cuda::std::linalg::dot(policy, V, W, 1.0) == cuda::std::linalg::dot(V, W, 1.0));
+    CHECK(cuda::std::linalg::dotc(policy, V, W) == cuda::std::linalg::dotc(V, W));
+    // the norm is scaled by the largest element, which rounds differently depending on the order of the elements
+    const double norm = cuda::std::linalg::vector_two_norm(V);
+    CHECK(cuda::std::fabs(cuda::std::linalg::vector_two_norm(policy, V) - norm) <= 1e-14 * norm);
+
+    // the squares of the elements overflow, but the norm is representable
+    const double huge = 1e300;
+    CHECK(cuda::std::fabs(cuda::std::linalg::vector_two_norm(policy, cuda::std::linalg::scaled(huge, V)) - huge * norm)
+          <= 1e-14 * huge * norm);
+  }
+
+  SECTION("add and scale")
+  {
+    std::vector<double> result(size);
+    std::vector<double> expected(size);
+    cuda::std::mdspan<double, cuda::std::dims<1>> R(result.data(), size);
+    cuda::std::mdspan<double, cuda::std::dims<1>> E(expected.data(), size);
+    cuda::std::linalg::add(policy, V, W, R);
+    cuda::std::linalg::add(V, W, E);
+    CHECK(result == expected);
+    cuda::std::linalg::scale(policy, 3.0, R);
+    cuda::std::linalg::scale(3.0, E);
+    CHECK(result == expected);
+  }
+
+  SECTION("matrix_vector_product")
+  {
+    std::vector<double> x(columns, 2.0);
+    std::vector<double> result(rows, 1.0);
+    std::vector<double> expected(rows, 1.0);
+    cuda::std::mdspan<double, cuda::std::dims<1>> X(x.data(), columns);
+    cuda::std::mdspan<double, cuda::std::dims<1>> R(result.data(), rows);
+    cuda::std::mdspan<double, cuda::std::dims<1>> E(expected.data(), rows);
+    cuda::std::linalg::matrix_vector_product(policy, A, X, R, R);
+    cuda::std::linalg::matrix_vector_product(A, X, E, E);
+    CHECK(result == expected);
+    cuda::std::linalg::matrix_vector_product(policy, cuda::std::linalg::transposed(B), X, R);
+    cuda::std::linalg::matrix_vector_product(cuda::std::linalg::transposed(B), X, E);
+    CHECK(result == expected);
+  }
+
+  SECTION("matrix_product and matrix_rank_1_update")
+  {
+    std::vector<double> result(rows * rows);
+    std::vector<double> expected(rows * rows);
+    cuda::std::mdspan<double, cuda::std::dims<2>> R(result.data(), rows, rows);
+    cuda::std::mdspan<double, cuda::std::dims<2>> E(expected.data(), rows, rows);
+    cuda::std::linalg::matrix_product(policy, A, B, R);
+    cuda::std::linalg::matrix_product(A, B, E);
+    CHECK(result == expected);
+
+    // column-major result
+    cuda::std::mdspan<double, cuda::std::dims<2>, cuda::std::layout_left> R_left(result.data(), rows, rows);
+    cuda::std::mdspan<double, cuda::std::dims<2>, cuda::std::layout_left> E_left(expected.data(), rows, rows);
+    cuda::std::linalg::matrix_product(policy, A, B, R_left, R_left);
+    cuda::std::linalg::matrix_product(A, B, E_left, E_left);
+    CHECK(result == expected);
+
+    cuda::std::mdspan<double, cuda::std::dims<1>> x(v.data(), rows);
+    cuda::std::linalg::matrix_rank_1_update(policy, x, x, R);
+    cuda::std::linalg::matrix_rank_1_update(x, x, E);
+    CHECK(result == expected);
+  }
+}
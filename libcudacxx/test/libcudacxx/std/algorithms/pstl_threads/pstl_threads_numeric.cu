@@ -0,0 +1,95 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// cuda::execution::threads_par runs the parallel algorithms on the thread pool backend for host ranges
+
+#include <cuda/execution>
+#include <cuda/std/execution>
+#include <cuda/std/functional>
+#include <cuda/std/numeric>
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <testing.cuh>
+
+#include "test_macros.h"
+#include "test_pstl.h"
+
+static_assert(_CCCL_HAS_BACKEND_THREADS(), "These tests require the thread pool backend");
+
+C2H_TEST("Thread pool backend of reductions and scans", "[parallel algorithm]")
+{
+  const int size = GENERATE(0, 1, 1000, 100000);
+  c2h::device_vector<int> d_data(size, thrust::no_init);
+  c2h::gen(C2H_SEED(1), d_data, 0, 1000);
+  c2h::host_vector<int> h_data = d_data;
+  const std::vector<int> data(h_data.begin(), h_data.end());
+  // more threads than the machine might have, so that the work is always shared
+  const auto policy = cuda::execution::threads_par.with(cuda::execution::num_threads(4));
+
+  SECTION("reduce and transform_reduce")
+  {
+    CHECK(cuda::std::reduce(policy, data.begin(), data.end(), 1ll) == std::reduce(data.begin(), data.end(), 1ll));
+    const auto square = [](const int value) {
+      return static_cast<long long>(value) * value;
+    };
+    CHECK(cuda::std::transform_reduce(policy, data.begin(), data.end(), 0ll, cuda::std::plus<>{}, square)
+          == std::transform_reduce(data.begin(), data.end(), 0ll, std::plus<>{}, square));
+  }
+
+  SECTION("inclusive_scan")
+  {
+    std::vector<int> result(size);
+    std::vector<int> expected(size);
+    auto end = cuda::std::inclusive_scan(policy, data.begin(), data.end(), result.begin());
+    CHECK(end == result.end());
+    std::inclusive_scan(data.begin(), data.end(), expected.begin());
+    CHECK(result == expected);
+
+    cuda::std::inclusive_scan(policy, data.begin(), data.end(), result.begin(), cuda::std::plus<>{}, 42);
+    std::inclusive_scan(data.begin(), data.end(), expected.begin(), std::plus<>{}, 42);
+    CHECK(result == expected);
+  }
+
+  SECTION("exclusive_scan")
+  {
+    std::vector<int> result(size);
+    std::vector<int> expected(size);
+    auto end = cuda::std::exclusive_scan(policy, data.begin(), data.end(), result.begin(), 42);
+    CHECK(end == result.end());
+    std::exclusive_scan(data.begin(), data.end(), expected.begin(), 42);
+    CHECK(result == expected);
+
+    // in place
+    result = data;
+    cuda::std::exclusive_scan(policy, result.begin(), result.end(), result.begin(), 0);
+    std::exclusive_scan(data.begin(), data.end(), expected.begin(), 0);
+    CHECK(result == expected);
+  }
+
+  SECTION("non-commutative scan")
+  {
+    // the partial sums grow linearly, so the input is kept short while still spanning several chunks
+    const int count = (std::min) (size, 5000);
+    std::vector<std::string> input(count);
+    for (int i = 0; i < count; ++i)
+    {
+      input[i] = std::string(1, static_cast<char>('a' + data[i] % 26));
+    }
+    std::vector<std::string> result(count);
+    std::vector<std::string> expected(count);
+    cuda::std::inclusive_scan(policy, input.begin(), input.end(), result.begin(), cuda::std::plus<>{});
+    std::inclusive_scan(input.begin(), input.end(), expected.begin(), std::plus<>{});
+    CHECK(result == expected);
+  }
+}
@@ -0,0 +1,99 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// The thread pool backend honors the number of threads requested by the policy and never deadlocks on nested or
+// concurrent calls
+
+#include <cuda/execution>
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+#include <cuda/std/numeric>
+
+#include <algorithm>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <testing.cuh>
+
+#include "test_macros.h"
+#include "test_pstl.h"
+
+static_assert(_CCCL_HAS_BACKEND_THREADS(), "These tests require the thread pool backend");
+
+template <class Policy>
+std::size_t count_threads(const Policy& policy, std::vector<int>& data)
+{
+  std::mutex mutex;
+  std::set<std::thread::id> ids;
+  cuda::std::for_each(policy, data.begin(), data.end(), [&](int&) {
+    std::lock_guard<std::mutex> lock{mutex};
+    ids.insert(std::this_thread::get_id());
+  });
+  return ids.size();
+}
+
+C2H_TEST("Thread pool backend configuration and scheduling", "[parallel algorithm]")
+{
+  const int size = GENERATE(0, 1, 1000, 100000);
+  std::vector<int> data(size, 1);
+
+  SECTION("num_threads")
+  {
+    CHECK(count_threads(cuda::execution::threads_par.with(cuda::execution::num_threads(1)), data) <= 1);
+    CHECK(count_threads(cuda::execution::threads_par.with(cuda::execution::num_threads(3)), data) <= 3);
+    CHECK(count_threads(cuda::std::execution::par.with(cuda::execution::num_threads(2)), data) <= 2);
+  }
+
+  SECTION("pin_threads")
+  {
+    const auto policy =
+      cuda::execution::threads_par.with(cuda::execution::num_threads(4)).with(cuda::execution::pin_threads());
+    CHECK(cuda::std::reduce(policy, data.begin(), data.end(), 0) == size);
+    const auto unpinned = policy.with(cuda::execution::pin_threads(false));
+    CHECK(cuda::std::reduce(unpinned, data.begin(), data.end(), 0) == size);
+  }
+
+  SECTION("nested calls")
+  {
+    const auto policy = cuda::execution::threads_par.with(cuda::execution::num_threads(4));
+    std::vector<int> sums(64);
+    cuda::std::for_each(policy, sums.begin(), sums.end(), [&](int& sum) {
+      sum = cuda::std::reduce(policy, data.begin(), data.end(), 0);
+    });
+    CHECK(std::all_of(sums.begin(), sums.end(), [&](const int sum) {
+      return sum == size;
+    }));
+  }
+
+  SECTION("concurrent calls")
+  {
+    const auto policy = cuda::execution::threads_par.with(cuda::execution::num_threads(4));
+    std::vector<int> sums(4);
+    std::vector<std::thread> callers;
+    for (int& sum : sums)
+    {
+      callers.emplace_back([&] {
+        for (int repetition = 0; repetition != 16; ++repetition)
+        {
+          sum += cuda::std::reduce(policy, data.begin(), data.end(), 0);
+        }
+      });
+    }
+    for (std::thread& caller : callers)
+    {
+      caller.join();
+    }
+    CHECK(std::all_of(sums.begin(), sums.end(), [&](const int sum) {
+      return sum == 16 * size;
+    }));
+  }
+}
@@ -0,0 +1,82 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// cuda::execution::threads_par runs the parallel algorithms on the thread pool backend for host ranges
+
+#include <cuda/execution>
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+#include <cuda/std/functional>
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <testing.cuh>
+
+#include "test_macros.h"
+#include "test_pstl.h"
+
+static_assert(_CCCL_HAS_BACKEND_THREADS(), "These tests require the thread pool backend");
+
+C2H_TEST("Thread pool backend of compacting algorithms", "[parallel algorithm]")
+{
+  const int size = GENERATE(0, 1, 1000, 100000);
+  c2h::device_vector<int> d_data(size, thrust::no_init);
+  c2h::gen(C2H_SEED(1), d_data, 0, 3);
+  c2h::host_vector<int> h_data = d_data;
+  const std::vector<int> data(h_data.begin(), h_data.end());
+  // more threads than the machine might have, so that the work is always shared
+  const auto policy = cuda::execution::threads_par.with(cuda::execution::num_threads(4));
+
+  SECTION("copy_if and remove_copy")
+  {
+    std::vector<int> result(size);
+    std::vector<int> expected(size);
+    const auto is_odd = [](const int value) {
+      return value % 2 == 1;
+    };
+    auto end          = cuda::std::copy_if(policy, data.begin(), data.end(), result.begin(), is_odd);
+    auto expected_end = std::copy_if(data.begin(), data.end(), expected.begin(), is_odd);
+    CHECK(end - result.begin() == expected_end - expected.begin());
+    CHECK(std::equal(expected.begin(), expected_end, result.begin()));
+
+    end          = cuda::std::remove_copy(policy, data.begin(), data.end(), result.begin(), 0);
+    expected_end = std::remove_copy(data.begin(), data.end(), expected.begin(), 0);
+    CHECK(end - result.begin() == expected_end - expected.begin());
+    CHECK(std::equal(expected.begin(), expected_end, result.begin()));
+  }
+
+  SECTION("unique_copy")
+  {
+    std::vector<int> result(size);
+    std::vector<int> expected(size);
+    auto end          = cuda::std::unique_copy(policy, data.begin(), data.end(), result.begin());
+    auto expected_end = std::unique_copy(data.begin(), data.end(), expected.begin());
+    CHECK(end - result.begin() == expected_end - expected.begin());
+    CHECK(std::equal(expected.begin(), expected_end, result.begin()));
+  }
+
+  SECTION("unique")
+  {
+    // non-trivial elements, so that moved-from elements would be noticed
+    std::vector<std::string> result(size);
+    for (int i = 0; i < size; ++i)
+    {
+      result[i] = std::to_string(data[i]);
+    }
+    std::vector<std::string> expected = result;
+    auto end                          = cuda::std::unique(policy, result.begin(), result.end());
+    auto expected_end                 = std::unique(expected.begin(), expected.end());
+    CHECK(end - result.begin() == expected_end - expected.begin());
+    CHECK(std::equal(expected.begin(), expected_end, result.begin()));
+  }
+}
@@ -0,0 +1,95 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// cuda::std::execution::unseq runs the non-modifying algorithms on the calling thread, and par_unseq on the thread pool
+// backend, with vector kernels for contiguous ranges of arithmetic types. Compare them with the serial algorithms on
+// ranges that end inside a block, and with several equal extrema.
+
+#include <cuda/std/algorithm>
+#include <cuda/std/cstdint>
+#include <cuda/std/execution>
+#include <cuda/std/functional>
+
+#include <algorithm>
+#include <vector>
+
+#include <testing.cuh>
+
+#include "test_macros.h"
+#include "test_pstl.h"
+
+static_assert(_CCCL_HAS_BACKEND_THREADS(), "These tests require the thread pool backend");
+
+using element_types =
+  c2h::type_list<cuda::std::int8_t, cuda::std::uint8_t, short, int, unsigned, long long, float, double>;
+
+template <class T, class Policy>
+void test_non_modifying(const Policy& policy, const std::vector<T>& data)
+{
+  const T* first = data.data();
+  const T* last  = data.data() + data.size();
+  std::vector<T> other(data);
+  if (!other.empty())
+  {
+    other[other.size() / 2] += 1;
+  }
+
+  for (const T value : {T{0}, T{3}, T{100}})
+  {
+    CHECK(cuda::std::find(policy, first, last, value) == std::find(first, last, value));
+    CHECK(cuda::std::count(policy, first, last, value) == std::count(first, last, value));
+  }
+
+  CHECK(cuda::std::mismatch(policy, first, last, other.data()).first == std::mismatch(first, last, other.data()).first);
+  CHECK(cuda::std::equal(policy, first, last, other.data()) == std::equal(first, last, other.data()));
+  CHECK(cuda::std::equal(policy, first, last, data.data()));
+  CHECK(cuda::std::min_element(policy, first, last) == std::min_element(first, last));
+  CHECK(cuda::std::max_element(policy, first, last) == std::max_element(first, last));
+
+  const auto result   = cuda::std::minmax_element(policy, first, last);
+  const auto expected = std::minmax_element(first, last);
+  CHECK(result.first == expected.first);
+  CHECK(result.second == expected.second);
+}
+
+C2H_TEST("Unsequenced non-modifying algorithms", "[parallel algorithm]", element_types)
+{
+  using T        = typename c2h::get<0, TestType>;
+  const int size = GENERATE(0, 1, 31, 33, 1000, 5001, 100000);
+
+  // Few distinct values, so that the extrema and the searched values occur many times
+  std::vector<T> data(size);
+  unsigned state = 1;
+  for (T& value : data)
+  {
+    state = state * 1103515245u + 12345u;
+    value = static_cast<T>((state >> 16) % 8);
+  }
+
+  SECTION("unseq")
+  {
+    test_non_modifying(cuda::std::execution::unseq, data);
+
+    // A range without adjacent equal elements
+    std::vector<T> distinct(size);
+    for (int i = 0; i < size; ++i)
+    {
+      distinct[i] = static_cast<T>(i % 2);
+    }
+    CHECK(cuda::std::adjacent_find(cuda::std::execution::unseq, distinct.begin(), distinct.end()) == distinct.end());
+    CHECK(cuda::std::adjacent_find(cuda::std::execution::unseq, data.begin(), data.end())
+          == std::adjacent_find(data.begin(), data.end()));
+  }
+
+  SECTION("par_unseq")
+  {
+    test_non_modifying(cuda::std::execution::par_unseq, data);
+  }
+}
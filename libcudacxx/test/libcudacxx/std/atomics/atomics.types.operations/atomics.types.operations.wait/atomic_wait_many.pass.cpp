@@ -0,0 +1,124 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: nvrtc
+
+// <cuda/std/atomic>
+
+// Host threads blocked on many atomics at once, which share the entries of the table of waiters, are all woken by
+// the notifications of their own atomic, also when the waiter and the notifier refer to it with different scopes
+
+#include <cuda/atomic>
+#include <cuda/std/atomic>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+
+#ifndef __CUDA_ARCH__
+#  include <chrono>
+#  include <thread>
+#  include <vector>
+
+constexpr int num_waiters = 96;
+
+template <class A, class T>
+void test_notify_one()
+{
+  A* atomics = new A[num_waiters];
+  for (int i = 0; i < num_waiters; ++i)
+  {
+    atomics[i].store(T(0));
+  }
+
+  std::vector<std::thread> waiters;
+  for (int i = 0; i < num_waiters; ++i)
+  {
+    waiters.emplace_back([&, i] {
+      atomics[i].wait(T(0));
+      assert(atomics[i].load() == T(1));
+    });
+  }
+  for (int i = num_waiters - 1; i >= 0; --i)
+  {
+    atomics[i].store(T(1));
+    atomics[i].notify_one();
+  }
+  for (std::thread& waiter : waiters)
+  {
+    waiter.join();
+  }
+  delete[] atomics;
+}
+
+template <class A, class T>
+void test_notify_all()
+{
+  A a{T(0)};
+  std::vector<std::thread> waiters;
+  for (int i = 0; i < num_waiters; ++i)
+  {
+    waiters.emplace_back([&] {
+      a.wait(T(0));
+    });
+  }
+  a.store(T(1));
+  a.notify_all();
+  for (std::thread& waiter : waiters)
+  {
+    waiter.join();
+  }
+
+  // Notifying without waiters is a no-op
+  a.notify_one();
+  a.notify_all();
+}
+
+template <class Waiter, class Notifier, class T>
+void test_mixed_scopes()
+{
+  alignas(Waiter::required_alignment) T value = T(0);
+  std::vector<std::thread> waiters;
+  for (int i = 0; i < num_waiters; ++i)
+  {
+    waiters.emplace_back([&] {
+      Waiter(value).wait(T(0));
+    });
+  }
+  // Gives the waiters time to block, so that they are woken by the notification rather than see the new value
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  Notifier notifier(value);
+  notifier.store(T(1));
+  notifier.notify_all();
+  for (std::thread& waiter : waiters)
+  {
+    waiter.join();
+  }
+}
+
+template <class T>
+void test()
+{
+  test_notify_one<cuda::std::atomic<T>, T>();
+  test_notify_one<cuda::atomic<T, cuda::thread_scope_device>, T>();
+  test_notify_all<cuda::std::atomic<T>, T>();
+  test_notify_all<cuda::atomic<T, cuda::thread_scope_block>, T>();
+  test_mixed_scopes<cuda::atomic_ref<T, cuda::thread_scope_device>, cuda::std::atomic_ref<T>, T>();
+  test_mixed_scopes<cuda::std::atomic_ref<T>, cuda::atomic_ref<T, cuda::thread_scope_block>, T>();
+  test_mixed_scopes<cuda::atomic_ref<T, cuda::thread_scope_block>, cuda::atomic_ref<T, cuda::thread_scope_device>, T>();
+}
+#endif // !__CUDA_ARCH__
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, (test<char>(); test<short>(); test<int>(); test<long long>(); test<float>();))
+
+  return 0;
+}
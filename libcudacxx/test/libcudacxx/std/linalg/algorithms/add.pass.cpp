@@ -0,0 +1,88 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/linalg>
+#include <cuda/std/mdspan>
+
+#include "test_macros.h"
+
+TEST_FUNC constexpr bool test_vectors()
+{
+  cuda::std::array<int, 5> a{1, 2, 3, 4, 5};
+  cuda::std::array<int, 5> b{10, 20, 30, 40, 50};
+  cuda::std::array<int, 5> c{};
+  cuda::std::mdspan<const int, cuda::std::dims<1>> x(a.data(), 5);
+  cuda::std::mdspan<int, cuda::std::dims<1>> y(b.data(), 5);
+  cuda::std::mdspan<int, cuda::std::extents<size_t, 5>> z(c.data());
+
+  cuda::std::linalg::add(x, y, z);
+  for (int i = 0; i < 5; ++i)
+  {
+    assert(c[i] == 11 * (i + 1));
+  }
+
+  // axpy: y = 2 * x + y, in place
+  cuda::std::linalg::add(cuda::std::linalg::scaled(2, x), y, y);
+  for (int i = 0; i < 5; ++i)
+  {
+    assert(b[i] == 12 * (i + 1));
+  }
+  return true;
+}
+
+TEST_FUNC constexpr bool test_matrices()
+{
+  cuda::std::array<int, 6> a{1, 2, 3, 4, 5, 6};
+  cuda::std::array<int, 6> b{};
+  cuda::std::array<int, 6> c{};
+  cuda::std::mdspan<const int, cuda::std::dims<2>> x(a.data(), 2, 3);
+  cuda::std::mdspan<int, cuda::std::dims<2>, cuda::std::layout_left> y(b.data(), 2, 3);
+  cuda::std::mdspan<int, cuda::std::dims<2>> z(c.data(), 2, 3);
+  for (int i = 0; i < 2; ++i)
+  {
+    for (int j = 0; j < 3; ++j)
+    {
+      y(i, j) = 10 * i + j;
+    }
+  }
+
+  // mixed layouts
+  cuda::std::linalg::add(x, y, z);
+  for (int i = 0; i < 2; ++i)
+  {
+    for (int j = 0; j < 3; ++j)
+    {
+      assert(z(i, j) == x(i, j) + 10 * i + j);
+    }
+  }
+
+  // transposed views
+  cuda::std::mdspan<int, cuda::std::dims<2>> w(b.data(), 3, 2);
+  cuda::std::linalg::add(cuda::std::linalg::transposed(x), cuda::std::linalg::transposed(x), w);
+  for (int i = 0; i < 3; ++i)
+  {
+    for (int j = 0; j < 2; ++j)
+    {
+      assert(w(i, j) == 2 * x(j, i));
+    }
+  }
+  return true;
+}
+
+int main(int, char**)
+{
+  test_vectors();
+  test_matrices();
+  static_assert(test_vectors());
+  static_assert(test_matrices());
+  return 0;
+}
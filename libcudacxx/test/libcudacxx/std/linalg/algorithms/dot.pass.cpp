@@ -0,0 +1,91 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/complex>
+#include <cuda/std/linalg>
+#include <cuda/std/mdspan>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+TEST_FUNC constexpr bool test_dot()
+{
+  // longer than the partial sums of the reduction, with a tail
+  cuda::std::array<int, 19> a{};
+  cuda::std::array<int, 19> b{};
+  int expected = 0;
+  for (int i = 0; i < 19; ++i)
+  {
+    a[i] = i + 1;
+    b[i] = 2 * i - 7;
+    expected += a[i] * b[i];
+  }
+  cuda::std::mdspan<const int, cuda::std::dims<1>> x(a.data(), 19);
+  cuda::std::mdspan<const int, cuda::std::extents<size_t, 19>> y(b.data());
+
+  static_assert(cuda::std::is_same_v<decltype(cuda::std::linalg::dot(x, y)), int>);
+  assert(cuda::std::linalg::dot(x, y) == expected);
+  assert(cuda::std::linalg::dot(x, y, 100) == expected + 100);
+  static_assert(cuda::std::is_same_v<decltype(cuda::std::linalg::dot(x, y, 0ll)), long long>);
+  assert(cuda::std::linalg::dot(x, y, 0ll) == expected);
+
+  // scaled vectors
+  assert(cuda::std::linalg::dot(cuda::std::linalg::scaled(3, x), y) == 3 * expected);
+
+  // strided vectors
+  cuda::std::layout_stride::mapping<cuda::std::dims<1>> map{cuda::std::dims<1>{9}, cuda::std::array<size_t, 1>{2}};
+  cuda::std::mdspan<const int, cuda::std::dims<1>, cuda::std::layout_stride> even(a.data(), map);
+  int expected_even = 0;
+  for (int i = 0; i < 9; ++i)
+  {
+    expected_even += a[2 * i] * a[2 * i];
+  }
+  assert(cuda::std::linalg::dot(even, even) == expected_even);
+
+  // empty vectors
+  cuda::std::mdspan<const int, cuda::std::dims<1>> empty(a.data(), 0);
+  assert(cuda::std::linalg::dot(empty, empty, 42) == 42);
+  return true;
+}
+
+TEST_FUNC void test_dotc()
+{
+  using C = cuda::std::complex<double>;
+  cuda::std::array<C, 3> a{C{1, 2}, C{3, -1}, C{0, 4}};
+  cuda::std::array<C, 3> b{C{2, 0}, C{1, 1}, C{-1, 2}};
+  cuda::std::mdspan<const C, cuda::std::dims<1>> x(a.data(), 3);
+  cuda::std::mdspan<const C, cuda::std::dims<1>> y(b.data(), 3);
+
+  C expected_dot{};
+  C expected_dotc{};
+  for (int i = 0; i < 3; ++i)
+  {
+    expected_dot += a[i] * b[i];
+    expected_dotc += cuda::std::conj(a[i]) * b[i];
+  }
+  assert(cuda::std::linalg::dot(x, y) == expected_dot);
+  assert(cuda::std::linalg::dotc(x, y) == expected_dotc);
+  assert(cuda::std::linalg::dotc(x, y, C(1, 1)) == expected_dotc + C(1, 1));
+
+  // dotc of real vectors is dot
+  cuda::std::array<double, 3> r{1.5, -2.0, 4.0};
+  cuda::std::mdspan<const double, cuda::std::dims<1>> v(r.data(), 3);
+  assert(cuda::std::linalg::dotc(v, v) == cuda::std::linalg::dot(v, v));
+}
+
+int main(int, char**)
+{
+  test_dot();
+  static_assert(test_dot());
+  test_dotc();
+  return 0;
+}
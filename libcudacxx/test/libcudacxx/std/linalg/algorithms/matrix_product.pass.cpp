@@ -0,0 +1,149 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/linalg>
+#include <cuda/std/mdspan>
+
+#include "test_macros.h"
+
+template <class LayoutA, class LayoutB, class LayoutC>
+TEST_FUNC constexpr void test_product(int* a, int* b, int* c, int* e, int m, int k, int n)
+{
+  cuda::std::mdspan<int, cuda::std::dims<2>, LayoutA> A(a, m, k);
+  cuda::std::mdspan<int, cuda::std::dims<2>, LayoutB> B(b, k, n);
+  cuda::std::mdspan<int, cuda::std::dims<2>, LayoutC> C(c, m, n);
+  cuda::std::mdspan<int, cuda::std::dims<2>> E(e, m, n);
+  for (int i = 0; i < m; ++i)
+  {
+    for (int l = 0; l < k; ++l)
+    {
+      A(i, l) = (i + 2 * l) % 7 - 3;
+    }
+  }
+  for (int l = 0; l < k; ++l)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      B(l, j) = (3 * l + j) % 5 - 2;
+    }
+  }
+  for (int i = 0; i < m; ++i)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      E(i, j) = i - j;
+    }
+  }
+  const auto expected = [&](int i, int j) {
+    int sum = 0;
+    for (int l = 0; l < k; ++l)
+    {
+      sum += A(i, l) * B(l, j);
+    }
+    return sum;
+  };
+
+  // C = A * B
+  cuda::std::linalg::matrix_product(A, B, C);
+  for (int i = 0; i < m; ++i)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      assert(C(i, j) == expected(i, j));
+    }
+  }
+
+  // C = E + A * B
+  cuda::std::linalg::matrix_product(A, B, E, C);
+  for (int i = 0; i < m; ++i)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      assert(C(i, j) == i - j + expected(i, j));
+    }
+  }
+
+  // C = C + 2 * A * B, in place
+  cuda::std::linalg::matrix_product(cuda::std::linalg::scaled(2, A), B, C, C);
+  for (int i = 0; i < m; ++i)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      assert(C(i, j) == i - j + 3 * expected(i, j));
+    }
+  }
+}
+
+TEST_FUNC constexpr bool test()
+{
+  constexpr int m = 3;
+  constexpr int k = 5;
+  constexpr int n = 4;
+  cuda::std::array<int, m * k> a{};
+  cuda::std::array<int, k * n> b{};
+  cuda::std::array<int, m * n> c{};
+  cuda::std::array<int, m * n> e{};
+  test_product<cuda::std::layout_right, cuda::std::layout_right, cuda::std::layout_right>(
+    a.data(), b.data(), c.data(), e.data(), m, k, n);
+  test_product<cuda::std::layout_left, cuda::std::layout_left, cuda::std::layout_left>(
+    a.data(), b.data(), c.data(), e.data(), m, k, n);
+  test_product<cuda::std::layout_left, cuda::std::layout_right, cuda::std::layout_right>(
+    a.data(), b.data(), c.data(), e.data(), m, k, n);
+  test_product<cuda::std::layout_right, cuda::std::layout_left, cuda::std::layout_left>(
+    a.data(), b.data(), c.data(), e.data(), m, k, n);
+
+  // transposed operands: C^T = B^T * A^T
+  {
+    cuda::std::mdspan<int, cuda::std::dims<2>> A(a.data(), m, k);
+    cuda::std::mdspan<int, cuda::std::dims<2>> B(b.data(), k, n);
+    cuda::std::mdspan<int, cuda::std::dims<2>> C(c.data(), m, n);
+    cuda::std::linalg::matrix_product(A, B, C);
+    cuda::std::array<int, m * n> d{};
+    cuda::std::mdspan<int, cuda::std::dims<2>> D(d.data(), n, m);
+    cuda::std::linalg::matrix_product(cuda::std::linalg::transposed(B), cuda::std::linalg::transposed(A), D);
+    for (int i = 0; i < m; ++i)
+    {
+      for (int j = 0; j < n; ++j)
+      {
+        assert(D(j, i) == C(i, j));
+      }
+    }
+  }
+  return true;
+}
+
+// extents larger than the blocks of the inner dimension and of the columns
+template <class Layout>
+void test_blocked()
+{
+  constexpr int m = 9;
+  constexpr int k = 300;
+  constexpr int n = 270;
+  int* a          = new int[m * k];
+  int* b          = new int[k * n];
+  int* c          = new int[m * n];
+  int* e          = new int[m * n];
+  test_product<Layout, Layout, Layout>(a, b, c, e, m, k, n);
+  test_product<Layout, Layout, Layout>(b, a, c, e, n, k, m);
+  delete[] a;
+  delete[] b;
+  delete[] c;
+  delete[] e;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test());
+  NV_IF_TARGET(NV_IS_HOST, (test_blocked<cuda::std::layout_right>(); test_blocked<cuda::std::layout_left>();))
+  return 0;
+}
@@ -0,0 +1,93 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/complex>
+#include <cuda/std/linalg>
+#include <cuda/std/mdspan>
+
+#include "test_macros.h"
+
+template <class Layout>
+TEST_FUNC constexpr void test_layout()
+{
+  cuda::std::array<int, 3> a{1, -2, 3};
+  cuda::std::array<int, 4> b{2, 0, -1, 5};
+  cuda::std::array<int, 12> c{};
+  cuda::std::mdspan<const int, cuda::std::dims<1>> x(a.data(), 3);
+  cuda::std::mdspan<const int, cuda::std::dims<1>> y(b.data(), 4);
+  cuda::std::mdspan<int, cuda::std::dims<2>, Layout> A(c.data(), 3, 4);
+  for (int i = 0; i < 3; ++i)
+  {
+    for (int j = 0; j < 4; ++j)
+    {
+      A(i, j) = i + j;
+    }
+  }
+
+  cuda::std::linalg::matrix_rank_1_update(x, y, A);
+  for (int i = 0; i < 3; ++i)
+  {
+    for (int j = 0; j < 4; ++j)
+    {
+      assert(A(i, j) == i + j + a[i] * b[j]);
+    }
+  }
+
+  // A^T += y * x^T
+  cuda::std::linalg::matrix_rank_1_update(y, cuda::std::linalg::scaled(-1, x), cuda::std::linalg::transposed(A));
+  for (int i = 0; i < 3; ++i)
+  {
+    for (int j = 0; j < 4; ++j)
+    {
+      assert(A(i, j) == i + j);
+    }
+  }
+}
+
+TEST_FUNC constexpr bool test()
+{
+  test_layout<cuda::std::layout_right>();
+  test_layout<cuda::std::layout_left>();
+  return true;
+}
+
+TEST_FUNC void test_conjugate()
+{
+  using C = cuda::std::complex<double>;
+  cuda::std::array<C, 2> a{C(1, 1), C(0, 2)};
+  cuda::std::array<C, 2> b{C(2, -1), C(1, 3)};
+  cuda::std::array<C, 4> c{};
+  cuda::std::array<C, 4> d{};
+  cuda::std::mdspan<const C, cuda::std::dims<1>> x(a.data(), 2);
+  cuda::std::mdspan<const C, cuda::std::dims<1>> y(b.data(), 2);
+  cuda::std::mdspan<C, cuda::std::dims<2>> A(c.data(), 2, 2);
+  cuda::std::mdspan<C, cuda::std::dims<2>, cuda::std::layout_left> B(d.data(), 2, 2);
+
+  cuda::std::linalg::matrix_rank_1_update(x, y, A);
+  cuda::std::linalg::matrix_rank_1_update_c(x, y, B);
+  for (int i = 0; i < 2; ++i)
+  {
+    for (int j = 0; j < 2; ++j)
+    {
+      assert(A(i, j) == a[i] * b[j]);
+      assert(B(i, j) == a[i] * cuda::std::conj(b[j]));
+    }
+  }
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test());
+  test_conjugate();
+  return 0;
+}
@@ -0,0 +1,97 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/linalg>
+#include <cuda/std/mdspan>
+
+#include "test_macros.h"
+
+template <class Layout>
+TEST_FUNC constexpr void test_layout()
+{
+  constexpr int rows    = 3;
+  constexpr int columns = 11;
+  cuda::std::array<int, rows * columns> a{};
+  cuda::std::mdspan<int, cuda::std::dims<2>, Layout> A(a.data(), rows, columns);
+  cuda::std::array<int, columns> b{};
+  cuda::std::array<int, rows> c{1, 2, 3};
+  cuda::std::array<int, rows> d{};
+  for (int j = 0; j < columns; ++j)
+  {
+    b[j] = j - 4;
+    for (int i = 0; i < rows; ++i)
+    {
+      A(i, j) = i * columns + j;
+    }
+  }
+  cuda::std::mdspan<const int, cuda::std::dims<1>> x(b.data(), columns);
+  cuda::std::mdspan<const int, cuda::std::dims<1>> y(c.data(), rows);
+  cuda::std::mdspan<int, cuda::std::dims<1>> z(d.data(), rows);
+
+  const auto expected = [&](int i) {
+    int sum = 0;
+    for (int j = 0; j < columns; ++j)
+    {
+      sum += A(i, j) * b[j];
+    }
+    return sum;
+  };
+
+  // z = A * x
+  cuda::std::linalg::matrix_vector_product(A, x, z);
+  for (int i = 0; i < rows; ++i)
+  {
+    assert(d[i] == expected(i));
+  }
+
+  // z = y + A * x
+  cuda::std::linalg::matrix_vector_product(A, x, y, z);
+  for (int i = 0; i < rows; ++i)
+  {
+    assert(d[i] == c[i] + expected(i));
+  }
+
+  // z = z + 2 * A * x, in place
+  cuda::std::linalg::matrix_vector_product(cuda::std::linalg::scaled(2, A), x, z, z);
+  for (int i = 0; i < rows; ++i)
+  {
+    assert(d[i] == c[i] + 3 * expected(i));
+  }
+
+  // w = A^T * z
+  cuda::std::array<int, columns> e{};
+  cuda::std::mdspan<int, cuda::std::dims<1>> w(e.data(), columns);
+  cuda::std::linalg::matrix_vector_product(cuda::std::linalg::transposed(A), z, w);
+  for (int j = 0; j < columns; ++j)
+  {
+    int sum = 0;
+    for (int i = 0; i < rows; ++i)
+    {
+      sum += A(i, j) * d[i];
+    }
+    assert(e[j] == sum);
+  }
+}
+
+TEST_FUNC constexpr bool test()
+{
+  test_layout<cuda::std::layout_right>();
+  test_layout<cuda::std::layout_left>();
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test());
+  return 0;
+}
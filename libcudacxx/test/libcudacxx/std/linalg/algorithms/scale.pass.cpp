@@ -0,0 +1,69 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/complex>
+#include <cuda/std/linalg>
+#include <cuda/std/mdspan>
+
+#include "test_macros.h"
+
+TEST_FUNC constexpr bool test()
+{
+  // vectors
+  {
+    cuda::std::array<int, 4> a{1, -2, 3, -4};
+    cuda::std::mdspan<int, cuda::std::dims<1>> x(a.data(), 4);
+    cuda::std::linalg::scale(3, x);
+    assert(a[0] == 3 && a[1] == -6 && a[2] == 9 && a[3] == -12);
+  }
+  // matrices in both layouts
+  {
+    cuda::std::array<int, 6> a{1, 2, 3, 4, 5, 6};
+    cuda::std::mdspan<int, cuda::std::dims<2>> x(a.data(), 2, 3);
+    cuda::std::linalg::scale(-1, x);
+    cuda::std::mdspan<int, cuda::std::dims<2>, cuda::std::layout_left> y(a.data(), 3, 2);
+    cuda::std::linalg::scale(2, y);
+    for (int i = 0; i < 6; ++i)
+    {
+      assert(a[i] == -2 * (i + 1));
+    }
+  }
+  // submatrix
+  {
+    cuda::std::array<int, 9> a{1, 1, 1, 1, 1, 1, 1, 1, 1};
+    cuda::std::layout_stride::mapping<cuda::std::dims<2>> map{
+      cuda::std::dims<2>{2, 2}, cuda::std::array<size_t, 2>{3, 1}};
+    cuda::std::mdspan<int, cuda::std::dims<2>, cuda::std::layout_stride> x(a.data() + 4, map);
+    cuda::std::linalg::scale(5, x);
+    assert(a[4] == 5 && a[5] == 5 && a[7] == 5 && a[8] == 5);
+    assert(a[0] == 1 && a[3] == 1 && a[6] == 1);
+  }
+  return true;
+}
+
+TEST_FUNC void test_complex()
+{
+  using C = cuda::std::complex<double>;
+  cuda::std::array<C, 2> a{C(1, 1), C(2, -1)};
+  cuda::std::mdspan<C, cuda::std::dims<1>> x(a.data(), 2);
+  cuda::std::linalg::scale(C(0, 1), x);
+  assert(a[0] == C(-1, 1));
+  assert(a[1] == C(1, 2));
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test());
+  test_complex();
+  return 0;
+}
@@ -0,0 +1,111 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/linalg>
+#include <cuda/std/mdspan>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+// Checks that the triangle t of A, with the diagonal d, times x is b
+template <class Matrix, class Triangle, class Diagonal>
+TEST_FUNC constexpr bool is_solution(Matrix A, Triangle, Diagonal, const int* x, const int* b)
+{
+  constexpr bool lower         = cuda::std::is_same_v<Triangle, cuda::std::linalg::lower_triangle_t>;
+  constexpr bool explicit_diag = cuda::std::is_same_v<Diagonal, cuda::std::linalg::explicit_diagonal_t>;
+  const int size               = static_cast<int>(A.extent(0));
+  for (int i = 0; i < size; ++i)
+  {
+    int sum = explicit_diag ? A(i, i) * x[i] : x[i];
+    for (int j = 0; j < size; ++j)
+    {
+      if (lower ? j < i : j > i)
+      {
+        sum += A(i, j) * x[j];
+      }
+    }
+    if (sum != b[i])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <class Layout, class Triangle, class Diagonal>
+TEST_FUNC constexpr void test_solve(Triangle t, Diagonal d)
+{
+  constexpr int size = 5;
+  cuda::std::array<int, size * size> a{};
+  cuda::std::mdspan<int, cuda::std::extents<int, size, size>, Layout> A(a.data());
+  // the elements of the other triangle are not zero, so reading them would give a wrong solution
+  for (int i = 0; i < size; ++i)
+  {
+    for (int j = 0; j < size; ++j)
+    {
+      A(i, j) = i == j ? (i % 2 == 0 ? 1 : -1) : (i + 2 * j) % 3 - 1;
+    }
+  }
+  cuda::std::array<int, size> expected{3, -1, 4, 1, -5};
+  cuda::std::array<int, size> b{};
+  {
+    constexpr bool lower         = cuda::std::is_same_v<Triangle, cuda::std::linalg::lower_triangle_t>;
+    constexpr bool explicit_diag = cuda::std::is_same_v<Diagonal, cuda::std::linalg::explicit_diagonal_t>;
+    for (int i = 0; i < size; ++i)
+    {
+      b[i] = explicit_diag ? A(i, i) * expected[i] : expected[i];
+      for (int j = 0; j < size; ++j)
+      {
+        if (lower ? j < i : j > i)
+        {
+          b[i] += A(i, j) * expected[j];
+        }
+      }
+    }
+  }
+
+  cuda::std::array<int, size> x{};
+  cuda::std::mdspan<const int, cuda::std::dims<1>> b_view(b.data(), size);
+  cuda::std::mdspan<int, cuda::std::dims<1>> x_view(x.data(), size);
+  cuda::std::linalg::triangular_matrix_vector_solve(A, t, d, b_view, x_view);
+  assert(x == expected);
+  assert(is_solution(A, t, d, x.data(), b.data()));
+
+  // in place
+  cuda::std::array<int, size> y = b;
+  cuda::std::mdspan<int, cuda::std::dims<1>> y_view(y.data(), size);
+  cuda::std::linalg::triangular_matrix_vector_solve(A, t, d, y_view);
+  assert(y == expected);
+}
+
+template <class Layout>
+TEST_FUNC constexpr void test_layout()
+{
+  test_solve<Layout>(cuda::std::linalg::lower_triangle, cuda::std::linalg::explicit_diagonal);
+  test_solve<Layout>(cuda::std::linalg::lower_triangle, cuda::std::linalg::implicit_unit_diagonal);
+  test_solve<Layout>(cuda::std::linalg::upper_triangle, cuda::std::linalg::explicit_diagonal);
+  test_solve<Layout>(cuda::std::linalg::upper_triangle, cuda::std::linalg::implicit_unit_diagonal);
+}
+
+TEST_FUNC constexpr bool test()
+{
+  test_layout<cuda::std::layout_right>();
+  test_layout<cuda::std::layout_left>();
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test());
+  return 0;
+}
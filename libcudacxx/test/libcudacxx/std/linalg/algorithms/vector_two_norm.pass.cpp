@@ -0,0 +1,92 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/cmath>
+#include <cuda/std/complex>
+#include <cuda/std/limits>
+#include <cuda/std/linalg>
+#include <cuda/std/mdspan>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+TEST_FUNC void test_real()
+{
+  cuda::std::array<double, 11> a{};
+  double sum_of_squares = 0.0;
+  for (int i = 0; i < 11; ++i)
+  {
+    a[i] = 0.5 * i - 2.0;
+    sum_of_squares += a[i] * a[i];
+  }
+  cuda::std::mdspan<const double, cuda::std::dims<1>> x(a.data(), 11);
+
+  static_assert(cuda::std::is_same_v<decltype(cuda::std::linalg::vector_two_norm(x)), double>);
+  assert(cuda::std::fabs(cuda::std::linalg::vector_two_norm(x) - cuda::std::sqrt(sum_of_squares)) < 1e-12);
+  assert(cuda::std::fabs(cuda::std::linalg::vector_two_norm(x, 3.0) - cuda::std::sqrt(sum_of_squares + 9.0)) < 1e-12);
+
+  // 3-4-5 triangle
+  cuda::std::array<float, 2> b{3.0f, -4.0f};
+  cuda::std::mdspan<const float, cuda::std::extents<int, 2>> y(b.data());
+  assert(cuda::std::linalg::vector_two_norm(y) == 5.0f);
+  assert(cuda::std::linalg::vector_two_norm(cuda::std::linalg::scaled(2.0f, y)) == 10.0f);
+
+  // empty vector
+  cuda::std::mdspan<const float, cuda::std::dims<1>> empty(b.data(), 0);
+  assert(cuda::std::linalg::vector_two_norm(empty) == 0.0f);
+  assert(cuda::std::linalg::vector_two_norm(empty, -2.0f) == 2.0f);
+}
+
+TEST_FUNC void test_complex()
+{
+  using C = cuda::std::complex<double>;
+  cuda::std::array<C, 2> a{C(3, 4), C(0, -12)};
+  cuda::std::mdspan<const C, cuda::std::dims<1>> x(a.data(), 2);
+
+  // the norm of a complex vector is real
+  static_assert(cuda::std::is_same_v<decltype(cuda::std::linalg::vector_two_norm(x)), double>);
+  assert(cuda::std::linalg::vector_two_norm(x) == 13.0);
+}
+
+template <class T>
+TEST_FUNC void test_scaling(T large, T tiny)
+{
+  // the squares of the elements overflow or underflow, but the norm is representable
+  cuda::std::array<T, 3> a{3 * large, T(0), -4 * large};
+  cuda::std::mdspan<const T, cuda::std::dims<1>> x(a.data(), 3);
+  assert(cuda::std::fabs(cuda::std::linalg::vector_two_norm(x) - 5 * large) <= 5 * large * 1e-6);
+  assert(cuda::std::fabs(cuda::std::linalg::vector_two_norm(x, 12 * large) - 13 * large) <= 13 * large * 1e-6);
+
+  cuda::std::array<T, 3> b{3 * tiny, T(0), -4 * tiny};
+  cuda::std::mdspan<const T, cuda::std::dims<1>> y(b.data(), 3);
+  assert(cuda::std::fabs(cuda::std::linalg::vector_two_norm(y) - 5 * tiny) <= 5 * tiny * 1e-6);
+
+  cuda::std::array<cuda::std::complex<T>, 1> c{cuda::std::complex<T>(3 * large, 4 * large)};
+  cuda::std::mdspan<const cuda::std::complex<T>, cuda::std::dims<1>> z(c.data(), 1);
+  assert(cuda::std::fabs(cuda::std::linalg::vector_two_norm(z) - 5 * large) <= 5 * large * 1e-6);
+
+  // the norm only overflows if it is not representable
+  cuda::std::array<T, 2> d{cuda::std::numeric_limits<T>::infinity(), large};
+  cuda::std::mdspan<const T, cuda::std::dims<1>> w(d.data(), 2);
+  assert(cuda::std::linalg::vector_two_norm(w) == cuda::std::numeric_limits<T>::infinity());
+  d = {cuda::std::numeric_limits<T>::max(), cuda::std::numeric_limits<T>::max()};
+  assert(cuda::std::linalg::vector_two_norm(w) == cuda::std::numeric_limits<T>::infinity());
+}
+
+int main(int, char**)
+{
+  test_real();
+  test_complex();
+  test_scaling<float>(1e20f, 1e-30f);
+  test_scaling<double>(1e200, 1e-200);
+  return 0;
+}
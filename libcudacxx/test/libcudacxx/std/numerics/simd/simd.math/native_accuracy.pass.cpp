@@ -0,0 +1,187 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <cuda/std/__simd_>
+
+// [simd.math], exp, log, sqrt, sin, cos, tanh, erf and pow of vectors of the native ABI
+//
+// On x86-64 hosts these functions compute all lanes of a vector register at once. Their results must stay within the
+// documented error bounds of the scalar functions, including for special and out of range arguments.
+
+#include <cuda/std/__simd_>
+#include <cuda/std/bit>
+#include <cuda/std/cassert>
+#include <cuda/std/cmath>
+#include <cuda/std/cstdint>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include "../simd_test_utils.h"
+
+// The distance in units in the last place between two numbers of the same sign, which is 0 for two NaNs
+template <typename T>
+TEST_FUNC bool within_ulps(T result, T expected, int ulps)
+{
+  using I = cuda::std::conditional_t<sizeof(T) == sizeof(int32_t), int32_t, int64_t>;
+  if (cuda::std::isnan(expected))
+  {
+    return cuda::std::isnan(result);
+  }
+  const I result_bits   = cuda::std::bit_cast<I>(result);
+  const I expected_bits = cuda::std::bit_cast<I>(expected);
+  if ((result_bits < 0) != (expected_bits < 0))
+  {
+    return false;
+  }
+  const I distance = result_bits < expected_bits ? expected_bits - result_bits : result_bits - expected_bits;
+  return distance <= ulps;
+}
+
+template <typename T>
+struct test_values
+{
+  static constexpr int size = 24;
+
+  TEST_FUNC static T get(int i)
+  {
+    const T values[size] = {
+      T{0},
+      -T{0},
+      T{0.5},
+      T{-0.75},
+      T{1},
+      T{2.5},
+      T{-3},
+      T{10.25},
+      T{-20.5},
+      T{0.001},
+      T{-1e-30},
+      T{88.5},
+      T{100},
+      T{-120},
+      T{700},
+      T{-745},
+      T{12345.5},
+      T{1e7},
+      T{1e22},
+      cuda::std::numeric_limits<T>::denorm_min() * T{3},
+      cuda::std::numeric_limits<T>::min(),
+      cuda::std::numeric_limits<T>::infinity(),
+      -cuda::std::numeric_limits<T>::infinity(),
+      cuda::std::numeric_limits<T>::quiet_NaN()};
+    return values[i % size];
+  }
+};
+
+// The bounds of the vector functions plus one for the rounding of the scalar functions
+template <typename T, typename Vec>
+TEST_FUNC void test_unary(const Vec& vec)
+{
+  constexpr bool is_float = cuda::std::is_same_v<T, float>;
+  const Vec exp_result    = cuda::std::simd::exp(vec);
+  const Vec log_result    = cuda::std::simd::log(vec);
+  const Vec sqrt_result   = cuda::std::simd::sqrt(vec);
+  const Vec sin_result    = cuda::std::simd::sin(vec);
+  const Vec cos_result    = cuda::std::simd::cos(vec);
+  const Vec tanh_result   = cuda::std::simd::tanh(vec);
+  const Vec erf_result    = cuda::std::simd::erf(vec);
+  for (int i = 0; i < Vec::size(); ++i)
+  {
+    assert(within_ulps(exp_result[i], cuda::std::exp(vec[i]), 2));
+    assert(within_ulps(log_result[i], cuda::std::log(vec[i]), 2));
+    assert(within_ulps(sqrt_result[i], cuda::std::sqrt(vec[i]), 0));
+    assert(within_ulps(sin_result[i], cuda::std::sin(vec[i]), 2));
+    assert(within_ulps(cos_result[i], cuda::std::cos(vec[i]), 2));
+    assert(within_ulps(tanh_result[i], cuda::std::tanh(vec[i]), is_float ? 2 : 3));
+    assert(within_ulps(erf_result[i], cuda::std::erf(vec[i]), 2));
+  }
+}
+
+template <typename T, typename Vec>
+TEST_FUNC void test_pow(const Vec& x)
+{
+  const T exponents[] = {T{2}, T{0.5}, T{-1.5}, T{3.25}, T{-7}, T{0}, cuda::std::numeric_limits<T>::infinity()};
+  for (const T exponent : exponents)
+  {
+    const Vec y(exponent);
+    const Vec pow_result = cuda::std::simd::pow(x, y);
+    for (int i = 0; i < Vec::size(); ++i)
+    {
+      assert(within_ulps(pow_result[i], cuda::std::pow(x[i], exponent), 2));
+    }
+  }
+}
+
+// Powers whose logarithm y log(x) is large, so that the error of log(x) is magnified the most
+template <typename Vec>
+TEST_FUNC void test_pow_large_exponent()
+{
+  constexpr int size         = 6;
+  const double args[size][2] = {
+    {741.86792225011811, -96.280782022505861},
+    {180.92, 95.74},
+    {1.4134339110138778, -1835.0858224383599},
+    {1.3955188591039158, 1565.1295038829649},
+    {0.71538591236301197, 876.37990368469139},
+    {5.034700844859867e-98, 3.1416896335792424}};
+  const Vec x([&args](int i) {
+    return args[i % size][0];
+  });
+  const Vec y([&args](int i) {
+    return args[i % size][1];
+  });
+  const Vec pow_result = cuda::std::simd::pow(x, y);
+  for (int i = 0; i < Vec::size(); ++i)
+  {
+    assert(within_ulps(pow_result[i], cuda::std::pow(x[i], y[i]), 2));
+  }
+}
+
+template <typename T, typename Abi>
+TEST_FUNC void test_abi()
+{
+  using Vec = simd::basic_vec<T, Abi>;
+  for (int offset = 0; offset < test_values<T>::size; offset += Vec::size())
+  {
+    const Vec vec([offset](int i) {
+      return test_values<T>::get(offset + i);
+    });
+    test_unary<T>(vec);
+    test_pow<T>(vec);
+  }
+}
+
+template <typename T>
+TEST_FUNC void test_type()
+{
+  test_abi<T, simd::native<T>>();
+  test_abi<T, simd::compatible<T>>();
+  test_abi<T, simd::fixed_size<16 / sizeof(T)>>();
+}
+
+TEST_FUNC void test_pow_large_exponent()
+{
+  test_pow_large_exponent<simd::basic_vec<double, simd::native<double>>>();
+  test_pow_large_exponent<simd::basic_vec<double, simd::fixed_size<8>>>();
+}
+
+TEST_FUNC bool test()
+{
+  test_type<float>();
+  test_type<double>();
+  test_pow_large_exponent();
+  return true;
+}
+
+int main(int, char**)
+{
+  assert(test());
+  return 0;
+}
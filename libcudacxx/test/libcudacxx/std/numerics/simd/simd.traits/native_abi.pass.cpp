@@ -0,0 +1,192 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: enable-tile
+// error: asm statement is unsupported in tile code
+
+// <cuda/std/__simd_>
+
+// template<class T> using native     = ...;
+// template<class T> using compatible = ...;
+//
+// On x86-64 hosts the native ABI fills a vector register, and the operations on vectors of that width use vector
+// instructions. The results must match the element-wise results of constant evaluation.
+
+#include <cuda/std/__simd_>
+#include <cuda/std/cassert>
+#include <cuda/std/cstdint>
+#include <cuda/std/type_traits>
+
+#include "../simd_test_utils.h"
+#include "test_macros.h"
+
+struct reverse_gen
+{
+  template <typename I, typename S>
+  TEST_FUNC constexpr int operator()(I i, S size) const
+  {
+    return size - 1 - i;
+  }
+};
+
+struct zero_odd_lanes_gen
+{
+  template <typename I>
+  TEST_FUNC constexpr int operator()(I i) const
+  {
+    return (i % 2 == 0) ? int{i} : simd::zero_element;
+  }
+};
+
+template <typename T>
+TEST_FUNC constexpr void test_sizes()
+{
+  constexpr int native_size     = simd::basic_vec<T, simd::native<T>>::size();
+  constexpr int compatible_size = simd::basic_vec<T, simd::compatible<T>>::size();
+  static_assert(native_size >= compatible_size);
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+  static_assert(native_size * sizeof(T) == _CCCL_SIMD_HOST_VECTOR_BYTES);
+  static_assert(compatible_size * sizeof(T) == 16);
+  // the lanes stay in an array aligned to at least 8 bytes, the operations only convert it to vector registers
+  static_assert(sizeof(simd::basic_vec<T, simd::native<T>>) == native_size * sizeof(T));
+  static_assert(alignof(simd::basic_vec<T, simd::native<T>>) == (alignof(T) < 8 ? 8 : alignof(T)));
+#else // ^^^ _CCCL_HAS_SIMD_HOST_VECTOR() ^^^ / vvv !_CCCL_HAS_SIMD_HOST_VECTOR() vvv
+  static_assert(compatible_size == 1);
+#endif // !_CCCL_HAS_SIMD_HOST_VECTOR()
+}
+
+template <typename T, typename Abi>
+TEST_FUNC constexpr void test_operations()
+{
+  using Vec           = simd::basic_vec<T, Abi>;
+  constexpr int N     = Vec::size();
+  const Vec a([](int i) { return static_cast<T>(i % 13 + 1); });
+  const Vec b([](int i) { return static_cast<T>(i % 7 + 1); });
+
+  const Vec sum        = a + b;
+  const Vec difference = a - b;
+  const Vec product    = a * b;
+  const Vec negated    = -a;
+  const auto less      = a < b;
+  const auto equal     = a == b;
+  for (int i = 0; i < N; ++i)
+  {
+    assert(sum[i] == static_cast<T>(a[i] + b[i]));
+    assert(difference[i] == static_cast<T>(a[i] - b[i]));
+    assert(product[i] == static_cast<T>(a[i] * b[i]));
+    assert(negated[i] == static_cast<T>(-a[i]));
+    assert(less[i] == (a[i] < b[i]));
+    assert(equal[i] == (a[i] == b[i]));
+  }
+  if constexpr (cuda::std::is_integral_v<T>)
+  {
+    const Vec bit_and = a & b;
+    const Vec bit_xor = a ^ b;
+    for (int i = 0; i < N; ++i)
+    {
+      assert(bit_and[i] == static_cast<T>(a[i] & b[i]));
+      assert(bit_xor[i] == static_cast<T>(a[i] ^ b[i]));
+    }
+    if constexpr (sizeof(T) >= sizeof(int))
+    {
+      const Vec shifted = a << (b & Vec(3));
+      for (int i = 0; i < N; ++i)
+      {
+        assert(shifted[i] == static_cast<T>(a[i] << (b[i] & 3)));
+      }
+    }
+  }
+  else
+  {
+    const Vec quotient = a / b;
+    for (int i = 0; i < N; ++i)
+    {
+      assert(quotient[i] == a[i] / b[i]);
+    }
+  }
+
+  // reductions
+  T expected_sum = 0;
+  T expected_min = a[0];
+  T expected_max = a[0];
+  T masked_sum   = 0;
+  for (int i = 0; i < N; ++i)
+  {
+    expected_sum = static_cast<T>(expected_sum + a[i]);
+    expected_min = a[i] < expected_min ? a[i] : expected_min;
+    expected_max = expected_max < a[i] ? a[i] : expected_max;
+    masked_sum   = less[i] ? static_cast<T>(masked_sum + a[i]) : masked_sum;
+  }
+  assert(simd::reduce(a) == expected_sum);
+  assert(simd::reduce(a, less) == masked_sum);
+  assert(simd::reduce_min(a) == expected_min);
+  assert(simd::reduce_max(a) == expected_max);
+
+  // mask reductions
+  const auto last = a == Vec(a[N - 1]);
+  int count       = 0;
+  int min_index   = -1;
+  int max_index   = -1;
+  for (int i = 0; i < N; ++i)
+  {
+    if (last[i])
+    {
+      ++count;
+      min_index = min_index < 0 ? i : min_index;
+      max_index = i;
+    }
+  }
+  assert(simd::reduce_count(last) == count);
+  assert(simd::reduce_min_index(last) == min_index);
+  assert(simd::reduce_max_index(last) == max_index);
+  assert(simd::any_of(last));
+  assert(!simd::all_of(less) || N == 1);
+  assert(simd::all_of(a == a));
+  assert(simd::none_of(a != a));
+
+  // permute
+  const Vec reversed = simd::permute(a, reverse_gen{});
+  const Vec zeroed   = simd::permute(a, zero_odd_lanes_gen{});
+  for (int i = 0; i < N; ++i)
+  {
+    assert(reversed[i] == a[N - 1 - i]);
+    assert(zeroed[i] == (i % 2 == 0 ? a[i] : T{}));
+  }
+}
+
+template <typename T>
+TEST_FUNC constexpr void test_type()
+{
+  test_sizes<T>();
+  test_operations<T, simd::native<T>>();
+  test_operations<T, simd::compatible<T>>();
+}
+
+TEST_FUNC constexpr bool test()
+{
+  test_type<int8_t>();
+  test_type<uint8_t>();
+  test_type<int16_t>();
+  test_type<uint16_t>();
+  test_type<int32_t>();
+  test_type<uint32_t>();
+  test_type<int64_t>();
+  test_type<uint64_t>();
+  test_type<float>();
+  test_type<double>();
+  return true;
+}
+
+int main(int, char**)
+{
+  static_assert(test());
+  assert(test());
+  return 0;
+}
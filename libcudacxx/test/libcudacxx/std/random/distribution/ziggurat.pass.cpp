@@ -0,0 +1,106 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// XFAIL: enable-tile
+// error: dynamic memory allocation is unsupported in tile code
+//
+// REQUIRES: long_tests
+
+// <random>
+
+// The float and double normal_distribution and exponential_distribution are generated with the ziggurat method, which
+// handles the tail beyond its bottom layer separately and combines the bits of the engines with less than 64 bits.
+
+#include <cuda/std/cassert>
+#include <cuda/std/cmath>
+#include <cuda/std/random>
+
+#include "random_utilities/test_distribution.h"
+#include "test_macros.h"
+
+template <class T>
+struct normal_cdf
+{
+  using P = typename cuda::std::normal_distribution<T>::param_type;
+
+  TEST_FUNC double operator()(double x, const P& p) const
+  {
+    return 0.5 * (1 + cuda::std::erf((x - (p.mean())) / (p.stddev() * cuda::std::sqrt(2))));
+  }
+};
+
+template <class T>
+struct exponential_cdf
+{
+  using P = typename cuda::std::exponential_distribution<T>::param_type;
+
+  TEST_FUNC double operator()(double x, const P& p) const
+  {
+    return x <= 0 ? 0.0 : 1.0 - cuda::std::exp(-p.lambda() * x);
+  }
+};
+
+// The fraction of the samples in the tail must match the density beyond the bottom layer of the ziggurat
+template <class T>
+TEST_FUNC void test_tails()
+{
+  constexpr int num_samples = 1 << 21;
+  cuda::std::philox4x64 g{};
+  cuda::std::normal_distribution<T> normal;
+  cuda::std::exponential_distribution<T> exponential;
+  int normal_tail      = 0;
+  int normal_far_tail  = 0;
+  int exponential_tail = 0;
+  for (int i = 0; i < num_samples; ++i)
+  {
+    const T x = normal(g);
+    const T y = exponential(g);
+    normal_tail += cuda::std::abs(x) > T(3.6541528853610092);
+    normal_far_tail += cuda::std::abs(x) > T(4.5);
+    exponential_tail += y > T(7.69711747013105);
+    assert(y >= 0);
+  }
+  // The expected counts are 2.58e-4, 6.80e-6 and 4.54e-4 times num_samples, and the bounds are 5 standard deviations
+  assert(normal_tail > 541 - 5 * 23 && normal_tail < 541 + 5 * 23);
+  assert(normal_far_tail > 0 && normal_far_tail < 14 + 5 * 4);
+  assert(exponential_tail > 952 - 5 * 31 && exponential_tail < 952 + 5 * 31);
+}
+
+template <class T, class G>
+TEST_FUNC void test_engine()
+{
+  {
+    using D                       = cuda::std::normal_distribution<T>;
+    using P                       = typename D::param_type;
+    cuda::std::array<P, 3> params = {P(0, 1), P(10, 2), P(-5, 0.5)};
+    test_distribution<D, true, G, false>(params, normal_cdf<T>{});
+  }
+  {
+    using D                       = cuda::std::exponential_distribution<T>;
+    using P                       = typename D::param_type;
+    cuda::std::array<P, 3> params = {P(1), P(0.5), P(20)};
+    test_distribution<D, true, G, false>(params, exponential_cdf<T>{});
+  }
+}
+
+template <class T>
+TEST_FUNC void test()
+{
+  test_tails<T>();
+  test_engine<T, cuda::std::philox4x32>();
+  test_engine<T, cuda::std::minstd_rand>();
+}
+
+int main(int, char**)
+{
+  test<double>();
+  test<float>();
+  return 0;
+}
@@ -0,0 +1,191 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <cuda/std/string_view>
+
+// The searches of strings of bytes on the host scan several bytes at a time. Compare them with element-wise searches
+// on strings longer than the blocks, at every position and with matches across the boundaries of the blocks.
+
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+#include <cuda/std/cstddef>
+#include <cuda/std/string_view>
+
+#include "test_macros.h"
+
+using SV = cuda::std::string_view;
+
+constexpr cuda::std::size_t npos = SV::npos;
+
+TEST_FUNC bool contains(SV set, char c)
+{
+  for (char x : set)
+  {
+    if (x == c)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+TEST_FUNC bool matches_at(SV sv, SV str, cuda::std::size_t i)
+{
+  for (cuda::std::size_t j = 0; j < str.size(); ++j)
+  {
+    if (sv[i + j] != str[j])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+TEST_FUNC cuda::std::size_t naive_find(SV sv, SV str, cuda::std::size_t pos)
+{
+  for (cuda::std::size_t i = pos; i + str.size() <= sv.size(); ++i)
+  {
+    if (matches_at(sv, str, i))
+    {
+      return i;
+    }
+  }
+  return npos;
+}
+
+TEST_FUNC cuda::std::size_t naive_rfind(SV sv, SV str, cuda::std::size_t pos)
+{
+  if (str.size() > sv.size())
+  {
+    return npos;
+  }
+  for (cuda::std::size_t i = cuda::std::min(pos, sv.size() - str.size()) + 1; i-- > 0;)
+  {
+    if (matches_at(sv, str, i))
+    {
+      return i;
+    }
+  }
+  return npos;
+}
+
+TEST_FUNC cuda::std::size_t naive_find_first_of(SV sv, SV set, cuda::std::size_t pos, bool in_set)
+{
+  for (cuda::std::size_t i = pos; i < sv.size(); ++i)
+  {
+    if (contains(set, sv[i]) == in_set)
+    {
+      return i;
+    }
+  }
+  return npos;
+}
+
+TEST_FUNC cuda::std::size_t naive_find_last_of(SV sv, SV set, cuda::std::size_t pos, bool in_set)
+{
+  for (cuda::std::size_t i = cuda::std::min(pos, sv.size() - 1) + 1; i-- > 0;)
+  {
+    if (contains(set, sv[i]) == in_set)
+    {
+      return i;
+    }
+  }
+  return npos;
+}
+
+TEST_FUNC void test_searches(SV sv, SV str)
+{
+  for (cuda::std::size_t pos = 0; pos <= sv.size() + 1; pos += 7)
+  {
+    assert(sv.find(str, pos) == naive_find(sv, str, pos));
+    assert(sv.rfind(str, pos) == naive_rfind(sv, str, pos));
+    assert(sv.find_first_of(str, pos) == (str.empty() ? npos : naive_find_first_of(sv, str, pos, true)));
+    assert(sv.find_first_not_of(str, pos) == naive_find_first_of(sv, str, pos, false));
+    if (!sv.empty())
+    {
+      assert(sv.find_last_of(str, pos) == (str.empty() ? npos : naive_find_last_of(sv, str, pos, true)));
+      assert(sv.find_last_not_of(str, pos) == naive_find_last_of(sv, str, pos, false));
+    }
+  }
+  assert(sv.rfind(str) == naive_rfind(sv, str, npos));
+  if (!str.empty())
+  {
+    assert(sv.rfind(str[0]) == naive_rfind(sv, str.substr(0, 1), npos));
+    assert(sv.rfind(str[0], sv.size() / 2) == naive_rfind(sv, str.substr(0, 1), sv.size() / 2));
+  }
+}
+
+TEST_FUNC void test()
+{
+  // A text over a small alphabet, so that the first and last bytes of the patterns match often
+  constexpr cuda::std::size_t size = 300;
+  char text[size];
+  unsigned state = 12345;
+  for (cuda::std::size_t i = 0; i < size; ++i)
+  {
+    state   = state * 1103515245u + 12345u;
+    text[i] = static_cast<char>('a' + (state >> 16) % 4);
+  }
+  text[size - 1] = '\xFF';
+
+  const SV patterns[] = {
+    "",
+    "a",
+    "ab",
+    "ba",
+    "abc",
+    "cab",
+    "abca",
+    "dddd",
+    "abcdabcd",
+    "bacadaba",
+    "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa",
+    "d\xFF",
+    "zz",
+    "\xFF",
+    "ab,",
+    ",;\xFF",
+    "abcd",
+    "xyzw!",
+    "abcdefghij"};
+  const cuda::std::size_t lengths[]       = {size, 0, 1, 15, 31, 33, 64, 100};
+  const cuda::std::size_t offsets[]       = {0, 3};
+  const cuda::std::size_t pattern_sizes[] = {2, 3, 17, 40};
+
+  for (cuda::std::size_t length : lengths)
+  {
+    for (cuda::std::size_t offset : offsets)
+    {
+      if (offset + length > size)
+      {
+        continue;
+      }
+      const SV sv{text + size - length - offset, length};
+      for (SV pattern : patterns)
+      {
+        test_searches(sv, pattern);
+      }
+      // Patterns taken from the text, so that they are found at every position
+      for (cuda::std::size_t n : pattern_sizes)
+      {
+        for (cuda::std::size_t i = 0; i + n <= length; i += 5)
+        {
+          test_searches(sv, sv.substr(i, n));
+        }
+      }
+    }
+  }
+}
+
+int main(int, char**)
+{
+  test();
+  return 0;
+}
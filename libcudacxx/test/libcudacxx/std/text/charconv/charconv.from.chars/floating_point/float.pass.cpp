@@ -0,0 +1,354 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/bit>
+#include <cuda/std/cassert>
+#include <cuda/std/charconv>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/cstring>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+struct TestItem
+{
+  const char* str;
+  cuda::std::chars_format fmt;
+  cuda::std::errc ec;
+  cuda::std::ptrdiff_t len;
+  float val; // the parsed value when ec is errc{}
+};
+
+// Source code for the generation of the test items
+// #include <charconv>
+// #include <cstring>
+// #include <iostream>
+// #include <string>
+// #include <system_error>
+//
+// template <class T>
+// std::string lit(T v)
+// {
+//   char buff[64];
+//   auto r = std::to_chars(buff, buff + sizeof(buff), v, std::chars_format::scientific);
+//   std::string s(buff, r.ptr);
+//   return s + (sizeof(T) == 4 ? "f" : "");
+// }
+//
+// template <class T, std::size_t N>
+// void gen(const char* const (&inputs)[N])
+// {
+//   std::chars_format fmts[] = {
+//     std::chars_format::general, std::chars_format::scientific, std::chars_format::fixed, std::chars_format::hex};
+//   const char* names[] = {"::general", "::scientific", "::fixed", "::hex"};
+//   const char* errcs[] = {"{}", "::invalid_argument", "::result_out_of_range"};
+//   std::size_t count = 0;
+//   std::string body;
+//   for (auto s : inputs)
+//   {
+//     for (int f = 0; f < 4; ++f)
+//     {
+//       T v{};
+//       const auto r = std::from_chars(s, s + std::strlen(s), v, fmts[f]);
+//       const int e  = r.ec == std::errc{} ? 0 : r.ec == std::errc::invalid_argument ? 1 : 2;
+//       body += "    TestItem{\"" + std::string(s) + "\", cuda::std::chars_format" + names[f] + ", cuda::std::errc"
+//             + errcs[e] + ", " + std::to_string(r.ptr - s) + ", " + lit(v) + "},\n";
+//       ++count;
+//     }
+//   }
+//   std::cout << "TEST_FUNC constexpr cuda::std::array<TestItem, " << count << "> get_test_items()\n{\n  return {{\n"
+//             << body << "  }};\n}\n";
+// }
+//
+// int main()
+// {
+// #ifdef FLOAT
+//   constexpr const char* inputs[] = {
+//     "0", "-0", "1", "-1.5", "0.1", "000123.4500e-2", "1.e5", ".5", "1e", "1e+", "1.5p3", "ff.8", "3.40282346e38",
+//     "3.40282357e38", "1e39", "1.17549435e-38", "1e-45", "7e-46", "1e-46", "16777217", "16777219",
+//     "1.00000005960464477539062500000000000000000000001", "0.000000000000000000000000000000000000000000000000000001",
+//     "1.fffffep127", "1.ffffffp127", "1p-149", "1.8p-149", "1p-150", "+1", " 1", ".", "-", "x"};
+// #else
+//   constexpr const char* inputs[] = {
+//     "0", "-0", "1", "-1.5", "0.1", "000123.4500e-2", "1.e5", ".5", "1e", "1e+", "1.5p3", "ff.8", "1e23",
+//     "9007199254740993", "9007199254740993.00000000000000000001", "1.7976931348623157e308", "1.7976931348623159e308",
+//     "1e309", "2.2250738585072014e-308", "2.2250738585072011e-308", "4.9406564584124654e-324",
+//     "2.4703282292062327e-324", "2.4703282292062328e-324", "1e-400", "123456789012345678901234567890",
+//     "1.fffffffffffff8p1023", "1p-1074", "1.8p-1074", "1p-1075", "+1", " 1", ".", "-", "x"};
+// #endif
+//   gen<
+// #ifdef FLOAT
+//     float
+// #else
+//     double
+// #endif
+//     >(inputs);
+// }
+//
+
+TEST_FUNC constexpr cuda::std::array<TestItem, 132> get_test_items()
+{
+  return {{
+    TestItem{"0", cuda::std::chars_format::general, cuda::std::errc{}, 1, 0e+00f},
+    TestItem{"0", cuda::std::chars_format::scientific, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{"0", cuda::std::chars_format::fixed, cuda::std::errc{}, 1, 0e+00f},
+    TestItem{"0", cuda::std::chars_format::hex, cuda::std::errc{}, 1, 0e+00f},
+    TestItem{"-0", cuda::std::chars_format::general, cuda::std::errc{}, 2, -0e+00f},
+    TestItem{"-0", cuda::std::chars_format::scientific, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{"-0", cuda::std::chars_format::fixed, cuda::std::errc{}, 2, -0e+00f},
+    TestItem{"-0", cuda::std::chars_format::hex, cuda::std::errc{}, 2, -0e+00f},
+    TestItem{"1", cuda::std::chars_format::general, cuda::std::errc{}, 1, 1e+00f},
+    TestItem{"1", cuda::std::chars_format::scientific, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{"1", cuda::std::chars_format::fixed, cuda::std::errc{}, 1, 1e+00f},
+    TestItem{"1", cuda::std::chars_format::hex, cuda::std::errc{}, 1, 1e+00f},
+    TestItem{"-1.5", cuda::std::chars_format::general, cuda::std::errc{}, 4, -1.5e+00f},
+    TestItem{"-1.5", cuda::std::chars_format::scientific, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{"-1.5", cuda::std::chars_format::fixed, cuda::std::errc{}, 4, -1.5e+00f},
+    TestItem{"-1.5", cuda::std::chars_format::hex, cuda::std::errc{}, 4, -1.3125e+00f},
+    TestItem{"0.1", cuda::std::chars_format::general, cuda::std::errc{}, 3, 1e-01f},
+    TestItem{"0.1", cuda::std::chars_format::scientific, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{"0.1", cuda::std::chars_format::fixed, cuda::std::errc{}, 3, 1e-01f},
+    TestItem{"0.1", cuda::std::chars_format::hex, cuda::std::errc{}, 3, 6.25e-02f},
+    TestItem{"000123.4500e-2", cuda::std::chars_format::general, cuda::std::errc{}, 14, 1.2345e+00f},
+    TestItem{"000123.4500e-2", cuda::std::chars_format::scientific, cuda::std::errc{}, 14, 1.2345e+00f},
+    TestItem{"000123.4500e-2", cuda::std::chars_format::fixed, cuda::std::errc{}, 11, 1.2345e+02f},
+    TestItem{"000123.4500e-2", cuda::std::chars_format::hex, cuda::std::errc{}, 12, 2.9126953e+02f},
+    TestItem{"1.e5", cuda::std::chars_format::general, cuda::std::errc{}, 4, 1e+05f},
+    TestItem{"1.e5", cuda::std::chars_format::scientific, cuda::std::errc{}, 4, 1e+05f},
+    TestItem{"1.e5", cuda::std::chars_format::fixed, cuda::std::errc{}, 2, 1e+00f},
+    TestItem{"1.e5", cuda::std::chars_format::hex, cuda::std::errc{}, 4, 1.8945312e+00f},
+    TestItem{".5", cuda::std::chars_format::general, cuda::std::errc{}, 2, 5e-01f},
+    TestItem{".5", cuda::std::chars_format::scientific, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{".5", cuda::std::chars_format::fixed, cuda::std::errc{}, 2, 5e-01f},
+    TestItem{".5", cuda::std::chars_format::hex, cuda::std::errc{}, 2, 3.125e-01f},
+    TestItem{"1e", cuda::std::chars_format::general, cuda::std::errc{}, 1, 1e+00f},
+    TestItem{"1e", cuda::std::chars_format::scientific, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{"1e", cuda::std::chars_format::fixed, cuda::std::errc{}, 1, 1e+00f},
+    TestItem{"1e", cuda::std::chars_format::hex, cuda::std::errc{}, 2, 3e+01f},
+    TestItem{"1e+", cuda::std::chars_format::general, cuda::std::errc{}, 1, 1e+00f},
+    TestItem{"1e+", cuda::std::chars_format::scientific, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{"1e+", cuda::std::chars_format::fixed, cuda::std::errc{}, 1, 1e+00f},
+    TestItem{"1e+", cuda::std::chars_format::hex, cuda::std::errc{}, 2, 3e+01f},
+    TestItem{"1.5p3", cuda::std::chars_format::general, cuda::std::errc{}, 3, 1.5e+00f},
+    TestItem{"1.5p3", cuda::std::chars_format::scientific, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{"1.5p3", cuda::std::chars_format::fixed, cuda::std::errc{}, 3, 1.5e+00f},
+    TestItem{"1.5p3", cuda::std::chars_format::hex, cuda::std::errc{}, 5, 1.05e+01f},
+    TestItem{"ff.8", cuda::std::chars_format::general, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{"ff.8", cuda::std::chars_format::scientific, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{"ff.8", cuda::std::chars_format::fixed, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{"ff.8", cuda::std::chars_format::hex, cuda::std::errc{}, 4, 2.555e+02f},
+    TestItem{"3.40282346e38", cuda::std::chars_format::general, cuda::std::errc{}, 13, 3.4028235e+38f},
+    TestItem{"3.40282346e38", cuda::std::chars_format::scientific, cuda::std::errc{}, 13, 3.4028235e+38f},
+    TestItem{"3.40282346e38", cuda::std::chars_format::fixed, cuda::std::errc{}, 10, 3.4028234e+00f},
+    TestItem{"3.40282346e38", cuda::std::chars_format::hex, cuda::std::errc{}, 13, 3.2506125e+00f},
+    TestItem{"3.40282357e38", cuda::std::chars_format::general, cuda::std::errc::result_out_of_range, 13, 0e+00f},
+    TestItem{"3.40282357e38", cuda::std::chars_format::scientific, cuda::std::errc::result_out_of_range, 13, 0e+00f},
+    TestItem{"3.40282357e38", cuda::std::chars_format::fixed, cuda::std::errc{}, 10, 3.4028237e+00f},
+    TestItem{"3.40282357e38", cuda::std::chars_format::hex, cuda::std::errc{}, 13, 3.2506125e+00f},
+    TestItem{"1e39", cuda::std::chars_format::general, cuda::std::errc::result_out_of_range, 4, 0e+00f},
+    TestItem{"1e39", cuda::std::chars_format::scientific, cuda::std::errc::result_out_of_range, 4, 0e+00f},
+    TestItem{"1e39", cuda::std::chars_format::fixed, cuda::std::errc{}, 1, 1e+00f},
+    TestItem{"1e39", cuda::std::chars_format::hex, cuda::std::errc{}, 4, 7.737e+03f},
+    TestItem{"1.17549435e-38", cuda::std::chars_format::general, cuda::std::errc{}, 14, 1.1754944e-38f},
+    TestItem{"1.17549435e-38", cuda::std::chars_format::scientific, cuda::std::errc{}, 14, 1.1754944e-38f},
+    TestItem{"1.17549435e-38", cuda::std::chars_format::fixed, cuda::std::errc{}, 10, 1.1754943e+00f},
+    TestItem{"1.17549435e-38", cuda::std::chars_format::hex, cuda::std::errc{}, 11, 1.0911343e+00f},
+    TestItem{"1e-45", cuda::std::chars_format::general, cuda::std::errc{}, 5, 1e-45f},
+    TestItem{"1e-45", cuda::std::chars_format::scientific, cuda::std::errc{}, 5, 1e-45f},
+    TestItem{"1e-45", cuda::std::chars_format::fixed, cuda::std::errc{}, 1, 1e+00f},
+    TestItem{"1e-45", cuda::std::chars_format::hex, cuda::std::errc{}, 2, 3e+01f},
+    TestItem{"7e-46", cuda::std::chars_format::general, cuda::std::errc::result_out_of_range, 5, 0e+00f},
+    TestItem{"7e-46", cuda::std::chars_format::scientific, cuda::std::errc::result_out_of_range, 5, 0e+00f},
+    TestItem{"7e-46", cuda::std::chars_format::fixed, cuda::std::errc{}, 1, 7e+00f},
+    TestItem{"7e-46", cuda::std::chars_format::hex, cuda::std::errc{}, 2, 1.26e+02f},
+    TestItem{"1e-46", cuda::std::chars_format::general, cuda::std::errc::result_out_of_range, 5, 0e+00f},
+    TestItem{"1e-46", cuda::std::chars_format::scientific, cuda::std::errc::result_out_of_range, 5, 0e+00f},
+    TestItem{"1e-46", cuda::std::chars_format::fixed, cuda::std::errc{}, 1, 1e+00f},
+    TestItem{"1e-46", cuda::std::chars_format::hex, cuda::std::errc{}, 2, 3e+01f},
+    TestItem{"16777217", cuda::std::chars_format::general, cuda::std::errc{}, 8, 1.6777216e+07f},
+    TestItem{"16777217", cuda::std::chars_format::scientific, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{"16777217", cuda::std::chars_format::fixed, cuda::std::errc{}, 8, 1.6777216e+07f},
+    TestItem{"16777217", cuda::std::chars_format::hex, cuda::std::errc{}, 8, 3.7692675e+08f},
+    TestItem{"16777219", cuda::std::chars_format::general, cuda::std::errc{}, 8, 1.677722e+07f},
+    TestItem{"16777219", cuda::std::chars_format::scientific, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{"16777219", cuda::std::chars_format::fixed, cuda::std::errc{}, 8, 1.677722e+07f},
+    TestItem{"16777219", cuda::std::chars_format::hex, cuda::std::errc{}, 8, 3.7692675e+08f},
+    TestItem{"1.00000005960464477539062500000000000000000000001",
+             cuda::std::chars_format::general,
+             cuda::std::errc{},
+             49,
+             1.0000001e+00f},
+    TestItem{"1.00000005960464477539062500000000000000000000001",
+             cuda::std::chars_format::scientific,
+             cuda::std::errc::invalid_argument,
+             0,
+             0e+00f},
+    TestItem{"1.00000005960464477539062500000000000000000000001",
+             cuda::std::chars_format::fixed,
+             cuda::std::errc{},
+             49,
+             1.0000001e+00f},
+    TestItem{
+      "1.00000005960464477539062500000000000000000000001", cuda::std::chars_format::hex, cuda::std::errc{}, 49, 1e+00f},
+    TestItem{"0.000000000000000000000000000000000000000000000000000001",
+             cuda::std::chars_format::general,
+             cuda::std::errc::result_out_of_range,
+             56,
+             0e+00f},
+    TestItem{"0.000000000000000000000000000000000000000000000000000001",
+             cuda::std::chars_format::scientific,
+             cuda::std::errc::invalid_argument,
+             0,
+             0e+00f},
+    TestItem{"0.000000000000000000000000000000000000000000000000000001",
+             cuda::std::chars_format::fixed,
+             cuda::std::errc::result_out_of_range,
+             56,
+             0e+00f},
+    TestItem{"0.000000000000000000000000000000000000000000000000000001",
+             cuda::std::chars_format::hex,
+             cuda::std::errc::result_out_of_range,
+             56,
+             0e+00f},
+    TestItem{"1.fffffep127", cuda::std::chars_format::general, cuda::std::errc{}, 2, 1e+00f},
+    TestItem{"1.fffffep127", cuda::std::chars_format::scientific, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{"1.fffffep127", cuda::std::chars_format::fixed, cuda::std::errc{}, 2, 1e+00f},
+    TestItem{"1.fffffep127", cuda::std::chars_format::hex, cuda::std::errc{}, 12, 3.4028235e+38f},
+    TestItem{"1.ffffffp127", cuda::std::chars_format::general, cuda::std::errc{}, 2, 1e+00f},
+    TestItem{"1.ffffffp127", cuda::std::chars_format::scientific, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{"1.ffffffp127", cuda::std::chars_format::fixed, cuda::std::errc{}, 2, 1e+00f},
+    TestItem{"1.ffffffp127", cuda::std::chars_format::hex, cuda::std::errc::result_out_of_range, 12, 0e+00f},
+    TestItem{"1p-149", cuda::std::chars_format::general, cuda::std::errc{}, 1, 1e+00f},
+    TestItem{"1p-149", cuda::std::chars_format::scientific, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{"1p-149", cuda::std::chars_format::fixed, cuda::std::errc{}, 1, 1e+00f},
+    TestItem{"1p-149", cuda::std::chars_format::hex, cuda::std::errc{}, 6, 1e-45f},
+    TestItem{"1.8p-149", cuda::std::chars_format::general, cuda::std::errc{}, 3, 1.8e+00f},
+    TestItem{"1.8p-149", cuda::std::chars_format::scientific, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{"1.8p-149", cuda::std::chars_format::fixed, cuda::std::errc{}, 3, 1.8e+00f},
+    TestItem{"1.8p-149", cuda::std::chars_format::hex, cuda::std::errc{}, 8, 3e-45f},
+    TestItem{"1p-150", cuda::std::chars_format::general, cuda::std::errc{}, 1, 1e+00f},
+    TestItem{"1p-150", cuda::std::chars_format::scientific, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{"1p-150", cuda::std::chars_format::fixed, cuda::std::errc{}, 1, 1e+00f},
+    TestItem{"1p-150", cuda::std::chars_format::hex, cuda::std::errc::result_out_of_range, 6, 0e+00f},
+    TestItem{"+1", cuda::std::chars_format::general, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{"+1", cuda::std::chars_format::scientific, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{"+1", cuda::std::chars_format::fixed, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{"+1", cuda::std::chars_format::hex, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{" 1", cuda::std::chars_format::general, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{" 1", cuda::std::chars_format::scientific, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{" 1", cuda::std::chars_format::fixed, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{" 1", cuda::std::chars_format::hex, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{".", cuda::std::chars_format::general, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{".", cuda::std::chars_format::scientific, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{".", cuda::std::chars_format::fixed, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{".", cuda::std::chars_format::hex, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{"-", cuda::std::chars_format::general, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{"-", cuda::std::chars_format::scientific, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{"-", cuda::std::chars_format::fixed, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{"-", cuda::std::chars_format::hex, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{"x", cuda::std::chars_format::general, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{"x", cuda::std::chars_format::scientific, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{"x", cuda::std::chars_format::fixed, cuda::std::errc::invalid_argument, 0, 0e+00f},
+    TestItem{"x", cuda::std::chars_format::hex, cuda::std::errc::invalid_argument, 0, 0e+00f},
+  }};
+}
+
+
+TEST_FUNC constexpr void test_from_chars(const TestItem& item)
+{
+  const auto len = static_cast<cuda::std::ptrdiff_t>(cuda::std::strlen(item.str));
+
+  float value = 42.0f;
+  const auto result = cuda::std::from_chars(item.str, item.str + len, value, item.fmt);
+  assert(result.ec == item.ec);
+  assert(result.ptr == item.str + item.len);
+  if (item.ec == cuda::std::errc{})
+  {
+    assert(cuda::std::bit_cast<cuda::std::uint32_t>(value) == cuda::std::bit_cast<cuda::std::uint32_t>(item.val));
+  }
+  else
+  {
+    // The value is not modified on error
+    assert(value == 42.0f);
+  }
+
+  // The parsing stops at the end of the input
+  if (item.ec != cuda::std::errc::invalid_argument && item.len > 1)
+  {
+    value              = 42.0f;
+    const auto partial = cuda::std::from_chars(item.str, item.str + item.len - 1, value, item.fmt);
+    assert(partial.ptr <= item.str + item.len - 1);
+  }
+}
+
+TEST_FUNC constexpr void test_non_finite(const char* str, cuda::std::ptrdiff_t len, bool negative, bool nan)
+{
+  for (auto fmt : {cuda::std::chars_format::general,
+                    cuda::std::chars_format::scientific,
+                    cuda::std::chars_format::fixed,
+                    cuda::std::chars_format::hex})
+  {
+    float value         = 42.0f;
+    const auto result = cuda::std::from_chars(str, str + cuda::std::strlen(str), value, fmt);
+    assert(result.ec == cuda::std::errc{});
+    assert(result.ptr == str + len);
+    if (nan)
+    {
+      assert(value != value);
+    }
+    else
+    {
+      assert(value == (negative ? -1 : 1) * cuda::std::numeric_limits<float>::infinity());
+    }
+    const auto sign = cuda::std::bit_cast<cuda::std::uint32_t>(value) >> (sizeof(float) * 8 - 1);
+    assert(sign == cuda::std::uint32_t{negative});
+  }
+}
+
+TEST_FUNC constexpr bool test()
+{
+  static_assert(cuda::std::is_same_v<cuda::std::from_chars_result,
+                                     decltype(cuda::std::from_chars(cuda::std::declval<const char*>(),
+                                                                    cuda::std::declval<const char*>(),
+                                                                    cuda::std::declval<float&>()))>);
+  static_assert(noexcept(cuda::std::from_chars(
+    cuda::std::declval<const char*>(), cuda::std::declval<const char*>(), cuda::std::declval<float&>())));
+  static_assert(noexcept(cuda::std::from_chars(
+    cuda::std::declval<const char*>(),
+    cuda::std::declval<const char*>(),
+    cuda::std::declval<float&>(),
+    cuda::std::chars_format::general)));
+
+  for (const auto& item : get_test_items())
+  {
+    test_from_chars(item);
+  }
+
+  test_non_finite("inf", 3, false, false);
+  test_non_finite("-INFINITY", 9, true, false);
+  test_non_finite("infinit", 3, false, false);
+  test_non_finite("nan", 3, false, true);
+  test_non_finite("-NaN", 4, true, true);
+  test_non_finite("nan(quiet_1)", 12, false, true);
+  test_non_finite("nan(a-b)", 3, false, true);
+  test_non_finite("nan(", 3, false, true);
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test());
+  return 0;
+}
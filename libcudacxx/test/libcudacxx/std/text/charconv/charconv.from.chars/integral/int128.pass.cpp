@@ -1322,6 +1322,13 @@ TEST_FUNC constexpr void test_overflow()
     item.str_unsigned = "";
     test_from_chars<T>(item, base, true);
   }
+
+  // 5. Test overflow that wraps around to a larger value
+  {
+    item.str_signed   = "400000000000000000000000000000000000000";
+    item.str_unsigned = "400000000000000000000000000000000000000";
+    test_from_chars<T>(item, base, true);
+  }
 }
 
 template <int Base>
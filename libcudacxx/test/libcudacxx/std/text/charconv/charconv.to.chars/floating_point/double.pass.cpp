@@ -0,0 +1,440 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/charconv>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstring>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+struct ShortestTestItem
+{
+  double val;
+  cuda::std::chars_format fmt; // chars_format{} selects the overload without a format
+  const char* str;
+};
+
+struct PrecisionTestItem
+{
+  double val;
+  cuda::std::chars_format fmt;
+  int precision;
+  const char* str;
+};
+
+// Source code for the generation of the test items
+// #include <charconv>
+// #include <cstdio>
+// #include <cstring>
+// #include <iostream>
+// #include <string>
+//
+// template <class T>
+// std::string lit(T v)
+// {
+//   char buff[64];
+//   auto r = std::to_chars(buff, buff + sizeof(buff), v, std::chars_format::scientific);
+//   std::string s(buff, r.ptr);
+//   return s + (sizeof(T) == 4 ? "f" : "");
+// }
+//
+// template <class T>
+// std::string str(T v, std::chars_format* fmt = nullptr, int prec = -1)
+// {
+//   char buff[2000];
+//   auto r = fmt == nullptr ? std::to_chars(buff, buff + sizeof(buff), v)
+//          : prec < 0       ? std::to_chars(buff, buff + sizeof(buff), v, *fmt)
+//                           : std::to_chars(buff, buff + sizeof(buff), v, *fmt, prec);
+//   return std::string(buff, r.ptr);
+// }
+//
+// template <class T, std::size_t N, std::size_t M>
+// void gen(const T (&shortest)[N], const T (&precision)[M])
+// {
+//   std::chars_format fmts[] = {
+//     std::chars_format{}, std::chars_format::scientific, std::chars_format::fixed, std::chars_format::general,
+//     std::chars_format::hex};
+//   const char* names[] = {"{}", "::scientific", "::fixed", "::general", "::hex"};
+//   std::size_t count = 0;
+//   std::string body;
+//   for (auto v : shortest)
+//   {
+//     for (int f = 0; f < 5; ++f)
+//     {
+//       const auto s = f == 0 ? str(v) : str(v, &fmts[f]);
+//       if (s.size() <= 50)
+//       {
+//         body += "    ShortestTestItem{" + lit(v) + ", cuda::std::chars_format" + names[f] + ", \"" + s + "\"},\n";
+//         ++count;
+//       }
+//     }
+//   }
+//   std::cout << "TEST_FUNC constexpr cuda::std::array<ShortestTestItem, " << count
+//             << "> get_shortest_test_items()\n{\n  return {{\n" << body << "  }};\n}\n\n";
+//   count = 0;
+//   body.clear();
+//   for (auto v : precision)
+//   {
+//     for (int f = 1; f < 5; ++f)
+//     {
+//       for (int prec : {0, 3, 17})
+//       {
+//         const auto s = str(v, &fmts[f], prec);
+//         if (s.size() <= 50)
+//         {
+//           body += "    PrecisionTestItem{" + lit(v) + ", cuda::std::chars_format" + names[f] + ", "
+//                 + std::to_string(prec) + ", \"" + s + "\"},\n";
+//           ++count;
+//         }
+//       }
+//     }
+//   }
+//   std::cout << "TEST_FUNC constexpr cuda::std::array<PrecisionTestItem, " << count
+//             << "> get_precision_test_items()\n{\n  return {{\n" << body << "  }};\n}\n";
+// }
+//
+// int main()
+// {
+// #ifdef FLOAT
+//   constexpr float shortest[] = {0.0f, -0.0f, 1.0f, -1.5f, 0.1f, 1e5f, 123456.0f, 1e6f, 1234567.0f, 1e-4f, 1e-5f,
+//                                 3e10f, 3.14159274f, -2.5e-7f, 1e-45f, 1.17549435e-38f, 3.40282347e38f, 16777217.0f};
+//   constexpr float precision[] = {
+//     0.0f, -1.5f, 0.1f, 2.5f, 9.995f, 123456.789f, 1e-10f, 1e10f, 1e-45f, 3.40282347e38f};
+// #else
+//   constexpr double shortest[] = {
+//     0.0, -0.0, 1.0, -1.5, 0.1, 1e5, 123456.0, 1e6, 1234567.0, 1e-4, 1e-5, 1e23, 3.141592653589793, -2.5e-7, 5e-324,
+//     2.2250738585072014e-308, 1.7976931348623157e308, 9007199254740993.0};
+//   constexpr double precision[] = {
+//     0.0, -1.5, 0.1, 2.5, 9.995, 123456.789, 1e-10, 1e21, 5e-324, 1.7976931348623157e308};
+// #endif
+//   gen(shortest, precision);
+// }
+
+TEST_FUNC constexpr cuda::std::array<ShortestTestItem, 87> get_shortest_test_items()
+{
+  return {{
+    ShortestTestItem{0e+00, cuda::std::chars_format{}, "0"},
+    ShortestTestItem{0e+00, cuda::std::chars_format::scientific, "0e+00"},
+    ShortestTestItem{0e+00, cuda::std::chars_format::fixed, "0"},
+    ShortestTestItem{0e+00, cuda::std::chars_format::general, "0"},
+    ShortestTestItem{0e+00, cuda::std::chars_format::hex, "0p+0"},
+    ShortestTestItem{-0e+00, cuda::std::chars_format{}, "-0"},
+    ShortestTestItem{-0e+00, cuda::std::chars_format::scientific, "-0e+00"},
+    ShortestTestItem{-0e+00, cuda::std::chars_format::fixed, "-0"},
+    ShortestTestItem{-0e+00, cuda::std::chars_format::general, "-0"},
+    ShortestTestItem{-0e+00, cuda::std::chars_format::hex, "-0p+0"},
+    ShortestTestItem{1e+00, cuda::std::chars_format{}, "1"},
+    ShortestTestItem{1e+00, cuda::std::chars_format::scientific, "1e+00"},
+    ShortestTestItem{1e+00, cuda::std::chars_format::fixed, "1"},
+    ShortestTestItem{1e+00, cuda::std::chars_format::general, "1"},
+    ShortestTestItem{1e+00, cuda::std::chars_format::hex, "1p+0"},
+    ShortestTestItem{-1.5e+00, cuda::std::chars_format{}, "-1.5"},
+    ShortestTestItem{-1.5e+00, cuda::std::chars_format::scientific, "-1.5e+00"},
+    ShortestTestItem{-1.5e+00, cuda::std::chars_format::fixed, "-1.5"},
+    ShortestTestItem{-1.5e+00, cuda::std::chars_format::general, "-1.5"},
+    ShortestTestItem{-1.5e+00, cuda::std::chars_format::hex, "-1.8p+0"},
+    ShortestTestItem{1e-01, cuda::std::chars_format{}, "0.1"},
+    ShortestTestItem{1e-01, cuda::std::chars_format::scientific, "1e-01"},
+    ShortestTestItem{1e-01, cuda::std::chars_format::fixed, "0.1"},
+    ShortestTestItem{1e-01, cuda::std::chars_format::general, "0.1"},
+    ShortestTestItem{1e-01, cuda::std::chars_format::hex, "1.999999999999ap-4"},
+    ShortestTestItem{1e+05, cuda::std::chars_format{}, "1e+05"},
+    ShortestTestItem{1e+05, cuda::std::chars_format::scientific, "1e+05"},
+    ShortestTestItem{1e+05, cuda::std::chars_format::fixed, "100000"},
+    ShortestTestItem{1e+05, cuda::std::chars_format::general, "100000"},
+    ShortestTestItem{1e+05, cuda::std::chars_format::hex, "1.86ap+16"},
+    ShortestTestItem{1.23456e+05, cuda::std::chars_format{}, "123456"},
+    ShortestTestItem{1.23456e+05, cuda::std::chars_format::scientific, "1.23456e+05"},
+    ShortestTestItem{1.23456e+05, cuda::std::chars_format::fixed, "123456"},
+    ShortestTestItem{1.23456e+05, cuda::std::chars_format::general, "123456"},
+    ShortestTestItem{1.23456e+05, cuda::std::chars_format::hex, "1.e24p+16"},
+    ShortestTestItem{1e+06, cuda::std::chars_format{}, "1e+06"},
+    ShortestTestItem{1e+06, cuda::std::chars_format::scientific, "1e+06"},
+    ShortestTestItem{1e+06, cuda::std::chars_format::fixed, "1000000"},
+    ShortestTestItem{1e+06, cuda::std::chars_format::general, "1e+06"},
+    ShortestTestItem{1e+06, cuda::std::chars_format::hex, "1.e848p+19"},
+    ShortestTestItem{1.234567e+06, cuda::std::chars_format{}, "1234567"},
+    ShortestTestItem{1.234567e+06, cuda::std::chars_format::scientific, "1.234567e+06"},
+    ShortestTestItem{1.234567e+06, cuda::std::chars_format::fixed, "1234567"},
+    ShortestTestItem{1.234567e+06, cuda::std::chars_format::general, "1.234567e+06"},
+    ShortestTestItem{1.234567e+06, cuda::std::chars_format::hex, "1.2d687p+20"},
+    ShortestTestItem{1e-04, cuda::std::chars_format{}, "1e-04"},
+    ShortestTestItem{1e-04, cuda::std::chars_format::scientific, "1e-04"},
+    ShortestTestItem{1e-04, cuda::std::chars_format::fixed, "0.0001"},
+    ShortestTestItem{1e-04, cuda::std::chars_format::general, "0.0001"},
+    ShortestTestItem{1e-04, cuda::std::chars_format::hex, "1.a36e2eb1c432dp-14"},
+    ShortestTestItem{1e-05, cuda::std::chars_format{}, "1e-05"},
+    ShortestTestItem{1e-05, cuda::std::chars_format::scientific, "1e-05"},
+    ShortestTestItem{1e-05, cuda::std::chars_format::fixed, "0.00001"},
+    ShortestTestItem{1e-05, cuda::std::chars_format::general, "1e-05"},
+    ShortestTestItem{1e-05, cuda::std::chars_format::hex, "1.4f8b588e368f1p-17"},
+    ShortestTestItem{1e+23, cuda::std::chars_format{}, "1e+23"},
+    ShortestTestItem{1e+23, cuda::std::chars_format::scientific, "1e+23"},
+    ShortestTestItem{1e+23, cuda::std::chars_format::fixed, "99999999999999991611392"},
+    ShortestTestItem{1e+23, cuda::std::chars_format::general, "1e+23"},
+    ShortestTestItem{1e+23, cuda::std::chars_format::hex, "1.52d02c7e14af6p+76"},
+    ShortestTestItem{3.141592653589793e+00, cuda::std::chars_format{}, "3.141592653589793"},
+    ShortestTestItem{3.141592653589793e+00, cuda::std::chars_format::scientific, "3.141592653589793e+00"},
+    ShortestTestItem{3.141592653589793e+00, cuda::std::chars_format::fixed, "3.141592653589793"},
+    ShortestTestItem{3.141592653589793e+00, cuda::std::chars_format::general, "3.141592653589793"},
+    ShortestTestItem{3.141592653589793e+00, cuda::std::chars_format::hex, "1.921fb54442d18p+1"},
+    ShortestTestItem{-2.5e-07, cuda::std::chars_format{}, "-2.5e-07"},
+    ShortestTestItem{-2.5e-07, cuda::std::chars_format::scientific, "-2.5e-07"},
+    ShortestTestItem{-2.5e-07, cuda::std::chars_format::fixed, "-0.00000025"},
+    ShortestTestItem{-2.5e-07, cuda::std::chars_format::general, "-2.5e-07"},
+    ShortestTestItem{-2.5e-07, cuda::std::chars_format::hex, "-1.0c6f7a0b5ed8dp-22"},
+    ShortestTestItem{5e-324, cuda::std::chars_format{}, "5e-324"},
+    ShortestTestItem{5e-324, cuda::std::chars_format::scientific, "5e-324"},
+    ShortestTestItem{5e-324, cuda::std::chars_format::general, "5e-324"},
+    ShortestTestItem{5e-324, cuda::std::chars_format::hex, "0.0000000000001p-1022"},
+    ShortestTestItem{2.2250738585072014e-308, cuda::std::chars_format{}, "2.2250738585072014e-308"},
+    ShortestTestItem{2.2250738585072014e-308, cuda::std::chars_format::scientific, "2.2250738585072014e-308"},
+    ShortestTestItem{2.2250738585072014e-308, cuda::std::chars_format::general, "2.2250738585072014e-308"},
+    ShortestTestItem{2.2250738585072014e-308, cuda::std::chars_format::hex, "1p-1022"},
+    ShortestTestItem{1.7976931348623157e+308, cuda::std::chars_format{}, "1.7976931348623157e+308"},
+    ShortestTestItem{1.7976931348623157e+308, cuda::std::chars_format::scientific, "1.7976931348623157e+308"},
+    ShortestTestItem{1.7976931348623157e+308, cuda::std::chars_format::general, "1.7976931348623157e+308"},
+    ShortestTestItem{1.7976931348623157e+308, cuda::std::chars_format::hex, "1.fffffffffffffp+1023"},
+    ShortestTestItem{9.007199254740992e+15, cuda::std::chars_format{}, "9007199254740992"},
+    ShortestTestItem{9.007199254740992e+15, cuda::std::chars_format::scientific, "9.007199254740992e+15"},
+    ShortestTestItem{9.007199254740992e+15, cuda::std::chars_format::fixed, "9007199254740992"},
+    ShortestTestItem{9.007199254740992e+15, cuda::std::chars_format::general, "9.007199254740992e+15"},
+    ShortestTestItem{9.007199254740992e+15, cuda::std::chars_format::hex, "1p+53"},
+  }};
+}
+
+TEST_FUNC constexpr cuda::std::array<PrecisionTestItem, 117> get_precision_test_items()
+{
+  return {{
+    PrecisionTestItem{0e+00, cuda::std::chars_format::scientific, 0, "0e+00"},
+    PrecisionTestItem{0e+00, cuda::std::chars_format::scientific, 3, "0.000e+00"},
+    PrecisionTestItem{0e+00, cuda::std::chars_format::scientific, 17, "0.00000000000000000e+00"},
+    PrecisionTestItem{0e+00, cuda::std::chars_format::fixed, 0, "0"},
+    PrecisionTestItem{0e+00, cuda::std::chars_format::fixed, 3, "0.000"},
+    PrecisionTestItem{0e+00, cuda::std::chars_format::fixed, 17, "0.00000000000000000"},
+    PrecisionTestItem{0e+00, cuda::std::chars_format::general, 0, "0"},
+    PrecisionTestItem{0e+00, cuda::std::chars_format::general, 3, "0"},
+    PrecisionTestItem{0e+00, cuda::std::chars_format::general, 17, "0"},
+    PrecisionTestItem{0e+00, cuda::std::chars_format::hex, 0, "0p+0"},
+    PrecisionTestItem{0e+00, cuda::std::chars_format::hex, 3, "0.000p+0"},
+    PrecisionTestItem{0e+00, cuda::std::chars_format::hex, 17, "0.00000000000000000p+0"},
+    PrecisionTestItem{-1.5e+00, cuda::std::chars_format::scientific, 0, "-2e+00"},
+    PrecisionTestItem{-1.5e+00, cuda::std::chars_format::scientific, 3, "-1.500e+00"},
+    PrecisionTestItem{-1.5e+00, cuda::std::chars_format::scientific, 17, "-1.50000000000000000e+00"},
+    PrecisionTestItem{-1.5e+00, cuda::std::chars_format::fixed, 0, "-2"},
+    PrecisionTestItem{-1.5e+00, cuda::std::chars_format::fixed, 3, "-1.500"},
+    PrecisionTestItem{-1.5e+00, cuda::std::chars_format::fixed, 17, "-1.50000000000000000"},
+    PrecisionTestItem{-1.5e+00, cuda::std::chars_format::general, 0, "-2"},
+    PrecisionTestItem{-1.5e+00, cuda::std::chars_format::general, 3, "-1.5"},
+    PrecisionTestItem{-1.5e+00, cuda::std::chars_format::general, 17, "-1.5"},
+    PrecisionTestItem{-1.5e+00, cuda::std::chars_format::hex, 0, "-2p+0"},
+    PrecisionTestItem{-1.5e+00, cuda::std::chars_format::hex, 3, "-1.800p+0"},
+    PrecisionTestItem{-1.5e+00, cuda::std::chars_format::hex, 17, "-1.80000000000000000p+0"},
+    PrecisionTestItem{1e-01, cuda::std::chars_format::scientific, 0, "1e-01"},
+    PrecisionTestItem{1e-01, cuda::std::chars_format::scientific, 3, "1.000e-01"},
+    PrecisionTestItem{1e-01, cuda::std::chars_format::scientific, 17, "1.00000000000000006e-01"},
+    PrecisionTestItem{1e-01, cuda::std::chars_format::fixed, 0, "0"},
+    PrecisionTestItem{1e-01, cuda::std::chars_format::fixed, 3, "0.100"},
+    PrecisionTestItem{1e-01, cuda::std::chars_format::fixed, 17, "0.10000000000000001"},
+    PrecisionTestItem{1e-01, cuda::std::chars_format::general, 0, "0.1"},
+    PrecisionTestItem{1e-01, cuda::std::chars_format::general, 3, "0.1"},
+    PrecisionTestItem{1e-01, cuda::std::chars_format::general, 17, "0.10000000000000001"},
+    PrecisionTestItem{1e-01, cuda::std::chars_format::hex, 0, "2p-4"},
+    PrecisionTestItem{1e-01, cuda::std::chars_format::hex, 3, "1.99ap-4"},
+    PrecisionTestItem{1e-01, cuda::std::chars_format::hex, 17, "1.999999999999a0000p-4"},
+    PrecisionTestItem{2.5e+00, cuda::std::chars_format::scientific, 0, "2e+00"},
+    PrecisionTestItem{2.5e+00, cuda::std::chars_format::scientific, 3, "2.500e+00"},
+    PrecisionTestItem{2.5e+00, cuda::std::chars_format::scientific, 17, "2.50000000000000000e+00"},
+    PrecisionTestItem{2.5e+00, cuda::std::chars_format::fixed, 0, "2"},
+    PrecisionTestItem{2.5e+00, cuda::std::chars_format::fixed, 3, "2.500"},
+    PrecisionTestItem{2.5e+00, cuda::std::chars_format::fixed, 17, "2.50000000000000000"},
+    PrecisionTestItem{2.5e+00, cuda::std::chars_format::general, 0, "2"},
+    PrecisionTestItem{2.5e+00, cuda::std::chars_format::general, 3, "2.5"},
+    PrecisionTestItem{2.5e+00, cuda::std::chars_format::general, 17, "2.5"},
+    PrecisionTestItem{2.5e+00, cuda::std::chars_format::hex, 0, "1p+1"},
+    PrecisionTestItem{2.5e+00, cuda::std::chars_format::hex, 3, "1.400p+1"},
+    PrecisionTestItem{2.5e+00, cuda::std::chars_format::hex, 17, "1.40000000000000000p+1"},
+    PrecisionTestItem{9.995e+00, cuda::std::chars_format::scientific, 0, "1e+01"},
+    PrecisionTestItem{9.995e+00, cuda::std::chars_format::scientific, 3, "9.995e+00"},
+    PrecisionTestItem{9.995e+00, cuda::std::chars_format::scientific, 17, "9.99499999999999922e+00"},
+    PrecisionTestItem{9.995e+00, cuda::std::chars_format::fixed, 0, "10"},
+    PrecisionTestItem{9.995e+00, cuda::std::chars_format::fixed, 3, "9.995"},
+    PrecisionTestItem{9.995e+00, cuda::std::chars_format::fixed, 17, "9.99499999999999922"},
+    PrecisionTestItem{9.995e+00, cuda::std::chars_format::general, 0, "1e+01"},
+    PrecisionTestItem{9.995e+00, cuda::std::chars_format::general, 3, "9.99"},
+    PrecisionTestItem{9.995e+00, cuda::std::chars_format::general, 17, "9.9949999999999992"},
+    PrecisionTestItem{9.995e+00, cuda::std::chars_format::hex, 0, "1p+3"},
+    PrecisionTestItem{9.995e+00, cuda::std::chars_format::hex, 3, "1.3fdp+3"},
+    PrecisionTestItem{9.995e+00, cuda::std::chars_format::hex, 17, "1.3fd70a3d70a3d0000p+3"},
+    PrecisionTestItem{1.23456789e+05, cuda::std::chars_format::scientific, 0, "1e+05"},
+    PrecisionTestItem{1.23456789e+05, cuda::std::chars_format::scientific, 3, "1.235e+05"},
+    PrecisionTestItem{1.23456789e+05, cuda::std::chars_format::scientific, 17, "1.23456789000000004e+05"},
+    PrecisionTestItem{1.23456789e+05, cuda::std::chars_format::fixed, 0, "123457"},
+    PrecisionTestItem{1.23456789e+05, cuda::std::chars_format::fixed, 3, "123456.789"},
+    PrecisionTestItem{1.23456789e+05, cuda::std::chars_format::fixed, 17, "123456.78900000000430737"},
+    PrecisionTestItem{1.23456789e+05, cuda::std::chars_format::general, 0, "1e+05"},
+    PrecisionTestItem{1.23456789e+05, cuda::std::chars_format::general, 3, "1.23e+05"},
+    PrecisionTestItem{1.23456789e+05, cuda::std::chars_format::general, 17, "123456.789"},
+    PrecisionTestItem{1.23456789e+05, cuda::std::chars_format::hex, 0, "2p+16"},
+    PrecisionTestItem{1.23456789e+05, cuda::std::chars_format::hex, 3, "1.e24p+16"},
+    PrecisionTestItem{1.23456789e+05, cuda::std::chars_format::hex, 17, "1.e240c9fbe76c90000p+16"},
+    PrecisionTestItem{1e-10, cuda::std::chars_format::scientific, 0, "1e-10"},
+    PrecisionTestItem{1e-10, cuda::std::chars_format::scientific, 3, "1.000e-10"},
+    PrecisionTestItem{1e-10, cuda::std::chars_format::scientific, 17, "1.00000000000000004e-10"},
+    PrecisionTestItem{1e-10, cuda::std::chars_format::fixed, 0, "0"},
+    PrecisionTestItem{1e-10, cuda::std::chars_format::fixed, 3, "0.000"},
+    PrecisionTestItem{1e-10, cuda::std::chars_format::fixed, 17, "0.00000000010000000"},
+    PrecisionTestItem{1e-10, cuda::std::chars_format::general, 0, "1e-10"},
+    PrecisionTestItem{1e-10, cuda::std::chars_format::general, 3, "1e-10"},
+    PrecisionTestItem{1e-10, cuda::std::chars_format::general, 17, "1e-10"},
+    PrecisionTestItem{1e-10, cuda::std::chars_format::hex, 0, "2p-34"},
+    PrecisionTestItem{1e-10, cuda::std::chars_format::hex, 3, "1.b7dp-34"},
+    PrecisionTestItem{1e-10, cuda::std::chars_format::hex, 17, "1.b7cdfd9d7bdbb0000p-34"},
+    PrecisionTestItem{1e+21, cuda::std::chars_format::scientific, 0, "1e+21"},
+    PrecisionTestItem{1e+21, cuda::std::chars_format::scientific, 3, "1.000e+21"},
+    PrecisionTestItem{1e+21, cuda::std::chars_format::scientific, 17, "1.00000000000000000e+21"},
+    PrecisionTestItem{1e+21, cuda::std::chars_format::fixed, 0, "1000000000000000000000"},
+    PrecisionTestItem{1e+21, cuda::std::chars_format::fixed, 3, "1000000000000000000000.000"},
+    PrecisionTestItem{1e+21, cuda::std::chars_format::fixed, 17, "1000000000000000000000.00000000000000000"},
+    PrecisionTestItem{1e+21, cuda::std::chars_format::general, 0, "1e+21"},
+    PrecisionTestItem{1e+21, cuda::std::chars_format::general, 3, "1e+21"},
+    PrecisionTestItem{1e+21, cuda::std::chars_format::general, 17, "1e+21"},
+    PrecisionTestItem{1e+21, cuda::std::chars_format::hex, 0, "2p+69"},
+    PrecisionTestItem{1e+21, cuda::std::chars_format::hex, 3, "1.b1bp+69"},
+    PrecisionTestItem{1e+21, cuda::std::chars_format::hex, 17, "1.b1ae4d6e2ef500000p+69"},
+    PrecisionTestItem{5e-324, cuda::std::chars_format::scientific, 0, "5e-324"},
+    PrecisionTestItem{5e-324, cuda::std::chars_format::scientific, 3, "4.941e-324"},
+    PrecisionTestItem{5e-324, cuda::std::chars_format::scientific, 17, "4.94065645841246544e-324"},
+    PrecisionTestItem{5e-324, cuda::std::chars_format::fixed, 0, "0"},
+    PrecisionTestItem{5e-324, cuda::std::chars_format::fixed, 3, "0.000"},
+    PrecisionTestItem{5e-324, cuda::std::chars_format::fixed, 17, "0.00000000000000000"},
+    PrecisionTestItem{5e-324, cuda::std::chars_format::general, 0, "5e-324"},
+    PrecisionTestItem{5e-324, cuda::std::chars_format::general, 3, "4.94e-324"},
+    PrecisionTestItem{5e-324, cuda::std::chars_format::general, 17, "4.9406564584124654e-324"},
+    PrecisionTestItem{5e-324, cuda::std::chars_format::hex, 0, "0p-1022"},
+    PrecisionTestItem{5e-324, cuda::std::chars_format::hex, 3, "0.000p-1022"},
+    PrecisionTestItem{5e-324, cuda::std::chars_format::hex, 17, "0.00000000000010000p-1022"},
+    PrecisionTestItem{1.7976931348623157e+308, cuda::std::chars_format::scientific, 0, "2e+308"},
+    PrecisionTestItem{1.7976931348623157e+308, cuda::std::chars_format::scientific, 3, "1.798e+308"},
+    PrecisionTestItem{1.7976931348623157e+308, cuda::std::chars_format::scientific, 17, "1.79769313486231571e+308"},
+    PrecisionTestItem{1.7976931348623157e+308, cuda::std::chars_format::general, 0, "2e+308"},
+    PrecisionTestItem{1.7976931348623157e+308, cuda::std::chars_format::general, 3, "1.8e+308"},
+    PrecisionTestItem{1.7976931348623157e+308, cuda::std::chars_format::general, 17, "1.7976931348623157e+308"},
+    PrecisionTestItem{1.7976931348623157e+308, cuda::std::chars_format::hex, 0, "2p+1023"},
+    PrecisionTestItem{1.7976931348623157e+308, cuda::std::chars_format::hex, 3, "2.000p+1023"},
+    PrecisionTestItem{1.7976931348623157e+308, cuda::std::chars_format::hex, 17, "1.fffffffffffff0000p+1023"},
+  }};
+}
+
+template <class ToChars>
+TEST_FUNC constexpr void test_to_chars(const char* ref_str, ToChars to_chars)
+{
+  constexpr cuda::std::size_t buff_size = 150;
+
+  char buff[buff_size + 1]{};
+  char* buff_start = buff + 1;
+
+  const auto ref_len = cuda::std::strlen(ref_str);
+
+  // Check valid buffer size
+  {
+    const auto result = to_chars(buff_start, buff_start + buff_size);
+    assert(result.ec == cuda::std::errc{});
+    assert(result.ptr == buff_start + ref_len);
+
+    // Compare with reference string
+    assert(cuda::std::strncmp(buff_start, ref_str, buff_size) == 0);
+
+    // Check that the operation did not underflow the buffer
+    assert(buff[0] == '\0');
+  }
+
+  // Check too small buffer
+  {
+    const auto result = to_chars(buff_start, buff_start + ref_len - 1);
+    assert(result.ec == cuda::std::errc::value_too_large);
+    assert(result.ptr == buff_start + ref_len - 1);
+  }
+
+  // Check zero buffer
+  {
+    const auto result = to_chars(buff_start, buff_start);
+    assert(result.ec == cuda::std::errc::value_too_large);
+    assert(result.ptr == buff_start);
+  }
+}
+
+TEST_FUNC constexpr void test_shortest(const ShortestTestItem& item)
+{
+  test_to_chars(item.str, [&](char* first, char* last) {
+    return (item.fmt == cuda::std::chars_format{})
+           ? cuda::std::to_chars(first, last, item.val)
+           : cuda::std::to_chars(first, last, item.val, item.fmt);
+  });
+}
+
+TEST_FUNC constexpr void test_precision(const PrecisionTestItem& item)
+{
+  test_to_chars(item.str, [&](char* first, char* last) {
+    return cuda::std::to_chars(first, last, item.val, item.fmt, item.precision);
+  });
+}
+
+TEST_FUNC constexpr void test_non_finite(double val, const char* ref_str)
+{
+  test_to_chars(ref_str, [&](char* first, char* last) {
+    return cuda::std::to_chars(first, last, val);
+  });
+  test_to_chars(ref_str, [&](char* first, char* last) {
+    return cuda::std::to_chars(first, last, val, cuda::std::chars_format::fixed);
+  });
+  test_to_chars(ref_str, [&](char* first, char* last) {
+    return cuda::std::to_chars(first, last, val, cuda::std::chars_format::scientific, 3);
+  });
+}
+
+TEST_FUNC constexpr bool test()
+{
+  static_assert(cuda::std::is_same_v<
+                cuda::std::to_chars_result,
+                decltype(cuda::std::to_chars(cuda::std::declval<char*>(), cuda::std::declval<char*>(), double{}))>);
+  static_assert(noexcept(cuda::std::to_chars(cuda::std::declval<char*>(), cuda::std::declval<char*>(), double{})));
+  static_assert(noexcept(cuda::std::to_chars(
+    cuda::std::declval<char*>(), cuda::std::declval<char*>(), double{}, cuda::std::chars_format::general)));
+  static_assert(noexcept(cuda::std::to_chars(
+    cuda::std::declval<char*>(), cuda::std::declval<char*>(), double{}, cuda::std::chars_format::general, int{})));
+
+  for (const auto& item : get_shortest_test_items())
+  {
+    test_shortest(item);
+  }
+  for (const auto& item : get_precision_test_items())
+  {
+    test_precision(item);
+  }
+
+  test_non_finite(cuda::std::numeric_limits<double>::infinity(), "inf");
+  test_non_finite(-cuda::std::numeric_limits<double>::infinity(), "-inf");
+  test_non_finite(cuda::std::numeric_limits<double>::quiet_NaN(), "nan");
+  test_non_finite(-cuda::std::numeric_limits<double>::quiet_NaN(), "-nan");
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test());
+  return 0;
+}
@@ -0,0 +1,445 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/charconv>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstring>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+struct ShortestTestItem
+{
+  float val;
+  cuda::std::chars_format fmt; // chars_format{} selects the overload without a format
+  const char* str;
+};
+
+struct PrecisionTestItem
+{
+  float val;
+  cuda::std::chars_format fmt;
+  int precision;
+  const char* str;
+};
+
+// Source code for the generation of the test items, built with -DFLOAT
+// #include <charconv>
+// #include <cstdio>
+// #include <cstring>
+// #include <iostream>
+// #include <string>
+//
+// template <class T>
+// std::string lit(T v)
+// {
+//   char buff[64];
+//   auto r = std::to_chars(buff, buff + sizeof(buff), v, std::chars_format::scientific);
+//   std::string s(buff, r.ptr);
+//   return s + (sizeof(T) == 4 ? "f" : "");
+// }
+//
+// template <class T>
+// std::string str(T v, std::chars_format* fmt = nullptr, int prec = -1)
+// {
+//   char buff[2000];
+//   auto r = fmt == nullptr ? std::to_chars(buff, buff + sizeof(buff), v)
+//          : prec < 0       ? std::to_chars(buff, buff + sizeof(buff), v, *fmt)
+//                           : std::to_chars(buff, buff + sizeof(buff), v, *fmt, prec);
+//   return std::string(buff, r.ptr);
+// }
+//
+// template <class T, std::size_t N, std::size_t M>
+// void gen(const T (&shortest)[N], const T (&precision)[M])
+// {
+//   std::chars_format fmts[] = {
+//     std::chars_format{}, std::chars_format::scientific, std::chars_format::fixed, std::chars_format::general,
+//     std::chars_format::hex};
+//   const char* names[] = {"{}", "::scientific", "::fixed", "::general", "::hex"};
+//   std::size_t count = 0;
+//   std::string body;
+//   for (auto v : shortest)
+//   {
+//     for (int f = 0; f < 5; ++f)
+//     {
+//       const auto s = f == 0 ? str(v) : str(v, &fmts[f]);
+//       if (s.size() <= 50)
+//       {
+//         body += "    ShortestTestItem{" + lit(v) + ", cuda::std::chars_format" + names[f] + ", \"" + s + "\"},\n";
+//         ++count;
+//       }
+//     }
+//   }
+//   std::cout << "TEST_FUNC constexpr cuda::std::array<ShortestTestItem, " << count
+//             << "> get_shortest_test_items()\n{\n  return {{\n" << body << "  }};\n}\n\n";
+//   count = 0;
+//   body.clear();
+//   for (auto v : precision)
+//   {
+//     for (int f = 1; f < 5; ++f)
+//     {
+//       for (int prec : {0, 3, 17})
+//       {
+//         const auto s = str(v, &fmts[f], prec);
+//         if (s.size() <= 50)
+//         {
+//           body += "    PrecisionTestItem{" + lit(v) + ", cuda::std::chars_format" + names[f] + ", "
+//                 + std::to_string(prec) + ", \"" + s + "\"},\n";
+//           ++count;
+//         }
+//       }
+//     }
+//   }
+//   std::cout << "TEST_FUNC constexpr cuda::std::array<PrecisionTestItem, " << count
+//             << "> get_precision_test_items()\n{\n  return {{\n" << body << "  }};\n}\n";
+// }
+//
+// int main()
+// {
+// #ifdef FLOAT
+//   constexpr float shortest[] = {0.0f, -0.0f, 1.0f, -1.5f, 0.1f, 1e5f, 123456.0f, 1e6f, 1234567.0f, 1e-4f, 1e-5f,
+//                                 3e10f, 3.14159274f, -2.5e-7f, 1e-45f, 1.17549435e-38f, 3.40282347e38f, 16777217.0f};
+//   constexpr float precision[] = {
+//     0.0f, -1.5f, 0.1f, 2.5f, 9.995f, 123456.789f, 1e-10f, 1e10f, 1e-45f, 3.40282347e38f};
+// #else
+//   constexpr double shortest[] = {
+//     0.0, -0.0, 1.0, -1.5, 0.1, 1e5, 123456.0, 1e6, 1234567.0, 1e-4, 1e-5, 1e23, 3.141592653589793, -2.5e-7, 5e-324,
+//     2.2250738585072014e-308, 1.7976931348623157e308, 9007199254740993.0};
+//   constexpr double precision[] = {
+//     0.0, -1.5, 0.1, 2.5, 9.995, 123456.789, 1e-10, 1e21, 5e-324, 1.7976931348623157e308};
+// #endif
+//   gen(shortest, precision);
+// }
+
+TEST_FUNC constexpr cuda::std::array<ShortestTestItem, 90> get_shortest_test_items()
+{
+  return {{
+    ShortestTestItem{0e+00f, cuda::std::chars_format{}, "0"},
+    ShortestTestItem{0e+00f, cuda::std::chars_format::scientific, "0e+00"},
+    ShortestTestItem{0e+00f, cuda::std::chars_format::fixed, "0"},
+    ShortestTestItem{0e+00f, cuda::std::chars_format::general, "0"},
+    ShortestTestItem{0e+00f, cuda::std::chars_format::hex, "0p+0"},
+    ShortestTestItem{-0e+00f, cuda::std::chars_format{}, "-0"},
+    ShortestTestItem{-0e+00f, cuda::std::chars_format::scientific, "-0e+00"},
+    ShortestTestItem{-0e+00f, cuda::std::chars_format::fixed, "-0"},
+    ShortestTestItem{-0e+00f, cuda::std::chars_format::general, "-0"},
+    ShortestTestItem{-0e+00f, cuda::std::chars_format::hex, "-0p+0"},
+    ShortestTestItem{1e+00f, cuda::std::chars_format{}, "1"},
+    ShortestTestItem{1e+00f, cuda::std::chars_format::scientific, "1e+00"},
+    ShortestTestItem{1e+00f, cuda::std::chars_format::fixed, "1"},
+    ShortestTestItem{1e+00f, cuda::std::chars_format::general, "1"},
+    ShortestTestItem{1e+00f, cuda::std::chars_format::hex, "1p+0"},
+    ShortestTestItem{-1.5e+00f, cuda::std::chars_format{}, "-1.5"},
+    ShortestTestItem{-1.5e+00f, cuda::std::chars_format::scientific, "-1.5e+00"},
+    ShortestTestItem{-1.5e+00f, cuda::std::chars_format::fixed, "-1.5"},
+    ShortestTestItem{-1.5e+00f, cuda::std::chars_format::general, "-1.5"},
+    ShortestTestItem{-1.5e+00f, cuda::std::chars_format::hex, "-1.8p+0"},
+    ShortestTestItem{1e-01f, cuda::std::chars_format{}, "0.1"},
+    ShortestTestItem{1e-01f, cuda::std::chars_format::scientific, "1e-01"},
+    ShortestTestItem{1e-01f, cuda::std::chars_format::fixed, "0.1"},
+    ShortestTestItem{1e-01f, cuda::std::chars_format::general, "0.1"},
+    ShortestTestItem{1e-01f, cuda::std::chars_format::hex, "1.99999ap-4"},
+    ShortestTestItem{1e+05f, cuda::std::chars_format{}, "1e+05"},
+    ShortestTestItem{1e+05f, cuda::std::chars_format::scientific, "1e+05"},
+    ShortestTestItem{1e+05f, cuda::std::chars_format::fixed, "100000"},
+    ShortestTestItem{1e+05f, cuda::std::chars_format::general, "100000"},
+    ShortestTestItem{1e+05f, cuda::std::chars_format::hex, "1.86ap+16"},
+    ShortestTestItem{1.23456e+05f, cuda::std::chars_format{}, "123456"},
+    ShortestTestItem{1.23456e+05f, cuda::std::chars_format::scientific, "1.23456e+05"},
+    ShortestTestItem{1.23456e+05f, cuda::std::chars_format::fixed, "123456"},
+    ShortestTestItem{1.23456e+05f, cuda::std::chars_format::general, "123456"},
+    ShortestTestItem{1.23456e+05f, cuda::std::chars_format::hex, "1.e24p+16"},
+    ShortestTestItem{1e+06f, cuda::std::chars_format{}, "1e+06"},
+    ShortestTestItem{1e+06f, cuda::std::chars_format::scientific, "1e+06"},
+    ShortestTestItem{1e+06f, cuda::std::chars_format::fixed, "1000000"},
+    ShortestTestItem{1e+06f, cuda::std::chars_format::general, "1e+06"},
+    ShortestTestItem{1e+06f, cuda::std::chars_format::hex, "1.e848p+19"},
+    ShortestTestItem{1.234567e+06f, cuda::std::chars_format{}, "1234567"},
+    ShortestTestItem{1.234567e+06f, cuda::std::chars_format::scientific, "1.234567e+06"},
+    ShortestTestItem{1.234567e+06f, cuda::std::chars_format::fixed, "1234567"},
+    ShortestTestItem{1.234567e+06f, cuda::std::chars_format::general, "1.234567e+06"},
+    ShortestTestItem{1.234567e+06f, cuda::std::chars_format::hex, "1.2d687p+20"},
+    ShortestTestItem{1e-04f, cuda::std::chars_format{}, "1e-04"},
+    ShortestTestItem{1e-04f, cuda::std::chars_format::scientific, "1e-04"},
+    ShortestTestItem{1e-04f, cuda::std::chars_format::fixed, "0.0001"},
+    ShortestTestItem{1e-04f, cuda::std::chars_format::general, "0.0001"},
+    ShortestTestItem{1e-04f, cuda::std::chars_format::hex, "1.a36e2ep-14"},
+    ShortestTestItem{1e-05f, cuda::std::chars_format{}, "1e-05"},
+    ShortestTestItem{1e-05f, cuda::std::chars_format::scientific, "1e-05"},
+    ShortestTestItem{1e-05f, cuda::std::chars_format::fixed, "0.00001"},
+    ShortestTestItem{1e-05f, cuda::std::chars_format::general, "1e-05"},
+    ShortestTestItem{1e-05f, cuda::std::chars_format::hex, "1.4f8b58p-17"},
+    ShortestTestItem{3e+10f, cuda::std::chars_format{}, "3e+10"},
+    ShortestTestItem{3e+10f, cuda::std::chars_format::scientific, "3e+10"},
+    ShortestTestItem{3e+10f, cuda::std::chars_format::fixed, "30000001024"},
+    ShortestTestItem{3e+10f, cuda::std::chars_format::general, "3e+10"},
+    ShortestTestItem{3e+10f, cuda::std::chars_format::hex, "1.bf08ecp+34"},
+    ShortestTestItem{3.1415927e+00f, cuda::std::chars_format{}, "3.1415927"},
+    ShortestTestItem{3.1415927e+00f, cuda::std::chars_format::scientific, "3.1415927e+00"},
+    ShortestTestItem{3.1415927e+00f, cuda::std::chars_format::fixed, "3.1415927"},
+    ShortestTestItem{3.1415927e+00f, cuda::std::chars_format::general, "3.1415927"},
+    ShortestTestItem{3.1415927e+00f, cuda::std::chars_format::hex, "1.921fb6p+1"},
+    ShortestTestItem{-2.5e-07f, cuda::std::chars_format{}, "-2.5e-07"},
+    ShortestTestItem{-2.5e-07f, cuda::std::chars_format::scientific, "-2.5e-07"},
+    ShortestTestItem{-2.5e-07f, cuda::std::chars_format::fixed, "-0.00000025"},
+    ShortestTestItem{-2.5e-07f, cuda::std::chars_format::general, "-2.5e-07"},
+    ShortestTestItem{-2.5e-07f, cuda::std::chars_format::hex, "-1.0c6f7ap-22"},
+    ShortestTestItem{1e-45f, cuda::std::chars_format{}, "1e-45"},
+    ShortestTestItem{1e-45f, cuda::std::chars_format::scientific, "1e-45"},
+    ShortestTestItem{1e-45f, cuda::std::chars_format::fixed, "0.000000000000000000000000000000000000000000001"},
+    ShortestTestItem{1e-45f, cuda::std::chars_format::general, "1e-45"},
+    ShortestTestItem{1e-45f, cuda::std::chars_format::hex, "0.000002p-126"},
+    ShortestTestItem{1.1754944e-38f, cuda::std::chars_format{}, "1.1754944e-38"},
+    ShortestTestItem{1.1754944e-38f, cuda::std::chars_format::scientific, "1.1754944e-38"},
+    ShortestTestItem{1.1754944e-38f, cuda::std::chars_format::fixed, "0.000000000000000000000000000000000000011754944"},
+    ShortestTestItem{1.1754944e-38f, cuda::std::chars_format::general, "1.1754944e-38"},
+    ShortestTestItem{1.1754944e-38f, cuda::std::chars_format::hex, "1p-126"},
+    ShortestTestItem{3.4028235e+38f, cuda::std::chars_format{}, "3.4028235e+38"},
+    ShortestTestItem{3.4028235e+38f, cuda::std::chars_format::scientific, "3.4028235e+38"},
+    ShortestTestItem{3.4028235e+38f, cuda::std::chars_format::fixed, "340282346638528859811704183484516925440"},
+    ShortestTestItem{3.4028235e+38f, cuda::std::chars_format::general, "3.4028235e+38"},
+    ShortestTestItem{3.4028235e+38f, cuda::std::chars_format::hex, "1.fffffep+127"},
+    ShortestTestItem{1.6777216e+07f, cuda::std::chars_format{}, "16777216"},
+    ShortestTestItem{1.6777216e+07f, cuda::std::chars_format::scientific, "1.6777216e+07"},
+    ShortestTestItem{1.6777216e+07f, cuda::std::chars_format::fixed, "16777216"},
+    ShortestTestItem{1.6777216e+07f, cuda::std::chars_format::general, "1.6777216e+07"},
+    ShortestTestItem{1.6777216e+07f, cuda::std::chars_format::hex, "1p+24"},
+  }};
+}
+
+TEST_FUNC constexpr cuda::std::array<PrecisionTestItem, 119> get_precision_test_items()
+{
+  return {{
+    PrecisionTestItem{0e+00f, cuda::std::chars_format::scientific, 0, "0e+00"},
+    PrecisionTestItem{0e+00f, cuda::std::chars_format::scientific, 3, "0.000e+00"},
+    PrecisionTestItem{0e+00f, cuda::std::chars_format::scientific, 17, "0.00000000000000000e+00"},
+    PrecisionTestItem{0e+00f, cuda::std::chars_format::fixed, 0, "0"},
+    PrecisionTestItem{0e+00f, cuda::std::chars_format::fixed, 3, "0.000"},
+    PrecisionTestItem{0e+00f, cuda::std::chars_format::fixed, 17, "0.00000000000000000"},
+    PrecisionTestItem{0e+00f, cuda::std::chars_format::general, 0, "0"},
+    PrecisionTestItem{0e+00f, cuda::std::chars_format::general, 3, "0"},
+    PrecisionTestItem{0e+00f, cuda::std::chars_format::general, 17, "0"},
+    PrecisionTestItem{0e+00f, cuda::std::chars_format::hex, 0, "0p+0"},
+    PrecisionTestItem{0e+00f, cuda::std::chars_format::hex, 3, "0.000p+0"},
+    PrecisionTestItem{0e+00f, cuda::std::chars_format::hex, 17, "0.00000000000000000p+0"},
+    PrecisionTestItem{-1.5e+00f, cuda::std::chars_format::scientific, 0, "-2e+00"},
+    PrecisionTestItem{-1.5e+00f, cuda::std::chars_format::scientific, 3, "-1.500e+00"},
+    PrecisionTestItem{-1.5e+00f, cuda::std::chars_format::scientific, 17, "-1.50000000000000000e+00"},
+    PrecisionTestItem{-1.5e+00f, cuda::std::chars_format::fixed, 0, "-2"},
+    PrecisionTestItem{-1.5e+00f, cuda::std::chars_format::fixed, 3, "-1.500"},
+    PrecisionTestItem{-1.5e+00f, cuda::std::chars_format::fixed, 17, "-1.50000000000000000"},
+    PrecisionTestItem{-1.5e+00f, cuda::std::chars_format::general, 0, "-2"},
+    PrecisionTestItem{-1.5e+00f, cuda::std::chars_format::general, 3, "-1.5"},
+    PrecisionTestItem{-1.5e+00f, cuda::std::chars_format::general, 17, "-1.5"},
+    PrecisionTestItem{-1.5e+00f, cuda::std::chars_format::hex, 0, "-2p+0"},
+    PrecisionTestItem{-1.5e+00f, cuda::std::chars_format::hex, 3, "-1.800p+0"},
+    PrecisionTestItem{-1.5e+00f, cuda::std::chars_format::hex, 17, "-1.80000000000000000p+0"},
+    PrecisionTestItem{1e-01f, cuda::std::chars_format::scientific, 0, "1e-01"},
+    PrecisionTestItem{1e-01f, cuda::std::chars_format::scientific, 3, "1.000e-01"},
+    PrecisionTestItem{1e-01f, cuda::std::chars_format::scientific, 17, "1.00000001490116119e-01"},
+    PrecisionTestItem{1e-01f, cuda::std::chars_format::fixed, 0, "0"},
+    PrecisionTestItem{1e-01f, cuda::std::chars_format::fixed, 3, "0.100"},
+    PrecisionTestItem{1e-01f, cuda::std::chars_format::fixed, 17, "0.10000000149011612"},
+    PrecisionTestItem{1e-01f, cuda::std::chars_format::general, 0, "0.1"},
+    PrecisionTestItem{1e-01f, cuda::std::chars_format::general, 3, "0.1"},
+    PrecisionTestItem{1e-01f, cuda::std::chars_format::general, 17, "0.10000000149011612"},
+    PrecisionTestItem{1e-01f, cuda::std::chars_format::hex, 0, "2p-4"},
+    PrecisionTestItem{1e-01f, cuda::std::chars_format::hex, 3, "1.99ap-4"},
+    PrecisionTestItem{1e-01f, cuda::std::chars_format::hex, 17, "1.99999a00000000000p-4"},
+    PrecisionTestItem{2.5e+00f, cuda::std::chars_format::scientific, 0, "2e+00"},
+    PrecisionTestItem{2.5e+00f, cuda::std::chars_format::scientific, 3, "2.500e+00"},
+    PrecisionTestItem{2.5e+00f, cuda::std::chars_format::scientific, 17, "2.50000000000000000e+00"},
+    PrecisionTestItem{2.5e+00f, cuda::std::chars_format::fixed, 0, "2"},
+    PrecisionTestItem{2.5e+00f, cuda::std::chars_format::fixed, 3, "2.500"},
+    PrecisionTestItem{2.5e+00f, cuda::std::chars_format::fixed, 17, "2.50000000000000000"},
+    PrecisionTestItem{2.5e+00f, cuda::std::chars_format::general, 0, "2"},
+    PrecisionTestItem{2.5e+00f, cuda::std::chars_format::general, 3, "2.5"},
+    PrecisionTestItem{2.5e+00f, cuda::std::chars_format::general, 17, "2.5"},
+    PrecisionTestItem{2.5e+00f, cuda::std::chars_format::hex, 0, "1p+1"},
+    PrecisionTestItem{2.5e+00f, cuda::std::chars_format::hex, 3, "1.400p+1"},
+    PrecisionTestItem{2.5e+00f, cuda::std::chars_format::hex, 17, "1.40000000000000000p+1"},
+    PrecisionTestItem{9.995e+00f, cuda::std::chars_format::scientific, 0, "1e+01"},
+    PrecisionTestItem{9.995e+00f, cuda::std::chars_format::scientific, 3, "9.995e+00"},
+    PrecisionTestItem{9.995e+00f, cuda::std::chars_format::scientific, 17, "9.99499988555908203e+00"},
+    PrecisionTestItem{9.995e+00f, cuda::std::chars_format::fixed, 0, "10"},
+    PrecisionTestItem{9.995e+00f, cuda::std::chars_format::fixed, 3, "9.995"},
+    PrecisionTestItem{9.995e+00f, cuda::std::chars_format::fixed, 17, "9.99499988555908203"},
+    PrecisionTestItem{9.995e+00f, cuda::std::chars_format::general, 0, "1e+01"},
+    PrecisionTestItem{9.995e+00f, cuda::std::chars_format::general, 3, "9.99"},
+    PrecisionTestItem{9.995e+00f, cuda::std::chars_format::general, 17, "9.994999885559082"},
+    PrecisionTestItem{9.995e+00f, cuda::std::chars_format::hex, 0, "1p+3"},
+    PrecisionTestItem{9.995e+00f, cuda::std::chars_format::hex, 3, "1.3fdp+3"},
+    PrecisionTestItem{9.995e+00f, cuda::std::chars_format::hex, 17, "1.3fd70a00000000000p+3"},
+    PrecisionTestItem{1.2345679e+05f, cuda::std::chars_format::scientific, 0, "1e+05"},
+    PrecisionTestItem{1.2345679e+05f, cuda::std::chars_format::scientific, 3, "1.235e+05"},
+    PrecisionTestItem{1.2345679e+05f, cuda::std::chars_format::scientific, 17, "1.23456789062500000e+05"},
+    PrecisionTestItem{1.2345679e+05f, cuda::std::chars_format::fixed, 0, "123457"},
+    PrecisionTestItem{1.2345679e+05f, cuda::std::chars_format::fixed, 3, "123456.789"},
+    PrecisionTestItem{1.2345679e+05f, cuda::std::chars_format::fixed, 17, "123456.78906250000000000"},
+    PrecisionTestItem{1.2345679e+05f, cuda::std::chars_format::general, 0, "1e+05"},
+    PrecisionTestItem{1.2345679e+05f, cuda::std::chars_format::general, 3, "1.23e+05"},
+    PrecisionTestItem{1.2345679e+05f, cuda::std::chars_format::general, 17, "123456.7890625"},
+    PrecisionTestItem{1.2345679e+05f, cuda::std::chars_format::hex, 0, "2p+16"},
+    PrecisionTestItem{1.2345679e+05f, cuda::std::chars_format::hex, 3, "1.e24p+16"},
+    PrecisionTestItem{1.2345679e+05f, cuda::std::chars_format::hex, 17, "1.e240ca00000000000p+16"},
+    PrecisionTestItem{1e-10f, cuda::std::chars_format::scientific, 0, "1e-10"},
+    PrecisionTestItem{1e-10f, cuda::std::chars_format::scientific, 3, "1.000e-10"},
+    PrecisionTestItem{1e-10f, cuda::std::chars_format::scientific, 17, "1.00000001335143196e-10"},
+    PrecisionTestItem{1e-10f, cuda::std::chars_format::fixed, 0, "0"},
+    PrecisionTestItem{1e-10f, cuda::std::chars_format::fixed, 3, "0.000"},
+    PrecisionTestItem{1e-10f, cuda::std::chars_format::fixed, 17, "0.00000000010000000"},
+    PrecisionTestItem{1e-10f, cuda::std::chars_format::general, 0, "1e-10"},
+    PrecisionTestItem{1e-10f, cuda::std::chars_format::general, 3, "1e-10"},
+    PrecisionTestItem{1e-10f, cuda::std::chars_format::general, 17, "1.000000013351432e-10"},
+    PrecisionTestItem{1e-10f, cuda::std::chars_format::hex, 0, "2p-34"},
+    PrecisionTestItem{1e-10f, cuda::std::chars_format::hex, 3, "1.b7dp-34"},
+    PrecisionTestItem{1e-10f, cuda::std::chars_format::hex, 17, "1.b7cdfe00000000000p-34"},
+    PrecisionTestItem{1e+10f, cuda::std::chars_format::scientific, 0, "1e+10"},
+    PrecisionTestItem{1e+10f, cuda::std::chars_format::scientific, 3, "1.000e+10"},
+    PrecisionTestItem{1e+10f, cuda::std::chars_format::scientific, 17, "1.00000000000000000e+10"},
+    PrecisionTestItem{1e+10f, cuda::std::chars_format::fixed, 0, "10000000000"},
+    PrecisionTestItem{1e+10f, cuda::std::chars_format::fixed, 3, "10000000000.000"},
+    PrecisionTestItem{1e+10f, cuda::std::chars_format::fixed, 17, "10000000000.00000000000000000"},
+    PrecisionTestItem{1e+10f, cuda::std::chars_format::general, 0, "1e+10"},
+    PrecisionTestItem{1e+10f, cuda::std::chars_format::general, 3, "1e+10"},
+    PrecisionTestItem{1e+10f, cuda::std::chars_format::general, 17, "10000000000"},
+    PrecisionTestItem{1e+10f, cuda::std::chars_format::hex, 0, "1p+33"},
+    PrecisionTestItem{1e+10f, cuda::std::chars_format::hex, 3, "1.2a0p+33"},
+    PrecisionTestItem{1e+10f, cuda::std::chars_format::hex, 17, "1.2a05f200000000000p+33"},
+    PrecisionTestItem{1e-45f, cuda::std::chars_format::scientific, 0, "1e-45"},
+    PrecisionTestItem{1e-45f, cuda::std::chars_format::scientific, 3, "1.401e-45"},
+    PrecisionTestItem{1e-45f, cuda::std::chars_format::scientific, 17, "1.40129846432481707e-45"},
+    PrecisionTestItem{1e-45f, cuda::std::chars_format::fixed, 0, "0"},
+    PrecisionTestItem{1e-45f, cuda::std::chars_format::fixed, 3, "0.000"},
+    PrecisionTestItem{1e-45f, cuda::std::chars_format::fixed, 17, "0.00000000000000000"},
+    PrecisionTestItem{1e-45f, cuda::std::chars_format::general, 0, "1e-45"},
+    PrecisionTestItem{1e-45f, cuda::std::chars_format::general, 3, "1.4e-45"},
+    PrecisionTestItem{1e-45f, cuda::std::chars_format::general, 17, "1.4012984643248171e-45"},
+    PrecisionTestItem{1e-45f, cuda::std::chars_format::hex, 0, "0p-126"},
+    PrecisionTestItem{1e-45f, cuda::std::chars_format::hex, 3, "0.000p-126"},
+    PrecisionTestItem{1e-45f, cuda::std::chars_format::hex, 17, "0.00000200000000000p-126"},
+    PrecisionTestItem{3.4028235e+38f, cuda::std::chars_format::scientific, 0, "3e+38"},
+    PrecisionTestItem{3.4028235e+38f, cuda::std::chars_format::scientific, 3, "3.403e+38"},
+    PrecisionTestItem{3.4028235e+38f, cuda::std::chars_format::scientific, 17, "3.40282346638528860e+38"},
+    PrecisionTestItem{3.4028235e+38f, cuda::std::chars_format::fixed, 0, "340282346638528859811704183484516925440"},
+    PrecisionTestItem{3.4028235e+38f, cuda::std::chars_format::fixed, 3, "340282346638528859811704183484516925440.000"},
+    PrecisionTestItem{3.4028235e+38f, cuda::std::chars_format::general, 0, "3e+38"},
+    PrecisionTestItem{3.4028235e+38f, cuda::std::chars_format::general, 3, "3.4e+38"},
+    PrecisionTestItem{3.4028235e+38f, cuda::std::chars_format::general, 17, "3.4028234663852886e+38"},
+    PrecisionTestItem{3.4028235e+38f, cuda::std::chars_format::hex, 0, "2p+127"},
+    PrecisionTestItem{3.4028235e+38f, cuda::std::chars_format::hex, 3, "2.000p+127"},
+    PrecisionTestItem{3.4028235e+38f, cuda::std::chars_format::hex, 17, "1.fffffe00000000000p+127"},
+  }};
+}
+
+template <class ToChars>
+TEST_FUNC constexpr void test_to_chars(const char* ref_str, ToChars to_chars)
+{
+  constexpr cuda::std::size_t buff_size = 150;
+
+  char buff[buff_size + 1]{};
+  char* buff_start = buff + 1;
+
+  const auto ref_len = cuda::std::strlen(ref_str);
+
+  // Check valid buffer size
+  {
+    const auto result = to_chars(buff_start, buff_start + buff_size);
+    assert(result.ec == cuda::std::errc{});
+    assert(result.ptr == buff_start + ref_len);
+
+    // Compare with reference string
+    assert(cuda::std::strncmp(buff_start, ref_str, buff_size) == 0);
+
+    // Check that the operation did not underflow the buffer
+    assert(buff[0] == '\0');
+  }
+
+  // Check too small buffer
+  {
+    const auto result = to_chars(buff_start, buff_start + ref_len - 1);
+    assert(result.ec == cuda::std::errc::value_too_large);
+    assert(result.ptr == buff_start + ref_len - 1);
+  }
+
+  // Check zero buffer
+  {
+    const auto result = to_chars(buff_start, buff_start);
+    assert(result.ec == cuda::std::errc::value_too_large);
+    assert(result.ptr == buff_start);
+  }
+}
+
+TEST_FUNC constexpr void test_shortest(const ShortestTestItem& item)
+{
+  test_to_chars(item.str, [&](char* first, char* last) {
+    return (item.fmt == cuda::std::chars_format{})
+           ? cuda::std::to_chars(first, last, item.val)
+           : cuda::std::to_chars(first, last, item.val, item.fmt);
+  });
+}
+
+TEST_FUNC constexpr void test_precision(const PrecisionTestItem& item)
+{
+  test_to_chars(item.str, [&](char* first, char* last) {
+    return cuda::std::to_chars(first, last, item.val, item.fmt, item.precision);
+  });
+}
+
+TEST_FUNC constexpr void test_non_finite(float val, const char* ref_str)
+{
+  test_to_chars(ref_str, [&](char* first, char* last) {
+    return cuda::std::to_chars(first, last, val);
+  });
+  test_to_chars(ref_str, [&](char* first, char* last) {
+    return cuda::std::to_chars(first, last, val, cuda::std::chars_format::fixed);
+  });
+  test_to_chars(ref_str, [&](char* first, char* last) {
+    return cuda::std::to_chars(first, last, val, cuda::std::chars_format::scientific, 3);
+  });
+}
+
+TEST_FUNC constexpr bool test()
+{
+  static_assert(cuda::std::is_same_v<
+                cuda::std::to_chars_result,
+                decltype(cuda::std::to_chars(cuda::std::declval<char*>(), cuda::std::declval<char*>(), float{}))>);
+  static_assert(noexcept(cuda::std::to_chars(cuda::std::declval<char*>(), cuda::std::declval<char*>(), float{})));
+  static_assert(noexcept(cuda::std::to_chars(
+    cuda::std::declval<char*>(), cuda::std::declval<char*>(), float{}, cuda::std::chars_format::general)));
+  static_assert(noexcept(cuda::std::to_chars(
+    cuda::std::declval<char*>(), cuda::std::declval<char*>(), float{}, cuda::std::chars_format::general, int{})));
+
+  for (const auto& item : get_shortest_test_items())
+  {
+    test_shortest(item);
+  }
+  for (const auto& item : get_precision_test_items())
+  {
+    test_precision(item);
+  }
+
+  test_non_finite(cuda::std::numeric_limits<float>::infinity(), "inf");
+  test_non_finite(-cuda::std::numeric_limits<float>::infinity(), "-inf");
+  test_non_finite(cuda::std::numeric_limits<float>::quiet_NaN(), "nan");
+  test_non_finite(-cuda::std::numeric_limits<float>::quiet_NaN(), "-nan");
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test());
+  return 0;
+}
@@ -13,6 +13,7 @@
 #include <cuda/std/cstddef>
 #include <cuda/std/cstdint>
 #include <cuda/std/cstring>
+#include <cuda/std/limits>
 #include <cuda/std/type_traits>
 #include <cuda/utility>
 
@@ -1192,6 +1193,33 @@ TEST_FUNC constexpr void test_to_chars(const TestItem& item)
   }
 }
 
+template <class T, int Base>
+TEST_FUNC constexpr void test_powers_of_base()
+{
+  constexpr cuda::std::size_t buff_size = 150;
+
+  // The powers of the base are a one followed by zeros, one more digit than the largest number below them
+  T value = 1;
+  for (int exp = 0;; ++exp)
+  {
+    char buff[buff_size]{};
+    const auto result = cuda::std::to_chars(buff, buff + buff_size, value, Base);
+    assert(result.ec == cuda::std::errc{});
+    assert(result.ptr == buff + exp + 1);
+    assert(buff[0] == '1');
+    for (int i = 1; i <= exp; ++i)
+    {
+      assert(buff[i] == '0');
+    }
+
+    if (value > cuda::std::numeric_limits<T>::max() / Base)
+    {
+      break;
+    }
+    value = static_cast<T>(value * Base);
+  }
+}
+
 template <int Base>
 TEST_FUNC constexpr bool test_base()
 {
@@ -1203,6 +1231,9 @@ TEST_FUNC constexpr bool test_base()
     test_to_chars<cuda::std::uint16_t, Base>(item);
   }
 
+  test_powers_of_base<cuda::std::int16_t, Base>();
+  test_powers_of_base<cuda::std::uint16_t, Base>();
+
   return true;
 }
 
@@ -0,0 +1,192 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/cassert>
+#include <cuda/std/limits>
+#include <cuda/std/string_view>
+#include <cuda/std/type_traits>
+
+#include "format_functions_common.h"
+#include "test_macros.h"
+
+// Provided by the selected checker.
+TEST_FUNC bool check(...);
+TEST_FUNC bool check_exception(...);
+
+template <class CharT, class F>
+TEST_FUNC _CCCL_NOINLINE void test_floating_point_values()
+{
+  // *** default type, the shortest representation ***
+  assert(check(SV("answer is 1"), SV("answer is {}"), F(1)));
+  assert(check(SV("answer is 0.1"), SV("answer is {}"), F(0.1)));
+  assert(check(SV("answer is 2.5"), SV("answer is {}"), F(2.5)));
+  assert(check(SV("answer is 123456"), SV("answer is {}"), F(123456)));
+  assert(check(SV("answer is 1e+05"), SV("answer is {}"), F(100000)));
+  assert(check(SV("answer is 1e-05"), SV("answer is {}"), F(0.00001)));
+  assert(check(SV("answer is 0"), SV("answer is {}"), F(0)));
+  assert(check(SV("answer is -0"), SV("answer is {}"), -F(0)));
+  assert(check(SV("answer is -1.5"), SV("answer is {}"), F(-1.5)));
+
+  // *** align-fill & width ***
+  assert(check(SV("answer is '    2.5'"), SV("answer is '{:7}'"), F(2.5)));
+  assert(check(SV("answer is '    2.5'"), SV("answer is '{:>7}'"), F(2.5)));
+  assert(check(SV("answer is '2.5    '"), SV("answer is '{:<7}'"), F(2.5)));
+  assert(check(SV("answer is '  2.5  '"), SV("answer is '{:^7}'"), F(2.5)));
+
+  // The fill character ':' is allowed here (P0645) but not in ranges (P2286).
+  assert(check(SV("answer is '::::2.5'"), SV("answer is '{::>7}'"), F(2.5)));
+  assert(check(SV("answer is '2.5::::'"), SV("answer is '{::<7}'"), F(2.5)));
+  assert(check(SV("answer is '::2.5::'"), SV("answer is '{::^7}'"), F(2.5)));
+
+  // Test whether zero padding is ignored
+  assert(check(SV("answer is '    2.5'"), SV("answer is '{:>07}'"), F(2.5)));
+  assert(check(SV("answer is '2.5    '"), SV("answer is '{:<07}'"), F(2.5)));
+  assert(check(SV("answer is '  2.5  '"), SV("answer is '{:^07}'"), F(2.5)));
+
+  // *** Sign ***
+  assert(check(SV("answer is -2.5"), SV("answer is {:-}"), F(-2.5)));
+  assert(check(SV("answer is 2.5"), SV("answer is {:-}"), F(2.5)));
+  assert(check(SV("answer is -2.5"), SV("answer is {:+}"), F(-2.5)));
+  assert(check(SV("answer is +2.5"), SV("answer is {:+}"), F(2.5)));
+  assert(check(SV("answer is +0"), SV("answer is {:+}"), F(0)));
+  assert(check(SV("answer is -0"), SV("answer is {:+}"), -F(0)));
+  assert(check(SV("answer is -2.5"), SV("answer is {: }"), F(-2.5)));
+  assert(check(SV("answer is  2.5"), SV("answer is {: }"), F(2.5)));
+
+  // *** alternate form ***
+  assert(check(SV("answer is 1."), SV("answer is {:#}"), F(1)));
+  assert(check(SV("answer is 2.5"), SV("answer is {:#}"), F(2.5)));
+  assert(check(SV("answer is 1.e+05"), SV("answer is {:#}"), F(100000)));
+  assert(check(SV("answer is 2."), SV("answer is {:#.0f}"), F(2)));
+  assert(check(SV("answer is 2.e+00"), SV("answer is {:#.0e}"), F(2)));
+  assert(check(SV("answer is 1.p+0"), SV("answer is {:#a}"), F(1)));
+  assert(check(SV("answer is 1.00"), SV("answer is {:#.3g}"), F(1)));
+  assert(check(SV("answer is 2.50000"), SV("answer is {:#g}"), F(2.5)));
+  assert(check(SV("answer is 0.000100000"), SV("answer is {:#g}"), F(0.0001)));
+  assert(check(SV("answer is 1.00000e+10"), SV("answer is {:#g}"), F(1e10)));
+  assert(check(SV("answer is 0.00000"), SV("answer is {:#g}"), F(0)));
+  assert(check(SV("answer is 1."), SV("answer is {:#.3}"), F(1)));
+
+  // *** zero-padding & width ***
+  assert(check(SV("answer is 0002.5"), SV("answer is {:06}"), F(2.5)));
+  assert(check(SV("answer is -002.5"), SV("answer is {:06}"), F(-2.5)));
+  assert(check(SV("answer is +002.5"), SV("answer is {:+06}"), F(2.5)));
+  assert(check(SV("answer is  002.5"), SV("answer is {: 06}"), F(2.5)));
+  assert(check(SV("answer is +002.500"), SV("answer is {:+08.3f}"), F(2.5)));
+  assert(check(SV("answer is -01.4p+1"), SV("answer is {:08a}"), F(-2.5)));
+  assert(check(SV("answer is 2.5"), SV("answer is {:02}"), F(2.5)));
+
+  // *** precision ***
+  assert(check(SV("answer is 3.14"), SV("answer is {:.3}"), F(3.14159)));
+  assert(check(SV("answer is 2"), SV("answer is {:.0}"), F(2.5)));
+  assert(check(SV("answer is 1e+02"), SV("answer is {:.2}"), F(100)));
+  assert(check(SV("answer is 3.142"), SV("answer is {:.3f}"), F(3.14159)));
+  assert(check(SV("answer is 1.23e+03"), SV("answer is {:.2e}"), F(1234.5)));
+  assert(check(SV("answer is 1.23e+03"), SV("answer is {:.3g}"), F(1234.5)));
+  assert(check(SV("answer is 0.5"), SV("answer is {:.10g}"), F(0.5)));
+  assert(check(SV("answer is 1.00p+0"), SV("answer is {:.2a}"), F(1)));
+  assert(check(SV("answer is 2p+0"), SV("answer is {:.0a}"), F(1.5)));
+  assert(check(SV("answer is 0.12"), SV("answer is {:.2f}"), F(0.125)));
+  assert(check(SV("answer is 10.0"), SV("answer is {:.1f}"), F(9.96)));
+  assert(check(SV("answer is 2.50"), SV("answer is {:.{}f}"), F(2.5), 2));
+  assert(check(SV("answer is    2.5"), SV("answer is {:{}.1f}"), F(2.5), 6));
+  if constexpr (cuda::std::is_same_v<F, float>)
+  {
+    assert(check(SV("answer is 0.100000001490116119384765625000"), SV("answer is {:.30f}"), F(0.1)));
+  }
+  else
+  {
+    assert(check(SV("answer is 0.100000000000000005551115123126"), SV("answer is {:.30f}"), F(0.1)));
+  }
+
+  // *** type ***
+  assert(check(SV("answer is 2.500000e+00"), SV("answer is {:e}"), F(2.5)));
+  assert(check(SV("answer is 2.500000E+00"), SV("answer is {:E}"), F(2.5)));
+  assert(check(SV("answer is 2.500000"), SV("answer is {:f}"), F(2.5)));
+  assert(check(SV("answer is 2.500000"), SV("answer is {:F}"), F(2.5)));
+  assert(check(SV("answer is 2.5"), SV("answer is {:g}"), F(2.5)));
+  assert(check(SV("answer is 1E-10"), SV("answer is {:G}"), F(1e-10)));
+  assert(check(SV("answer is 1.4p+1"), SV("answer is {:a}"), F(2.5)));
+  assert(check(SV("answer is 1.FEP+7"), SV("answer is {:A}"), F(255)));
+
+  assert(check_exception(
+    "The type option contains an invalid value for a floating-point formatting argument", SV("{:d}"), F(0)));
+}
+
+template <class CharT, class F>
+TEST_FUNC _CCCL_NOINLINE void test_floating_point_non_finite()
+{
+  const F inf = cuda::std::numeric_limits<F>::infinity();
+  const F nan = cuda::std::numeric_limits<F>::quiet_NaN();
+
+  assert(check(SV("answer is inf"), SV("answer is {}"), inf));
+  assert(check(SV("answer is -inf"), SV("answer is {}"), -inf));
+  assert(check(SV("answer is +inf"), SV("answer is {:+}"), inf));
+  assert(check(SV("answer is INF"), SV("answer is {:F}"), inf));
+  assert(check(SV("answer is inf"), SV("answer is {:.3e}"), inf));
+  assert(check(SV("answer is nan"), SV("answer is {}"), nan));
+  assert(check(SV("answer is -nan"), SV("answer is {}"), -nan));
+  assert(check(SV("answer is NAN"), SV("answer is {:E}"), nan));
+  assert(check(SV("answer is nan"), SV("answer is {:#}"), nan));
+
+  // The zero padding does not apply to infinity and NaN
+  assert(check(SV("answer is '  inf'"), SV("answer is '{:05}'"), inf));
+  assert(check(SV("answer is ' -inf'"), SV("answer is '{:05}'"), -inf));
+  assert(check(SV("answer is '  nan'"), SV("answer is '{:05}'"), nan));
+  assert(check(SV("answer is '-inf '"), SV("answer is '{:<5}'"), -inf));
+}
+
+template <class CharT, class F>
+TEST_FUNC void test_floating_point()
+{
+  test_floating_point_values<CharT, F>();
+  test_floating_point_non_finite<CharT, F>();
+}
+
+template <class CharT>
+TEST_FUNC _CCCL_NOINLINE void test_min_max()
+{
+  // *** check the minima and maxima ***
+  assert(check(SV("1e-45"), SV("{}"), cuda::std::numeric_limits<float>::denorm_min()));
+  assert(check(SV("1.1754944e-38"), SV("{}"), cuda::std::numeric_limits<float>::min()));
+  assert(check(SV("3.4028235e+38"), SV("{}"), cuda::std::numeric_limits<float>::max()));
+  assert(check(SV("-3.4028235e+38"), SV("{}"), cuda::std::numeric_limits<float>::lowest()));
+  assert(check(SV("340282346638528859811704183484516925440"), SV("{:.0f}"), cuda::std::numeric_limits<float>::max()));
+
+  assert(check(SV("5e-324"), SV("{}"), cuda::std::numeric_limits<double>::denorm_min()));
+  assert(check(SV("2.2250738585072014e-308"), SV("{}"), cuda::std::numeric_limits<double>::min()));
+  assert(check(SV("1.7976931348623157e+308"), SV("{}"), cuda::std::numeric_limits<double>::max()));
+  assert(check(SV("-1.7976931348623157e+308"), SV("{}"), cuda::std::numeric_limits<double>::lowest()));
+  assert(check(SV("4.94065645841246544e-324"), SV("{:.17e}"), cuda::std::numeric_limits<double>::denorm_min()));
+  assert(check(SV("0.0000000000001p-1022"), SV("{:a}"), cuda::std::numeric_limits<double>::denorm_min()));
+}
+
+template <class CharT>
+TEST_FUNC _CCCL_NOINLINE void test()
+{
+  test_floating_point<CharT, float>();
+  test_floating_point<CharT, double>();
+
+  test_min_max<CharT>();
+}
+
+TEST_FUNC void test()
+{
+  test<char>();
+#if _CCCL_HAS_WCHAR_T()
+  test<wchar_t>();
+#endif // _CCCL_HAS_WCHAR_T()
+}
+
+int main(int, char**)
+{
+  test();
+  return 0;
+}
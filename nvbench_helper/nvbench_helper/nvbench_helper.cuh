@@ -7,6 +7,7 @@
 
 #include <cuda/std/cmath>
 #include <cuda/std/complex>
+#include <cuda/std/execution>
 #include <cuda/std/functional>
 #include <cuda/std/limits>
 #include <cuda/std/span>
@@ -14,7 +15,6 @@
 
 #if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
 #  include <cuda/memory_resource>
-#  include <cuda/std/execution>
 #  include <cuda/stream>
 #endif // THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
 
@@ -744,6 +744,11 @@ auto policy(caching_allocator_t&)
 {
   return thrust::device;
 }
+// Without the CUDA device system, the standard parallel policy runs the cuda::std algorithms on a host backend
+auto cuda_policy(caching_allocator_t&)
+{
+  return cuda::std::execution::par;
+}
 #endif
 
 #if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
@@ -761,6 +766,10 @@ auto policy(caching_allocator_t&, nvbench::launch&)
 {
   return thrust::device;
 }
+auto cuda_policy(caching_allocator_t&, nvbench::launch&)
+{
+  return cuda::std::execution::par;
+}
 #endif
 
 #if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
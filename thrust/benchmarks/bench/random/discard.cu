@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: BSD-3
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/random.h>
+#include <thrust/tabulate.h>
+
+#include "nvbench_helper.cuh"
+
+// Splits one engine into independent streams by jumping each element ahead by index * stride, which is how parallel
+// Monte Carlo codes seed per-thread engines. The cost of every element is dominated by a single discard call, which
+// is logarithmic in the distance for the recurrence-based engines and constant for the counter-based philox engines.
+template <typename Engine>
+struct discard_op
+{
+  unsigned long long stride;
+
+  __host__ __device__ typename Engine::result_type operator()(unsigned long long i) const
+  {
+    Engine engine;
+    engine.discard(i * stride);
+    return engine();
+  }
+};
+
+template <typename Engine>
+static void discard(nvbench::state& state)
+{
+  const auto elements = static_cast<std::size_t>(state.get_int64("Elements"));
+  const auto stride   = 1ull << state.get_int64("Stride");
+
+  thrust::device_vector<typename Engine::result_type> output(elements, thrust::no_init);
+
+  state.add_element_count(elements);
+  state.add_global_memory_writes<typename Engine::result_type>(elements);
+
+  caching_allocator_t alloc;
+  state.exec(nvbench::exec_tag::gpu | nvbench::exec_tag::no_batch | nvbench::exec_tag::sync,
+             [&](nvbench::launch& launch) {
+               thrust::tabulate(policy(alloc, launch), output.begin(), output.end(), discard_op<Engine>{stride});
+             });
+}
+
+static void basic(nvbench::state& state)
+{
+  const auto rng_engine = state.get_string("Engine");
+  if (rng_engine == "minstd")
+  {
+    discard<thrust::random::minstd_rand>(state);
+  }
+  else if (rng_engine == "ranlux24")
+  {
+    discard<thrust::random::ranlux24>(state);
+  }
+  else if (rng_engine == "ranlux48")
+  {
+    discard<thrust::random::ranlux48>(state);
+  }
+  else if (rng_engine == "taus88")
+  {
+    discard<thrust::random::taus88>(state);
+  }
+  else if (rng_engine == "philox4x32")
+  {
+    discard<thrust::random::philox4x32>(state);
+  }
+  else if (rng_engine == "philox4x64")
+  {
+    discard<thrust::random::philox4x64>(state);
+  }
+}
+
+NVBENCH_BENCH(basic)
+  .set_name("base")
+  .add_int64_power_of_two_axis("Elements", nvbench::range(10, 16, 2))
+  .add_int64_axis("Stride", {10, 20, 40})
+  .add_string_axis("Engine", {"minstd", "ranlux24", "ranlux48", "taus88", "philox4x32", "philox4x64"});
@@ -0,0 +1,60 @@
+#include <thrust/random.h>
+#include <thrust/sequence.h>
+#include <thrust/shuffle.h>
+#include <thrust/sort.h>
+#include <thrust/system/omp/execution_policy.h>
+
+#include <omp.h>
+
+#include <unittest/unittest.h>
+
+void TestOmpShuffleIndependentOfThreadCount()
+{
+  // large enough to be split into several buckets
+  const size_t n = (size_t(1) << 18) + 17;
+
+  thrust::host_vector<int> input(n);
+  thrust::sequence(input.begin(), input.end());
+
+  const int max_threads = omp_get_max_threads();
+
+  thrust::host_vector<int> reference(n);
+  omp_set_num_threads(1);
+  thrust::default_random_engine g(1234);
+  thrust::shuffle_copy(thrust::omp::par, input.begin(), input.end(), reference.begin(), g);
+
+  for (int threads : {2, 3, 8})
+  {
+    thrust::host_vector<int> result(n);
+    omp_set_num_threads(threads);
+    g.seed(1234);
+    thrust::shuffle_copy(thrust::omp::par, input.begin(), input.end(), result.begin(), g);
+
+    ASSERT_EQUAL(reference, result);
+  }
+
+  omp_set_num_threads(max_threads);
+
+  ASSERT_EQUAL(false, reference == input);
+  thrust::sort(reference.begin(), reference.end());
+  ASSERT_EQUAL(input, reference);
+}
+DECLARE_UNITTEST(TestOmpShuffleIndependentOfThreadCount);
+
+void TestOmpShuffleInPlace()
+{
+  const size_t n = (size_t(1) << 18) + 17;
+
+  thrust::host_vector<int> data(n);
+  thrust::sequence(data.begin(), data.end());
+
+  thrust::host_vector<int> copy(n);
+  thrust::default_random_engine g(7);
+  thrust::shuffle_copy(thrust::omp::par, data.begin(), data.end(), copy.begin(), g);
+
+  g.seed(7);
+  thrust::shuffle(thrust::omp::par, data.begin(), data.end(), g);
+
+  ASSERT_EQUAL(copy, data);
+}
+DECLARE_UNITTEST(TestOmpShuffleInPlace);
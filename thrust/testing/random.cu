@@ -1,6 +1,7 @@
 #include <thrust/generate.h>
 #include <thrust/random.h>
 #include <thrust/random/detail/urng_traits.h>
+#include <thrust/tabulate.h>
 
 #include <cuda/std/random>
 
@@ -142,6 +143,34 @@ struct ValidateEngineUnequal
   }
 };
 
+template <typename Engine>
+struct ValidateEngineDiscard
+{
+  _CCCL_HOST_DEVICE bool operator()() const
+  {
+    bool result = true;
+
+    const unsigned long long distances[] = {1, 17, 1000, 54321};
+    for (unsigned long long z : distances)
+    {
+      // jumping ahead must land on the same state as stepping
+      Engine e0(7), e1(7);
+      e0();
+      e1();
+
+      e0.discard(z);
+      for (unsigned long long i = 0; i < z; ++i)
+      {
+        e1();
+      }
+      result &= (e0 == e1);
+      result &= (e0() == e1());
+    }
+
+    return result;
+  }
+};
+
 template <typename Distribution, typename Engine>
 struct ValidateDistributionMin
 {
@@ -264,6 +293,43 @@ void TestEngineMin()
   ASSERT_EQUAL(true, d[0]);
 }
 
+template <typename Engine>
+void TestEngineDiscard()
+{
+  ValidateEngineDiscard<Engine> f;
+
+  // test host
+  thrust::host_vector<bool> h(1);
+  thrust::generate(h.begin(), h.end(), f);
+
+  ASSERT_EQUAL(true, h[0]);
+
+  // test device
+  thrust::device_vector<bool> d(1);
+  thrust::generate(d.begin(), d.end(), f);
+
+  ASSERT_EQUAL(true, d[0]);
+}
+
+template <typename Engine>
+void TestEngineGenerate()
+{
+  // bulk generation must match repeated calls, including ranges that end mid-block
+  for (int n : {0, 1, 7, 8, 9, 1000})
+  {
+    Engine e0(13), e1(13);
+
+    thrust::host_vector<typename Engine::result_type> h(n);
+    e0.generate(h.begin(), h.end());
+
+    for (int i = 0; i < n; ++i)
+    {
+      ASSERT_EQUAL(e1(), h[i]);
+    }
+    ASSERT_EQUAL(true, e0 == e1);
+  }
+}
+
 template <typename Engine>
 void TestEngineSaveRestore()
 {
@@ -360,6 +426,22 @@ void TestRanlux24BaseSaveRestore()
 }
 DECLARE_UNITTEST(TestRanlux24BaseSaveRestore);
 
+void TestRanlux24BaseDiscard()
+{
+  using Engine = thrust::random::ranlux24_base;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestRanlux24BaseDiscard);
+
+void TestRanlux24BaseGenerate()
+{
+  using Engine = thrust::random::ranlux24_base;
+
+  TestEngineGenerate<Engine>();
+}
+DECLARE_UNITTEST(TestRanlux24BaseGenerate);
+
 void TestRanlux24BaseEqual()
 {
   using Engine = thrust::random::ranlux24_base;
@@ -408,6 +490,22 @@ void TestRanlux48BaseSaveRestore()
 }
 DECLARE_UNITTEST(TestRanlux48BaseSaveRestore);
 
+void TestRanlux48BaseDiscard()
+{
+  using Engine = thrust::random::ranlux48_base;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestRanlux48BaseDiscard);
+
+void TestRanlux48BaseGenerate()
+{
+  using Engine = thrust::random::ranlux48_base;
+
+  TestEngineGenerate<Engine>();
+}
+DECLARE_UNITTEST(TestRanlux48BaseGenerate);
+
 void TestRanlux48BaseEqual()
 {
   using Engine = thrust::random::ranlux48_base;
@@ -465,6 +563,22 @@ void TestMinstdRandSaveRestore()
 }
 DECLARE_UNITTEST(TestMinstdRandSaveRestore);
 
+void TestMinstdRandDiscard()
+{
+  using Engine = thrust::random::minstd_rand;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestMinstdRandDiscard);
+
+void TestMinstdRandGenerate()
+{
+  using Engine = thrust::random::minstd_rand;
+
+  TestEngineGenerate<Engine>();
+}
+DECLARE_UNITTEST(TestMinstdRandGenerate);
+
 void TestMinstdRandEqual()
 {
   using Engine = thrust::random::minstd_rand;
@@ -513,6 +627,22 @@ void TestMinstdRand0SaveRestore()
 }
 DECLARE_UNITTEST(TestMinstdRand0SaveRestore);
 
+void TestMinstdRand0Discard()
+{
+  using Engine = thrust::random::minstd_rand0;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestMinstdRand0Discard);
+
+void TestMinstdRand0Generate()
+{
+  using Engine = thrust::random::minstd_rand0;
+
+  TestEngineGenerate<Engine>();
+}
+DECLARE_UNITTEST(TestMinstdRand0Generate);
+
 void TestMinstdRand0Equal()
 {
   using Engine = thrust::random::minstd_rand0;
@@ -561,6 +691,22 @@ void TestTaus88SaveRestore()
 }
 DECLARE_UNITTEST(TestTaus88SaveRestore);
 
+void TestTaus88Discard()
+{
+  using Engine = thrust::random::taus88;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestTaus88Discard);
+
+void TestTaus88Generate()
+{
+  using Engine = thrust::random::taus88;
+
+  TestEngineGenerate<Engine>();
+}
+DECLARE_UNITTEST(TestTaus88Generate);
+
 void TestTaus88Equal()
 {
   using Engine = thrust::random::taus88;
@@ -609,6 +755,22 @@ void TestRanlux24SaveRestore()
 }
 DECLARE_UNITTEST(TestRanlux24SaveRestore);
 
+void TestRanlux24Discard()
+{
+  using Engine = thrust::random::ranlux24;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestRanlux24Discard);
+
+void TestRanlux24Generate()
+{
+  using Engine = thrust::random::ranlux24;
+
+  TestEngineGenerate<Engine>();
+}
+DECLARE_UNITTEST(TestRanlux24Generate);
+
 void TestRanlux24Equal()
 {
   using Engine = thrust::random::ranlux24;
@@ -657,6 +819,22 @@ void TestRanlux48SaveRestore()
 }
 DECLARE_UNITTEST(TestRanlux48SaveRestore);
 
+void TestRanlux48Discard()
+{
+  using Engine = thrust::random::ranlux48;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestRanlux48Discard);
+
+void TestRanlux48Generate()
+{
+  using Engine = thrust::random::ranlux48;
+
+  TestEngineGenerate<Engine>();
+}
+DECLARE_UNITTEST(TestRanlux48Generate);
+
 void TestRanlux48Equal()
 {
   using Engine = thrust::random::ranlux48;
@@ -673,6 +851,128 @@ void TestRanlux48Unequal()
 }
 DECLARE_UNITTEST(TestRanlux48Unequal);
 
+void TestPhilox4x32Validation()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineValidation<Engine, 1955073260u>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Validation);
+
+void TestPhilox4x32SaveRestore()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32SaveRestore);
+
+void TestPhilox4x32Discard()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Discard);
+
+void TestPhilox4x32Equal()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Equal);
+
+void TestPhilox4x32Unequal()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Unequal);
+
+void TestPhilox4x64Validation()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineValidation<Engine, 3409172418970261260ull>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Validation);
+
+void TestPhilox4x64SaveRestore()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64SaveRestore);
+
+void TestPhilox4x64Discard()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Discard);
+
+void TestPhilox4x64Equal()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Equal);
+
+void TestPhilox4x64Unequal()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Unequal);
+
+template <typename Engine>
+struct philox_stream_element
+{
+  _CCCL_HOST_DEVICE typename Engine::result_type operator()(unsigned long long i) const
+  {
+    Engine e;
+    e.discard(i);
+    return e();
+  }
+};
+
+template <typename Vector>
+void TestPhiloxTabulateMatchesSequentialStream()
+{
+  using Engine = thrust::random::philox4x32;
+
+  // element i reads position i of one stream, so the result does not depend on how the range is split
+  Vector v(1000);
+  thrust::tabulate(v.begin(), v.end(), philox_stream_element<Engine>{});
+
+  thrust::host_vector<typename Vector::value_type> h(v.size());
+  Engine e;
+  for (size_t i = 0; i < h.size(); ++i)
+  {
+    h[i] = e();
+  }
+
+  ASSERT_EQUAL(h, v);
+}
+
+void TestPhiloxTabulateMatchesSequentialStreamHost()
+{
+  TestPhiloxTabulateMatchesSequentialStream<thrust::host_vector<thrust::random::philox4x32::result_type>>();
+}
+DECLARE_UNITTEST(TestPhiloxTabulateMatchesSequentialStreamHost);
+
+void TestPhiloxTabulateMatchesSequentialStreamDevice()
+{
+  TestPhiloxTabulateMatchesSequentialStream<thrust::device_vector<thrust::random::philox4x32::result_type>>();
+}
+DECLARE_UNITTEST(TestPhiloxTabulateMatchesSequentialStreamDevice);
+
 _CCCL_DIAG_PUSH
 _CCCL_DIAG_SUPPRESS_MSVC(4305) // truncation warning
 template <typename Distribution, typename Validator>
@@ -850,6 +1150,50 @@ void TestNormalDistributionSaveRestore()
 }
 DECLARE_UNITTEST(TestNormalDistributionSaveRestore);
 
+template <typename Distribution>
+void TestDistributionGenerate()
+{
+  using T = typename Distribution::result_type;
+
+  // split the range so that the second call starts in the middle of a pair or block
+  for (int n : {0, 1, 2, 5, 64, 1001})
+  {
+    thrust::minstd_rand e0(7), e1(7);
+    Distribution d0(3, 5), d1(3, 5);
+
+    thrust::host_vector<T> h(n);
+    d0.generate(h.begin(), h.begin() + n / 3, e0);
+    d0.generate(h.begin() + n / 3, h.end(), e0);
+
+    for (int i = 0; i < n; ++i)
+    {
+      ASSERT_ALMOST_EQUAL(d1(e1), h[i]);
+    }
+    ASSERT_EQUAL(true, e0 == e1);
+  }
+}
+
+void TestUniformIntDistributionGenerate()
+{
+  TestDistributionGenerate<thrust::random::uniform_int_distribution<int>>();
+  TestDistributionGenerate<thrust::random::uniform_int_distribution<unsigned int>>();
+}
+DECLARE_UNITTEST(TestUniformIntDistributionGenerate);
+
+void TestUniformRealDistributionGenerate()
+{
+  TestDistributionGenerate<thrust::random::uniform_real_distribution<float>>();
+  TestDistributionGenerate<thrust::random::uniform_real_distribution<double>>();
+}
+DECLARE_UNITTEST(TestUniformRealDistributionGenerate);
+
+void TestNormalDistributionGenerate()
+{
+  TestDistributionGenerate<thrust::random::normal_distribution<float>>();
+  TestDistributionGenerate<thrust::random::normal_distribution<double>>();
+}
+DECLARE_UNITTEST(TestNormalDistributionGenerate);
+
 template <typename Distribution, typename Engine>
 void ValidateDistributionWithEngine()
 {
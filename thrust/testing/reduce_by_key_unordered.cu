@@ -0,0 +1,200 @@
+#include <thrust/execution_policy.h>
+#include <thrust/reduce.h>
+#include <thrust/sort.h>
+
+#include <cuda/functional>
+
+#include <unittest/unittest.h>
+
+template <typename T>
+struct is_equal_div_10_reduce_unordered
+{
+  _CCCL_HOST_DEVICE bool operator()(const T x, const T& y) const
+  {
+    return ((int) x / 10) == ((int) y / 10);
+  }
+};
+
+// brings the output of reduce_by_key_unordered into a canonical order
+template <typename KeyVector, typename ValueVector, typename IteratorPair>
+void sort_output(KeyVector& keys, ValueVector& values, IteratorPair new_last)
+{
+  keys.resize(new_last.first - keys.begin());
+  values.resize(new_last.second - values.begin());
+  thrust::sort_by_key(keys.begin(), keys.end(), values.begin());
+}
+
+template <typename Vector>
+void TestReduceByKeyUnorderedSimple()
+{
+  using T = typename Vector::value_type;
+
+  Vector keys{21, 11, 37, 21, 20, 11, 21, 37, 21};
+  Vector values{0, 1, 2, 3, 4, 5, 6, 7, 8};
+
+  Vector output_keys(keys.size());
+  Vector output_values(values.size());
+
+  auto new_last = thrust::reduce_by_key_unordered(
+    keys.begin(), keys.end(), values.begin(), output_keys.begin(), output_values.begin());
+
+  ASSERT_EQUAL(new_last.first - output_keys.begin(), 4);
+  ASSERT_EQUAL(new_last.second - output_values.begin(), 4);
+  sort_output(output_keys, output_values, new_last);
+
+  Vector ref_keys{11, 20, 21, 37};
+  Vector ref_values{6, 4, 17, 9};
+  ASSERT_EQUAL(output_keys, ref_keys);
+  ASSERT_EQUAL(output_values, ref_values);
+
+  // test BinaryPredicate
+  output_keys.resize(keys.size());
+  output_values.resize(values.size());
+
+  new_last = thrust::reduce_by_key_unordered(
+    keys.begin(),
+    keys.end(),
+    values.begin(),
+    output_keys.begin(),
+    output_values.begin(),
+    is_equal_div_10_reduce_unordered<T>());
+
+  ASSERT_EQUAL(new_last.first - output_keys.begin(), 3);
+  sort_output(output_keys, output_values, new_last);
+
+  // only the decade of the output keys is specified
+  ASSERT_EQUAL(output_keys[0] / 10, 1);
+  ASSERT_EQUAL(output_keys[1] / 10, 2);
+  ASSERT_EQUAL(output_keys[2] / 10, 3);
+  ref_values = {6, 21, 9};
+  ASSERT_EQUAL(output_values, ref_values);
+
+  // test BinaryFunction
+  output_keys.resize(keys.size());
+  output_values.resize(values.size());
+
+  new_last = thrust::reduce_by_key_unordered(
+    keys.begin(),
+    keys.end(),
+    values.begin(),
+    output_keys.begin(),
+    output_values.begin(),
+    ::cuda::std::equal_to<T>(),
+    ::cuda::maximum<T>());
+
+  ASSERT_EQUAL(new_last.first - output_keys.begin(), 4);
+  sort_output(output_keys, output_values, new_last);
+
+  ref_values = {5, 4, 8, 7};
+  ASSERT_EQUAL(output_keys, ref_keys);
+  ASSERT_EQUAL(output_values, ref_values);
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestReduceByKeyUnorderedSimple);
+
+void TestReduceByKeyUnorderedEmpty()
+{
+  thrust::device_vector<int> keys;
+  thrust::device_vector<int> values;
+  thrust::device_vector<int> output_keys(1);
+  thrust::device_vector<int> output_values(1);
+
+  auto new_last = thrust::reduce_by_key_unordered(
+    keys.begin(), keys.end(), values.begin(), output_keys.begin(), output_values.begin());
+
+  ASSERT_EQUAL(new_last.first - output_keys.begin(), 0);
+  ASSERT_EQUAL(new_last.second - output_values.begin(), 0);
+}
+DECLARE_UNITTEST(TestReduceByKeyUnorderedEmpty);
+
+template <typename K>
+struct TestReduceByKeyUnordered
+{
+  void operator()(const size_t n)
+  {
+    using V = unsigned int; // ValueType
+
+    // few distinct keys, scattered over the whole input
+    thrust::host_vector<K> h_keys = unittest::random_integers<K>(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+      h_keys[i] = static_cast<K>(h_keys[i] % 37);
+    }
+    thrust::host_vector<V> h_vals   = unittest::random_integers<V>(n);
+    thrust::device_vector<K> d_keys = h_keys;
+    thrust::device_vector<V> d_vals = h_vals;
+
+    // reference: sort, then reduce consecutive keys
+    thrust::host_vector<K> ref_keys = h_keys;
+    thrust::host_vector<V> ref_vals = h_vals;
+    thrust::stable_sort_by_key(ref_keys.begin(), ref_keys.end(), ref_vals.begin());
+    auto ref_last = thrust::reduce_by_key(
+      ref_keys.begin(), ref_keys.end(), ref_vals.begin(), ref_keys.begin(), ref_vals.begin());
+    ref_keys.resize(ref_last.first - ref_keys.begin());
+    ref_vals.resize(ref_last.second - ref_vals.begin());
+
+    thrust::host_vector<K> h_keys_output(n);
+    thrust::host_vector<V> h_vals_output(n);
+    thrust::device_vector<K> d_keys_output(n);
+    thrust::device_vector<V> d_vals_output(n);
+
+    auto h_last = thrust::reduce_by_key_unordered(
+      h_keys.begin(), h_keys.end(), h_vals.begin(), h_keys_output.begin(), h_vals_output.begin());
+    auto d_last = thrust::reduce_by_key_unordered(
+      d_keys.begin(), d_keys.end(), d_vals.begin(), d_keys_output.begin(), d_vals_output.begin());
+
+    sort_output(h_keys_output, h_vals_output, h_last);
+    sort_output(d_keys_output, d_vals_output, d_last);
+
+    ASSERT_EQUAL(ref_keys, h_keys_output);
+    ASSERT_EQUAL(ref_vals, h_vals_output);
+    ASSERT_EQUAL(ref_keys, d_keys_output);
+    ASSERT_EQUAL(ref_vals, d_vals_output);
+  }
+};
+VariableUnitTest<TestReduceByKeyUnordered, IntegralTypes> TestReduceByKeyUnorderedInstance;
+
+void TestReduceByKeyUnorderedManyDistinctKeys()
+{
+  using K = long long;
+  using V = int;
+
+  // more distinct keys than a single hash table slot array starts with, and keys differing only in their high bits
+  const size_t n = 100000;
+  thrust::host_vector<K> h_keys(n);
+  thrust::host_vector<V> h_vals(n, 1);
+  for (size_t i = 0; i < n; ++i)
+  {
+    h_keys[i] = static_cast<K>((i * 7919) % 30011) << 32;
+  }
+
+  thrust::device_vector<K> d_keys = h_keys;
+  thrust::device_vector<V> d_vals = h_vals;
+  thrust::device_vector<K> d_keys_output(n);
+  thrust::device_vector<V> d_vals_output(n);
+
+  auto d_last = thrust::reduce_by_key_unordered(
+    d_keys.begin(), d_keys.end(), d_vals.begin(), d_keys_output.begin(), d_vals_output.begin());
+
+  ASSERT_EQUAL(d_last.first - d_keys_output.begin(), 30011);
+  ASSERT_EQUAL(thrust::reduce(d_vals_output.begin(), d_last.second), static_cast<V>(n));
+}
+DECLARE_UNITTEST(TestReduceByKeyUnorderedManyDistinctKeys);
+
+void TestReduceByKeyUnorderedFloatKeys()
+{
+  // floating point keys are not hashed, since equal values may have different bit patterns
+  thrust::device_vector<float> keys{1.0f, -0.0f, 2.5f, 0.0f, 1.0f};
+  thrust::device_vector<int> values{1, 2, 3, 4, 5};
+  thrust::device_vector<float> output_keys(5);
+  thrust::device_vector<int> output_values(5);
+
+  auto new_last = thrust::reduce_by_key_unordered(
+    keys.begin(), keys.end(), values.begin(), output_keys.begin(), output_values.begin());
+
+  ASSERT_EQUAL(new_last.first - output_keys.begin(), 3);
+  sort_output(output_keys, output_values, new_last);
+
+  thrust::device_vector<int> ref_values{6, 6, 3};
+  ASSERT_EQUAL(output_values, ref_values);
+}
+DECLARE_UNITTEST(TestReduceByKeyUnorderedFloatKeys);
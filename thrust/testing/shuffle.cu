@@ -139,7 +139,7 @@ void TestShuffleCopyCudaStdPhilox()
 DECLARE_VECTOR_UNITTEST(TestShuffleCopyCudaStdPhilox);
 
 template <typename ShuffleFunc, typename T>
-void TestHostDeviceIdenticalBase(size_t m)
+void TestHostDeviceIdenticalBase(size_t m, bool same_algorithm = true)
 {
   thrust::host_vector<T> host_result(m);
   thrust::device_vector<T> device_result(m);
@@ -152,12 +152,26 @@ void TestHostDeviceIdenticalBase(size_t m)
   ShuffleFunc{}(host_result.begin(), host_result.end(), host_g);
   ShuffleFunc{}(device_result.begin(), device_result.end(), device_g);
 
+  if (!same_algorithm)
+  {
+    // different permutations of the same elements
+    thrust::sort(host_result.begin(), host_result.end());
+    thrust::sort(device_result.begin(), device_result.end());
+  }
+
   ASSERT_EQUAL(device_result, host_result);
 }
 template <typename T>
 void TestHostDeviceIdentical(size_t m)
 {
-  TestHostDeviceIdenticalBase<thrust_shuffle, T>(m);
+  // the OMP and TBB systems shuffle with a bucket algorithm suited to CPUs, whose permutation for a given seed differs
+  // from the one of the other systems
+  constexpr bool host_bucket_shuffle =
+    THRUST_HOST_SYSTEM == THRUST_HOST_SYSTEM_OMP || THRUST_HOST_SYSTEM == THRUST_HOST_SYSTEM_TBB;
+  constexpr bool device_bucket_shuffle =
+    THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP || THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB;
+
+  TestHostDeviceIdenticalBase<thrust_shuffle, T>(m, host_bucket_shuffle == device_bucket_shuffle);
 }
 template <typename T>
 void TestHostDeviceIdenticalIterator(size_t m)
@@ -360,14 +374,16 @@ struct vector_compare
 
 // Brute force check permutations are uniformly distributed on small input
 // Uses a chi-squared test indicating 99% confidence the output is uniformly
-// random
+// random. With fewer samples a uniform shuffle may miss one of the 120
+// permutations, as the bucket shuffle of the OMP and TBB backends does for this
+// seed with 1000 samples
 template <typename ShuffleFunc, typename Vector>
 void TestShuffleUniformPermutationBase()
 {
   using T = typename Vector::value_type;
 
   size_t m                  = 5;
-  size_t num_samples        = 1000;
+  size_t num_samples        = 10000;
   size_t total_permutations = 1 * 2 * 3 * 4 * 5;
   std::map<thrust::host_vector<T>, size_t, vector_compare> permutation_counts;
   Vector sequence(m);
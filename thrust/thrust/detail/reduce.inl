@@ -21,23 +21,31 @@
 // Include all active backend system implementations (generic, sequential, host and device)
 #include <thrust/system/detail/generic/reduce.h>
 #include <thrust/system/detail/generic/reduce_by_key.h>
+#include <thrust/system/detail/generic/reduce_by_key_unordered.h>
 #include <thrust/system/detail/sequential/reduce.h>
 #include <thrust/system/detail/sequential/reduce_by_key.h>
+#include <thrust/system/detail/sequential/reduce_by_key_unordered.h>
 #include __THRUST_HOST_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(reduce.h)
 #include __THRUST_DEVICE_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(reduce.h)
 #include __THRUST_HOST_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(reduce_by_key.h)
 #include __THRUST_DEVICE_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(reduce_by_key.h)
+#include __THRUST_HOST_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(reduce_by_key_unordered.h)
+#include __THRUST_DEVICE_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(reduce_by_key_unordered.h)
 
 // Some build systems need a hint to know which files we could include
 #if 0
 #  include <thrust/system/cpp/detail/reduce.h>
 #  include <thrust/system/cpp/detail/reduce_by_key.h>
+#  include <thrust/system/cpp/detail/reduce_by_key_unordered.h>
 #  include <thrust/system/cuda/detail/reduce.h>
 #  include <thrust/system/cuda/detail/reduce_by_key.h>
+#  include <thrust/system/cuda/detail/reduce_by_key_unordered.h>
 #  include <thrust/system/omp/detail/reduce.h>
 #  include <thrust/system/omp/detail/reduce_by_key.h>
+#  include <thrust/system/omp/detail/reduce_by_key_unordered.h>
 #  include <thrust/system/tbb/detail/reduce.h>
 #  include <thrust/system/tbb/detail/reduce_by_key.h>
+#  include <thrust/system/tbb/detail/reduce_by_key_unordered.h>
 #endif
 
 THRUST_NAMESPACE_BEGIN
@@ -380,4 +388,188 @@ template <typename InputIterator1,
     binary_op);
 }
 
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> reduce_by_key_unordered(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::reduce_by_key_unordered");
+  using thrust::system::detail::generic::reduce_by_key_unordered;
+  return reduce_by_key_unordered(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    keys_first,
+    keys_last,
+    values_first,
+    keys_output,
+    values_output);
+} // end reduce_by_key_unordered()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> reduce_by_key_unordered(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::reduce_by_key_unordered");
+  using thrust::system::detail::generic::reduce_by_key_unordered;
+  return reduce_by_key_unordered(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    keys_first,
+    keys_last,
+    values_first,
+    keys_output,
+    values_output,
+    binary_pred);
+} // end reduce_by_key_unordered()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> reduce_by_key_unordered(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::reduce_by_key_unordered");
+  using thrust::system::detail::generic::reduce_by_key_unordered;
+  return reduce_by_key_unordered(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    keys_first,
+    keys_last,
+    values_first,
+    keys_output,
+    values_output,
+    binary_pred,
+    binary_op);
+} // end reduce_by_key_unordered()
+
+template <typename InputIterator1, typename InputIterator2, typename OutputIterator1, typename OutputIterator2>
+::cuda::std::pair<OutputIterator1, OutputIterator2> reduce_by_key_unordered(
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::reduce_by_key_unordered");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<InputIterator1>::type;
+  using System2 = typename thrust::iterator_system<InputIterator2>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator1>::type;
+  using System4 = typename thrust::iterator_system<OutputIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+
+  return thrust::reduce_by_key_unordered(
+    select_system(system1, system2, system3, system4), keys_first, keys_last, values_first, keys_output, values_output);
+}
+
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+::cuda::std::pair<OutputIterator1, OutputIterator2> reduce_by_key_unordered(
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::reduce_by_key_unordered");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<InputIterator1>::type;
+  using System2 = typename thrust::iterator_system<InputIterator2>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator1>::type;
+  using System4 = typename thrust::iterator_system<OutputIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+
+  return thrust::reduce_by_key_unordered(
+    select_system(system1, system2, system3, system4),
+    keys_first,
+    keys_last,
+    values_first,
+    keys_output,
+    values_output,
+    binary_pred);
+}
+
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+::cuda::std::pair<OutputIterator1, OutputIterator2> reduce_by_key_unordered(
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::reduce_by_key_unordered");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<InputIterator1>::type;
+  using System2 = typename thrust::iterator_system<InputIterator2>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator1>::type;
+  using System4 = typename thrust::iterator_system<OutputIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+
+  return thrust::reduce_by_key_unordered(
+    select_system(system1, system2, system3, system4),
+    keys_first,
+    keys_last,
+    values_first,
+    keys_output,
+    values_output,
+    binary_pred,
+    binary_op);
+}
+
 THRUST_NAMESPACE_END
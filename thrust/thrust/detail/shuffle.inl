@@ -15,7 +15,20 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/shuffle.h>
 #include <thrust/system/detail/generic/select_system.h>
+
+// Include all active backend system implementations (generic, sequential, host and device)
 #include <thrust/system/detail/generic/shuffle.h>
+#include <thrust/system/detail/sequential/shuffle.h>
+#include __THRUST_HOST_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(shuffle.h)
+#include __THRUST_DEVICE_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(shuffle.h)
+
+// Some build systems need a hint to know which files we could include
+#if 0
+#  include <thrust/system/cpp/detail/shuffle.h>
+#  include <thrust/system/cuda/detail/shuffle.h>
+#  include <thrust/system/omp/detail/shuffle.h>
+#  include <thrust/system/tbb/detail/shuffle.h>
+#endif
 
 THRUST_NAMESPACE_BEGIN
 
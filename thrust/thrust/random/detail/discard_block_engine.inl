@@ -15,6 +15,8 @@
 
 #include <thrust/random/discard_block_engine.h>
 
+#include <cuda/std/__algorithm/min.h>
+
 THRUST_NAMESPACE_BEGIN
 
 namespace random
@@ -71,13 +73,48 @@ discard_block_engine<Engine, p, r>::operator()()
 template <typename Engine, size_t p, size_t r>
 _CCCL_HOST_DEVICE void discard_block_engine<Engine, p, r>::discard(unsigned long long z)
 {
-  // XXX this should be accelerated
-  for (; z > 0; --z)
+  // consume what is left of the current block
+  const unsigned long long remaining = used_block - m_n;
+  if (z <= remaining)
+  {
+    m_e.discard(z);
+    m_n += static_cast<unsigned int>(z);
+    return;
+  }
+
+  m_e.discard(remaining);
+  z -= remaining;
+
+  // each further block of used_block results advances the base engine by block_size values
+  unsigned long long blocks = z / used_block;
+  const unsigned int rest   = static_cast<unsigned int>(z % used_block);
+  while (blocks > 0)
+  {
+    const unsigned long long chunk = ::cuda::std::min(blocks, ~0ull / block_size);
+    m_e.discard(chunk * block_size);
+    blocks -= chunk;
+  }
+
+  if (rest > 0)
   {
-    this->operator()();
-  } // end for
+    m_e.discard(block_size - used_block + rest);
+  }
+  m_n = rest > 0 ? rest : static_cast<unsigned int>(used_block);
 }
 
+template <typename Engine, size_t p, size_t r>
+template <typename ForwardIterator>
+_CCCL_HOST_DEVICE void discard_block_engine<Engine, p, r>::generate(ForwardIterator first, ForwardIterator last)
+{
+  // work on a local copy so that stores through the output cannot alias the state
+  discard_block_engine e = *this;
+  for (; first != last; ++first)
+  {
+    *first = e();
+  }
+  *this = e;
+} // end discard_block_engine::generate()
+
 template <typename Engine, size_t p, size_t r>
 _CCCL_HOST_DEVICE const typename discard_block_engine<Engine, p, r>::base_type&
 discard_block_engine<Engine, p, r>::base() const
@@ -54,6 +54,15 @@ _CCCL_HOST_DEVICE void linear_congruential_engine<UIntType, a, c, m>::discard(un
   thrust::random::detail::linear_congruential_engine_discard::discard(*this, z);
 } // end linear_congruential_engine::discard()
 
+template <typename UIntType, UIntType a, UIntType c, UIntType m>
+template <typename ForwardIterator>
+_CCCL_HOST_DEVICE void
+linear_congruential_engine<UIntType, a, c, m>::generate(ForwardIterator first, ForwardIterator last)
+{
+  thrust::random::detail::linear_congruential_engine_generate_implementation<UIntType, a, c, m>::generate(
+    m_x, first, last);
+} // end linear_congruential_engine::generate()
+
 template <typename UIntType, UIntType a, UIntType c, UIntType m>
 template <typename CharT, typename Traits>
 std::basic_ostream<CharT, Traits>&
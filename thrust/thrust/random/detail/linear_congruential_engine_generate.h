@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/random/detail/mod.h>
+
+#include <cuda/std/cstdint>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random::detail
+{
+template <typename UIntType, UIntType a, unsigned long long c, UIntType m>
+struct linear_congruential_engine_generate_implementation
+{
+  template <typename ForwardIterator>
+  _CCCL_HOST_DEVICE static void generate(UIntType& state, ForwardIterator first, ForwardIterator last)
+  {
+    UIntType x = state;
+    for (; first != last; ++first)
+    {
+      x      = detail::mod<UIntType, a, c, m>(x);
+      *first = x;
+    }
+    state = x;
+  }
+}; // end linear_congruential_engine_generate_implementation
+
+// specialize for small integers and c == 0
+// x_{n+j} = a^j * x_n mod m, so a block of consecutive values is a set of independent multiplies of the same state
+// rather than one serial chain of modular multiplications, which lets the compiler pipeline or vectorize them
+template <std::uint32_t a, std::uint32_t m>
+struct linear_congruential_engine_generate_implementation<std::uint32_t, a, 0, m>
+{
+  static constexpr int lanes                  = 8;
+  static constexpr unsigned long long modulus = m == 0 ? (1ull << 32) : m;
+
+  template <typename ForwardIterator>
+  _CCCL_HOST_DEVICE static void generate(std::uint32_t& state, ForwardIterator first, ForwardIterator last)
+  {
+    unsigned long long multiplier[lanes];
+    multiplier[0] = a % modulus;
+    for (int j = 1; j < lanes; ++j)
+    {
+      multiplier[j] = (multiplier[j - 1] * a) % modulus;
+    }
+
+    std::uint32_t x = state;
+    std::uint32_t block[lanes];
+    while (first != last)
+    {
+      for (int j = 0; j < lanes; ++j)
+      {
+        block[j] = static_cast<std::uint32_t>((multiplier[j] * x) % modulus);
+      }
+
+      int j = 0;
+      for (; j < lanes && first != last; ++j, ++first)
+      {
+        *first = block[j];
+      }
+      x = block[j - 1];
+    }
+    state = x;
+  }
+}; // end linear_congruential_engine_generate_implementation
+} // namespace random::detail
+
+THRUST_NAMESPACE_END
@@ -44,12 +44,23 @@ linear_feedback_shift_engine<UIntType, w, k, q, s>::operator()()
 template <typename UIntType, size_t w, size_t k, size_t q, size_t s>
 _CCCL_HOST_DEVICE void linear_feedback_shift_engine<UIntType, w, k, q, s>::discard(unsigned long long z)
 {
-  for (; z > 0; --z)
-  {
-    this->operator()();
-  } // end for
+  thrust::random::detail::linear_feedback_shift_engine_discard::discard(*this, z);
 } // end linear_feedback_shift_engine::discard()
 
+template <typename UIntType, size_t w, size_t k, size_t q, size_t s>
+template <typename ForwardIterator>
+_CCCL_HOST_DEVICE void
+linear_feedback_shift_engine<UIntType, w, k, q, s>::generate(ForwardIterator first, ForwardIterator last)
+{
+  // work on a local copy so that stores through the output cannot alias the state
+  linear_feedback_shift_engine e = *this;
+  for (; first != last; ++first)
+  {
+    *first = e();
+  }
+  *this = e;
+} // end linear_feedback_shift_engine::generate()
+
 template <typename UIntType, size_t w, size_t k, size_t q, size_t s>
 template <typename CharT, typename Traits>
 std::basic_ostream<CharT, Traits>&
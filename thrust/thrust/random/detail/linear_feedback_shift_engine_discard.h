@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/cstddef>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random::detail
+{
+// A w x w matrix over GF(2), stored by columns: column j is the image of the j-th unit vector.
+template <typename UIntType, ::cuda::std::size_t w>
+struct gf2_matrix
+{
+  UIntType column[w];
+
+  _CCCL_HOST_DEVICE UIntType apply(UIntType v) const
+  {
+    UIntType result = 0;
+    for (::cuda::std::size_t j = 0; j < w; ++j, v >>= 1)
+    {
+      result ^= column[j] & (UIntType(0) - (v & 1u));
+    }
+    return result;
+  }
+
+  _CCCL_HOST_DEVICE void square()
+  {
+    const gf2_matrix tmp = *this;
+    for (::cuda::std::size_t j = 0; j < w; ++j)
+    {
+      column[j] = tmp.apply(tmp.column[j]);
+    }
+  }
+}; // end gf2_matrix
+
+struct linear_feedback_shift_engine_discard
+{
+  // The transition of a linear_feedback_shift_engine only shifts, masks and xors its state, so it is a linear map
+  // over GF(2). Advancing by z steps multiplies the state by the z-th power of the transition matrix, which takes
+  // O(w^2 log z) operations by repeated squaring.
+  template <typename LinearFeedbackShiftEngine>
+  _CCCL_HOST_DEVICE static void discard(LinearFeedbackShiftEngine& lfsr, unsigned long long z)
+  {
+    using result_type                  = typename LinearFeedbackShiftEngine::result_type;
+    constexpr ::cuda::std::size_t w    = LinearFeedbackShiftEngine::word_size;
+    constexpr unsigned long long small = 2 * w;
+
+    if (z <= small)
+    {
+      for (; z > 0; --z)
+      {
+        lfsr();
+      }
+      return;
+    }
+
+    // the first step drops any seeded bits above the word size, after which the state fits the w x w matrix
+    lfsr();
+    --z;
+
+    gf2_matrix<result_type, w> transition;
+    for (::cuda::std::size_t j = 0; j < w; ++j)
+    {
+      LinearFeedbackShiftEngine unit(result_type(1) << j);
+      transition.column[j] = unit();
+    }
+
+    result_type state = lfsr.m_value;
+    while (true)
+    {
+      if (z & 1)
+      {
+        state = transition.apply(state);
+      }
+
+      z >>= 1;
+      if (z == 0)
+      {
+        break;
+      }
+
+      transition.square();
+    }
+
+    lfsr.m_value = state;
+  }
+}; // end linear_feedback_shift_engine_discard
+} // namespace random::detail
+
+THRUST_NAMESPACE_END
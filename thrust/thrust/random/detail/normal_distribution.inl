@@ -57,6 +57,22 @@ normal_distribution<RealType>::operator()(UniformRandomNumberGenerator& urng, co
   return super_t::sample(urng, parm.first, parm.second);
 } // end normal_distribution::operator()()
 
+template <typename RealType>
+template <typename ForwardIterator, typename UniformRandomNumberGenerator>
+_CCCL_HOST_DEVICE void
+normal_distribution<RealType>::generate(ForwardIterator first, ForwardIterator last, UniformRandomNumberGenerator& urng)
+{
+  generate(first, last, urng, m_param);
+} // end normal_distribution::generate()
+
+template <typename RealType>
+template <typename ForwardIterator, typename UniformRandomNumberGenerator>
+_CCCL_HOST_DEVICE void normal_distribution<RealType>::generate(
+  ForwardIterator first, ForwardIterator last, UniformRandomNumberGenerator& urng, const param_type& parm)
+{
+  super_t::generate_samples(first, last, urng, parm.first, parm.second);
+} // end normal_distribution::generate()
+
 template <typename RealType>
 _CCCL_HOST_DEVICE typename normal_distribution<RealType>::param_type normal_distribution<RealType>::param() const
 {
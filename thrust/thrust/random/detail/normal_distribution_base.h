@@ -68,6 +68,20 @@ protected:
     return mean + stddev * S3 * erfcinv(2 * p);
   }
 
+  template <typename ForwardIterator, typename UniformRandomNumberGenerator>
+  _CCCL_HOST_DEVICE void generate_samples(
+    ForwardIterator first,
+    ForwardIterator last,
+    UniformRandomNumberGenerator& urng,
+    const RealType mean,
+    const RealType stddev)
+  {
+    for (; first != last; ++first)
+    {
+      *first = sample(urng, mean, stddev);
+    }
+  }
+
   // no-op
   _CCCL_HOST_DEVICE void reset() {}
 };
@@ -115,6 +129,68 @@ protected:
     return mean + stddev * result;
   }
 
+  // produces the same values as repeated calls to sample(), but keeps both halves of every pair and evaluates the
+  // transcendental functions for a whole block of pairs at once
+  template <typename ForwardIterator, typename UniformRandomNumberGenerator>
+  _CCCL_HOST_DEVICE void generate_samples(
+    ForwardIterator first,
+    ForwardIterator last,
+    UniformRandomNumberGenerator& urng,
+    const RealType mean,
+    const RealType stddev)
+  {
+    using ::cuda::std::cos;
+    using ::cuda::std::log;
+    using ::cuda::std::sin;
+    using ::cuda::std::sqrt;
+
+    constexpr int pairs_per_block = 32;
+    constexpr auto pi             = ::cuda::std::__numbers<RealType>::__pi();
+
+    // hand out the second half of a pair left over by a previous call
+    if (m_valid && first != last)
+    {
+      *first = sample(urng, mean, stddev);
+      ++first;
+    }
+
+    RealType uniform[2 * pairs_per_block];
+    RealType block[2 * pairs_per_block];
+    while (first != last)
+    {
+      int n = 0;
+      for (ForwardIterator it = first; n < 2 * pairs_per_block && it != last; ++it)
+      {
+        ++n;
+      }
+
+      const int pairs = n / 2;
+      if (pairs == 0)
+      {
+        // a single value left: draw a new pair and keep its second half for later
+        *first = sample(urng, mean, stddev);
+        return;
+      }
+
+      uniform_real_distribution<RealType> u01;
+      u01.generate(uniform, uniform + 2 * pairs, urng);
+      for (int i = 0; i < pairs; ++i)
+      {
+        const RealType r1  = uniform[2 * i];
+        const RealType r2  = uniform[2 * i + 1];
+        const RealType rho = sqrt(-RealType(2) * log(RealType(1) - r2));
+
+        block[2 * i]     = mean + stddev * (rho * cos(RealType(2) * pi * r1));
+        block[2 * i + 1] = mean + stddev * (rho * sin(RealType(2) * pi * r1));
+      }
+
+      for (int i = 0; i < 2 * pairs; ++i, ++first)
+      {
+        *first = block[i];
+      }
+    }
+  }
+
 private:
   RealType m_r1{}, m_r2{}, m_cached_rho{};
   bool m_valid{false};
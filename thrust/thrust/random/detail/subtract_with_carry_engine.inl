@@ -80,12 +80,23 @@ subtract_with_carry_engine<UIntType, w, s, r>::operator()()
 template <typename UIntType, size_t w, size_t s, size_t r>
 _CCCL_HOST_DEVICE void subtract_with_carry_engine<UIntType, w, s, r>::discard(unsigned long long z)
 {
-  for (; z > 0; --z)
-  {
-    this->operator()();
-  } // end for
+  thrust::random::detail::subtract_with_carry_engine_discard::discard(*this, z);
 } // end subtract_with_carry_engine::discard()
 
+template <typename UIntType, size_t w, size_t s, size_t r>
+template <typename ForwardIterator>
+_CCCL_HOST_DEVICE void
+subtract_with_carry_engine<UIntType, w, s, r>::generate(ForwardIterator first, ForwardIterator last)
+{
+  // work on a local copy so that stores through the output cannot alias the state
+  subtract_with_carry_engine e = *this;
+  for (; first != last; ++first)
+  {
+    *first = e();
+  }
+  *this = e;
+} // end subtract_with_carry_engine::generate()
+
 template <typename UIntType, size_t w, size_t s, size_t r>
 template <typename CharT, typename Traits>
 std::basic_ostream<CharT, Traits>&
@@ -0,0 +1,348 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random::detail
+{
+// Fixed capacity unsigned integer made of little-endian 32-bit limbs. Only the handful of operations needed for
+// modular exponentiation are provided.
+template <::cuda::std::size_t Limbs>
+struct multiprecision_uint
+{
+  static constexpr ::cuda::std::size_t limb_bits = 32;
+
+  ::cuda::std::uint32_t limb[Limbs];
+
+  _CCCL_HOST_DEVICE multiprecision_uint()
+  {
+    for (::cuda::std::size_t i = 0; i < Limbs; ++i)
+    {
+      limb[i] = 0;
+    }
+  }
+
+  // ors `value` into the bits starting at `offset`
+  _CCCL_HOST_DEVICE void set_bits(::cuda::std::size_t offset, ::cuda::std::uint64_t value)
+  {
+    ::cuda::std::size_t i = offset / limb_bits;
+    unsigned shift        = offset % limb_bits;
+    for (; value != 0 && i < Limbs; ++i)
+    {
+      limb[i] |= static_cast<::cuda::std::uint32_t>(value << shift);
+      value = shift == 0 ? value >> limb_bits : value >> (limb_bits - shift);
+      shift = 0;
+    }
+  }
+
+  // returns bits [offset, offset + width), width <= 64
+  _CCCL_HOST_DEVICE ::cuda::std::uint64_t get_bits(::cuda::std::size_t offset, ::cuda::std::size_t width) const
+  {
+    ::cuda::std::uint64_t result = 0;
+    for (::cuda::std::size_t bit = 0; bit < width;)
+    {
+      const ::cuda::std::size_t i = (offset + bit) / limb_bits;
+      const unsigned shift        = (offset + bit) % limb_bits;
+      if (i >= Limbs)
+      {
+        break;
+      }
+      result |= static_cast<::cuda::std::uint64_t>(limb[i] >> shift) << bit;
+      bit += limb_bits - shift;
+    }
+    return width < 64 ? result & ((::cuda::std::uint64_t(1) << width) - 1) : result;
+  }
+
+  _CCCL_HOST_DEVICE bool is_zero() const
+  {
+    for (::cuda::std::size_t i = 0; i < Limbs; ++i)
+    {
+      if (limb[i] != 0)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  _CCCL_HOST_DEVICE friend bool operator<(const multiprecision_uint& lhs, const multiprecision_uint& rhs)
+  {
+    for (::cuda::std::size_t i = Limbs; i-- > 0;)
+    {
+      if (lhs.limb[i] != rhs.limb[i])
+      {
+        return lhs.limb[i] < rhs.limb[i];
+      }
+    }
+    return false;
+  }
+
+  _CCCL_HOST_DEVICE friend bool operator==(const multiprecision_uint& lhs, const multiprecision_uint& rhs)
+  {
+    for (::cuda::std::size_t i = 0; i < Limbs; ++i)
+    {
+      if (lhs.limb[i] != rhs.limb[i])
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  _CCCL_HOST_DEVICE multiprecision_uint& operator+=(const multiprecision_uint& rhs)
+  {
+    ::cuda::std::uint64_t carry = 0;
+    for (::cuda::std::size_t i = 0; i < Limbs; ++i)
+    {
+      carry += static_cast<::cuda::std::uint64_t>(limb[i]) + rhs.limb[i];
+      limb[i] = static_cast<::cuda::std::uint32_t>(carry);
+      carry >>= limb_bits;
+    }
+    return *this;
+  }
+
+  // requires *this >= rhs
+  _CCCL_HOST_DEVICE multiprecision_uint& operator-=(const multiprecision_uint& rhs)
+  {
+    ::cuda::std::uint64_t borrow = 0;
+    for (::cuda::std::size_t i = 0; i < Limbs; ++i)
+    {
+      const ::cuda::std::uint64_t d = static_cast<::cuda::std::uint64_t>(limb[i]) - rhs.limb[i] - borrow;
+      limb[i]                       = static_cast<::cuda::std::uint32_t>(d);
+      borrow                        = (d >> limb_bits) & 1;
+    }
+    return *this;
+  }
+
+  _CCCL_HOST_DEVICE multiprecision_uint operator<<(::cuda::std::size_t bits) const
+  {
+    multiprecision_uint result;
+    const ::cuda::std::size_t limbs = bits / limb_bits;
+    const unsigned shift            = bits % limb_bits;
+    for (::cuda::std::size_t i = Limbs; i-- > limbs;)
+    {
+      ::cuda::std::uint64_t v = static_cast<::cuda::std::uint64_t>(limb[i - limbs]) << shift;
+      if (shift != 0 && i > limbs)
+      {
+        v |= limb[i - limbs - 1] >> (limb_bits - shift);
+      }
+      result.limb[i] = static_cast<::cuda::std::uint32_t>(v);
+    }
+    return result;
+  }
+
+  _CCCL_HOST_DEVICE multiprecision_uint operator>>(::cuda::std::size_t bits) const
+  {
+    multiprecision_uint result;
+    const ::cuda::std::size_t limbs = bits / limb_bits;
+    const unsigned shift            = bits % limb_bits;
+    for (::cuda::std::size_t i = 0; i + limbs < Limbs; ++i)
+    {
+      ::cuda::std::uint64_t v = limb[i + limbs] >> shift;
+      if (shift != 0 && i + limbs + 1 < Limbs)
+      {
+        v |= static_cast<::cuda::std::uint64_t>(limb[i + limbs + 1]) << (limb_bits - shift);
+      }
+      result.limb[i] = static_cast<::cuda::std::uint32_t>(v);
+    }
+    return result;
+  }
+
+  // keeps only the low `bits` bits
+  _CCCL_HOST_DEVICE void truncate(::cuda::std::size_t bits)
+  {
+    for (::cuda::std::size_t i = 0; i < Limbs; ++i)
+    {
+      if ((i + 1) * limb_bits <= bits)
+      {
+        continue;
+      }
+      limb[i] = i * limb_bits >= bits ? 0u : limb[i] & ((::cuda::std::uint32_t(1) << (bits - i * limb_bits)) - 1u);
+    }
+  }
+
+  // the product is truncated to Limbs limbs
+  _CCCL_HOST_DEVICE friend multiprecision_uint operator*(const multiprecision_uint& lhs, const multiprecision_uint& rhs)
+  {
+    multiprecision_uint result;
+    for (::cuda::std::size_t i = 0; i < Limbs; ++i)
+    {
+      if (lhs.limb[i] == 0)
+      {
+        continue;
+      }
+      ::cuda::std::uint64_t carry = 0;
+      for (::cuda::std::size_t j = 0; i + j < Limbs; ++j)
+      {
+        carry += static_cast<::cuda::std::uint64_t>(lhs.limb[i]) * rhs.limb[j] + result.limb[i + j];
+        result.limb[i + j] = static_cast<::cuda::std::uint32_t>(carry);
+        carry >>= limb_bits;
+      }
+    }
+    return result;
+  }
+}; // end multiprecision_uint
+
+// Advances a subtract_with_carry_engine by jumping through its equivalent linear congruential generator.
+//
+// With b = 2^w, the borrow sequence x_n = (x_{n-s} - x_{n-r} - c_{n-1}) mod b is the base-b expansion, read
+// backwards, of S_n / m with m = b^r - b^s + 1 (Marsaglia & Zaman, "A new class of random number generators", 1991).
+// The integer S_n = A - floor(A / b^(r-s)) + c_{n-1}, where A holds the lag buffer as base-b digits with the oldest
+// value least significant, evolves as S_{n+1} = b^-1 S_n mod m. Jumping z steps therefore costs one modular
+// exponentiation, after which the r newest digits and the carry are read back from the expansion.
+template <typename UIntType, ::cuda::std::size_t w, ::cuda::std::size_t s, ::cuda::std::size_t r>
+struct subtract_with_carry_engine_discard_implementation
+{
+  // room for the full product of two residues modulo m plus the bits shifted in during reduction
+  static constexpr ::cuda::std::size_t state_bits = r * w;
+  static constexpr ::cuda::std::size_t limbs      = (2 * state_bits + w) / 32 + 2;
+
+  using number = multiprecision_uint<limbs>;
+
+  _CCCL_HOST_DEVICE static number modulus()
+  {
+    // b^r - b^s + 1
+    number m;
+    m.set_bits(state_bits, 1);
+    number bs;
+    bs.set_bits(s * w, 1);
+    m -= bs;
+    number one;
+    one.set_bits(0, 1);
+    m += one;
+    return m;
+  }
+
+  _CCCL_HOST_DEVICE static void reduce(number& x, const number& m)
+  {
+    // b^r = b^s - 1 (mod m), so the digits above b^r fold back onto the low part
+    while (!(x >> state_bits).is_zero())
+    {
+      const number high = x >> state_bits;
+      x.truncate(state_bits);
+      x += high << (s * w);
+      x -= high;
+    }
+    while (!(x < m))
+    {
+      x -= m;
+    }
+  }
+
+  _CCCL_HOST_DEVICE static void discard(UIntType (&x)[r], unsigned int& index, int& borrow, unsigned long long z)
+  {
+    const number m = modulus();
+
+    number state;
+    for (::cuda::std::size_t j = 0; j < r; ++j)
+    {
+      state.set_bits(j * w, x[(index + j) % r]);
+    }
+    const number high = state >> ((r - s) * w);
+    state -= high;
+    number carry;
+    carry.set_bits(0, static_cast<::cuda::std::uint64_t>(borrow));
+    state += carry;
+
+    const unsigned int k = static_cast<unsigned int>((index + z % r) % r);
+    if (state == m)
+    {
+      // the only state this maps to m is a fixed point of the recurrence
+      index = k;
+      return;
+    }
+
+    // multiplier = b^-1 mod m = m - (b^(r-1) - b^(s-1))
+    number multiplier = m;
+    number quotient;
+    quotient.set_bits((r - 1) * w, 1);
+    number low;
+    low.set_bits((s - 1) * w, 1);
+    quotient -= low;
+    multiplier -= quotient;
+
+    for (; z > 0; z >>= 1)
+    {
+      if (z & 1)
+      {
+        state = state * multiplier;
+        reduce(state, m);
+      }
+      if (z > 1)
+      {
+        multiplier = multiplier * multiplier;
+        reduce(multiplier, m);
+      }
+    }
+
+    // the newest value is the leading digit of state / m
+    number digits;
+    number remainder = state;
+    for (::cuda::std::size_t j = r; j-- > 0;)
+    {
+      const number shifted     = remainder << w;
+      ::cuda::std::uint64_t xj = shifted.get_bits(state_bits, w);
+      number estimate;
+      estimate.set_bits(0, xj);
+      remainder = shifted;
+      remainder -= estimate * m;
+      while (!(remainder < m))
+      {
+        remainder -= m;
+        ++xj;
+      }
+      digits.set_bits(j * w, xj);
+      x[(k + j) % r] = static_cast<UIntType>(xj);
+    }
+
+    // recover the carry from S = A - floor(A / b^(r-s)) + c
+    number without_carry = digits;
+    without_carry -= digits >> ((r - s) * w);
+    state -= without_carry;
+
+    borrow = static_cast<int>(state.get_bits(0, 1));
+    index  = k;
+  }
+}; // end subtract_with_carry_engine_discard_implementation
+
+struct subtract_with_carry_engine_discard
+{
+  template <typename SubtractWithCarryEngine>
+  _CCCL_HOST_DEVICE static void discard(SubtractWithCarryEngine& swc, unsigned long long z)
+  {
+    constexpr ::cuda::std::size_t w = SubtractWithCarryEngine::word_size;
+    constexpr ::cuda::std::size_t s = SubtractWithCarryEngine::short_lag;
+    constexpr ::cuda::std::size_t r = SubtractWithCarryEngine::long_lag;
+
+    // the jump is only valid once every lag slot holds a generated value, and short jumps are cheaper to step
+    if (z < 16 * r)
+    {
+      for (; z > 0; --z)
+      {
+        swc();
+      }
+      return;
+    }
+
+    subtract_with_carry_engine_discard_implementation<typename SubtractWithCarryEngine::result_type, w, s, r>::discard(
+      swc.m_x, swc.m_k, swc.m_carry, z);
+  }
+}; // end subtract_with_carry_engine_discard
+} // namespace random::detail
+
+THRUST_NAMESPACE_END
@@ -64,6 +64,46 @@ uniform_int_distribution<IntType>::operator()(UniformRandomNumberGenerator& urng
   return static_cast<result_type>(real_dist(urng));
 } // end uniform_int_distribution::operator()()
 
+template <typename IntType>
+template <typename ForwardIterator, typename UniformRandomNumberGenerator>
+_CCCL_HOST_DEVICE void uniform_int_distribution<IntType>::generate(
+  ForwardIterator first, ForwardIterator last, UniformRandomNumberGenerator& urng)
+{
+  generate(first, last, urng, m_param);
+} // end uniform_int_distribution::generate()
+
+template <typename IntType>
+template <typename ForwardIterator, typename UniformRandomNumberGenerator>
+_CCCL_HOST_DEVICE void uniform_int_distribution<IntType>::generate(
+  ForwardIterator first, ForwardIterator last, UniformRandomNumberGenerator& urng, const param_type& parm)
+{
+  using float_type = typename thrust::detail::largest_available_float::type;
+  constexpr int bs = 64;
+
+  const float_type real_min(static_cast<float_type>(parm.first));
+  const float_type real_max(static_cast<float_type>(parm.second));
+
+  // same construction as operator()
+  uniform_real_distribution<float_type> real_dist(real_min, real_max + float_type(1));
+
+  float_type block[bs];
+  while (first != last)
+  {
+    int n = 0;
+    for (ForwardIterator it = first; n < bs && it != last; ++it)
+    {
+      ++n;
+    }
+
+    real_dist.generate(block, block + n, urng);
+
+    for (int i = 0; i < n; ++i, ++first)
+    {
+      *first = static_cast<result_type>(block[i]);
+    }
+  }
+} // end uniform_int_distribution::generate()
+
 template <typename IntType>
 _CCCL_HOST_DEVICE typename uniform_int_distribution<IntType>::result_type uniform_int_distribution<IntType>::a() const
 {
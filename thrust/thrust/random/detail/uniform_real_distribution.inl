@@ -64,6 +64,52 @@ uniform_real_distribution<RealType>::operator()(UniformRandomNumberGenerator& ur
   return ::cuda::std::lerp(parm.first, parm.second, result);
 } // end uniform_real::operator()()
 
+template <typename RealType>
+template <typename ForwardIterator, typename UniformRandomNumberGenerator>
+_CCCL_HOST_DEVICE void uniform_real_distribution<RealType>::generate(
+  ForwardIterator first, ForwardIterator last, UniformRandomNumberGenerator& urng)
+{
+  generate(first, last, urng, m_param);
+} // end uniform_real::generate()
+
+template <typename RealType>
+template <typename ForwardIterator, typename UniformRandomNumberGenerator>
+_CCCL_HOST_DEVICE void uniform_real_distribution<RealType>::generate(
+  ForwardIterator first, ForwardIterator last, UniformRandomNumberGenerator& urng, const param_type& parm)
+{
+  using traits     = thrust::random::detail::urng_traits<UniformRandomNumberGenerator>;
+  using uint_type  = typename UniformRandomNumberGenerator::result_type;
+  constexpr int bs = 64;
+
+  // same mapping as operator(), hoisted out of the loop
+  const result_type denominator = result_type(1) + static_cast<result_type>((traits::max) () - (traits::min) ());
+
+  uint_type raw[bs];
+  result_type block[bs];
+  while (first != last)
+  {
+    int n = 0;
+    for (ForwardIterator it = first; n < bs && it != last; ++it)
+    {
+      ++n;
+    }
+
+    // the generator runs serially, the conversion has no dependencies between elements
+    thrust::random::detail::urng_generate(urng, raw, raw + n);
+    for (int i = 0; i < n; ++i)
+    {
+      result_type result = static_cast<result_type>(raw[i] - (traits::min) ());
+      result /= denominator;
+      block[i] = ::cuda::std::lerp(parm.first, parm.second, result);
+    }
+
+    for (int i = 0; i < n; ++i, ++first)
+    {
+      *first = block[i];
+    }
+  }
+} // end uniform_real::generate()
+
 template <typename RealType>
 _CCCL_HOST_DEVICE typename uniform_real_distribution<RealType>::result_type
 uniform_real_distribution<RealType>::a() const
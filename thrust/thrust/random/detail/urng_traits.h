@@ -15,6 +15,8 @@
 
 #include <cuda/std/__type_traits/enable_if.h>
 #include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/__type_traits/void_t.h>
+#include <cuda/std/__utility/declval.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -82,6 +84,35 @@ struct urng_traits
     return uniform_random_number_generator_max<UniformRandomNumberGenerator>();
   }
 };
+
+template <typename UniformRandomNumberGenerator, typename = void>
+inline constexpr bool has_generate_member_v = false;
+
+template <typename UniformRandomNumberGenerator>
+inline constexpr bool has_generate_member_v<
+  UniformRandomNumberGenerator,
+  ::cuda::std::void_t<decltype(::cuda::std::declval<UniformRandomNumberGenerator&>().generate(
+    ::cuda::std::declval<urng_result_t<UniformRandomNumberGenerator>*>(),
+    ::cuda::std::declval<urng_result_t<UniformRandomNumberGenerator>*>()))>> = true;
+
+// fills [first, last) with consecutive results of urng, through its bulk generate member when it provides one
+template <typename UniformRandomNumberGenerator>
+_CCCL_HOST_DEVICE void urng_generate(UniformRandomNumberGenerator& urng,
+                                     urng_result_t<UniformRandomNumberGenerator>* first,
+                                     urng_result_t<UniformRandomNumberGenerator>* last)
+{
+  if constexpr (has_generate_member_v<UniformRandomNumberGenerator>)
+  {
+    urng.generate(first, last);
+  }
+  else
+  {
+    for (; first != last; ++first)
+    {
+      *first = urng();
+    }
+  }
+}
 } // namespace random::detail
 
 THRUST_NAMESPACE_END
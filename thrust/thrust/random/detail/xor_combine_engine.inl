@@ -77,12 +77,25 @@ xor_combine_engine<Engine1, s1, Engine2, s2>::operator()()
 template <typename Engine1, size_t s1, typename Engine2, size_t s2>
 _CCCL_HOST_DEVICE void xor_combine_engine<Engine1, s1, Engine2, s2>::discard(unsigned long long z)
 {
-  for (; z > 0; --z)
-  {
-    this->operator()();
-  } // end for
+  // each result consumes exactly one value from either base engine
+  m_b1.discard(z);
+  m_b2.discard(z);
 } // end xor_combine_engine::discard()
 
+template <typename Engine1, size_t s1, typename Engine2, size_t s2>
+template <typename ForwardIterator>
+_CCCL_HOST_DEVICE void
+xor_combine_engine<Engine1, s1, Engine2, s2>::generate(ForwardIterator first, ForwardIterator last)
+{
+  // work on a local copy so that stores through the output cannot alias the state
+  xor_combine_engine e = *this;
+  for (; first != last; ++first)
+  {
+    *first = e();
+  }
+  *this = e;
+} // end xor_combine_engine::generate()
+
 template <typename Engine1, size_t s1, typename Engine2, size_t s2>
 template <typename CharT, typename Traits>
 std::basic_ostream<CharT, Traits>&
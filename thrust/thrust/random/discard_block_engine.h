@@ -144,10 +144,21 @@ public:
    *  and discards the results.
    *
    *  \param z The number of random values to discard.
-   *  \note This function is provided because an implementation may be able to accelerate it.
+   *  \note The base engine is advanced in a single call per block boundary, so this is as fast as the base
+   *        engine's \p discard.
    */
   _CCCL_HOST_DEVICE void discard(unsigned long long z);
 
+  /*! This member function fills a range with consecutive random values and updates this \p discard_block_engine's
+   *  state as if <tt>operator()</tt> had been called once per element.
+   *
+   *  \param first The beginning of the range to fill.
+   *  \param last The end of the range to fill.
+   *  \note This function is provided because an implementation may be able to accelerate it.
+   */
+  template <typename ForwardIterator>
+  _CCCL_HOST_DEVICE void generate(ForwardIterator first, ForwardIterator last);
+
   // property functions
 
   /*! This member function returns a const reference to this \p discard_block_engine's
@@ -17,6 +17,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/random/detail/linear_congruential_engine_discard.h>
+#include <thrust/random/detail/linear_congruential_engine_generate.h>
 #include <thrust/random/detail/random_core_access.h>
 
 #include <cuda/std/__host_stdlib/istream>
@@ -175,6 +176,16 @@ public:
    */
   _CCCL_HOST_DEVICE void discard(unsigned long long z);
 
+  /*! This member function fills a range with consecutive random values and updates this \p linear_congruential_engine's
+   *  state as if <tt>operator()</tt> had been called once per element.
+   *
+   *  \param first The beginning of the range to fill.
+   *  \param last The end of the range to fill.
+   *  \note This function is provided because an implementation may be able to accelerate it.
+   */
+  template <typename ForwardIterator>
+  _CCCL_HOST_DEVICE void generate(ForwardIterator first, ForwardIterator last);
+
   /*! \cond
    */
 
@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/random/detail/linear_feedback_shift_engine_discard.h>
 #include <thrust/random/detail/linear_feedback_shift_engine_wordmask.h>
 #include <thrust/random/detail/random_core_access.h>
 
@@ -130,10 +131,21 @@ public:
    *  and discards the results.
    *
    *  \param z The number of random values to discard.
-   *  \note This function is provided because an implementation may be able to accelerate it.
+   *  \note The state is advanced by raising the transition matrix over GF(2) to the power \p z, so the
+   *        cost grows logarithmically with \p z.
    */
   _CCCL_HOST_DEVICE void discard(unsigned long long z);
 
+  /*! This member function fills a range with consecutive random values and updates this
+   *  \p linear_feedback_shift_engine's state as if <tt>operator()</tt> had been called once per element.
+   *
+   *  \param first The beginning of the range to fill.
+   *  \param last The end of the range to fill.
+   *  \note This function is provided because an implementation may be able to accelerate it.
+   */
+  template <typename ForwardIterator>
+  _CCCL_HOST_DEVICE void generate(ForwardIterator first, ForwardIterator last);
+
   /*! \cond
    */
 
@@ -142,6 +154,8 @@ private:
 
   friend struct thrust::random::detail::random_core_access;
 
+  friend struct thrust::random::detail::linear_feedback_shift_engine_discard;
+
   _CCCL_HOST_DEVICE bool equal(const linear_feedback_shift_engine& rhs) const;
 
   template <typename CharT, typename Traits>
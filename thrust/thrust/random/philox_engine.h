@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file philox_engine.h
+ *  \brief A counter-based pseudorandom number engine.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__random/philox_engine.h>
+#include <cuda/std/cstddef>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+/*! \addtogroup random_number_engine_templates
+ *  \{
+ */
+
+/*! \typedef philox_engine
+ *  \brief A \p philox_engine random number engine produces unsigned integer random numbers
+ *         by encrypting a counter with the Philox block cipher (Salmon et al., "Parallel random
+ *         numbers: as easy as 1, 2, 3", SC 2011).
+ *
+ *         Unlike the other engines in \p thrust::random, the state of a \p philox_engine is just a
+ *         key and a counter, so \p discard and \p set_counter jump to any position of the stream in
+ *         constant time. Element \c i of a parallel algorithm can therefore draw from position \c i
+ *         of a single stream, and the result does not depend on how the work is split across threads.
+ *
+ *  \tparam UIntType The type of unsigned integer to produce.
+ *  \tparam w The word size of the produced values.
+ *  \tparam n The number of words produced per counter value.
+ *  \tparam r The number of rounds of the block cipher.
+ *  \tparam consts The multipliers and round constants of the block cipher.
+ *
+ *  \note \p philox_engine is an alias of \p cuda::std::philox_engine, so it can be used with the
+ *        \p thrust::random distributions as well as the \p cuda::std ones.
+ *  \note Inexperienced users should not use this class template directly.  Instead, use
+ *  \p philox4x32 or \p philox4x64.
+ *
+ *  The following code snippet shows how to fill a range with a reproducible stream of random numbers in parallel:
+ *
+ *  \code
+ *  #include <thrust/execution_policy.h>
+ *  #include <thrust/host_vector.h>
+ *  #include <thrust/random.h>
+ *  #include <thrust/tabulate.h>
+ *
+ *  struct draw
+ *  {
+ *    __host__ __device__ float operator()(unsigned long long i) const
+ *    {
+ *      thrust::philox4x32 rng;
+ *      rng.discard(i);
+ *      thrust::uniform_real_distribution<float> dist;
+ *      return dist(rng);
+ *    }
+ *  };
+ *
+ *  int main()
+ *  {
+ *    thrust::host_vector<float> v(1000);
+ *    // the same values are produced with any backend and any number of threads
+ *    thrust::tabulate(thrust::host, v.begin(), v.end(), draw{});
+ *    return 0;
+ *  }
+ *  \endcode
+ */
+template <typename UIntType, ::cuda::std::size_t w, ::cuda::std::size_t n, ::cuda::std::size_t r, UIntType... consts>
+using philox_engine = ::cuda::std::philox_engine<UIntType, w, n, r, consts...>;
+
+/*! \} // random_number_engine_templates
+ */
+
+/*! \addtogroup predefined_random
+ *  \{
+ */
+
+/*! \typedef philox4x32
+ *  \brief A random number engine with predefined parameters which implements the
+ *         Philox counter-based random number generation algorithm with 32-bit words.
+ *  \note The 10000th consecutive invocation of a default-constructed object of type \p philox4x32
+ *        shall produce the value \c 1955073260 .
+ */
+using philox4x32 = ::cuda::std::philox4x32;
+
+/*! \typedef philox4x64
+ *  \brief A random number engine with predefined parameters which implements the
+ *         Philox counter-based random number generation algorithm with 64-bit words.
+ *  \note The 10000th consecutive invocation of a default-constructed object of type \p philox4x64
+ *        shall produce the value \c 3409172418970261260 .
+ */
+using philox4x64 = ::cuda::std::philox4x64;
+
+/*! \} // predefined_random
+ */
+} // namespace random
+
+// import names into thrust::
+using random::philox4x32;
+using random::philox4x64;
+using random::philox_engine;
+
+THRUST_NAMESPACE_END
@@ -19,6 +19,7 @@
 #endif // no system header
 
 #include <thrust/random/detail/random_core_access.h>
+#include <thrust/random/detail/subtract_with_carry_engine_discard.h>
 
 #include <cuda/std/__host_stdlib/istream>
 #include <cuda/std/__host_stdlib/ostream>
@@ -129,10 +130,21 @@ public:
    *  and discards the results.
    *
    *  \param z The number of random values to discard.
-   *  \note This function is provided because an implementation may be able to accelerate it.
+   *  \note The state is advanced through the equivalent linear congruential generator with a multi-precision
+   *        modulus, so the cost grows logarithmically with \p z.
    */
   _CCCL_HOST_DEVICE void discard(unsigned long long z);
 
+  /*! This member function fills a range with consecutive random values and updates this \p subtract_with_carry_engine's
+   *  state as if <tt>operator()</tt> had been called once per element.
+   *
+   *  \param first The beginning of the range to fill.
+   *  \param last The end of the range to fill.
+   *  \note This function is provided because an implementation may be able to accelerate it.
+   */
+  template <typename ForwardIterator>
+  _CCCL_HOST_DEVICE void generate(ForwardIterator first, ForwardIterator last);
+
   /*! \cond
    */
 
@@ -143,6 +155,8 @@ private:
 
   friend struct thrust::random::detail::random_core_access;
 
+  friend struct thrust::random::detail::subtract_with_carry_engine_discard;
+
   _CCCL_HOST_DEVICE bool equal(const subtract_with_carry_engine& rhs) const;
 
   template <typename CharT, typename Traits>
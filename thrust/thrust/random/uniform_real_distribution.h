@@ -135,6 +135,31 @@ public:
   template <typename UniformRandomNumberGenerator>
   _CCCL_HOST_DEVICE result_type operator()(UniformRandomNumberGenerator& urng, const param_type& parm);
 
+  /*! This method fills a range with uniform random numbers drawn from this \p uniform_real_distribution, producing the
+   *  same values as calling <tt>operator()</tt> once per element. The random integers are drawn in blocks, through the
+   *  generator's own \p generate member when it has one, and converted in a loop without dependencies between elements.
+   *
+   *  \param first The beginning of the range to fill.
+   *  \param last The end of the range to fill.
+   *  \param urng The \p UniformRandomNumberGenerator to use as a source of randomness.
+   */
+  template <typename ForwardIterator, typename UniformRandomNumberGenerator>
+  _CCCL_HOST_DEVICE void generate(ForwardIterator first, ForwardIterator last, UniformRandomNumberGenerator& urng);
+
+  /*! This method fills a range with uniform random numbers as if by creating a new \p uniform_real_distribution from
+   *  the given \p param_type object, and calling its \p generate method with the given range and
+   *  \p UniformRandomNumberGenerator.
+   *
+   *  \param first The beginning of the range to fill.
+   *  \param last The end of the range to fill.
+   *  \param urng The \p UniformRandomNumberGenerator to use as a source of randomness.
+   *  \param parm A \p param_type object encapsulating the parameters of the \p uniform_real_distribution
+   *              to draw from.
+   */
+  template <typename ForwardIterator, typename UniformRandomNumberGenerator>
+  _CCCL_HOST_DEVICE void
+  generate(ForwardIterator first, ForwardIterator last, UniformRandomNumberGenerator& urng, const param_type& parm);
+
   // property functions
 
   /*! This method returns the value of the parameter with which this \p uniform_real_distribution
@@ -1171,6 +1171,461 @@ template <typename InputIterator1,
   BinaryPredicate binary_pred,
   BinaryFunction binary_op);
 
+/*! \p reduce_by_key_unordered groups the key-value pairs of the range <tt>[keys_first, keys_last)</tt> by key, whether
+ *  or not equal keys are consecutive, and reduces the values of every group. For each group of equal keys, one key
+ *  is copied to \c keys_output and the reduction of the group's values to \c values_output. The order of the groups
+ *  in the output, and the order in which the values of a group are combined, are unspecified.
+ *
+ *  This is equivalent to \p sort_by_key followed by \p reduce_by_key, without requiring the keys to be sorted. The
+ *  CPU systems reduce integer, enumeration and pointer keys compared with \c equal_to in hash tables, which takes a
+ *  single pass over the input; other keys are sorted first, and must then be LessThanComparable with an ordering
+ *  consistent with the equality predicate.
+ *
+ *  This version of \p reduce_by_key_unordered uses the function object \c equal_to
+ *  to test for equality and \c plus to reduce values with equal keys.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the input key range.
+ *  \param keys_last  The end of the input key range.
+ *  \param values_first The beginning of the input value range.
+ *  \param keys_output The beginning of the output key range.
+ *  \param values_output The beginning of the output value range.
+ *  \return A pair of iterators at end of the ranges <tt>[keys_output, keys_output_last)</tt> and <tt>[values_output,
+ *          values_output_last)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator1 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p InputIterator1's \c value_type is convertible to \c OutputIterator1's \c value_type.
+ *  \tparam InputIterator2 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p InputIterator2's \c value_type is convertible to \c OutputIterator2's \c value_type.
+ *  \tparam OutputIterator1 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam OutputIterator2 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *
+ *  \pre The input ranges shall not overlap either output range.
+ *
+ *  The following code snippet demonstrates how to use \p reduce_by_key_unordered to
+ *  sum the values of every key using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/reduce.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {1, 3, 3, 3, 2, 2, 1}; // input keys
+ *  int B[N] = {9, 8, 7, 6, 5, 4, 3}; // input values
+ *  int C[N];                         // output keys
+ *  int D[N];                         // output values
+ *
+ *  cuda::std::pair<int*,int*> new_end;
+ *  new_end = thrust::reduce_by_key_unordered(thrust::host, A, A + N, B, C, D);
+ *
+ *  // new_end.first - C is 3, and C holds the keys {1, 2, 3} in an unspecified order.
+ *  // D holds the sums 12, 9 and 21 of the keys 1, 2 and 3, in the same order as C.
+ *  \endcode
+ *
+ *  \see reduce_by_key
+ *  \see sort_by_key
+ */
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> reduce_by_key_unordered(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output);
+
+/*! \p reduce_by_key_unordered groups the key-value pairs of the range <tt>[keys_first, keys_last)</tt> by key, whether
+ *  or not equal keys are consecutive, and reduces the values of every group. For each group of equal keys, one key
+ *  is copied to \c keys_output and the reduction of the group's values to \c values_output. The order of the groups
+ *  in the output, and the order in which the values of a group are combined, are unspecified.
+ *
+ *  This is equivalent to \p sort_by_key followed by \p reduce_by_key, without requiring the keys to be sorted. The
+ *  CPU systems reduce integer, enumeration and pointer keys compared with \c equal_to in hash tables, which takes a
+ *  single pass over the input; other keys are sorted first, and must then be LessThanComparable with an ordering
+ *  consistent with the equality predicate.
+ *
+ *  This version of \p reduce_by_key_unordered uses the function object \c equal_to
+ *  to test for equality and \c plus to reduce values with equal keys.
+ *
+ *  \param keys_first The beginning of the input key range.
+ *  \param keys_last  The end of the input key range.
+ *  \param values_first The beginning of the input value range.
+ *  \param keys_output The beginning of the output key range.
+ *  \param values_output The beginning of the output value range.
+ *  \return A pair of iterators at end of the ranges <tt>[keys_output, keys_output_last)</tt> and <tt>[values_output,
+ *          values_output_last)</tt>.
+ *
+ *  \tparam InputIterator1 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p InputIterator1's \c value_type is convertible to \c OutputIterator1's \c value_type.
+ *  \tparam InputIterator2 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p InputIterator2's \c value_type is convertible to \c OutputIterator2's \c value_type.
+ *  \tparam OutputIterator1 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam OutputIterator2 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *
+ *  \pre The input ranges shall not overlap either output range.
+ *
+ *  The following code snippet demonstrates how to use \p reduce_by_key_unordered to
+ *  sum the values of every key:
+ *
+ *  \code
+ *  #include <thrust/reduce.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {1, 3, 3, 3, 2, 2, 1}; // input keys
+ *  int B[N] = {9, 8, 7, 6, 5, 4, 3}; // input values
+ *  int C[N];                         // output keys
+ *  int D[N];                         // output values
+ *
+ *  cuda::std::pair<int*,int*> new_end;
+ *  new_end = thrust::reduce_by_key_unordered(A, A + N, B, C, D);
+ *
+ *  // new_end.first - C is 3, and C holds the keys {1, 2, 3} in an unspecified order.
+ *  // D holds the sums 12, 9 and 21 of the keys 1, 2 and 3, in the same order as C.
+ *  \endcode
+ *
+ *  \see reduce_by_key
+ *  \see sort_by_key
+ */
+template <typename InputIterator1, typename InputIterator2, typename OutputIterator1, typename OutputIterator2>
+::cuda::std::pair<OutputIterator1, OutputIterator2> reduce_by_key_unordered(
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output);
+
+/*! \p reduce_by_key_unordered groups the key-value pairs of the range <tt>[keys_first, keys_last)</tt> by key, whether
+ *  or not equal keys are consecutive, and reduces the values of every group. For each group of equal keys, one key
+ *  is copied to \c keys_output and the reduction of the group's values to \c values_output. The order of the groups
+ *  in the output, and the order in which the values of a group are combined, are unspecified.
+ *
+ *  This is equivalent to \p sort_by_key followed by \p reduce_by_key, without requiring the keys to be sorted. The
+ *  CPU systems reduce integer, enumeration and pointer keys compared with \c equal_to in hash tables, which takes a
+ *  single pass over the input; other keys are sorted first, and must then be LessThanComparable with an ordering
+ *  consistent with the equality predicate.
+ *
+ *  This version of \p reduce_by_key_unordered uses the function object \c binary_pred
+ *  to test for equality and \c plus to reduce values with equal keys.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the input key range.
+ *  \param keys_last  The end of the input key range.
+ *  \param values_first The beginning of the input value range.
+ *  \param keys_output The beginning of the output key range.
+ *  \param values_output The beginning of the output value range.
+ *  \param binary_pred The binary predicate used to determine equality.
+ *  \return A pair of iterators at end of the ranges <tt>[keys_output, keys_output_last)</tt> and <tt>[values_output,
+ *          values_output_last)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator1 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p InputIterator1's \c value_type is convertible to \c OutputIterator1's \c value_type.
+ *  \tparam InputIterator2 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p InputIterator2's \c value_type is convertible to \c OutputIterator2's \c value_type.
+ *  \tparam OutputIterator1 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam OutputIterator2 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam BinaryPredicate is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/named_req/BinaryPredicate">Binary Predicate</a>.
+ *
+ *  \pre The input ranges shall not overlap either output range.
+ *
+ *  The following code snippet demonstrates how to use \p reduce_by_key_unordered to
+ *  sum the values of every key using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/reduce.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {1, 3, 3, 3, 2, 2, 1}; // input keys
+ *  int B[N] = {9, 8, 7, 6, 5, 4, 3}; // input values
+ *  int C[N];                         // output keys
+ *  int D[N];                         // output values
+ *
+ *  cuda::std::pair<int*,int*> new_end;
+ *  new_end = thrust::reduce_by_key_unordered(thrust::host, A, A + N, B, C, D, cuda::std::equal_to<int>{});
+ *
+ *  // new_end.first - C is 3, and C holds the keys {1, 2, 3} in an unspecified order.
+ *  // D holds the sums 12, 9 and 21 of the keys 1, 2 and 3, in the same order as C.
+ *  \endcode
+ *
+ *  \see reduce_by_key
+ *  \see sort_by_key
+ */
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> reduce_by_key_unordered(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred);
+
+/*! \p reduce_by_key_unordered groups the key-value pairs of the range <tt>[keys_first, keys_last)</tt> by key, whether
+ *  or not equal keys are consecutive, and reduces the values of every group. For each group of equal keys, one key
+ *  is copied to \c keys_output and the reduction of the group's values to \c values_output. The order of the groups
+ *  in the output, and the order in which the values of a group are combined, are unspecified.
+ *
+ *  This is equivalent to \p sort_by_key followed by \p reduce_by_key, without requiring the keys to be sorted. The
+ *  CPU systems reduce integer, enumeration and pointer keys compared with \c equal_to in hash tables, which takes a
+ *  single pass over the input; other keys are sorted first, and must then be LessThanComparable with an ordering
+ *  consistent with the equality predicate.
+ *
+ *  This version of \p reduce_by_key_unordered uses the function object \c binary_pred
+ *  to test for equality and \c plus to reduce values with equal keys.
+ *
+ *  \param keys_first The beginning of the input key range.
+ *  \param keys_last  The end of the input key range.
+ *  \param values_first The beginning of the input value range.
+ *  \param keys_output The beginning of the output key range.
+ *  \param values_output The beginning of the output value range.
+ *  \param binary_pred The binary predicate used to determine equality.
+ *  \return A pair of iterators at end of the ranges <tt>[keys_output, keys_output_last)</tt> and <tt>[values_output,
+ *          values_output_last)</tt>.
+ *
+ *  \tparam InputIterator1 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p InputIterator1's \c value_type is convertible to \c OutputIterator1's \c value_type.
+ *  \tparam InputIterator2 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p InputIterator2's \c value_type is convertible to \c OutputIterator2's \c value_type.
+ *  \tparam OutputIterator1 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam OutputIterator2 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam BinaryPredicate is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/named_req/BinaryPredicate">Binary Predicate</a>.
+ *
+ *  \pre The input ranges shall not overlap either output range.
+ *
+ *  The following code snippet demonstrates how to use \p reduce_by_key_unordered to
+ *  sum the values of every key:
+ *
+ *  \code
+ *  #include <thrust/reduce.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {1, 3, 3, 3, 2, 2, 1}; // input keys
+ *  int B[N] = {9, 8, 7, 6, 5, 4, 3}; // input values
+ *  int C[N];                         // output keys
+ *  int D[N];                         // output values
+ *
+ *  cuda::std::pair<int*,int*> new_end;
+ *  new_end = thrust::reduce_by_key_unordered(A, A + N, B, C, D, cuda::std::equal_to<int>{});
+ *
+ *  // new_end.first - C is 3, and C holds the keys {1, 2, 3} in an unspecified order.
+ *  // D holds the sums 12, 9 and 21 of the keys 1, 2 and 3, in the same order as C.
+ *  \endcode
+ *
+ *  \see reduce_by_key
+ *  \see sort_by_key
+ */
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+::cuda::std::pair<OutputIterator1, OutputIterator2> reduce_by_key_unordered(
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred);
+
+/*! \p reduce_by_key_unordered groups the key-value pairs of the range <tt>[keys_first, keys_last)</tt> by key, whether
+ *  or not equal keys are consecutive, and reduces the values of every group. For each group of equal keys, one key
+ *  is copied to \c keys_output and the reduction of the group's values to \c values_output. The order of the groups
+ *  in the output, and the order in which the values of a group are combined, are unspecified.
+ *
+ *  This is equivalent to \p sort_by_key followed by \p reduce_by_key, without requiring the keys to be sorted. The
+ *  CPU systems reduce integer, enumeration and pointer keys compared with \c equal_to in hash tables, which takes a
+ *  single pass over the input; other keys are sorted first, and must then be LessThanComparable with an ordering
+ *  consistent with the equality predicate.
+ *
+ *  This version of \p reduce_by_key_unordered uses the function object \c binary_pred
+ *  to test for equality and \c binary_op to reduce values with equal keys.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the input key range.
+ *  \param keys_last  The end of the input key range.
+ *  \param values_first The beginning of the input value range.
+ *  \param keys_output The beginning of the output key range.
+ *  \param values_output The beginning of the output value range.
+ *  \param binary_pred The binary predicate used to determine equality.
+ *  \param binary_op The binary function used to accumulate values.
+ *  \return A pair of iterators at end of the ranges <tt>[keys_output, keys_output_last)</tt> and <tt>[values_output,
+ *          values_output_last)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator1 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p InputIterator1's \c value_type is convertible to \c OutputIterator1's \c value_type.
+ *  \tparam InputIterator2 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p InputIterator2's \c value_type is convertible to \c OutputIterator2's \c value_type.
+ *  \tparam OutputIterator1 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam OutputIterator2 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam BinaryPredicate is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/named_req/BinaryPredicate">Binary Predicate</a>.
+ *  \tparam BinaryFunction is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/utility/functional/binary_function">Binary Function</a>
+ *          and \c BinaryFunction's \c result_type is convertible to \c OutputIterator2's \c value_type.
+ *          \c binary_op must be associative and commutative.
+ *
+ *  \pre The input ranges shall not overlap either output range.
+ *
+ *  The following code snippet demonstrates how to use \p reduce_by_key_unordered to
+ *  compute the maximum value of every key using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/reduce.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {1, 3, 3, 3, 2, 2, 1}; // input keys
+ *  int B[N] = {9, 8, 7, 6, 5, 4, 3}; // input values
+ *  int C[N];                         // output keys
+ *  int D[N];                         // output values
+ *
+ *  cuda::std::pair<int*,int*> new_end;
+ *  new_end = thrust::reduce_by_key_unordered(
+ *    thrust::host, A, A + N, B, C, D, cuda::std::equal_to<int>{}, cuda::maximum{});
+ *
+ *  // new_end.first - C is 3, and C holds the keys {1, 2, 3} in an unspecified order.
+ *  // D holds the maxima 9, 5 and 8 of the keys 1, 2 and 3, in the same order as C.
+ *  \endcode
+ *
+ *  \see reduce_by_key
+ *  \see sort_by_key
+ */
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> reduce_by_key_unordered(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op);
+
+/*! \p reduce_by_key_unordered groups the key-value pairs of the range <tt>[keys_first, keys_last)</tt> by key, whether
+ *  or not equal keys are consecutive, and reduces the values of every group. For each group of equal keys, one key
+ *  is copied to \c keys_output and the reduction of the group's values to \c values_output. The order of the groups
+ *  in the output, and the order in which the values of a group are combined, are unspecified.
+ *
+ *  This is equivalent to \p sort_by_key followed by \p reduce_by_key, without requiring the keys to be sorted. The
+ *  CPU systems reduce integer, enumeration and pointer keys compared with \c equal_to in hash tables, which takes a
+ *  single pass over the input; other keys are sorted first, and must then be LessThanComparable with an ordering
+ *  consistent with the equality predicate.
+ *
+ *  This version of \p reduce_by_key_unordered uses the function object \c binary_pred
+ *  to test for equality and \c binary_op to reduce values with equal keys.
+ *
+ *  \param keys_first The beginning of the input key range.
+ *  \param keys_last  The end of the input key range.
+ *  \param values_first The beginning of the input value range.
+ *  \param keys_output The beginning of the output key range.
+ *  \param values_output The beginning of the output value range.
+ *  \param binary_pred The binary predicate used to determine equality.
+ *  \param binary_op The binary function used to accumulate values.
+ *  \return A pair of iterators at end of the ranges <tt>[keys_output, keys_output_last)</tt> and <tt>[values_output,
+ *          values_output_last)</tt>.
+ *
+ *  \tparam InputIterator1 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p InputIterator1's \c value_type is convertible to \c OutputIterator1's \c value_type.
+ *  \tparam InputIterator2 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p InputIterator2's \c value_type is convertible to \c OutputIterator2's \c value_type.
+ *  \tparam OutputIterator1 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam OutputIterator2 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam BinaryPredicate is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/named_req/BinaryPredicate">Binary Predicate</a>.
+ *  \tparam BinaryFunction is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/utility/functional/binary_function">Binary Function</a>
+ *          and \c BinaryFunction's \c result_type is convertible to \c OutputIterator2's \c value_type.
+ *          \c binary_op must be associative and commutative.
+ *
+ *  \pre The input ranges shall not overlap either output range.
+ *
+ *  The following code snippet demonstrates how to use \p reduce_by_key_unordered to
+ *  compute the maximum value of every key:
+ *
+ *  \code
+ *  #include <thrust/reduce.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {1, 3, 3, 3, 2, 2, 1}; // input keys
+ *  int B[N] = {9, 8, 7, 6, 5, 4, 3}; // input values
+ *  int C[N];                         // output keys
+ *  int D[N];                         // output values
+ *
+ *  cuda::std::pair<int*,int*> new_end;
+ *  new_end = thrust::reduce_by_key_unordered(A, A + N, B, C, D, cuda::std::equal_to<int>{}, cuda::maximum{});
+ *
+ *  // new_end.first - C is 3, and C holds the keys {1, 2, 3} in an unspecified order.
+ *  // D holds the maxima 9, 5 and 8 of the keys 1, 2 and 3, in the same order as C.
+ *  \endcode
+ *
+ *  \see reduce_by_key
+ *  \see sort_by_key
+ */
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+::cuda::std::pair<OutputIterator1, OutputIterator2> reduce_by_key_unordered(
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op);
+
 /*! \} // end reductions
  */
 
@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file reduce_by_key_unordered.h
+ *  \brief C++ implementation of reduce_by_key_unordered.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/cpp/detail/execution_policy.h>
+#include <thrust/system/detail/generic/reduce_by_key_unordered.h>
+#include <thrust/system/detail/internal/hash_reduce_by_key.h>
+
+#include <cuda/std/__utility/pair.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::cpp::detail
+{
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+::cuda::std::pair<OutputIterator1, OutputIterator2> reduce_by_key_unordered(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  using KeyType   = thrust::detail::it_value_t<InputIterator1>;
+  using ValueType = thrust::detail::it_value_t<InputIterator2>;
+
+  if constexpr (!thrust::system::detail::internal::can_hash_reduce_by_key_v<KeyType, BinaryPredicate>)
+  {
+    return thrust::system::detail::generic::reduce_by_key_unordered(
+      exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  }
+  else
+  {
+    using reduce_type = thrust::system::detail::internal::hash_reduce_by_key<KeyType, ValueType, BinaryFunction>;
+
+    if (keys_first == keys_last)
+    {
+      return ::cuda::std::make_pair(keys_output, values_output);
+    }
+
+    // a single chunk and partition
+    reduce_type reduce(keys_last - keys_first, 1, binary_op);
+    reduce.build(0, keys_first, values_first);
+    const auto size = reduce.scan();
+    reduce.write(0, keys_output, values_output);
+
+    return ::cuda::std::make_pair(keys_output + size, values_output + size);
+  }
+} // end reduce_by_key_unordered()
+} // namespace system::cpp::detail
+THRUST_NAMESPACE_END
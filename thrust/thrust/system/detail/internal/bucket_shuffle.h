@@ -0,0 +1,255 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/random/uniform_int_distribution.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__bit/countl.h>
+#include <cuda/std/__bit/integral.h>
+#include <cuda/std/__utility/swap.h>
+#include <cuda/std/cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+namespace bucket_shuffle_detail
+{
+// the splitmix64 finalizer, a bijective mixing function of 64-bit words
+inline std::uint64_t mix(std::uint64_t x)
+{
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+  return x ^ (x >> 31);
+}
+
+constexpr std::uint64_t golden_gamma = 0x9E3779B97F4A7C15ull;
+
+// a splitmix64 stream, used to drive the Fisher-Yates shuffle of a single bucket
+class random_stream
+{
+public:
+  explicit random_stream(std::uint64_t seed)
+      : m_state(seed)
+  {}
+
+  std::uint64_t operator()()
+  {
+    m_state += golden_gamma;
+    return mix(m_state);
+  }
+
+  // returns a uniformly distributed integer in [0, bound)
+  std::uint64_t below(std::uint64_t bound)
+  {
+    if (bound <= (1ull << 32))
+    {
+      // Lemire, "Fast Random Integer Generation in an Interval", ACM TOMACS 29 (2019)
+      std::uint64_t product = (operator()() >> 32) * bound;
+      if ((product & 0xFFFFFFFFull) < bound)
+      {
+        const std::uint64_t threshold = ((1ull << 32) - bound) % bound;
+        while ((product & 0xFFFFFFFFull) < threshold)
+        {
+          product = (operator()() >> 32) * bound;
+        }
+      }
+      return product >> 32;
+    }
+
+    const std::uint64_t mask = (~0ull) >> ::cuda::std::countl_zero(bound - 1);
+    std::uint64_t x;
+    do
+    {
+      x = operator()() & mask;
+    } while (x >= bound);
+    return x;
+  }
+
+private:
+  std::uint64_t m_state;
+};
+} // namespace bucket_shuffle_detail
+
+// Shuffles [first, first + n) into result with a parallel bucket scatter into a buffer followed by a Fisher-Yates
+// shuffle of each bucket, in the spirit of MergeShuffle (Bacher et al., "MergeShuffle: a very fast, parallel random permutation
+// algorithm", 2015).
+//
+// Every element is sent to a bucket drawn from a hash of the seed and its index, and elements keep their input order
+// within a bucket. Every bucket is then shuffled with its own stream seeded from the bucket index. Since the bucket
+// contents form a uniformly random partition and every bucket is uniformly permuted, the concatenation is a uniformly
+// random permutation. Neither step depends on the chunking of the input, so the result only depends on the seed and n,
+// and not on the number of threads used by the backend.
+//
+// A backend drives the algorithm with parallel loops:
+//   1. count(c) for every chunk c in [0, num_chunks())
+//   2. scan(), sequentially
+//   3. scatter(c) for every chunk
+//   4. shuffle_bucket(b) for every bucket b in [0, num_buckets()), which also writes the bucket to result
+// buffer must point to n elements, counts to num_chunks() * num_buckets() elements and bucket_begin to
+// num_buckets() + 1 elements. The input is only read by scatter and result is only written by shuffle_bucket, so
+// result may alias the input.
+template <typename RandomIterator, typename OutputIterator>
+class bucket_shuffle
+{
+public:
+  using size_type = std::uint64_t;
+
+  // XXX these values are a tuning opportunity
+  // buckets of this many elements are shuffled in cache
+  static constexpr size_type target_bucket_size = size_type(1) << 15;
+  // more buckets make the scatter less cache friendly
+  static constexpr size_type max_buckets = size_type(1) << 12;
+
+  static size_type num_buckets_for(size_type n)
+  {
+    const size_type wanted = (::cuda::std::max) (size_type(1), (n + target_bucket_size - 1) / target_bucket_size);
+    return (::cuda::std::min) (max_buckets, ::cuda::std::bit_ceil(wanted));
+  }
+
+  using value_type = thrust::detail::it_value_t<RandomIterator>;
+
+  template <typename URBG>
+  bucket_shuffle(RandomIterator first,
+                 size_type n,
+                 OutputIterator result,
+                 value_type* buffer,
+                 size_type num_chunks,
+                 size_type* counts,
+                 size_type* bucket_begin,
+                 URBG&& g)
+      : m_first(first)
+      , m_n(n)
+      , m_result(result)
+      , m_buffer(buffer)
+      , m_num_chunks(num_chunks)
+      , m_num_buckets(num_buckets_for(n))
+      , m_bucket_bits(::cuda::std::bit_width(m_num_buckets) - 1)
+      , m_counts(counts)
+      , m_bucket_begin(bucket_begin)
+  {
+    // draw through a distribution, since thrust engines do not produce full 32-bit words
+    thrust::uniform_int_distribution<std::uint32_t> dist;
+    for (std::uint64_t* key : {&m_bucket_key, &m_shuffle_key})
+    {
+      const std::uint64_t hi = dist(g);
+      *key                   = (hi << 32) | dist(g);
+    }
+  }
+
+  size_type num_chunks() const
+  {
+    return m_num_chunks;
+  }
+
+  size_type num_buckets() const
+  {
+    return m_num_buckets;
+  }
+
+  void count(size_type chunk) const
+  {
+    size_type* counts = m_counts + chunk * m_num_buckets;
+    for (size_type b = 0; b < m_num_buckets; ++b)
+    {
+      counts[b] = 0;
+    }
+
+    for (size_type i = chunk_begin(chunk); i < chunk_begin(chunk + 1); ++i)
+    {
+      ++counts[bucket(i)];
+    }
+  }
+
+  // turns the per-chunk counts into scatter offsets: chunk c writes its elements of bucket b after those of the
+  // earlier chunks, so the input order is preserved within every bucket
+  void scan() const
+  {
+    size_type offset = 0;
+    for (size_type b = 0; b < m_num_buckets; ++b)
+    {
+      m_bucket_begin[b] = offset;
+      for (size_type c = 0; c < m_num_chunks; ++c)
+      {
+        const size_type count              = m_counts[c * m_num_buckets + b];
+        m_counts[c * m_num_buckets + b] = offset;
+        offset += count;
+      }
+    }
+    m_bucket_begin[m_num_buckets] = offset;
+  }
+
+  void scatter(size_type chunk) const
+  {
+    size_type* offsets = m_counts + chunk * m_num_buckets;
+    RandomIterator iter = m_first + chunk_begin(chunk);
+    for (size_type i = chunk_begin(chunk); i < chunk_begin(chunk + 1); ++i, ++iter)
+    {
+      m_buffer[offsets[bucket(i)]++] = *iter;
+    }
+  }
+
+  // a Fisher-Yates shuffle of one bucket of the buffer, which is then copied to the result while still in cache
+  void shuffle_bucket(size_type b) const
+  {
+    using ::cuda::std::swap;
+
+    value_type* first    = m_buffer + m_bucket_begin[b];
+    const size_type size = m_bucket_begin[b + 1] - m_bucket_begin[b];
+
+    bucket_shuffle_detail::random_stream rng(bucket_shuffle_detail::mix(m_shuffle_key + b));
+    for (size_type i = size; i > 1; --i)
+    {
+      swap(first[i - 1], first[rng.below(i)]);
+    }
+
+    OutputIterator result = m_result + m_bucket_begin[b];
+    for (size_type i = 0; i < size; ++i, ++result)
+    {
+      *result = first[i];
+    }
+  }
+
+private:
+  size_type chunk_begin(size_type chunk) const
+  {
+    // the first n % num_chunks chunks get one extra element
+    return (m_n / m_num_chunks) * chunk + (::cuda::std::min) (chunk, m_n % m_num_chunks);
+  }
+
+  size_type bucket(size_type i) const
+  {
+    // the top bits of an independent hash of every index
+    return m_bucket_bits == 0
+           ? 0
+           : bucket_shuffle_detail::mix(m_bucket_key + (i + 1) * bucket_shuffle_detail::golden_gamma)
+               >> (64 - m_bucket_bits);
+  }
+
+  RandomIterator m_first;
+  size_type m_n;
+  OutputIterator m_result;
+  value_type* m_buffer;
+  size_type m_num_chunks;
+  size_type m_num_buckets;
+  int m_bucket_bits;
+  size_type* m_counts;
+  size_type* m_bucket_begin;
+  std::uint64_t m_bucket_key;
+  std::uint64_t m_shuffle_key;
+};
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
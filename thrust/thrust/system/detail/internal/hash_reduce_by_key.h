@@ -0,0 +1,284 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__bit/integral.h>
+#include <cuda/std/__functional/operations.h>
+#include <cuda/std/__type_traits/is_enum.h>
+#include <cuda/std/__type_traits/is_integral.h>
+#include <cuda/std/__type_traits/is_pointer.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+// Keys can be hashed when equality is the builtin one of an integer, enumeration or pointer type, so that equal keys
+// have equal bit patterns.
+template <typename Key, typename BinaryPredicate>
+inline constexpr bool can_hash_reduce_by_key_v =
+  (::cuda::std::is_integral_v<Key> || ::cuda::std::is_enum_v<Key> || ::cuda::std::is_pointer_v<Key>)
+  && (::cuda::std::is_same_v<BinaryPredicate, ::cuda::std::equal_to<Key>>
+      || ::cuda::std::is_same_v<BinaryPredicate, ::cuda::std::equal_to<>>);
+
+namespace hash_reduce_by_key_detail
+{
+template <typename Key>
+std::uint64_t hash(const Key& key)
+{
+  std::uint64_t x;
+  if constexpr (::cuda::std::is_pointer_v<Key>)
+  {
+    x = reinterpret_cast<std::uintptr_t>(key);
+  }
+  else
+  {
+    x = static_cast<std::uint64_t>(key);
+  }
+
+  // the splitmix64 finalizer, so that keys differing only in their high bits do not collide in the table
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+  return x ^ (x >> 31);
+}
+
+// An open addressing hash table with linear probing which combines the values of equal keys.
+// Slots are selected by the low bits of the hash, so the high bits remain free to partition the key space.
+template <typename Key, typename Value>
+class table
+{
+public:
+  table()
+      : m_size(0)
+  {}
+
+  ::cuda::std::size_t size() const
+  {
+    return m_size;
+  }
+
+  template <typename BinaryFunction>
+  void insert(std::uint64_t h, const Key& key, const Value& value, BinaryFunction& binary_op)
+  {
+    // most insertions hit an existing key, so the raw pointers are hoisted out of the probing loop
+    const unsigned char* occupied  = m_occupied.data();
+    const Key* keys                = m_keys.data();
+    const ::cuda::std::size_t mask = m_keys.size() - 1;
+    ::cuda::std::size_t i          = h & mask;
+    for (; !m_keys.empty() && occupied[i]; i = (i + 1) & mask)
+    {
+      if (keys[i] == key)
+      {
+        Value* slot = m_values.data() + i;
+        *slot       = binary_op(*slot, value);
+        return;
+      }
+    }
+
+    // keep the load factor at most 1/4, which keeps probe sequences short
+    if (4 * (m_size + 1) > m_keys.size())
+    {
+      grow();
+      i = find_empty(h);
+    }
+
+    m_occupied[i] = 1;
+    m_keys[i]     = key;
+    m_values[i]   = value;
+    ++m_size;
+  }
+
+  // inserts every element of other into this table
+  template <typename BinaryFunction>
+  void merge(const table& other, BinaryFunction& binary_op)
+  {
+    for (::cuda::std::size_t i = 0; i < other.m_keys.size(); ++i)
+    {
+      if (other.m_occupied[i])
+      {
+        insert(hash(other.m_keys[i]), other.m_keys[i], other.m_values[i], binary_op);
+      }
+    }
+  }
+
+  template <typename OutputIterator1, typename OutputIterator2>
+  void copy(OutputIterator1 keys_output, OutputIterator2 values_output) const
+  {
+    for (::cuda::std::size_t i = 0; i < m_keys.size(); ++i)
+    {
+      if (m_occupied[i])
+      {
+        *keys_output   = m_keys[i];
+        *values_output = m_values[i];
+        ++keys_output;
+        ++values_output;
+      }
+    }
+  }
+
+private:
+  ::cuda::std::size_t find_empty(std::uint64_t h) const
+  {
+    const ::cuda::std::size_t mask = m_occupied.size() - 1;
+    ::cuda::std::size_t i          = h & mask;
+    while (m_occupied[i])
+    {
+      i = (i + 1) & mask;
+    }
+    return i;
+  }
+
+  void grow()
+  {
+    table result;
+    result.m_occupied.resize(::cuda::std::max<::cuda::std::size_t>(16, 2 * m_keys.size()), 0);
+    result.m_keys.resize(result.m_occupied.size());
+    result.m_values.resize(result.m_occupied.size());
+
+    for (::cuda::std::size_t j = 0; j < m_keys.size(); ++j)
+    {
+      if (m_occupied[j])
+      {
+        const ::cuda::std::size_t i = result.find_empty(hash(m_keys[j]));
+        result.m_occupied[i]        = 1;
+        result.m_keys[i]            = ::cuda::std::move(m_keys[j]);
+        result.m_values[i]          = ::cuda::std::move(m_values[j]);
+      }
+    }
+
+    result.m_size = m_size;
+    *this         = ::cuda::std::move(result);
+  }
+
+  ::cuda::std::size_t m_size;
+  std::vector<unsigned char> m_occupied;
+  std::vector<Key> m_keys;
+  std::vector<Value> m_values;
+};
+} // namespace hash_reduce_by_key_detail
+
+// Reduces the values of equal keys with thread-local hash tables, without sorting.
+//
+// The input is split into chunks, and every chunk builds its own tables. The key space is split into partitions by the
+// high bits of the hash, and every chunk keeps one table per partition, so partition p of the result only depends on
+// table p of every chunk. The partitions are then merged and written out independently.
+//
+// A backend drives the algorithm with parallel loops:
+//   1. build(c, ...) for every chunk c in [0, num_chunks())
+//   2. merge(p) for every partition p in [0, num_partitions())
+//   3. scan(), sequentially, which returns the number of distinct keys
+//   4. write(p, ...) for every partition
+template <typename Key, typename Value, typename BinaryFunction>
+class hash_reduce_by_key
+{
+public:
+  using size_type = ::cuda::std::size_t;
+
+  hash_reduce_by_key(size_type n, size_type num_chunks, BinaryFunction binary_op)
+      : m_n(n)
+      , m_num_chunks(num_chunks)
+      , m_num_partitions(::cuda::std::bit_ceil(num_chunks))
+      , m_partition_bits(::cuda::std::bit_width(m_num_partitions) - 1)
+      , m_binary_op(binary_op)
+      , m_tables(m_num_chunks * m_num_partitions)
+      , m_offsets(m_num_partitions + 1)
+  {}
+
+  size_type num_chunks() const
+  {
+    return m_num_chunks;
+  }
+
+  size_type num_partitions() const
+  {
+    return m_num_partitions;
+  }
+
+  template <typename InputIterator1, typename InputIterator2>
+  void build(size_type chunk, InputIterator1 keys_first, InputIterator2 values_first)
+  {
+    BinaryFunction binary_op = m_binary_op;
+    table_type* tables       = m_tables.data() + chunk * m_num_partitions;
+
+    const size_type first = chunk_begin(chunk);
+    const size_type last  = chunk_begin(chunk + 1);
+    keys_first += first;
+    values_first += first;
+    for (size_type i = first; i < last; ++i, ++keys_first, ++values_first)
+    {
+      const Key key         = *keys_first;
+      const std::uint64_t h = hash_reduce_by_key_detail::hash(key);
+      tables[partition(h)].insert(h, key, Value(*values_first), binary_op);
+    }
+  }
+
+  // merges the tables of partition p of every chunk into the one of the first chunk
+  void merge(size_type p)
+  {
+    BinaryFunction binary_op = m_binary_op;
+    table_type& result       = m_tables[p];
+    for (size_type c = 1; c < m_num_chunks; ++c)
+    {
+      table_type& other = m_tables[c * m_num_partitions + p];
+      result.merge(other, binary_op);
+      other = table_type();
+    }
+  }
+
+  size_type scan()
+  {
+    m_offsets[0] = 0;
+    for (size_type p = 0; p < m_num_partitions; ++p)
+    {
+      m_offsets[p + 1] = m_offsets[p] + m_tables[p].size();
+    }
+    return m_offsets[m_num_partitions];
+  }
+
+  template <typename OutputIterator1, typename OutputIterator2>
+  void write(size_type p, OutputIterator1 keys_output, OutputIterator2 values_output) const
+  {
+    m_tables[p].copy(keys_output + m_offsets[p], values_output + m_offsets[p]);
+  }
+
+private:
+  using table_type = hash_reduce_by_key_detail::table<Key, Value>;
+
+  size_type chunk_begin(size_type chunk) const
+  {
+    // the first n % num_chunks chunks get one extra element
+    return (m_n / m_num_chunks) * chunk + (::cuda::std::min) (chunk, m_n % m_num_chunks);
+  }
+
+  size_type partition(std::uint64_t h) const
+  {
+    return m_partition_bits == 0 ? 0 : static_cast<size_type>(h >> (64 - m_partition_bits));
+  }
+
+  size_type m_n;
+  size_type m_num_chunks;
+  size_type m_num_partitions;
+  int m_partition_bits;
+  BinaryFunction m_binary_op;
+  std::vector<table_type> m_tables;
+  std::vector<size_type> m_offsets;
+};
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file reduce_by_key_unordered.h
+ *  \brief OpenMP implementation of reduce_by_key_unordered.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/reduce_by_key_unordered.h>
+#include <thrust/system/detail/internal/hash_reduce_by_key.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__utility/pair.h>
+#include <cuda/std/cstdint>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#  include <omp.h>
+#endif // omp support
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+::cuda::std::pair<OutputIterator1, OutputIterator2> reduce_by_key_unordered(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  using KeyType   = thrust::detail::it_value_t<InputIterator1>;
+  using ValueType = thrust::detail::it_value_t<InputIterator2>;
+
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(
+    thrust::detail::depend_on_instantiation<KeyType, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+    "OpenMP compiler support is not enabled");
+
+  if constexpr (!thrust::system::detail::internal::can_hash_reduce_by_key_v<KeyType, BinaryPredicate>)
+  {
+    return thrust::system::detail::generic::reduce_by_key_unordered(
+      exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  }
+  else
+  {
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    using reduce_type = thrust::system::detail::internal::hash_reduce_by_key<KeyType, ValueType, BinaryFunction>;
+    using size_type   = typename reduce_type::size_type;
+
+    const size_type n = keys_last - keys_first;
+    if (n == 0)
+    {
+      return ::cuda::std::make_pair(keys_output, values_output);
+    }
+
+    // XXX this value is a tuning opportunity
+    const size_type min_chunk_size = 1 << 14;
+    const size_type num_chunks     = (::cuda::std::min) ((n + min_chunk_size - 1) / min_chunk_size,
+                                                     static_cast<size_type>(omp_get_max_threads()));
+
+    reduce_type reduce(n, num_chunks, binary_op);
+
+    using index_type = std::intptr_t;
+
+    THRUST_PRAGMA_OMP(parallel for)
+    for (index_type c = 0; c < static_cast<index_type>(reduce.num_chunks()); ++c)
+    {
+      reduce.build(c, keys_first, values_first);
+    }
+
+    THRUST_PRAGMA_OMP(parallel for schedule(dynamic))
+    for (index_type p = 0; p < static_cast<index_type>(reduce.num_partitions()); ++p)
+    {
+      reduce.merge(p);
+    }
+
+    const size_type size = reduce.scan();
+
+    THRUST_PRAGMA_OMP(parallel for)
+    for (index_type p = 0; p < static_cast<index_type>(reduce.num_partitions()); ++p)
+    {
+      reduce.write(p, keys_output, values_output);
+    }
+
+    return ::cuda::std::make_pair(keys_output + size, values_output + size);
+#else // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+    return ::cuda::std::make_pair(keys_output, values_output);
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+  }
+} // end reduce_by_key_unordered()
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
@@ -0,0 +1,112 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file shuffle.h
+ *  \brief OpenMP implementation of shuffle and shuffle_copy.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/bucket_shuffle.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/cstdint>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#  include <omp.h>
+#endif // omp support
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+template <typename DerivedPolicy, typename RandomIterator, typename OutputIterator, typename URBG>
+void shuffle_copy(
+  execution_policy<DerivedPolicy>& exec, RandomIterator first, RandomIterator last, OutputIterator result, URBG&& g)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(
+    thrust::detail::depend_on_instantiation<RandomIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+    "OpenMP compiler support is not enabled");
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  using shuffle_type = thrust::system::detail::internal::bucket_shuffle<RandomIterator, OutputIterator>;
+  using size_type    = typename shuffle_type::size_type;
+  using value_type   = typename shuffle_type::value_type;
+
+  const size_type n = static_cast<size_type>(last - first);
+  if (n == 0)
+  {
+    return;
+  }
+
+  // the number of chunks only affects the parallelism, not the result
+  const size_type num_chunks  = (::cuda::std::min) (n, static_cast<size_type>(omp_get_max_threads()));
+  const size_type num_buckets = shuffle_type::num_buckets_for(n);
+
+  thrust::detail::temporary_array<value_type, DerivedPolicy> buffer(exec, n);
+  thrust::detail::temporary_array<size_type, DerivedPolicy> counts(exec, num_chunks * num_buckets);
+  thrust::detail::temporary_array<size_type, DerivedPolicy> bucket_begin(exec, num_buckets + 1);
+
+  const shuffle_type shuffle(
+    first,
+    n,
+    result,
+    thrust::raw_pointer_cast(buffer.data()),
+    num_chunks,
+    thrust::raw_pointer_cast(counts.data()),
+    thrust::raw_pointer_cast(bucket_begin.data()),
+    g);
+
+  using index_type = std::intptr_t;
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (index_type c = 0; c < static_cast<index_type>(num_chunks); ++c)
+  {
+    shuffle.count(c);
+  }
+
+  shuffle.scan();
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (index_type c = 0; c < static_cast<index_type>(num_chunks); ++c)
+  {
+    shuffle.scatter(c);
+  }
+
+  THRUST_PRAGMA_OMP(parallel for schedule(dynamic))
+  for (index_type b = 0; b < static_cast<index_type>(num_buckets); ++b)
+  {
+    shuffle.shuffle_bucket(b);
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+} // end shuffle_copy()
+
+template <typename DerivedPolicy, typename RandomIterator, typename URBG>
+void shuffle(execution_policy<DerivedPolicy>& exec, RandomIterator first, RandomIterator last, URBG&& g)
+{
+  // shuffle_copy buffers the input before writing the result, so it can work in place
+  thrust::system::omp::detail::shuffle_copy(exec, first, last, first, g);
+} // end shuffle()
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
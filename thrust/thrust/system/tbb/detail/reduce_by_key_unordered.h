@@ -0,0 +1,152 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file reduce_by_key_unordered.h
+ *  \brief TBB implementation of reduce_by_key_unordered.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/reduce_by_key_unordered.h>
+#include <thrust/system/detail/internal/hash_reduce_by_key.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__utility/pair.h>
+
+#include <thread>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::tbb::detail
+{
+namespace reduce_by_key_unordered_detail
+{
+template <typename Reduce, typename InputIterator1, typename InputIterator2>
+struct build_body
+{
+  Reduce& reduce;
+  InputIterator1 keys_first;
+  InputIterator2 values_first;
+
+  void operator()(const ::tbb::blocked_range<typename Reduce::size_type>& r) const
+  {
+    for (typename Reduce::size_type c = r.begin(); c != r.end(); ++c)
+    {
+      reduce.build(c, keys_first, values_first);
+    }
+  }
+}; // end build_body
+
+template <typename Reduce>
+struct merge_body
+{
+  Reduce& reduce;
+
+  void operator()(const ::tbb::blocked_range<typename Reduce::size_type>& r) const
+  {
+    for (typename Reduce::size_type p = r.begin(); p != r.end(); ++p)
+    {
+      reduce.merge(p);
+    }
+  }
+}; // end merge_body
+
+template <typename Reduce, typename OutputIterator1, typename OutputIterator2>
+struct write_body
+{
+  const Reduce& reduce;
+  OutputIterator1 keys_output;
+  OutputIterator2 values_output;
+
+  void operator()(const ::tbb::blocked_range<typename Reduce::size_type>& r) const
+  {
+    for (typename Reduce::size_type p = r.begin(); p != r.end(); ++p)
+    {
+      reduce.write(p, keys_output, values_output);
+    }
+  }
+}; // end write_body
+} // namespace reduce_by_key_unordered_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+::cuda::std::pair<OutputIterator1, OutputIterator2> reduce_by_key_unordered(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  using KeyType   = thrust::detail::it_value_t<InputIterator1>;
+  using ValueType = thrust::detail::it_value_t<InputIterator2>;
+
+  if constexpr (!thrust::system::detail::internal::can_hash_reduce_by_key_v<KeyType, BinaryPredicate>)
+  {
+    return thrust::system::detail::generic::reduce_by_key_unordered(
+      exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  }
+  else
+  {
+    using reduce_type = thrust::system::detail::internal::hash_reduce_by_key<KeyType, ValueType, BinaryFunction>;
+    using size_type   = typename reduce_type::size_type;
+
+    const size_type n = keys_last - keys_first;
+    if (n == 0)
+    {
+      return ::cuda::std::make_pair(keys_output, values_output);
+    }
+
+    // XXX this value is a tuning opportunity
+    const size_type min_chunk_size = 1 << 14;
+    const size_type p              = (::cuda::std::max) (1u, std::thread::hardware_concurrency());
+    const size_type num_chunks     = (::cuda::std::min) ((n + min_chunk_size - 1) / min_chunk_size, p);
+
+    reduce_type reduce(n, num_chunks, binary_op);
+
+    // force grainsize == 1 with simple_partioner()
+    ::tbb::parallel_for(
+      ::tbb::blocked_range<size_type>(0, reduce.num_chunks(), 1),
+      reduce_by_key_unordered_detail::build_body<reduce_type, InputIterator1, InputIterator2>{
+        reduce, keys_first, values_first},
+      ::tbb::simple_partitioner());
+
+    ::tbb::parallel_for(::tbb::blocked_range<size_type>(0, reduce.num_partitions(), 1),
+                        reduce_by_key_unordered_detail::merge_body<reduce_type>{reduce},
+                        ::tbb::simple_partitioner());
+
+    const size_type size = reduce.scan();
+
+    ::tbb::parallel_for(
+      ::tbb::blocked_range<size_type>(0, reduce.num_partitions(), 1),
+      reduce_by_key_unordered_detail::write_body<reduce_type, OutputIterator1, OutputIterator2>{
+        reduce, keys_output, values_output},
+      ::tbb::simple_partitioner());
+
+    return ::cuda::std::make_pair(keys_output + size, values_output + size);
+  }
+} // end reduce_by_key_unordered()
+} // namespace system::tbb::detail
+THRUST_NAMESPACE_END
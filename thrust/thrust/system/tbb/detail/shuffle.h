@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file shuffle.h
+ *  \brief TBB implementation of shuffle and shuffle_copy.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/system/detail/internal/bucket_shuffle.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+
+#include <thread>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::tbb::detail
+{
+namespace shuffle_detail
+{
+// calls the member function Phase of a bucket_shuffle for every index in the range
+template <typename Shuffle, void (Shuffle::*Phase)(typename Shuffle::size_type) const>
+struct body
+{
+  const Shuffle& shuffle;
+
+  void operator()(const ::tbb::blocked_range<typename Shuffle::size_type>& r) const
+  {
+    for (typename Shuffle::size_type i = r.begin(); i != r.end(); ++i)
+    {
+      (shuffle.*Phase)(i);
+    }
+  }
+}; // end body
+} // namespace shuffle_detail
+
+template <typename DerivedPolicy, typename RandomIterator, typename OutputIterator, typename URBG>
+void shuffle_copy(
+  execution_policy<DerivedPolicy>& exec, RandomIterator first, RandomIterator last, OutputIterator result, URBG&& g)
+{
+  using shuffle_type = thrust::system::detail::internal::bucket_shuffle<RandomIterator, OutputIterator>;
+  using size_type    = typename shuffle_type::size_type;
+  using value_type   = typename shuffle_type::value_type;
+
+  const size_type n = static_cast<size_type>(last - first);
+  if (n == 0)
+  {
+    return;
+  }
+
+  // the number of chunks only affects the parallelism, not the result
+  // XXX oversubscribing is a tuning opportunity
+  const size_type p           = (::cuda::std::max) (1u, std::thread::hardware_concurrency());
+  const size_type num_chunks  = (::cuda::std::min) (n, p);
+  const size_type num_buckets = shuffle_type::num_buckets_for(n);
+
+  thrust::detail::temporary_array<value_type, DerivedPolicy> buffer(exec, n);
+  thrust::detail::temporary_array<size_type, DerivedPolicy> counts(exec, num_chunks * num_buckets);
+  thrust::detail::temporary_array<size_type, DerivedPolicy> bucket_begin(exec, num_buckets + 1);
+
+  const shuffle_type shuffle(
+    first,
+    n,
+    result,
+    thrust::raw_pointer_cast(buffer.data()),
+    num_chunks,
+    thrust::raw_pointer_cast(counts.data()),
+    thrust::raw_pointer_cast(bucket_begin.data()),
+    g);
+
+  // force grainsize == 1 with simple_partioner()
+  ::tbb::parallel_for(::tbb::blocked_range<size_type>(0, num_chunks, 1),
+                      shuffle_detail::body<shuffle_type, &shuffle_type::count>{shuffle},
+                      ::tbb::simple_partitioner());
+
+  shuffle.scan();
+
+  ::tbb::parallel_for(::tbb::blocked_range<size_type>(0, num_chunks, 1),
+                      shuffle_detail::body<shuffle_type, &shuffle_type::scatter>{shuffle},
+                      ::tbb::simple_partitioner());
+
+  ::tbb::parallel_for(::tbb::blocked_range<size_type>(0, num_buckets),
+                      shuffle_detail::body<shuffle_type, &shuffle_type::shuffle_bucket>{shuffle});
+} // end shuffle_copy()
+
+template <typename DerivedPolicy, typename RandomIterator, typename URBG>
+void shuffle(execution_policy<DerivedPolicy>& exec, RandomIterator first, RandomIterator last, URBG&& g)
+{
+  // shuffle_copy buffers the input before writing the result, so it can work in place
+  thrust::system::tbb::detail::shuffle_copy(exec, first, last, first, g);
+} // end shuffle()
+} // namespace system::tbb::detail
+THRUST_NAMESPACE_END